@@ -7,7 +7,7 @@
 %  spatial_sigma: sigma of the Gaussian spatial weight
 %  tonal_sigma:   sigma of the Gaussian tonal weight
 %  truncation:    at how many sigma to truncate the Gaussians
-%  method:        one of 'full', 'xysep', 'uvsep', 'arc', 'pwlinear'
+%  method:        one of 'full', 'xysep', 'uvsep', 'arc', 'pwlinear', 'lattice'
 %  boundary_condition: Defines how the boundary of the image is handled.
 %                      See HELP BOUNDARY_CONDITION
 %
@@ -28,6 +28,11 @@
 %  'pwlinear' uses a piece-wise linear approximation to the bilateral
 %  filter, is fast for larger spatial sigmas (Durand and Dorsey).
 %
+%  'lattice' uses a permutohedral lattice in the joint space-value domain,
+%  its cost does not depend on the spatial sigma. TRUNCATION and
+%  BOUNDARY_CONDITION are ignored. Color images are filtered jointly
+%  (Adams et al.).
+%
 %  'uvsep' and 'arc' haven't been implemented yet.
 %
 % LITERATURE:
@@ -37,6 +42,8 @@
 %    Conference on Multimedia and Expo, 2005.
 %  F. Durand and J. Dorsey, "Fast bilateral filtering for the display of high-dynamic-range images,"
 %    ACM Transactions on Graphics 21(3), 2002.
+%  A. Adams, J. Baek and M.A. Davis, "Fast high-dimensional filtering using the permutohedral lattice,"
+%    Computer Graphics Forum 29(2):753-762, 2010.
 %
 % SEE ALSO:
 %  arcf, pmd
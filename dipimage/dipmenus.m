@@ -1210,7 +1210,7 @@ functionlist('bilateralf') = struct(...
    'display','Bilateral filter',...
    'inparams',struct('description',{'Input image','Spatial sigma','Tonal sigma','Truncation','Method','Boundary condition'},...
                      'type',       {'image',      'array',        'array',      'array',     'option', 'option'},...
-                     'constraint', {[],           [],             [],           [],          {'full','pwlinear','xysep','uvsep','arc'},boundary_condition},...
+                     'constraint', {[],           [],             [],           [],          {'full','pwlinear','xysep','lattice','uvsep','arc'},boundary_condition},...
                      'default',    {'a',          2.0,            30.0,         2,           'xysep',  ''}),...
    'outparams',{{'Output image'}});
 functionlist('kuwahara') = struct(...
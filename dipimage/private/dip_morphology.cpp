@@ -83,7 +83,7 @@ void hitmiss( mxArray* plhs[], int nrhs, const mxArray* prhs[] ) {
    plhs[ 0 ] = dml::GetArray( out );
 }
 
-using ScalarParamFilterFunction = void ( * )( dip::Image const&, dip::Image&, dip:: dfloat, dip::uint );
+using ScalarParamFilterFunction = void ( * )( dip::Image const&, dip::Image&, dip:: dfloat, dip::uint, dip::String const& );
 void ScalarParamFilter( ScalarParamFilterFunction function, mxArray* plhs[], int nrhs, const mxArray* prhs[] ) {
    DML_MIN_ARGS( 2 );
    DML_MAX_ARGS( 3 );
@@ -92,7 +92,7 @@ void ScalarParamFilter( ScalarParamFilterFunction function, mxArray* plhs[], int
    dip::uint connectivity = nrhs > 2 ? dml::GetUnsigned( prhs[ 2 ] ) : 1;
    dml::MatlabInterface mi;
    dip::Image out = mi.NewImage();
-   function( in, out, h, connectivity );
+   function( in, out, h, connectivity, dip::S::HYBRID );
    plhs[ 0 ] = dml::GetArray( out );
 }
 
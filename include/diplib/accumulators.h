@@ -26,6 +26,7 @@
 
 #include "diplib/library/export.h"
 #include "diplib/library/error.h"
+#include "diplib/library/numeric.h"
 #include "diplib/library/types.h"
 
 
@@ -491,6 +492,9 @@ class DIP_NO_EXPORT CovarianceAccumulator {
 /// \brief `DirectionalStatisticsAccumulator` computes directional mean and standard deviation by accumulating
 /// a unit vector with the input value as angle.
 ///
+/// Angles are accumulated relative to the first sample, such that a sequence of identical values yields
+/// a standard deviation of exactly 0, no matter how the samples are split over different accumulators.
+///
 /// Samples are added one by one, using the `Push` method. Other members are used to retrieve estimates of
 /// the sample statistics based on the samples seen up to that point.
 ///
@@ -503,19 +507,32 @@ class DIP_NO_EXPORT DirectionalStatisticsAccumulator {
       /// Reset the accumulator, leaving it as if newly allocated.
       void Reset() {
          n_ = 0;
+         offset_ = 0.0;
          sum_ = { 0.0, 0.0 };
       }
 
       /// Add a sample to the accumulator
       void Push( dfloat x ) {
+         if( n_ == 0 ) {
+            offset_ = x;
+         }
          ++n_;
+         x -= offset_;
          sum_ += dcomplex{ std::cos( x ), std::sin( x ) };
       }
 
       /// Combine two accumulators
       DirectionalStatisticsAccumulator& operator+=( DirectionalStatisticsAccumulator const& b ) {
+         if( b.n_ == 0 ) {
+            return *this;
+         }
+         if( n_ == 0 ) {
+            *this = b;
+            return *this;
+         }
          n_ += b.n_;
-         sum_ += b.sum_;
+         dfloat rotation = b.offset_ - offset_;
+         sum_ += ( rotation == 0.0 ) ? b.sum_ : b.sum_ * dcomplex{ std::cos( rotation ), std::sin( rotation ) };
          return *this;
       }
 
@@ -525,7 +542,7 @@ class DIP_NO_EXPORT DirectionalStatisticsAccumulator {
       }
       /// Unbiased estimator of population mean
       dfloat Mean() const {
-         return std::arg( sum_ );
+         return std::remainder( std::arg( sum_ ) + offset_, 2.0 * pi );
       }
       /// Unbiased estimator of population variance
       dfloat Variance() const {
@@ -542,7 +559,8 @@ class DIP_NO_EXPORT DirectionalStatisticsAccumulator {
 
    private:
       dip::uint n_ = 0; // number of values x collected
-      dcomplex sum_ = { 0.0, 0.0 }; // sum of values exp(i x)
+      dfloat offset_ = 0.0; // the first value collected
+      dcomplex sum_ = { 0.0, 0.0 }; // sum of values exp(i (x - offset_))
 };
 
 /// \brief Combine two accumulators
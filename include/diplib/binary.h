@@ -48,9 +48,9 @@ namespace dip {
 /// For dilations with arbitrary structuring elements, see \ref dip::Dilation, for dilations with an isotropic (disk)
 /// structuring element, see \ref dip::IsotropicDilation.
 ///
-/// !!! attention
-///     This algorithm exists for historical reasons. \ref dip::Dilation with a diamond, square or octagonal
-///     structuring element is always faster.
+/// The image is processed in a bit-packed representation, 64 pixels at the time, using multiple threads
+/// for large images. This is typically faster than \ref dip::Dilation with a diamond, square or octagonal
+/// structuring element, unless `iterations` is large.
 DIP_EXPORT void BinaryDilation(
       Image const& in,
       Image& out,
@@ -81,9 +81,9 @@ DIP_NODISCARD inline Image BinaryDilation(
 /// For erosions with arbitrary structuring elements, see \ref dip::Erosion, for erosions with an isotropic (disk)
 /// structuring element, see \ref dip::IsotropicDilation.
 ///
-/// !!! attention
-///     This algorithm exists for historical reasons. \ref dip::Erosion with a diamond, square or octagonal
-///     structuring element is always faster.
+/// The image is processed in a bit-packed representation, 64 pixels at the time, using multiple threads
+/// for large images. This is typically faster than \ref dip::Erosion with a diamond, square or octagonal
+/// structuring element, unless `iterations` is large.
 DIP_EXPORT void BinaryErosion(
       Image const& in,
       Image& out,
@@ -116,9 +116,9 @@ DIP_NODISCARD inline Image BinaryErosion(
 ///
 /// For closings with arbitrary structuring elements, see \ref dip::Closing.
 ///
-/// !!! attention
-///     This algorithm exists for historical reasons. \ref dip::Closing with a diamond, square or octagonal
-///     structuring element is always faster.
+/// The image is processed in a bit-packed representation, 64 pixels at the time, using multiple threads
+/// for large images. This is typically faster than \ref dip::Closing with a diamond, square or octagonal
+/// structuring element, unless `iterations` is large.
 DIP_EXPORT void BinaryClosing(
       Image const& in,
       Image& out,
@@ -151,9 +151,9 @@ DIP_NODISCARD inline Image BinaryClosing(
 ///
 /// For openings with arbitrary structuring elements, see \ref dip::Opening.
 ///
-/// !!! attention
-///     This algorithm exists for historical reasons. \ref dip::Opening with a diamond, square or octagonal
-///     structuring element is always faster.
+/// The image is processed in a bit-packed representation, 64 pixels at the time, using multiple threads
+/// for large images. This is typically faster than \ref dip::Opening with a diamond, square or octagonal
+/// structuring element, unless `iterations` is large.
 DIP_EXPORT void BinaryOpening(
       Image const& in,
       Image& out,
@@ -512,6 +512,9 @@ DIP_NODISCARD inline Image BinaryAreaClosing(
 /// The `edgeCondition` parameter specifies whether the border of the image should be treated as object (`"object"`)
 /// or as background (`"background"`).
 ///
+/// For large 3D images, the pixels at each distance are tested using multiple threads. Pixels are removed in the
+/// same order as in the single-threaded algorithm, so the result does not depend on the number of threads.
+///
 /// !!! warning
 ///     Pixels in a 2-pixel border around the edge are not processed. If this is an issue, consider adding 2 pixels
 ///     on each side of your image.
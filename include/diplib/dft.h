@@ -377,6 +377,64 @@ DIP_EXPORT extern bool const usingFFTW;
 /// be computed is complex-to-complex or not.
 DIP_EXPORT dip::uint MaxFactor( bool complex = true );
 
+/// \brief Statistics of the DFT plan cache, see \ref dip::GetDFTPlanCacheStatistics.
+struct DFTPlanCacheStatistics {
+   dip::uint hits = 0;     ///< The number of times a plan was found in the cache.
+   dip::uint misses = 0;   ///< The number of times a plan had to be created.
+   dip::uint size = 0;     ///< The number of plans currently in the cache.
+};
+
+/// \brief Sets the maximum number of plans kept in the DFT plan cache.
+///
+/// When using PocketFFT, \ref DFT and \ref RDFT objects obtain their plan from a cache, so that creating multiple
+/// objects for the same transform size is cheap. There is a separate cache for complex and real transforms, in
+/// single and double precision; `size` applies to each of them. Once a cache contains more than `size` plans,
+/// the least recently used plans not currently in use are deleted. Plans in use are never deleted, so the
+/// cache can temporarily grow beyond `size`. If `size` is 0, plans are deleted as soon as they are no longer
+/// used. The default size is 30.
+///
+/// Obtaining a plan that is already in the cache does not block other threads doing the same.
+///
+/// When using FFTW, plans are not cached. FFTW reuses the knowledge gained when creating a plan (the "wisdom")
+/// when creating another plan for the same transform. See \ref dip::SaveDFTWisdom to preserve this knowledge
+/// across program runs.
+DIP_EXPORT void SetDFTPlanCacheSize( dip::uint size );
+
+/// \brief Returns the maximum number of plans kept in the DFT plan cache, see \ref dip::SetDFTPlanCacheSize.
+DIP_EXPORT dip::uint GetDFTPlanCacheSize();
+
+/// \brief Returns the number of cache hits and misses since the start of the program or the last call to
+/// \ref dip::ResetDFTPlanCacheStatistics, and the current number of plans in the cache.
+///
+/// When using FFTW, no plans are cached, and the number of misses is the number of plans created.
+DIP_EXPORT DFTPlanCacheStatistics GetDFTPlanCacheStatistics();
+
+/// \brief Resets the hit and miss counts of the DFT plan cache to zero, see \ref dip::GetDFTPlanCacheStatistics.
+DIP_EXPORT void ResetDFTPlanCacheStatistics();
+
+/// \brief Writes the FFTW wisdom accumulated so far to the file `filename`.
+///
+/// When FFTW creates a plan, it measures the speed of different ways of computing the transform. The results of
+/// these measurements are called "wisdom". Loading a saved wisdom file with \ref dip::LoadDFTWisdom when the
+/// program starts avoids repeating these measurements, and can significantly reduce the time spent creating plans
+/// in programs that compute transforms of many different sizes.
+///
+/// Returns `true` on success. When not using FFTW (see \ref dip::usingFFTW), this function does nothing and
+/// returns `false`; PocketFFT does not do any measurements when creating plans.
+///
+/// !!! attention
+///     This function must not be called while other threads create \ref DFT or \ref RDFT objects.
+DIP_EXPORT bool SaveDFTWisdom( String const& filename );
+
+/// \brief Reads FFTW wisdom from the file `filename`, written by \ref dip::SaveDFTWisdom.
+///
+/// Returns `true` on success, or `false` if the file cannot be read or does not contain valid wisdom. When not
+/// using FFTW (see \ref dip::usingFFTW), this function does nothing and returns `false`.
+///
+/// !!! attention
+///     This function must not be called while other threads create \ref DFT or \ref RDFT objects.
+DIP_EXPORT bool LoadDFTWisdom( String const& filename );
+
 /// \endgroup
 
 } // namespace dip
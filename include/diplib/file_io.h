@@ -183,6 +183,19 @@ class FixedOutputBuffer: public OutputBuffer {
 /// interface set it might also be impossible to dictate what the strides will look like. In these cases,
 /// the flag is ignored.
 ///
+/// If `mode` is `"mmap"`, the file is mapped into memory instead of read, and `out` is an image that refers to
+/// this mapped memory (or to the ROI within it). Opening a file this way takes the same time no matter how large
+/// it is, the pixel data is read from disk when it is accessed. The mapped memory is read-only, writing to the
+/// pixels of `out` will crash the program. If `mode` is `"mmap copy-on-write"`, the pixels of `out` can be modified;
+/// modified pages of memory are copied, the changes are not written to the file. In both cases, the file is read
+/// as usual if it cannot be mapped: if the pixel data is compressed, not stored in the machine's byte order, or
+/// not aligned in the file (this can happen for ICS v2 files, which store the header and the pixel data in the
+/// same file), if `out` is protected or has an external interface, or if the operating system refuses to map
+/// the file.
+///
+/// If the file was written by \ref dip::ImageWriteICS with the `"chunked"` option, the compressed pixel data is
+/// decompressed in parallel, and only the chunks that contain pixels in the region of interest are decompressed.
+///
 /// Information about the file and all metadata are returned in the \ref dip::FileInformation output argument.
 // TODO: read sensor information also into the history strings
 DIP_EXPORT FileInformation ImageReadICS(
@@ -271,17 +284,26 @@ DIP_EXPORT bool ImageIsICS( String const& filename );
 ///   The ICS file contains only the header, the IDS file contains only the pixel data. ICS v2 combines
 ///   these two pieces into a single '.ics' file. `"v2"` is the default.
 /// - '"uncompressed"` or '"gzip"`: Determine whether to compress the pixel data or not. `"gzip"` is the default.
+/// - `"chunked"`: When compressing, the pixel data is split into chunks of 1 MiB that are compressed independently,
+///   using multiple threads. The result is still a single valid gzip stream, which any ICS reader can read.
+///   An index to the chunks is written to the header as history lines with the key "gzip_index", it allows
+///   \ref dip::ImageReadICS to decompress the chunks in parallel, and to decompress only the chunks needed
+///   when reading a region of interest. The compressed data is kept in memory until it is written to file.
 /// - `"fast"`: Writes data in the order in which they are in memory, which is faster.
 ///
 /// Note that the `"fast"` option yields a file with permuted dimensions. The software reading the file must be
 /// aware of the possibility of permuted dimensions, and check the "order" tag in the file. If the image has
 /// non-contiguous data, then the `"fast"` option is ignored, the image is always saved in the "normal" dimension order
+///
+/// `compressionLevel` is the gzip compression level, from 1 (fastest) to 9 (smallest file). It is ignored if
+/// the data is not compressed.
 DIP_EXPORT void ImageWriteICS(
       Image const& image,
       String const& filename,
       StringArray const& history = {},
       dip::uint significantBits = 0,
-      StringSet const& options = {}
+      StringSet const& options = {},
+      dip::uint compressionLevel = 9
 );
 
 
@@ -297,17 +319,15 @@ DIP_EXPORT void ImageWriteICS(
 /// image. Some Zeiss confocal microscopes write TIFF files (with an ".lsm" extension) in which image
 /// planes and thumbnails alternate. A range such as {0,-1,2} reads all image planes skipping the
 /// thumbnails.
-/// It is currently not possible to read multiple pages from a binary or color-mapped image.
 ///
 /// `roi` can be set to read in a subset of the pixels in the 2D image. If only one array element is given,
 /// it is used for both dimensions. An empty array indicates that all pixels should be read. Tensor dimensions
 /// are not included in the `roi` parameter, but are set through the `channels` parameter.
-/// It is currently not possible to read an ROI from a binary or a color-mapped image.
+/// Only the strips or tiles of the file that intersect the ROI are read. For large images, these are
+/// decoded in parallel.
 ///
 /// Color-mapped (palette) images are read as sRGB images by applying the color map. Set `useColorMap`
 /// to `"ignore"` to return the color map indices as pixel values, ignoring the color map.
-/// With this option set, it becomes possible to read an ROI of a color-mapped image, or to read a
-/// multi-paged color-mapped image.
 ///
 /// The pixels per inch value in the TIFF file will be used to set the pixel size of `out`. In the case of
 /// multiple 2D slices read as a 3D image, there is no information about the pixel size along the 3rd dimension
@@ -410,6 +430,50 @@ DIP_NODISCARD inline Image ImageReadTIFFSeries(
 /// pixel data. See \ref dip::ImageReadTIFF for more details on the handling of `filename` and `imageNumber`.
 DIP_NODISCARD DIP_EXPORT FileInformation ImageReadTIFFInfo( String const& filename, dip::uint imageNumber = 0 );
 
+/// \brief Reads one level of a multi-resolution (pyramidal) TIFF file.
+///
+/// A pyramidal TIFF file stores, besides the full-resolution image, a series of reduced-resolution versions
+/// of the same image. These reduced-resolution images (levels) are either stored as SubIFDs of the
+/// full-resolution image (as written by \ref dip::ImageWriteTIFFPyramid with `layout` set to `"subifd"`),
+/// or as the pages that follow the full-resolution image in the file, tagged as reduced-resolution images
+/// (`layout` set to `"pages"`). Both layouts are recognized.
+///
+/// `imageNumber` selects the page with the full-resolution image, and `level` the level to read, with 0
+/// the full-resolution image itself. Use \ref dip::ImageReadTIFFPyramidInfo to find the number of levels
+/// and their sizes.
+///
+/// `roi` and `channels` are as in \ref dip::ImageReadTIFF, the `roi` is given in the pixel coordinates of
+/// the selected level. Only the tiles that intersect the ROI are read, which makes it possible to efficiently
+/// read any part of a very large image at a chosen resolution.
+///
+/// Color-mapped images are always read as sRGB images.
+DIP_EXPORT FileInformation ImageReadTIFFPyramidLevel(
+      Image& out,
+      String const& filename,
+      dip::uint level,
+      RangeArray const& roi = {},
+      Range const& channels = {},
+      dip::uint imageNumber = 0
+);
+DIP_NODISCARD inline Image ImageReadTIFFPyramidLevel(
+      String const& filename,
+      dip::uint level,
+      RangeArray const& roi = {},
+      Range const& channels = {},
+      dip::uint imageNumber = 0
+) {
+   Image out;
+   ImageReadTIFFPyramidLevel( out, filename, level, roi, channels, imageNumber );
+   return out;
+}
+
+/// \brief Reads image information and metadata for each of the levels of a multi-resolution (pyramidal)
+/// TIFF file. See \ref dip::ImageReadTIFFPyramidLevel for more details.
+///
+/// The output array has one element per level, the first element describes the full-resolution image.
+/// For a file without reduced-resolution images, the output has a single element.
+DIP_NODISCARD DIP_EXPORT std::vector< FileInformation > ImageReadTIFFPyramidInfo( String const& filename, dip::uint imageNumber = 0 );
+
 /// \brief Returns true if the file `filename` is a TIFF file.
 DIP_EXPORT bool ImageIsTIFF( String const& filename );
 
@@ -455,6 +519,35 @@ DIP_EXPORT void ImageWriteTIFF(
       dip::uint jpegLevel = 80
 );
 
+/// \brief Writes a 2D `image` as a multi-resolution (pyramidal) TIFF file.
+///
+/// The file contains the full-resolution image followed by `nLevels - 1` reduced-resolution versions of it,
+/// each one half the size of the previous one along both dimensions. Each reduced level is computed by
+/// averaging blocks of 2x2 pixels of the previous level (binary images are subsampled instead), using
+/// \ref dip::Resampling, which is multithreaded. If `nLevels` is 0, levels are added until the smallest one
+/// fits in a single tile. Fewer levels are written if the image becomes too small to halve.
+///
+/// All levels are written as tiled images with tiles of `tileSize` by `tileSize` pixels, `tileSize` must be
+/// a multiple of 16. Tiled images allow \ref dip::ImageReadTIFFPyramidLevel to efficiently read a small
+/// region of a very large image.
+///
+/// `layout` determines where the reduced-resolution images are stored:
+///
+/// - `"subifd"`: as SubIFDs of the full-resolution image. Other programs see a single-page TIFF file. This is
+///   the layout used by many whole-slide imaging and geospatial applications.
+/// - `"pages"`: as the pages following the full-resolution image, tagged as reduced-resolution images.
+///
+/// See \ref dip::ImageWriteTIFF for the meaning of the other parameters and for limitations.
+DIP_EXPORT void ImageWriteTIFFPyramid(
+      Image const& image,
+      String const& filename,
+      dip::uint nLevels = 0,
+      String const& layout = "subifd",
+      String const& compression = "",
+      dip::uint jpegLevel = 80,
+      dip::uint tileSize = 256
+);
+
 
 /// \brief Reads an image from the JPEG file `filename` and puts it in `out`.
 ///
@@ -653,10 +746,18 @@ DIP_NODISCARD inline std::vector< dip::uint8 > ImageWritePNG(
 /// the NumPy array's first index is the y axis as the second index is the x axis (this is how 2D arrays are
 /// treated everywhere in Python). We generalize this to arbitrary dimensions by reversing the indices.
 /// A standard C-order NumPy array this way translates to a DIPlib image with \ref normal_strides.
-DIP_EXPORT FileInformation ImageReadNPY( Image& out, String const& filename );
-DIP_NODISCARD inline Image ImageReadNPY( String const& filename ) {
+///
+/// If `mode` is `"mmap"`, the file is mapped into memory instead of read, and `out` is an image that refers to
+/// this mapped memory. Opening a file this way takes the same time no matter how large it is, the pixel data
+/// is read from disk when it is accessed. The mapped memory is read-only, writing to the pixels of `out` will
+/// crash the program. If `mode` is `"mmap copy-on-write"`, the pixels of `out` can be modified; modified pages
+/// of memory are copied, the changes are not written to the file. In both cases, the file is read as usual if it
+/// cannot be mapped: if it is not stored in the machine's byte order, if `out` is protected or has an external
+/// interface, or if the operating system refuses to map the file.
+DIP_EXPORT FileInformation ImageReadNPY( Image& out, String const& filename, String const& mode = "" );
+DIP_NODISCARD inline Image ImageReadNPY( String const& filename, String const& mode = "" ) {
    Image out;
-   ImageReadNPY( out, filename );
+   ImageReadNPY( out, filename, mode );
    return out;
 }
 
@@ -20,6 +20,7 @@
 
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include "diplib.h"
 #include "diplib/boundary.h"
@@ -327,6 +328,8 @@ DIP_EXPORT Image::Pixel ResampleAtUnchecked(
 ///
 /// `out` will have the same size as `map`, and the same data type and tensor shape as `in`. If `out` is protected,
 /// its data type will not change, but the computations will still be performed in the data type of `in`.
+///
+/// To apply the same coordinate map to many images, use \ref dip::PreparedWarp.
 DIP_EXPORT void ResampleAt(
       Image const& in,
       Image const& map,
@@ -345,6 +348,93 @@ DIP_NODISCARD inline Image ResampleAt(
   return out;
 }
 
+/// \brief A coordinate map prepared for repeatedly resampling images of the same size.
+///
+/// \ref dip::ResampleAt, when given a coordinate map, computes for each output pixel the integer and fractional
+/// parts of its input coordinates, and tests whether these are inside the image domain. When the same map is applied
+/// to many images, for example to correct the lens distortion in each frame of a video stream, this work can be done
+/// once. A `PreparedWarp` object stores, for each output pixel, the offset to the input pixel to read from, and
+/// the fractional coordinates quantized to 15 bits (a precision of 1/32768 of a pixel). This takes 4 bytes per
+/// pixel for nearest neighbor interpolation, and `4 + 2 * n` bytes per pixel for linear and cubic interpolation
+/// in $n$ dimensions.
+///
+/// ```cpp
+/// dip::PreparedWarp warp( map, frame.Sizes(), "linear" );
+/// while( /* more frames */ ) {
+///    // ... read `frame` ...
+///    warp.Apply( frame, corrected );
+/// }
+/// ```
+///
+/// `map` and `interpolationMethod` are as in \ref dip::ResampleAt, and `inSizes` are the sizes of the images
+/// that the warp will be applied to. The number of tensor elements of `map` must match the length of `inSizes`.
+/// The result of \ref Apply is identical to that of \ref dip::ResampleAt, except for the rounding of the
+/// fractional coordinates. Computations are done in single-precision floating-point arithmetic for all but
+/// double-precision and 64-bit integer images.
+///
+/// For cubic interpolation, the input image is copied to a buffer with a one-pixel border each time the warp
+/// is applied. For the other interpolation methods, the input image is copied only if its strides are not
+/// compatible with the normal strides (see \ref normal_strides). The total number of input pixels must be smaller
+/// than $2^{32}$.
+class DIP_NO_EXPORT PreparedWarp {
+   public:
+      /// \brief A default-constructed `PreparedWarp` cannot be applied.
+      PreparedWarp() = default;
+
+      /// \brief Prepares the coordinate map `map` for resampling images of size `inSizes`.
+      DIP_EXPORT PreparedWarp(
+            Image const& map,
+            UnsignedArray inSizes,
+            String const& interpolationMethod = S::LINEAR
+      );
+
+      /// \brief Returns true if the warp has been prepared, and can be applied.
+      bool IsPrepared() const {
+         return !offsets_.empty();
+      }
+
+      /// \brief Returns the sizes of the images that the warp can be applied to.
+      UnsignedArray const& InputSizes() const {
+         return inSizes_;
+      }
+
+      /// \brief Returns the sizes of the output images, the same as the sizes of the coordinate map.
+      UnsignedArray const& OutputSizes() const {
+         return outSizes_;
+      }
+
+      /// \brief Resamples `in` at the coordinates in the prepared map.
+      ///
+      /// `in` must have the sizes given when the warp was prepared, and can have any data type and any number
+      /// of tensor elements. If `in` is binary, nearest neighbor interpolation is used.
+      /// For any coordinates outside of the image domain, the pixel value `fill` will be returned.
+      ///
+      /// `out` will have the same size as the coordinate map, and the same data type and tensor shape as `in`.
+      /// If `out` is protected, its data type will not change, but the computations will still be performed
+      /// in the data type of `in`.
+      DIP_EXPORT void Apply( Image const& in, Image& out, Image::Pixel const& fill = { 0 } ) const;
+      DIP_NODISCARD Image Apply( Image const& in, Image::Pixel const& fill = { 0 } ) const {
+         Image out;
+         Apply( in, out, fill );
+         return out;
+      }
+
+   private:
+      enum class Method : uint8 {
+            NEAREST_NEIGHBOR,
+            LINEAR,
+            CUBIC_ORDER_3,
+      };
+      UnsignedArray inSizes_;
+      UnsignedArray outSizes_;
+      Method method_ = Method::LINEAR;
+      std::vector< uint32 > offsets_;     // For each output pixel, offset in pixels to the base input pixel, computed
+                                          //    with normal strides for an input image with a 1-pixel border if
+                                          //    `method_` is CUBIC_ORDER_3, or the maximum value if outside the image
+      std::vector< uint16 > fractions_;   // For each output pixel, `n` fractional coordinates multiplied by
+                                          //    2^15, empty if `method_` is NEAREST_NEIGHBOR
+};
+
 // Undocumented internal function called by the other forms of Skew.
 // Each sub-volume perpendicular to axis is shifted with sub-pixel precision, according to `shearArray`.
 // That is, if `axis` is 1, then the sub-volume `in[:,ii,:,:,...]`, with all possible `ii`, is shifted
@@ -771,6 +861,10 @@ DIP_NODISCARD inline Image AffineTransform(
 /// `interpolationMethod` has a restricted set of options: `"linear"`, `"3-cubic"`, or `"nearest"`.
 /// See \ref interpolation_methods for their definition. If `in` is binary, `interpolationMethod` will be
 /// ignored, nearest neighbor interpolation will be used.
+///
+/// The thin plate spline is evaluated at each output pixel, at a cost proportional to the number of control
+/// points. For many control points, or to warp many images with the same control points, use
+/// \ref dip::WarpControlPointsMap and \ref dip::ResampleAt instead.
 DIP_EXPORT void WarpControlPoints(
       Image const& in,
       Image& out,
@@ -791,6 +885,52 @@ DIP_NODISCARD inline Image WarpControlPoints(
    return out;
 }
 
+/// \brief Computes the coordinate map for warping an image based on a set of control points using thin plate
+/// spline interpolation
+///
+/// `map` is forged as a double-precision floating-point image of sizes `sizes`, with one tensor element per
+/// dimension. For each pixel it contains the coordinates in the input image that \ref dip::WarpControlPoints would
+/// sample. `inCoordinates`, `outCoordinates` and `lambda` are as in \ref dip::WarpControlPoints. The map can be
+/// passed to \ref dip::ResampleAt to warp any number of images of sizes `sizes` with the same control points:
+///
+/// ```cpp
+/// dip::Image map = dip::WarpControlPointsMap( img.Sizes(), inCoordinates, outCoordinates, 0.0, 0.01 );
+/// for( auto& frame : frames ) {
+///    frame = dip::ResampleAt( frame, map );
+/// }
+/// ```
+///
+/// If `maximumError` is 0, the thin plate spline is evaluated at each pixel, at a cost proportional to the
+/// number of control points. Otherwise, the image is divided into boxes, and the map within each box is
+/// computed by multilinear interpolation between the values at its corners. A box is interpolated only if
+/// the interpolation error is guaranteed to be at most `maximumError` pixels, see
+/// \ref dip::ThinPlateSpline::InterpolationErrorBound. Other boxes are subdivided, the number of pieces is
+/// chosen by comparing the thin plate spline to the interpolated values at the center of the box and at the
+/// centers of its faces. Boxes that are too small for these tests to be cheaper than evaluating the thin plate
+/// spline at each pixel are computed exactly, such that the cost is never significantly larger than with
+/// `maximumError` set to 0. Because the thin plate spline is smooth away from the control points, most of the
+/// map is computed by interpolation if `maximumError` is not too small, making its cost nearly independent of
+/// the number of pixels.
+DIP_EXPORT void WarpControlPointsMap(
+      UnsignedArray const& sizes,
+      Image& map,
+      FloatCoordinateArray const& inCoordinates,
+      FloatCoordinateArray const& outCoordinates,
+      dfloat lambda = 0,
+      dfloat maximumError = 0
+);
+DIP_NODISCARD inline Image WarpControlPointsMap(
+      UnsignedArray const& sizes,
+      FloatCoordinateArray const& inCoordinates,
+      FloatCoordinateArray const& outCoordinates,
+      dfloat lambda = 0,
+      dfloat maximumError = 0
+) {
+   Image map;
+   WarpControlPointsMap( sizes, map, inCoordinates, outCoordinates, lambda, maximumError );
+   return map;
+}
+
 /// \brief Computes the log-polar transform of the 2D image.
 ///
 /// By default, `out` will be a square image with side equal to the smaller of the two sides of `in`. However,
@@ -19,6 +19,7 @@
 #define DIP_HISTOGRAM_H
 
 #include <cmath>
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -26,6 +27,7 @@
 #include "diplib/iterators.h"
 #include "diplib/lookup_table.h"
 #include "diplib/measurement.h"
+#include "diplib/private/robin_map.h"
 
 
 /// \file
@@ -45,6 +47,21 @@ inline dip::sint FindBin( dfloat value, dfloat lowerBound, dfloat binSize, dip::
    return static_cast< dip::sint >( clamp(( value - lowerBound ) / binSize, 0.0, static_cast< dfloat >( nBins - 1 )));
    // the cast does implicit floor because it's always non-negative
 }
+
+// Hash function for the linear bin indices of a sparse histogram. These indices are multiples of large strides,
+// the identity hash (`std::hash`) would map them to few buckets of the hash table.
+struct SparseHistogramHash {
+   std::size_t operator()( dip::uint index ) const {
+      uint64 hash = static_cast< uint64 >( index );
+      hash ^= hash >> 33u;
+      hash *= 0xff51afd7ed558ccdull;
+      hash ^= hash >> 33u;
+      return static_cast< std::size_t >( hash );
+   }
+};
+
+// Index used to compute the values of a sparse cumulative histogram, defined in `src/histogram/histogram.cpp`.
+class SparseCumulativeIndex;
 }
 
 
@@ -60,11 +77,27 @@ inline dip::sint FindBin( dfloat value, dfloat lowerBound, dfloat binSize, dip::
 ///
 /// To facilitate usage for one-dimensional histograms, all getter functions that return a value
 /// for a given dimension, default to dimension 0, so can be called without arguments.
+///
+/// The bins are normally stored in an image, with one pixel per bin (see \ref GetImage). For
+/// multi-dimensional histograms this image can become too large to allocate, even though most of its bins
+/// are empty. For example, the histogram of a 5-channel image with 256 bins per channel has 2^40^ bins.
+/// The constructors that take a \ref Storage argument can instead create a sparse histogram, which stores
+/// only the non-empty bins in a hash table. Sparse histograms support \ref At, \ref Count, \ref GetMarginal,
+/// \ref Cumulative, \ref Smooth, \ref ReverseLookup, and adding and subtracting other sparse histograms.
+/// Functions that need access to the bins as an image, such as \ref GetImage and most of the functions
+/// that compute statistics from a histogram, throw an exception for a sparse histogram. \ref Dense returns
+/// a dense copy of the histogram.
 class DIP_NO_EXPORT Histogram {
    public:
       /// \brief Type of histogram bins. See \ref dip::DT_COUNT.
       using CountType = uint64;
 
+      /// \brief How the histogram bins are stored.
+      enum class Storage : uint8 {
+            DENSE,      ///< In an image with one pixel per bin.
+            SPARSE,     ///< In a hash table that contains only the non-empty bins.
+      };
+
       /// \brief Configuration information for how the histogram is computed.
       ///
       /// Constructors exist to set different subsets of the configuration; write upper bound and bin size
@@ -267,6 +300,25 @@ class DIP_NO_EXPORT Histogram {
          }
       }
 
+      /// \brief Like the constructor above, but `storage` determines how the bins are stored.
+      ///
+      /// With `storage` set to \ref Storage::SPARSE, only the non-empty bins are stored. This allows computing
+      /// histograms with many dimensions and many bins per dimension, of which most are empty.
+      Histogram( Image const& input, Image const& mask, ConfigurationArray configuration, Storage storage ) {
+         DIP_THROW_IF( !input.IsForged(), E::IMAGE_NOT_FORGED );
+         DIP_THROW_IF( !input.DataType().IsReal(), E::DATA_TYPE_NOT_SUPPORTED );
+         DIP_START_STACK_TRACE
+            ArrayUseParameter( configuration, input.TensorElements(), Configuration( input.DataType() ) );
+            if( storage == Storage::SPARSE ) {
+               SparseImageHistogram( input, mask, configuration );
+            } else if( input.IsScalar() ) {
+               ScalarImageHistogram( input, mask, configuration[ 0 ] );
+            } else {
+               TensorImageHistogram( input, mask, configuration );
+            }
+         DIP_END_STACK_TRACE
+      }
+
       /// \brief This version of the constructor is identical to the previous one, but with a single configuration
       /// parameter instead of an array.
       Histogram( Image const& input, Image const& mask, Configuration configuration ) {
@@ -327,6 +379,20 @@ class DIP_NO_EXPORT Histogram {
          DIP_END_STACK_TRACE
       }
 
+      /// \brief Like the constructor above, but `storage` determines how the bins are stored.
+      ///
+      /// With `storage` set to \ref Storage::SPARSE, only the non-empty bins are stored. This allows computing
+      /// the joint histogram of many feature values, with many bins per dimension.
+      Histogram( Measurement::IteratorFeature const& featureValues, ConfigurationArray configuration, Storage storage ) {
+         Configuration defaultConf( 0.0, 100.0, 100 ); // nBins==100
+         defaultConf.lowerIsPercentile = true;
+         defaultConf.upperIsPercentile = true;
+         DIP_START_STACK_TRACE
+            ArrayUseParameter( configuration, featureValues.NumberOfValues(), defaultConf );
+            MeasurementFeatureHistogram( featureValues, configuration, storage == Storage::SPARSE );
+         DIP_END_STACK_TRACE
+      }
+
       /// \brief An empty histogram with the given configuration. Histogram bins are initialized to 0.
       ///
       /// The array must not be empty. The histogram will have `configuration->size()` dimensions.
@@ -371,15 +437,35 @@ class DIP_NO_EXPORT Histogram {
       void swap( Histogram& other ) noexcept {
          using std::swap;
          swap( data_, other.data_ );
+         swap( sparseData_, other.sparseData_ );
+         swap( cumulativeIndex_, other.cumulativeIndex_ );
          swap( lowerBounds_, other.lowerBounds_ );
          swap( binSizes_, other.binSizes_ );
       }
 
       /// \brief Returns false for a default-initialized histogram.
       bool IsInitialized() const {
-         return data_.IsForged();
+         return data_.IsForged() || IsSparse();
+      }
+
+      /// \brief Returns true if only the non-empty bins are stored. See \ref Storage.
+      bool IsSparse() const {
+         return static_cast< bool >( sparseData_ );
+      }
+
+      /// \brief Returns the number of bins stored: the number of non-empty bins for a sparse histogram, or
+      /// the total number of bins for a dense one.
+      dip::uint StoredBins() const {
+         DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+         return IsSparse() ? sparseData_->size() : data_.NumberOfPixels();
       }
 
+      /// \brief Returns a dense version of the histogram.
+      ///
+      /// If the histogram is already dense, returns `*this`, sharing the data segment. Otherwise, allocates an
+      /// image with one pixel per bin, which might be very large.
+      DIP_EXPORT Histogram Dense() const;
+
       /// \brief Deep copy, returns a copy of `this` with its own data segment.
       ///
       /// When making a copy of a histogram, the data segment is shared:
@@ -398,7 +484,11 @@ class DIP_NO_EXPORT Histogram {
       Histogram Copy() const {
          DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
          Histogram out( *this );
-         out.data_ = data_.Copy();
+         if( IsSparse() ) {
+            out.sparseData_ = std::make_shared< SparseData >( *sparseData_ );
+         } else {
+            out.data_ = data_.Copy();
+         }
          return out;
       }
 
@@ -419,6 +509,9 @@ class DIP_NO_EXPORT Histogram {
       /// This function is particularly interesting when applied to a histogram resulting from clustering
       /// algorithms such as \ref dip::KMeansClustering( dip::Histogram const&, dip::uint ) or
       /// \ref dip::MinimumVariancePartitioning( dip::Histogram const&, dip::uint ).
+      ///
+      /// For a sparse cumulative histogram, the value of each bin might need to be computed when it is looked up,
+      /// see \ref dip::Histogram::Cumulative.
       DIP_EXPORT void ReverseLookup( Image const& input, Image& out, BooleanArray excludeOutOfBoundValues = { false } );
       DIP_NODISCARD Image ReverseLookup( Image const& input, BooleanArray excludeOutOfBoundValues = { false } ) {
          Image out;
@@ -430,12 +523,19 @@ class DIP_NO_EXPORT Histogram {
       ///
       /// Adding multiple histograms together can be useful, for example, when accumulating pixel values
       /// from multiple images, or in multiple threads.
+      ///
+      /// Either both histograms are dense, or both are sparse.
       Histogram& operator+=( Histogram const& other ) {
          DIP_THROW_IF( !IsInitialized() || !other.IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
          DIP_THROW_IF(( data_.Sizes() != other.data_.Sizes() ||
                       ( lowerBounds_ != other.lowerBounds_ ) ||
-                      ( binSizes_ != other.binSizes_ )), "Histograms don't match" );
-         data_ += other.data_;
+                      ( binSizes_ != other.binSizes_ ) ||
+                      ( IsSparse() != other.IsSparse() )), "Histograms don't match" );
+         if( IsSparse() ) {
+            SparseAdd( other, false );
+         } else {
+            data_ += other.data_;
+         }
          return *this;
       }
 
@@ -444,8 +544,13 @@ class DIP_NO_EXPORT Histogram {
          DIP_THROW_IF( !IsInitialized() || !other.IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
          DIP_THROW_IF(( data_.Sizes() != other.data_.Sizes() ||
                       ( lowerBounds_ != other.lowerBounds_ ) ||
-                      ( binSizes_ != other.binSizes_ )), "Histograms don't match" );
-         data_ -= other.data_;
+                      ( binSizes_ != other.binSizes_ ) ||
+                      ( IsSparse() != other.IsSparse() )), "Histograms don't match" );
+         if( IsSparse() ) {
+            SparseAdd( other, true );
+         } else {
+            data_ -= other.data_;
+         }
          return *this;
       }
 
@@ -557,6 +662,9 @@ class DIP_NO_EXPORT Histogram {
          DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
          DIP_THROW_IF( Dimensionality() != 1, E::ILLEGAL_DIMENSIONALITY );
          DIP_THROW_IF( x >= data_.Size( 0 ), E::INDEX_OUT_OF_RANGE );
+         if( IsSparse() ) {
+            return SparseAt( { x } );
+         }
          return *static_cast< CountType* >( data_.Pointer( static_cast< dip::sint >( x ) * data_.Stride( 0 ) ));
       }
       /// \brief Get the value at the given bin in a 2D histogram
@@ -565,6 +673,9 @@ class DIP_NO_EXPORT Histogram {
          DIP_THROW_IF( Dimensionality() != 2, E::ILLEGAL_DIMENSIONALITY );
          DIP_THROW_IF( x >= data_.Size( 0 ), E::INDEX_OUT_OF_RANGE );
          DIP_THROW_IF( y >= data_.Size( 1 ), E::INDEX_OUT_OF_RANGE );
+         if( IsSparse() ) {
+            return SparseAt( { x, y } );
+         }
          return *static_cast< CountType* >( data_.Pointer( static_cast< dip::sint >( x ) * data_.Stride( 0 ) +
                                                            static_cast< dip::sint >( y ) * data_.Stride( 1 )));
       }
@@ -576,6 +687,9 @@ class DIP_NO_EXPORT Histogram {
          DIP_THROW_IF( x >= data_.Size( 0 ), E::INDEX_OUT_OF_RANGE );
          DIP_THROW_IF( y >= data_.Size( 1 ), E::INDEX_OUT_OF_RANGE );
          DIP_THROW_IF( z >= data_.Size( 2 ), E::INDEX_OUT_OF_RANGE );
+         if( IsSparse() ) {
+            return SparseAt( { x, y, z } );
+         }
          return *static_cast< CountType* >( data_.Pointer( static_cast< dip::sint >( x ) * data_.Stride( 0 ) +
                                                            static_cast< dip::sint >( y ) * data_.Stride( 1 ) +
                                                            static_cast< dip::sint >( z ) * data_.Stride( 2 )));
@@ -584,18 +698,27 @@ class DIP_NO_EXPORT Histogram {
       /// \brief Get the value at the given bin
       CountType At( UnsignedArray const& bin ) const {
          DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+         if( IsSparse() ) {
+            DIP_THROW_IF( bin.size() != data_.Dimensionality(), E::ARRAY_PARAMETER_WRONG_LENGTH );
+            DIP_THROW_IF( !( bin < data_.Sizes() ), E::INDEX_OUT_OF_RANGE );
+            return SparseAt( bin );
+         }
          return *static_cast< CountType* >( data_.Pointer( bin )); // Does all the checking
       }
 
       /// \brief Get the image that holds the bin counts. The image is always scalar and of type \ref dip::DT_COUNT.
+      ///
+      /// The histogram must be dense, see \ref Dense.
       Image const& GetImage() const {
          DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+         DIP_THROW_IF( IsSparse(), "Not supported for a sparse histogram" );
          return data_;
       }
 
-      /// \brief Returns an iterator to the first bin
+      /// \brief Returns an iterator to the first bin. The histogram must be dense, see \ref Dense.
       ConstImageIterator< CountType > begin() const {
          DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+         DIP_THROW_IF( IsSparse(), "Not supported for a sparse histogram" );
          return ConstImageIterator< CountType >( data_ );
       }
 
@@ -604,9 +727,10 @@ class DIP_NO_EXPORT Histogram {
          return {};
       }
 
-      /// \brief Returns a pointer to the first bin
+      /// \brief Returns a pointer to the first bin. The histogram must be dense, see \ref Dense.
       CountType const* Origin() const {
          DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+         DIP_THROW_IF( IsSparse(), "Not supported for a sparse histogram" );
          return static_cast< CountType const* >( data_.Origin() );
       }
 
@@ -622,13 +746,21 @@ class DIP_NO_EXPORT Histogram {
       /// For a multi-dimensional histogram, the cumulative histogram has `bin(i,j,k)` equal to the sum of all bins
       /// with indices equal or smaller to `i`, `j` and `k`: `bin(1..i,1..j,1..k)`. It is computed through the
       /// \ref dip::CumulativeSum function.
+      ///
+      /// A sparse histogram keeps its original bin counts, and builds an index to compute cumulative values from.
+      /// If the dense histogram is not much larger than the number of stored bins, this index is the dense
+      /// cumulative histogram. Otherwise it is a k-d tree where each node holds the sum of the counts below it;
+      /// the cumulative value of a bin is computed when it is accessed, adding up the nodes and bins with equal
+      /// or smaller indices. For a high-dimensional histogram with many stored bins this is expensive. The
+      /// marginals and the count of a sparse cumulative histogram cannot be computed, and it cannot be smoothed,
+      /// added to or subtracted from.
       DIP_EXPORT Histogram& Cumulative();
 
       /// \brief Returns the marginal histogram for dimension `dim`.
       ///
       /// The marginal histogram represents the marginal intensity distribution. It is a 1D histogram determined
       /// by summing over all dimensions except `dim`, and is equivalent to the histogram for tensor element
-      /// `dim`.
+      /// `dim`. The marginal histogram of a sparse histogram is dense.
       DIP_EXPORT Histogram GetMarginal( dip::uint dim ) const;
 
       /// \brief Smooths the histogram, using Gaussian smoothing with parameters `sigma`.
@@ -639,13 +771,22 @@ class DIP_NO_EXPORT Histogram {
       ///
       /// The histogram is extended by `std::ceil( 3 * sigma )` below and above the original bounds, to prevent the
       /// histogram count to change.
+      ///
+      /// A sparse histogram is smoothed by spreading each stored bin over its neighbors, one dimension at a time,
+      /// and rounding the result to integer counts. It remains sparse, but stores many more bins than before.
       DIP_EXPORT Histogram& Smooth( FloatArray sigma );
       Histogram& Smooth( dfloat sigma = 1 ) {
          return Smooth( FloatArray{ sigma } );
       }
 
    private:
+      using SparseData = tsl::robin_map< dip::uint, CountType, detail::SparseHistogramHash >;
+
       Image data_;             // This is where the bins are stored. Always scalar and DT_COUNT.
+                               // For a sparse histogram it is not forged, only its sizes are used.
+      std::shared_ptr< SparseData > sparseData_; // For a sparse histogram, maps the linear index of each non-empty
+                                                 // bin (first dimension changing fastest) to its count.
+      std::shared_ptr< detail::SparseCumulativeIndex const > cumulativeIndex_; // Set by `Cumulative()` for a sparse histogram.
       FloatArray lowerBounds_; // These are the lower bounds of the histogram along each dimension.
       FloatArray binSizes_;    // These are the sizes of the bins along each dimension.
       // Compute the upper bound by : lowerBounds_[ii] + binSizes_[ii]*data_.Size(ii).
@@ -659,7 +800,10 @@ class DIP_NO_EXPORT Histogram {
       DIP_EXPORT void ScalarImageHistogram( Image const& input, Image const& mask, Configuration& configuration );
       DIP_EXPORT void TensorImageHistogram( Image const& input, Image const& mask, ConfigurationArray& configuration );
       DIP_EXPORT void JointImageHistogram( Image const& input1, Image const& input2, Image const& mask, ConfigurationArray& configuration );
-      DIP_EXPORT void MeasurementFeatureHistogram( Measurement::IteratorFeature const& featureValues, ConfigurationArray& configuration );
+      DIP_EXPORT void MeasurementFeatureHistogram( Measurement::IteratorFeature const& featureValues, ConfigurationArray& configuration, bool sparse = false );
+      DIP_EXPORT void SparseImageHistogram( Image const& input, Image const& mask, ConfigurationArray& configuration );
+      DIP_EXPORT CountType SparseAt( UnsignedArray const& bin ) const;
+      DIP_EXPORT void SparseAdd( Histogram const& other, bool subtract );
       DIP_EXPORT void EmptyHistogram( ConfigurationArray configuration );
       DIP_EXPORT void HistogramFromDataPointer( CountType const* data, Configuration const& configuration );
 };
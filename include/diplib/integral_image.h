@@ -0,0 +1,195 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DIP_INTEGRAL_IMAGE_H
+#define DIP_INTEGRAL_IMAGE_H
+
+#include "diplib.h"
+
+
+/// \file
+/// \brief Declares \ref dip::IntegralImage, a summed-area table for computing local sums, means and variances.
+/// See \ref linear.
+
+
+namespace dip {
+
+
+/// \addtogroup linear
+
+
+/// \brief The integral image (summed-area table) of an image, used to compute the sum of the pixels within
+/// any rectangular box in constant time.
+///
+/// The integral image stores, for each pixel, the sum of all input pixels with lower or equal coordinates along
+/// all dimensions. The sum over an arbitrary box is then computed from the values at its $2^n$ corners, for an
+/// $n$-dimensional image. Optionally, the integral image of the squared pixel values is stored as well, allowing
+/// the computation of the variance within each box.
+///
+/// Constructing the integral image takes one pass over the image for each dimension. Once constructed, a
+/// rectangular uniform filter (\ref dip::Uniform), variance filter (\ref dip::VarianceFilter) or standard deviation
+/// filter can be computed for any filter size at a cost that does not depend on that size. This is useful when
+/// these local statistics are needed at many different scales, for example for multi-scale local thresholding.
+/// The Sauvola threshold, for example, is computed as follows:
+///
+/// ```cpp
+/// dip::IntegralImage integral( img, { 7, 7 }, {}, "variance" );
+/// dip::Image mean = integral.Mean( { 15, 15 } );
+/// dip::Image threshold = mean * ( 1 + 0.2 * ( integral.StandardDeviation( { 15, 15 } ) / 128 - 1 ));
+/// dip::Image out = img > threshold;
+/// ```
+///
+/// The input image is extended by `border` pixels on each side using `boundaryCondition` (see
+/// \ref dip::BoundaryCondition) before the integral image is computed. Filters that use a window with
+/// a size up to `2 * border + 1` pixels compute the same result as \ref dip::Uniform and \ref dip::VarianceFilter
+/// with a rectangular kernel of that size. Windows that extend further than the border are truncated, the mean
+/// and variance are then computed over the pixels that fall within the extended image.
+///
+/// The input image must be real-valued or binary, and can have any number of tensor elements; each tensor element is
+/// processed independently. To avoid overflow and loss of precision, sums of integer pixel values are accumulated
+/// in 64-bit integers. The same is true for the sums of squares of 8-bit and 16-bit integer images. Other sums,
+/// including both sums for 32-bit integer images when `statistics` is `"variance"`, are accumulated in
+/// double-precision floating-point values; for these, the image's mean value is subtracted before accumulation,
+/// to limit the magnitude of the sums and thus the rounding errors in the results. These rounding errors still
+/// grow with the difference between the local and the global mean, relative to the local variance.
+class DIP_NO_EXPORT IntegralImage {
+   public:
+      /// \brief A default-constructed integral image is empty.
+      IntegralImage() = default;
+
+      /// \brief Constructs the integral image of `in`.
+      ///
+      /// If `statistics` is `"mean"`, only the sum of pixel values is stored. If it is `"variance"`, the sum of
+      /// squared pixel values is stored as well, and \ref Variance and \ref StandardDeviation can be used.
+      ///
+      /// `border` and `boundaryCondition` determine how the image is extended before computing the integral image,
+      /// see the class description. `border` can be a scalar, which applies to all dimensions.
+      DIP_EXPORT explicit IntegralImage(
+            Image const& in,
+            UnsignedArray border = {},
+            StringArray const& boundaryCondition = {},
+            String const& statistics = "mean"
+      );
+
+      /// \brief Returns true if the integral image has been computed.
+      bool IsComputed() const {
+         return sums_.IsForged();
+      }
+
+      /// \brief Returns the sizes of the image the integral image was constructed from.
+      UnsignedArray const& Sizes() const {
+         return sizes_;
+      }
+
+      /// \brief Returns the size of the border by which the input image was extended.
+      UnsignedArray const& Border() const {
+         return border_;
+      }
+
+      /// \brief Returns the number of tensor elements of the image the integral image was constructed from.
+      dip::uint TensorElements() const {
+         return tensor_.Elements();
+      }
+
+      /// \brief Returns true if the sums of squares are stored, so that the variance can be computed.
+      bool HasSquares() const {
+         return squares_.IsForged();
+      }
+
+      /// \brief Returns the sum of the pixel values within the box with top-left corner at `origin` and sizes
+      /// `sizes`, for tensor element `tensorElement`.
+      ///
+      /// `origin` is given in the coordinate system of the input image, it can be negative to include pixels
+      /// in the border. The box is truncated to the extended image.
+      DIP_EXPORT dfloat BoxSum( IntegerArray const& origin, UnsignedArray const& sizes, dip::uint tensorElement = 0 ) const;
+
+      /// \brief Returns the sum of the squared pixel values within the box with top-left corner at `origin` and
+      /// sizes `sizes`, for tensor element `tensorElement`. See \ref BoxSum.
+      DIP_EXPORT dfloat BoxSumOfSquares( IntegerArray const& origin, UnsignedArray const& sizes, dip::uint tensorElement = 0 ) const;
+
+      /// \brief Computes, for each pixel, the sum of the pixel values within a rectangular window of size
+      /// `filterSize` around the pixel.
+      ///
+      /// The window covers the pixels from `-filterSize / 2` to `( filterSize - 1 ) / 2` (using integer
+      /// division), relative to the pixel being computed. This is the same window as used by \ref dip::Uniform
+      /// for a rectangular kernel. `filterSize` can be a scalar, which applies to all dimensions.
+      ///
+      /// `out` is of a floating-point type, with the same tensor shape as the input image.
+      DIP_EXPORT void Sum( UnsignedArray const& filterSize, Image& out ) const;
+      DIP_NODISCARD Image Sum( UnsignedArray const& filterSize ) const {
+         Image out;
+         Sum( filterSize, out );
+         return out;
+      }
+
+      /// \brief Computes, for each pixel, the mean of the pixel values within a rectangular window of size
+      /// `filterSize` around the pixel. See \ref Sum.
+      DIP_EXPORT void Mean( UnsignedArray const& filterSize, Image& out ) const;
+      DIP_NODISCARD Image Mean( UnsignedArray const& filterSize ) const {
+         Image out;
+         Mean( filterSize, out );
+         return out;
+      }
+
+      /// \brief Computes, for each pixel, the sample variance of the pixel values within a rectangular window
+      /// of size `filterSize` around the pixel. See \ref Sum.
+      ///
+      /// The integral image must have been constructed with `statistics` set to `"variance"`.
+      DIP_EXPORT void Variance( UnsignedArray const& filterSize, Image& out ) const;
+      DIP_NODISCARD Image Variance( UnsignedArray const& filterSize ) const {
+         Image out;
+         Variance( filterSize, out );
+         return out;
+      }
+
+      /// \brief Computes, for each pixel, the sample standard deviation of the pixel values within a rectangular
+      /// window of size `filterSize` around the pixel. See \ref Sum.
+      ///
+      /// The integral image must have been constructed with `statistics` set to `"variance"`.
+      DIP_EXPORT void StandardDeviation( UnsignedArray const& filterSize, Image& out ) const;
+      DIP_NODISCARD Image StandardDeviation( UnsignedArray const& filterSize ) const {
+         Image out;
+         StandardDeviation( filterSize, out );
+         return out;
+      }
+
+      /// \brief Computes, for each pixel, the mean and the sample variance of the pixel values within a
+      /// rectangular window of size `filterSize` around the pixel, in a single pass. See \ref Sum.
+      ///
+      /// The integral image must have been constructed with `statistics` set to `"variance"`.
+      DIP_EXPORT void MeanAndVariance( UnsignedArray const& filterSize, Image& mean, Image& variance ) const;
+
+   private:
+      UnsignedArray sizes_;         // Sizes of the input image
+      UnsignedArray border_;        // Border added to the input image
+      Tensor tensor_;               // Tensor shape of the input image
+      DataType dataType_;           // Data type of the input image
+      dip::PixelSize pixelSize_;    // Pixel size of the input image
+      String colorSpace_;           // Color space of the input image
+      dfloat offset_ = 0;           // Value subtracted from the input before accumulation
+      Image sums_;                  // Sizes are `sizes_ + 2 * border_ + 1`, the first element along each dimension is 0
+      Image squares_;               // Same as `sums_`, for the squared values
+
+      void Compute( UnsignedArray filterSize, dip::uint statistic, Image& out1, Image& out2 ) const;
+};
+
+
+/// \endgroup
+
+} // namespace dip
+
+#endif // DIP_INTEGRAL_IMAGE_H
@@ -659,6 +659,14 @@ class DIP_NO_EXPORT ThinPlateSpline {
       /// \brief Evaluates the thin plate spline function at point `pt`.
       DIP_EXPORT FloatArray Evaluate( FloatArray const& pt );
 
+      /// \brief Returns an upper bound to the error made when the function is approximated, within the box
+      /// with corners `lower` and `upper`, by multilinear interpolation of its values at the corners of the box.
+      ///
+      /// The bound is the Euclidean norm of the error vector, and is derived from the second derivatives of the
+      /// radial basis function within the box. It is infinite if any of the control points lies within the box.
+      /// The cost of computing the bound is similar to that of evaluating the function once.
+      DIP_EXPORT dfloat InterpolationErrorBound( FloatArray const& lower, FloatArray const& upper ) const;
+
    private:
       std::vector< dfloat > x_;
       FloatCoordinateArray c_;
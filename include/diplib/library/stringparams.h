@@ -113,6 +113,8 @@ constexpr char const* SHIFTED = "shifted";
 constexpr char const* SUBSAMPLE = "subsample";
 constexpr char const* ISOTROPIC = "isotropic";
 constexpr char const* LENGTH = "length";
+constexpr char const* PRIORITY_QUEUE = "priority queue";
+constexpr char const* HYBRID = "hybrid";
 
 // Watershed flags
 constexpr char const* CORRECT = "correct";
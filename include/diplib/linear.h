@@ -258,7 +258,9 @@ DIP_NODISCARD inline Image Convolution(
 ///
 /// `boundaryCondition` indicates how the boundary should be expanded in each dimension. See \ref dip::BoundaryCondition.
 ///
-/// \see dip::ConvolveFT, dip::SeparableConvolution, dip::GeneralConvolution
+/// To compute the uniform filter with a rectangular kernel for many different sizes, use \ref dip::IntegralImage.
+///
+/// \see dip::ConvolveFT, dip::SeparableConvolution, dip::GeneralConvolution, dip::IntegralImage
 DIP_EXPORT void Uniform(
       Image const& in,
       Image& out,
@@ -0,0 +1,197 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DIP_MAX_TREE_H
+#define DIP_MAX_TREE_H
+
+#include <vector>
+
+#include "diplib.h"
+
+
+/// \file
+/// \brief Declares \ref dip::MaxTree, the component tree of a grey-value image.
+/// See \ref morphology.
+
+
+namespace dip {
+
+
+/// \addtogroup morphology
+
+
+/// \brief The max-tree or min-tree (component tree) of a scalar grey-value image.
+///
+/// Each node in the max-tree represents a connected component of a threshold set $\{ x \mid f(x) \ge h \}$,
+/// for a level $h$ equal to the grey value of the pixels in the component that are not in any of its child nodes.
+/// The parent of a node is the component at the next lower level that contains it. The root node represents the
+/// whole image, at the level of the minimum grey value. The min-tree is the same structure built on the threshold
+/// sets $\{ x \mid f(x) \le h \}$, with the root at the maximum grey value.
+///
+/// Constructing the tree is somewhat more expensive than computing a single \ref dip::AreaOpening. Once constructed,
+/// the tree stores, for each node, the area, volume, bounding box and moments of the component it represents.
+/// Filters based on these attributes (connected filters, such as the area opening) can then be computed in linear
+/// time, without constructing the tree again. This is useful, for example, to apply a filter with many different
+/// parameter values.
+///
+/// Nodes are indexed such that the parent of a node always has a lower index than the node itself, the root has
+/// index 0. Thus, iterating over nodes in reverse order visits children before their parents.
+///
+/// Large 8-bit images are split into slabs along the last image dimension, and the tree for each slab is constructed
+/// in a separate thread. The trees are then merged along the slab boundaries. Merging requires walking down the
+/// branches of the trees, which is only cheap if the number of grey levels is small; images of other data types
+/// are always processed in a single thread. The result does not depend on the number of threads used.
+///
+/// !!! literature
+///     - P. Salembier, A. Oliveras and L. Garrido, "Antiextensive connected operators for image and sequence
+///       processing", IEEE Transactions on Image Processing 7(4):555-570, 1998.
+///     - C. Berger, T. Géraud, R. Levillain, N. Widynski, A. Baillard and E. Bertin, "Effective component tree
+///       computation with application to pattern recognition in astronomical imaging", IEEE International Conference
+///       on Image Processing 4:41-44, 2007.
+///     - M.H.F. Wilkinson, H. Gao, W.H. Hesselink, J.E. Jonker and A. Meijster, "Concurrent computation of attribute
+///       filters on shared memory parallel machines", IEEE Transactions on Pattern Analysis and Machine Intelligence
+///       30(10):1800-1813, 2008.
+class DIP_NO_EXPORT MaxTree {
+   public:
+      /// Type for indices to nodes
+      using NodeIndex = dip::uint;
+
+      /// \brief A default-constructed tree is empty, it has no nodes.
+      MaxTree() = default;
+
+      /// \brief Constructs the max-tree (`polarity` is `"opening"`) or min-tree (`polarity` is `"closing"`)
+      /// of the scalar, real-valued image `in`.
+      ///
+      /// See \ref connectivity for information on the connectivity parameter.
+      DIP_EXPORT explicit MaxTree( Image const& in, dip::uint connectivity = 1, String const& polarity = S::OPENING );
+
+      /// \brief Returns the number of nodes in the tree.
+      dip::uint NumberOfNodes() const {
+         return parent_.size();
+      }
+
+      /// \brief Returns true if the tree is a min-tree.
+      bool IsMinTree() const {
+         return isMinTree_;
+      }
+
+      /// \brief Returns the sizes of the image the tree was constructed from.
+      UnsignedArray const& Sizes() const {
+         return nodes_.Sizes();
+      }
+
+      /// \brief Returns the index of the root node, which is always 0.
+      NodeIndex Root() const {
+         return 0;
+      }
+
+      /// \brief Returns the index of the parent node of `node`. The parent of the root node is itself.
+      NodeIndex Parent( NodeIndex node ) const {
+         return parent_[ node ];
+      }
+
+      /// \brief Returns the grey level of `node`.
+      dfloat Level( NodeIndex node ) const {
+         return level_[ node ];
+      }
+
+      /// \brief Returns the area of `node`, the number of pixels in the component.
+      dip::uint Area( NodeIndex node ) const {
+         return area_[ node ];
+      }
+
+      /// \brief Returns the volume of `node`, the sum of the absolute differences between the grey values of
+      /// the pixels in the component and the level of the node.
+      dfloat Volume( NodeIndex node ) const {
+         return volume_[ node ];
+      }
+
+      /// \brief Returns the bounding box of `node`, as a set of ranges that can be used to index into
+      /// the image (see \ref dip::Image::At(RangeArray const&) const).
+      DIP_EXPORT RangeArray BoundingBox( NodeIndex node ) const;
+
+      /// \brief Returns the centroid of `node`, the mean of the coordinates of the pixels in the component.
+      DIP_EXPORT FloatArray Centroid( NodeIndex node ) const;
+
+      /// \brief Returns the second order central moments of `node`, computed on the coordinates of the
+      /// pixels in the component.
+      ///
+      /// The moments are stored in the same order as symmetric tensors are stored in an image
+      /// (see \ref dip::Tensor::Shape). That is, xx, yy, xy in 2D, and xx, yy, zz, xy, xz, yz in 3D.
+      /// These are the plain moments (the covariance matrix of the coordinates), not the inertia tensor
+      /// returned by \ref dip::MomentAccumulator::SecondOrder.
+      DIP_EXPORT FloatArray SecondOrderCentralMoments( NodeIndex node ) const;
+
+      /// \brief Returns the image with, for each pixel, the index of the node it belongs to.
+      ///
+      /// A pixel belongs to the node with the highest index (the node furthest from the root) whose component
+      /// contains it. The pixel's grey value equals the level of this node.
+      Image const& Nodes() const {
+         return nodes_;
+      }
+
+      /// \brief Returns the index of the node that the pixel at `coords` belongs to.
+      NodeIndex Node( UnsignedArray const& coords ) const {
+         return nodes_.At( coords ).As< NodeIndex >();
+      }
+
+      /// \brief Applies a connected filter to the image the tree was constructed from.
+      ///
+      /// `keep` has one element for each node. The pixels that belong to a node for which `keep` is false
+      /// are assigned the level of the closest ancestor for which `keep` is true (the "direct" decision rule).
+      /// The root is always kept. If the criterion used to compute `keep` is increasing (a node is only kept if
+      /// its parent is also kept), as is the case with the area, this is an attribute opening (or closing,
+      /// for a min-tree).
+      ///
+      /// `out` has the same data type and pixel size as the image the tree was constructed from.
+      DIP_EXPORT void Filter( std::vector< bool > const& keep, Image& out ) const;
+      DIP_NODISCARD Image Filter( std::vector< bool > const& keep ) const {
+         Image out;
+         Filter( keep, out );
+         return out;
+      }
+
+      /// \brief Computes the area opening (max-tree) or area closing (min-tree), removing all nodes with an area
+      /// smaller than `filterSize`. The result is identical to that of \ref dip::AreaOpening.
+      DIP_EXPORT void AreaFilter( dip::uint filterSize, Image& out ) const;
+      DIP_NODISCARD Image AreaFilter( dip::uint filterSize ) const {
+         Image out;
+         AreaFilter( filterSize, out );
+         return out;
+      }
+
+   private:
+      bool isMinTree_ = false;
+      DataType dataType_;                 // Data type of the input image
+      dip::PixelSize pixelSize_;          // Pixel size of the input image
+      Image nodes_;                       // DT_LABEL image with node index for each pixel
+      std::vector< NodeIndex > parent_;
+      std::vector< dfloat > level_;
+      std::vector< dip::uint > area_;
+      std::vector< dfloat > volume_;
+      std::vector< dip::uint > bbLower_;  // nDims values per node
+      std::vector< dip::uint > bbUpper_;  // nDims values per node
+      std::vector< dfloat > m1_;          // Sum of coordinates, nDims values per node
+      std::vector< dfloat > m2_;          // Sum of products of coordinates, nDims * ( nDims + 1 ) / 2 values per node
+};
+
+
+/// \endgroup
+
+} // namespace dip
+
+#endif // DIP_MAX_TREE_H
@@ -806,7 +806,8 @@ class DIP_CLASS_EXPORT LineBased : public Base {
       explicit LineBased( Information const& information ) : Base( information, Type::LINE_BASED ) {}
 
       /// \brief Called once for each image line, to accumulate information about each object.
-      /// This function is not called in parallel, and hence does not need to be thread-safe.
+      /// This function is not called in parallel, and hence does not need to be thread-safe. See
+      /// \ref dip::Feature::LineBased::ScanLineInThread for the version that is called in parallel.
       ///
       /// The two line iterators can always be incremented exactly the same number of times.
       /// `label` is non-zero where there is an object pixel.
@@ -829,6 +830,50 @@ class DIP_CLASS_EXPORT LineBased : public Base {
             ObjectIdToIndexMap const& objectIndices
       ) = 0;
 
+      /// \brief Returns `true` if the feature can accumulate information about each object in multiple threads.
+      ///
+      /// If all the line-based features requested from \ref dip::MeasurementTool::Measure return `true`,
+      /// the image will be scanned in parallel. In this case, \ref dip::Feature::LineBased::SetNumberOfThreads
+      /// is called before the scan, \ref dip::Feature::LineBased::ScanLineInThread is called instead of
+      /// \ref dip::Feature::LineBased::ScanLine, and \ref dip::Feature::LineBased::Reduce is called after the scan,
+      /// before \ref dip::Feature::LineBased::Finish.
+      ///
+      /// The default implementation returns `false`.
+      virtual bool SupportsMultithreading() const { return false; }
+
+      /// \brief Called before scanning the image in parallel, with the number of threads that will be used.
+      ///
+      /// The feature should allocate an array of accumulators for each additional thread (for `nThreads - 1`
+      /// threads, thread 0 uses the array allocated in \ref dip::Feature::Base::Initialize).
+      virtual void SetNumberOfThreads( dip::uint nThreads ) {
+         ( void ) nThreads;
+      }
+
+      /// \brief Called once for each image line, to accumulate information about each object, when scanning
+      /// the image in parallel.
+      ///
+      /// Same as \ref dip::Feature::LineBased::ScanLine, but called concurrently from `nThreads` threads
+      /// (see \ref dip::Feature::LineBased::SetNumberOfThreads). `thread` is the index to the thread, and
+      /// indicates which array of accumulators to use. The image is split into consecutive chunks, thread 0
+      /// processes the first chunk, thread 1 the next one, etc.
+      ///
+      /// The default implementation calls \ref dip::Feature::LineBased::ScanLine.
+      virtual void ScanLineInThread(
+            LineIterator< LabelType > label,
+            LineIterator< dfloat > grey,
+            UnsignedArray coordinates,
+            dip::uint dimension,
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
+      );
+
+      /// \brief Called after scanning the image in parallel, to merge the accumulators of all threads
+      /// into those of thread 0.
+      ///
+      /// Accumulators should be merged in thread order, such that the result is the same as when scanning
+      /// the image in a single thread (up to rounding errors in floating-point sums).
+      virtual void Reduce() {}
+
       /// \brief Called once for each object, to finalize the measurement.
       virtual void Finish( dip::uint objectIndex, Measurement::ValueIterator output ) = 0;
 };
@@ -0,0 +1,199 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DIP_MEMORY_POOL_H
+#define DIP_MEMORY_POOL_H
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "diplib.h"
+
+
+/// \file
+/// \brief Declares \ref dip::MemoryPool, a pooling allocator for image data and temporary buffers.
+/// See \ref infrastructure.
+
+
+namespace dip {
+
+
+/// \addtogroup infrastructure
+
+
+/// \brief A pooling memory allocator for image data and temporary buffers.
+///
+/// Applications that repeatedly process images of the same sizes, such as a video processing pipeline,
+/// allocate and free the same amount of memory over and over again. A `MemoryPool` keeps freed memory blocks
+/// around, such that later allocations of a similar size can reuse them instead of calling `std::malloc`.
+///
+/// Requested sizes are rounded up to a size class. There are four size classes for each power of two, so at most
+/// 25% of the memory is wasted. A freed block is kept in the pool unless that would increase the total size of the
+/// cached blocks beyond the pool's capacity, in which case it is returned to the system. Blocks still in use
+/// when the `MemoryPool` object is destroyed remain valid, they are freed when they are released.
+///
+/// The pool can be used in two ways:
+///
+/// - Per image, as a \ref dip::ExternalInterface: `img.SetExternalInterface( &pool )`. The image data is then
+///   allocated from the pool when the image is forged. The caller maintains ownership of the pool, which
+///   must outlive the images that use it as their external interface (but not their data segments).
+///
+/// - Globally, through \ref dip::SetDefaultMemoryPool. The pool is then used for the data of all images that
+///   don't have an external interface, and for the temporary line buffers used by the frameworks (see
+///   \ref frameworks).
+///
+/// `MemoryPool` is thread safe. \ref GetStatistics reports how often allocations were satisfied from the pool,
+/// which can be used to tune its capacity.
+class DIP_CLASS_EXPORT MemoryPool : public ExternalInterface {
+   public:
+      /// \brief Counters describing the use of the memory pool.
+      struct Statistics {
+         dip::uint hits = 0;          ///< Number of allocations satisfied by a cached block.
+         dip::uint misses = 0;        ///< Number of allocations that needed a new block.
+         dip::uint releases = 0;      ///< Number of blocks returned to the pool for reuse.
+         dip::uint discards = 0;      ///< Number of blocks freed because the pool was full.
+         dip::uint cachedBlocks = 0;  ///< Number of blocks currently kept in the pool.
+         dip::uint cachedBytes = 0;   ///< Number of bytes currently kept in the pool.
+
+         /// \brief The fraction of allocations satisfied by a cached block, 0 if there were no allocations.
+         dfloat HitRate() const {
+            dip::uint total = hits + misses;
+            return total == 0 ? 0.0 : static_cast< dfloat >( hits ) / static_cast< dfloat >( total );
+         }
+      };
+
+      /// \brief Creates a pool that caches up to `capacity` bytes of freed memory.
+      DIP_EXPORT explicit MemoryPool( dip::uint capacity = 1024 * 1024 * 1024 );
+
+      MemoryPool( MemoryPool const& ) = delete;
+      MemoryPool& operator=( MemoryPool const& ) = delete;
+      DIP_EXPORT ~MemoryPool() override;
+
+      /// \brief Allocates a block of at least `size` bytes. The block is aligned like memory returned by `std::malloc`.
+      ///
+      /// When the returned \ref dip::DataSegment releases the block, it is returned to the pool.
+      DIP_EXPORT DataSegment Allocate( dip::uint size );
+
+      /// \brief Allocates image data from the pool, with normal strides. Called by \ref dip::Image::Forge.
+      DIP_EXPORT DataSegment AllocateData(
+            void*& origin,
+            dip::DataType dataType,
+            UnsignedArray const& sizes,
+            IntegerArray& strides,
+            dip::Tensor const& tensor,
+            dip::sint& tensorStride
+      ) override;
+
+      /// \brief Changes the maximum number of bytes kept in the pool. Cached blocks are freed if necessary.
+      DIP_EXPORT void SetCapacity( dip::uint capacity );
+
+      /// \brief Returns the maximum number of bytes kept in the pool.
+      DIP_EXPORT dip::uint Capacity() const;
+
+      /// \brief Frees all cached blocks. Blocks in use are not affected.
+      DIP_EXPORT void Clear();
+
+      /// \brief Returns the usage counters.
+      DIP_EXPORT Statistics GetStatistics() const;
+
+      /// \brief Resets the `hits`, `misses`, `releases` and `discards` counters to zero.
+      DIP_EXPORT void ResetStatistics();
+
+   private:
+      class Impl;
+      std::shared_ptr< Impl > impl_; // shared with the deleters of the blocks handed out
+};
+
+
+/// \brief Installs `pool` as the default memory pool, to be used for all image data and framework buffers.
+///
+/// Pass `nullptr` to uninstall the pool, memory will then be allocated with `std::malloc` again.
+/// The caller maintains ownership of the pool, and must uninstall it before destroying it.
+/// Images and buffers allocated from the pool remain valid after it is uninstalled or destroyed.
+///
+/// Unlike \ref dip::SetNumberOfThreads, this setting is global, it applies to all threads.
+DIP_EXPORT void SetDefaultMemoryPool( MemoryPool* pool );
+
+/// \brief Returns the currently installed default memory pool, or `nullptr` if there is none.
+DIP_EXPORT MemoryPool* GetDefaultMemoryPool();
+
+
+/// \brief A 32-byte aligned temporary buffer, allocated from the default memory pool if one is installed.
+///
+/// This is a replacement for \ref dip::AlignedBuffer, used by the frameworks and other functions that
+/// allocate temporary buffers for every call. The buffer is not initialized.
+class PooledBuffer {
+   public:
+      /// A default-initialized buffer is empty.
+      PooledBuffer() = default;
+      /// A buffer of size `size`, uninitialized.
+      explicit PooledBuffer( dip::uint size ) {
+         resize( size );
+      }
+      /// Change the size of the buffer to `size`. Data is not preserved.
+      ///
+      /// If the buffer is already large enough, it is not reallocated.
+      void resize( dip::uint size ) {
+         if( size > capacity_ ) {
+            data_.reset();
+            capacity_ = 0;
+            MemoryPool* pool = GetDefaultMemoryPool();
+            if( pool ) {
+               data_ = pool->Allocate( size + align_ - 1 );
+            } else {
+               void* p = std::malloc( size + align_ - 1 );
+               if( !p ) {
+                  throw std::bad_alloc();
+               }
+               data_ = DataSegment{ p, std::free };
+            }
+            dip::uint diff = reinterpret_cast< dip::uint >( data_.get() ) & ( align_ - 1 );
+            offset_ = diff == 0 ? 0 : align_ - diff;
+            capacity_ = size;
+         }
+         size_ = size;
+      }
+      /// Free the buffer's memory.
+      void clear() noexcept {
+         data_.reset();
+         size_ = 0;
+         capacity_ = 0;
+      }
+      /// True if the buffer is empty (its size is zero).
+      DIP_NODISCARD bool empty() const noexcept { return size_ == 0; }
+      /// Returns the size of the buffer.
+      dip::uint size() const noexcept { return size_; }
+      /// Returns a pointer to the first byte of the buffer.
+      dip::uint8* data() noexcept { return static_cast< dip::uint8* >( data_.get() ) + offset_; };
+      /// Returns a pointer to the first byte of the buffer.
+      dip::uint8 const* data() const noexcept { return static_cast< dip::uint8 const* >( data_.get() ) + offset_; };
+
+   private:
+      constexpr static dip::uint align_ = 32; // Must be a power of two!
+      dip::uint size_ = 0;
+      dip::uint capacity_ = 0;
+      dip::uint offset_ = 0;
+      DataSegment data_;
+};
+
+
+/// \endgroup
+
+} // namespace dip
+
+#endif // DIP_MEMORY_POOL_H
@@ -815,7 +815,7 @@ DIP_NODISCARD inline Image MorphologicalLaplace(
 /// approximation of the erosion.
 ///
 /// See also \ref dip::PercentileFilter, which does the same thing but uses a percentile instead of
-/// a rank as input argument.
+/// a rank as input argument. The notes there on the computational cost apply here too.
 ///
 /// `boundary` determines the boundary conditions. See \ref dip::BoundaryCondition.
 /// The default value is the most meaningful one, but any value can be used. By default it is
@@ -979,6 +979,11 @@ DIP_NODISCARD inline Image RankMaxOpening(
 /// merging. But note that, due to the way that the region seeds are computed (\ref dip::Minima), setting
 /// `maxDepth` to 0 would lead to the exact same result.
 ///
+/// For the `"fast"` algorithm, the pixels are sorted using multiple threads, but the flooding itself is
+/// sequential. The on-line merging depends on the order in which pixels are processed and on the sizes of
+/// the regions at that time, so the flooding cannot be split up over parts of the image without changing
+/// the result.
+///
 /// Any pixel that is infinity will be part of the watershed lines, as is any pixel not within
 /// `mask`.
 ///
@@ -1145,6 +1150,9 @@ DIP_NODISCARD inline Image CompactWatershed(
 /// of iterations, but typically \ref dip::DT_UINT8), or of type \ref dip::DT_SFLOAT if the exact stochastic watershed
 /// is computed.
 ///
+/// The iterations are computed in parallel. Each iteration uses its own random stream, split off from `random`
+/// (see \ref dip::Random::Split), so that the result is the same no matter how many threads are used.
+///
 /// !!! literature
 ///     - J. Angulo and D. Jeulin, "Stochastic watershed segmentation", Proceedings of the 8th International Symposium on
 ///       Mathematical Morphology, Instituto Nacional de Pesquisas Espaciais (INPE), São José dos Campos, pp. 265–276, 2007.
@@ -1383,10 +1391,22 @@ DIP_NODISCARD inline Image UpperSkeleton2D(
 ///
 /// See \ref connectivity for information on the connectivity parameter.
 ///
-/// The algorithm implemented is a hybrid between the method proposed by Vincent (a forward raster scan, followed
-/// by a backward raster scan, followed by a LIFO queue propagation method), and that proposed by Robinson and Whelan
-/// (a priority queue method). We implement the forward and backward scan, and follow it by a priority queue propagation.
-/// The priority queue method has the advantage of visiting each pixels exactly once.
+/// `method` selects the algorithm used:
+///
+/// - `"priority queue"`: a hybrid between the method proposed by Vincent (a forward raster scan, followed
+///   by a backward raster scan, followed by a FIFO queue propagation method), and that proposed by Robinson and Whelan
+///   (a priority queue method). We implement the forward and backward scan, and follow it by a priority queue propagation.
+///   The priority queue method has the advantage of visiting each pixels exactly once. This method does not use
+///   multithreading.
+/// - `"hybrid"`: Vincent's hybrid method. The image is split into slabs along the last (slowest varying) dimension,
+///   the raster scans are performed on each slab independently, using multiple threads. The pixels that can still
+///   propagate after the raster scans, including those along the slab boundaries, are propagated from using a FIFO
+///   queue. Pixels can be visited more than once, but there is no overhead of keeping a queue sorted.
+///   This method is much faster when `marker` is close to `in`, as in \ref dip::HMaxima, but can be
+///   slower than `"priority queue"` when values propagate over long distances, as when `marker` contains a few
+///   isolated seeds.
+///
+/// Both methods produce identical output.
 ///
 /// For binary images, this function calls \ref dip::BinaryPropagation, which uses the same algorithm but is specialized
 /// for the binary case (e.g. using a stack instead of a priority queue).
@@ -1404,16 +1424,18 @@ DIP_EXPORT void MorphologicalReconstruction(
       Image const& in, // grey-value mask
       Image& out,
       dip::uint connectivity = 0,
-      String const& direction = S::DILATION
+      String const& direction = S::DILATION,
+      String const& method = S::PRIORITY_QUEUE
 );
 DIP_NODISCARD inline Image MorphologicalReconstruction(
       Image const& marker,
       Image const& in,
       dip::uint connectivity = 0,
-      String const& direction = S::DILATION
+      String const& direction = S::DILATION,
+      String const& method = S::PRIORITY_QUEUE
 ) {
    Image out;
-   MorphologicalReconstruction( marker, in, out, connectivity, direction );
+   MorphologicalReconstruction( marker, in, out, connectivity, direction, method );
    return out;
 }
 
@@ -1432,17 +1454,19 @@ DIP_EXPORT void LimitedMorphologicalReconstruction(
       Image& out,
       dfloat maxDistance = 20,
       dip::uint connectivity = 0,
-      String const& direction = S::DILATION
+      String const& direction = S::DILATION,
+      String const& method = S::PRIORITY_QUEUE
 );
 DIP_NODISCARD inline Image LimitedMorphologicalReconstruction(
       Image const& marker,
       Image const& in,
       dfloat maxDistance = 20,
       dip::uint connectivity = 0,
-      String const& direction = S::DILATION
+      String const& direction = S::DILATION,
+      String const& method = S::PRIORITY_QUEUE
 ) {
    Image out;
-   LimitedMorphologicalReconstruction( marker, in, out, maxDistance, connectivity, direction );
+   LimitedMorphologicalReconstruction( marker, in, out, maxDistance, connectivity, direction, method );
    return out;
 }
 
@@ -1451,26 +1475,31 @@ DIP_NODISCARD inline Image LimitedMorphologicalReconstruction(
 /// The H-Minima filtered image has all local minima with a depth less than `h` removed:
 ///
 /// ```cpp
-/// HMinima = dip::MorphologicalReconstruction( in + h, in, connectivity, "erosion" );
+/// HMinima = dip::MorphologicalReconstruction( in + h, in, connectivity, "erosion", method );
 /// ```
 ///
+/// `method` is passed on to \ref dip::MorphologicalReconstruction. Because the marker image differs from `in`
+/// by a constant, `"hybrid"` is the faster method here.
+///
 /// \see dip::MorphologicalReconstruction, dip::Minima, dip::HMaxima
 inline void HMinima(
       Image const& in,
       Image& out,
       dfloat h,
-      dip::uint connectivity = 0
+      dip::uint connectivity = 0,
+      String const& method = S::HYBRID
 ) {
    Image tmp = Add( in, h, in.DataType() );
-   MorphologicalReconstruction( tmp, in, out, connectivity, S::EROSION );
+   MorphologicalReconstruction( tmp, in, out, connectivity, S::EROSION, method );
 }
 DIP_NODISCARD inline Image HMinima(
       Image const& in,
       dfloat h,
-      dip::uint connectivity = 0
+      dip::uint connectivity = 0,
+      String const& method = S::HYBRID
 ) {
    Image out;
-   HMinima( in, out, h, connectivity );
+   HMinima( in, out, h, connectivity, method );
    return out;
 }
 
@@ -1479,26 +1508,31 @@ DIP_NODISCARD inline Image HMinima(
 /// The H-Maxima filtered image has all local maxima with a height less than `h` removed:
 ///
 /// ```cpp
-/// HMaxima = dip::MorphologicalReconstruction( in - h, in, connectivity, "dilation" );
+/// HMaxima = dip::MorphologicalReconstruction( in - h, in, connectivity, "dilation", method );
 /// ```
 ///
+/// `method` is passed on to \ref dip::MorphologicalReconstruction. Because the marker image differs from `in`
+/// by a constant, `"hybrid"` is the faster method here.
+///
 /// \see dip::MorphologicalReconstruction, dip::Maxima, dip::HMinima
 inline void HMaxima(
       Image const& in,
       Image& out,
       dfloat h,
-      dip::uint connectivity = 0
+      dip::uint connectivity = 0,
+      String const& method = S::HYBRID
 ) {
    Image tmp = Subtract( in, h, in.DataType() );
-   MorphologicalReconstruction( tmp, in, out, connectivity, S::DILATION );
+   MorphologicalReconstruction( tmp, in, out, connectivity, S::DILATION, method );
 }
 DIP_NODISCARD inline Image HMaxima(
       Image const& in,
       dfloat h,
-      dip::uint connectivity = 0
+      dip::uint connectivity = 0,
+      String const& method = S::HYBRID
 ) {
    Image out;
-   HMaxima( in, out, h, connectivity );
+   HMaxima( in, out, h, connectivity, method );
    return out;
 }
 
@@ -1511,20 +1545,24 @@ DIP_NODISCARD inline Image HMaxima(
 /// applied in conjunction with the watershed to reduce the number of regions created. The function \ref dip::SeededWatershed
 /// has a similar result, but obtained in a different way, to applying `dip::Watershed` to the output of `ImposeMinima`.
 ///
+/// `method` is passed on to \ref dip::MorphologicalReconstruction.
+///
 /// \see dip::MorphologicalReconstruction, dip::Minima, dip::Watershed, dip::SeededWatershed
 DIP_EXPORT void ImposeMinima(
       Image const& in,
       Image const& marker,
       Image& out,
-      dip::uint connectivity = 0
+      dip::uint connectivity = 0,
+      String const& method = S::PRIORITY_QUEUE
 );
 DIP_NODISCARD inline Image ImposeMinima(
       Image const& in,
       Image const& marker,
-      dip::uint connectivity = 0
+      dip::uint connectivity = 0,
+      String const& method = S::PRIORITY_QUEUE
 ) {
    Image out;
-   ImposeMinima( in, marker, out, connectivity );
+   ImposeMinima( in, marker, out, connectivity, method );
    return out;
 }
 
@@ -1590,7 +1628,10 @@ DIP_NODISCARD inline Image Leveling(
 /// the algorithm for our fast watershed (`"fast"` mode to \ref dip::Watershed). For binary images, this function calls
 /// \ref dip::BinaryAreaOpening or \ref dip::BinaryAreaClosing.
 ///
-/// \see dip::AreaClosing, dip::VolumeOpening, dip::VolumeClosing, dip::PathOpening, dip::DirectedPathOpening, dip::Opening, dip::Closing, dip::Maxima, dip::Minima, dip::SmallObjectsRemove
+/// To compute area openings of the same image with many different values of `filterSize`, it is more efficient
+/// to construct a \ref dip::MaxTree once, and call \ref dip::MaxTree::AreaFilter for each value.
+///
+/// \see dip::AreaClosing, dip::MaxTree, dip::VolumeOpening, dip::VolumeClosing, dip::PathOpening, dip::DirectedPathOpening, dip::Opening, dip::Closing, dip::Maxima, dip::Minima, dip::SmallObjectsRemove
 ///
 /// !!! literature
 ///     - L. Vincent, "Grayscale area openings and closings, their efficient implementation and applications",
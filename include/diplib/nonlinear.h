@@ -46,6 +46,14 @@ namespace dip {
 /// shape with corresponding sizes, or through a binary image. See \ref dip::Kernel.
 ///
 /// `boundaryCondition` indicates how the boundary should be expanded in each dimension. See \ref dip::BoundaryCondition.
+///
+/// For 2D images of 8-bit or 16-bit integer types, with a rectangular kernel, a histogram-based algorithm is used,
+/// whose cost per pixel is independent of the kernel size (Perreault and Hébert, 2007). For other images and kernels,
+/// the cost per pixel grows with the kernel size.
+///
+/// !!! literature
+///     - S. Perreault and P. Hébert, "Median filtering in constant time", IEEE Transactions on Image Processing
+///       16(9):2389-2394, 2007.
 DIP_EXPORT void PercentileFilter(
       Image const& in,
       Image& out,
@@ -98,7 +106,9 @@ DIP_NODISCARD inline Image MedianFilter(
 ///
 /// `boundaryCondition` indicates how the boundary should be expanded in each dimension. See \ref dip::BoundaryCondition.
 ///
-/// Uses \ref dip::FastVarianceAccumulator for the computation.
+/// Uses \ref dip::FastVarianceAccumulator for the computation. For large rectangular kernels, the sums are
+/// computed through a \ref dip::IntegralImage instead, making the cost independent of the kernel size.
+/// To compute the variance for many different kernel sizes, use \ref dip::IntegralImage directly.
 DIP_EXPORT void VarianceFilter(
       Image const& in,
       Image& out,
@@ -796,6 +806,56 @@ DIP_NODISCARD inline Image SeparableBilateralFilter(
    return out;
 }
 
+/// \brief Bilateral filter using the permutohedral lattice, whose cost does not depend on the sigmas
+///
+/// The bilateral filter is a non-linear edge-preserving smoothing filter. It locally averages input pixels,
+/// weighting them with both the spatial distance to the origin as well as the intensity difference with the
+/// pixel at the origin. The weights are Gaussian, and therefore there are two sigmas as parameters. The
+/// spatial sigma can be defined differently for each image dimension in `spatialSigma`. `tonalSigma` determines
+/// what similar intensities are. Both must be positive.
+///
+/// This version of the filter considers each pixel as a point in a feature space composed of its coordinates
+/// and its value, scaled by the sigmas. The pixel values are accumulated on a sparse lattice (the permutohedral
+/// lattice) in this space, which is then blurred with a small kernel, and the output is interpolated from it, as
+/// described by Adams et al. The computational cost is linear in the number of pixels and quadratic in the
+/// dimensionality of the feature space, but independent of the sigmas. It is thus efficient for large spatial
+/// sigmas. Its result is an approximation to that of \ref dip::FullBilateralFilter.
+///
+/// If `in` is not scalar, the tonal distance between two pixels is the Euclidean distance between their tensor
+/// values. That is, for color images, the color channels are filtered jointly, and false colors are not produced.
+/// Each tensor element adds a dimension to the feature space.
+///
+/// Pixels outside the image domain are not used, the weights are normalized using only pixels within the image.
+/// There is thus no boundary condition parameter.
+///
+/// The optional image `estimate`, if forged, is used as the tonal center when computing the kernel at each pixel.
+/// That is, each point in the kernel is computed based on the distance of the corresponding pixel value in `in`
+/// to the value of the pixel at the origin of the kernel in `estimate`. If not forged, `in` is used for `estimate`.
+/// `estimate` must be real-valued and have the same sizes and number of tensor elements as `in`.
+///
+/// `in` must be real-valued. The output image has a floating-point type.
+///
+/// !!! literature
+///     - A. Adams, J. Baek and M.A. Davis, "Fast high-dimensional filtering using the permutohedral lattice",
+///       Computer Graphics Forum 29(2):753-762, 2010.
+DIP_EXPORT void LatticeBilateralFilter(
+      Image const& in,
+      Image const& estimate,
+      Image& out,
+      FloatArray spatialSigmas = { 2.0 },
+      dfloat tonalSigma = 30.0
+);
+DIP_NODISCARD inline Image LatticeBilateralFilter(
+      Image const& in,
+      Image const& estimate = {},
+      FloatArray spatialSigmas = { 2.0 },
+      dfloat tonalSigma = 30.0
+) {
+   Image out;
+   LatticeBilateralFilter( in, estimate, out, std::move( spatialSigmas ), tonalSigma );
+   return out;
+}
+
 /// \brief Bilateral filter, convenience function that allows selecting an implementation
 ///
 /// The `method` can be set to one of the following:
@@ -804,10 +864,10 @@ DIP_NODISCARD inline Image SeparableBilateralFilter(
 /// - `"xysep"` (default): xy-separable approximation, calls \ref dip::SeparableBilateralFilter.
 /// - `"pwlinear"`: piecewise linear approximation (quantized), calls \ref dip::QuantizedBilateralFilter.
 ///   The bins are automatically computed.
+/// - `"lattice"`: permutohedral lattice approximation, calls \ref dip::LatticeBilateralFilter. `truncation`
+///   and `boundaryCondition` are ignored. Tensor images are filtered jointly.
 ///
 /// See the linked functions for details on the other parameters.
-// TODO: Implement Paris and Durand (2006): http://people.csail.mit.edu/sparis/bf/
-// https://people.csail.mit.edu/sparis/publi/2009/ijcv/Paris_09_Fast_Approximation.pdf
 // TODO: Implement cross-bilateral filter
 // TODO: Implement bilateral filters correctly for tensor images (how to define distance? Simple answer: weigh all tensor elements equally. Is there a reason to do it differently?)
 DIP_EXPORT void BilateralFilter(
@@ -117,7 +117,7 @@ void init_assorted( py::module& m ) {
                               dip::uint dim1,
                               dip::uint dim2 ) {
              return ImageDisplay( input, range, {}, complexMode, projectionMode, coordinates, dim1, dim2 );
-          }, "in"_a, "range"_a = dip::FloatArray{}, "complexMode"_a = "abs", "projectionMode"_a = "mean", "coordinates"_a = dip::UnsignedArray{}, "dim1"_a = 0, "dim2"_a = 1,
+          }, "in"_a, "range"_a = dip::FloatArray{}, "complexMode"_a = "abs", "projectionMode"_a = "mean", "coordinates"_a = dip::UnsignedArray{}, "dim1"_a = 0, "dim2"_a = 1, release_gil(),
           "A function that performs the functionality of the `dip::ImageDisplay` class." );
    m.def( "ImageDisplay", []( dip::Image const& input,
                               dip::String const& mappingMode,
@@ -127,88 +127,88 @@ void init_assorted( py::module& m ) {
                               dip::uint dim1,
                               dip::uint dim2 ) {
              return ImageDisplay( input, {}, mappingMode, complexMode, projectionMode, coordinates, dim1, dim2 );
-          }, "in"_a, "mappingMode"_a, "complexMode"_a = "abs", "projectionMode"_a = "mean", "coordinates"_a = dip::UnsignedArray{}, "dim1"_a = 0, "dim2"_a = 1,
+          }, "in"_a, "mappingMode"_a, "complexMode"_a = "abs", "projectionMode"_a = "mean", "coordinates"_a = dip::UnsignedArray{}, "dim1"_a = 0, "dim2"_a = 1, release_gil(),
           "Overload of the above that allows a `mappingMode` to be given instead of\n"
           "a `range`." );
    m.def( "ApplyColorMap", py::overload_cast< dip::Image const&, dip::String const& >( &dip::ApplyColorMap ),
-          "in"_a, "colorMap"_a = "grey", doc_strings::dip·ApplyColorMap·Image·CL·Image·L·String·CL );
+          "in"_a, "colorMap"_a = "grey", release_gil(), doc_strings::dip·ApplyColorMap·Image·CL·Image·L·String·CL );
    m.def( "ApplyColorMap", py::overload_cast< dip::Image const&, dip::Image&, dip::String const& >( &dip::ApplyColorMap ),
-          "in"_a, py::kw_only(), "out"_a, "colorMap"_a = "grey", doc_strings::dip·ApplyColorMap·Image·CL·Image·L·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "colorMap"_a = "grey", release_gil(), doc_strings::dip·ApplyColorMap·Image·CL·Image·L·String·CL );
    m.def( "Overlay", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image::Pixel const& >( &dip::Overlay ),
-          "in"_a, "overlay"_a, "color"_a = dip::Image::Pixel{ 255, 0, 0 }, doc_strings::dip·Overlay·Image·CL·Image·CL·Image·L·Image·Pixel·CL );
+          "in"_a, "overlay"_a, "color"_a = dip::Image::Pixel{ 255, 0, 0 }, release_gil(), doc_strings::dip·Overlay·Image·CL·Image·CL·Image·L·Image·Pixel·CL );
    m.def( "Overlay", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::Image::Pixel const& >( &dip::Overlay ),
-          "in"_a, "overlay"_a, py::kw_only(), "out"_a, "color"_a = dip::Image::Pixel{ 255, 0, 0 }, doc_strings::dip·Overlay·Image·CL·Image·CL·Image·L·Image·Pixel·CL );
+          "in"_a, "overlay"_a, py::kw_only(), "out"_a, "color"_a = dip::Image::Pixel{ 255, 0, 0 }, release_gil(), doc_strings::dip·Overlay·Image·CL·Image·CL·Image·L·Image·Pixel·CL );
    m.def( "MarkLabelEdges", py::overload_cast< dip::Image const&, dip::uint >( &dip::MarkLabelEdges ),
-          "in"_a, "factor"_a = 2, doc_strings::dip·MarkLabelEdges·Image·CL·Image·L·dip·uint· );
+          "in"_a, "factor"_a = 2, release_gil(), doc_strings::dip·MarkLabelEdges·Image·CL·Image·L·dip·uint· );
    m.def( "MarkLabelEdges", py::overload_cast< dip::Image const&, dip::Image&, dip::uint >( &dip::MarkLabelEdges ),
-          "in"_a, py::kw_only(), "out"_a, "factor"_a = 2, doc_strings::dip·MarkLabelEdges·Image·CL·Image·L·dip·uint· );
+          "in"_a, py::kw_only(), "out"_a, "factor"_a = 2, release_gil(), doc_strings::dip·MarkLabelEdges·Image·CL·Image·L·dip·uint· );
 
    // diplib/file_io.h
    m.def( "ImageReadICS", []( dip::String const& filename, dip::RangeArray const& roi, dip::Range const& channels, dip::String const& mode ) {
       auto out = dip::ImageReadICS( filename, roi, channels, mode );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "mode"_a = "", doc_strings::dip·ImageReadICS·Image·L·String·CL·RangeArray·CL·Range·CL·String·CL );
+   }, "filename"_a, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "mode"_a = "", release_gil(), doc_strings::dip·ImageReadICS·Image·L·String·CL·RangeArray·CL·Range·CL·String·CL );
    m.def( "ImageReadICS", []( dip::Image& out, dip::String const& filename, dip::RangeArray const& roi, dip::Range const& channels, dip::String const& mode ) {
       auto fi = dip::ImageReadICS( out, filename, roi, channels, mode );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "mode"_a = "", doc_strings::dip·ImageReadICS·Image·L·String·CL·RangeArray·CL·Range·CL·String·CL );
+   }, py::kw_only(), "out"_a, "filename"_a, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "mode"_a = "", release_gil(), doc_strings::dip·ImageReadICS·Image·L·String·CL·RangeArray·CL·Range·CL·String·CL );
    m.def( "ImageReadICS", []( dip::String const& filename, dip::UnsignedArray const& origin, dip::UnsignedArray const& sizes, dip::UnsignedArray const& spacing, dip::Range const& channels, dip::String const& mode ) {
       auto out = dip::ImageReadICS( filename, origin, sizes, spacing, channels, mode );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, "origin"_a = dip::UnsignedArray{}, "sizes"_a = dip::UnsignedArray{}, "spacing"_a = dip::UnsignedArray{}, "channels"_a = dip::Range{}, "mode"_a = "", doc_strings::dip·ImageReadICS·Image·L·String·CL·UnsignedArray·CL·UnsignedArray·CL·UnsignedArray·CL·Range·CL·String·CL );
+   }, "filename"_a, "origin"_a = dip::UnsignedArray{}, "sizes"_a = dip::UnsignedArray{}, "spacing"_a = dip::UnsignedArray{}, "channels"_a = dip::Range{}, "mode"_a = "", release_gil(), doc_strings::dip·ImageReadICS·Image·L·String·CL·UnsignedArray·CL·UnsignedArray·CL·UnsignedArray·CL·Range·CL·String·CL );
    m.def( "ImageReadICS", []( dip::Image& out, dip::String const& filename, dip::UnsignedArray const& origin, dip::UnsignedArray const& sizes, dip::UnsignedArray const& spacing, dip::Range const& channels, dip::String const& mode ) {
       auto fi = dip::ImageReadICS( out, filename, origin, sizes, spacing, channels, mode );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, "origin"_a = dip::UnsignedArray{}, "sizes"_a = dip::UnsignedArray{}, "spacing"_a = dip::UnsignedArray{}, "channels"_a = dip::Range{}, "mode"_a = "", doc_strings::dip·ImageReadICS·Image·L·String·CL·UnsignedArray·CL·UnsignedArray·CL·UnsignedArray·CL·Range·CL·String·CL );
+   }, py::kw_only(), "out"_a, "filename"_a, "origin"_a = dip::UnsignedArray{}, "sizes"_a = dip::UnsignedArray{}, "spacing"_a = dip::UnsignedArray{}, "channels"_a = dip::Range{}, "mode"_a = "", release_gil(), doc_strings::dip·ImageReadICS·Image·L·String·CL·UnsignedArray·CL·UnsignedArray·CL·UnsignedArray·CL·Range·CL·String·CL );
    m.def( "ImageReadICSInfo", []( dip::String const& filename ) {
       auto fi = dip::ImageReadICSInfo( filename );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, "filename"_a, doc_strings::dip·ImageReadICSInfo·String·CL );
-   m.def( "ImageIsICS", &dip::ImageIsICS, "filename"_a, doc_strings::dip·ImageIsICS·String·CL );
-   m.def( "ImageWriteICS", []( dip::Image const& image, dip::String const& filename, dip::StringArray const& history, dip::uint significantBits, dip::StringSet const& options ) {
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadICSInfo·String·CL );
+   m.def( "ImageIsICS", &dip::ImageIsICS, "filename"_a, release_gil(), doc_strings::dip·ImageIsICS·String·CL );
+   m.def( "ImageWriteICS", []( dip::Image const& image, dip::String const& filename, dip::StringArray const& history, dip::uint significantBits, dip::StringSet const& options, dip::uint compressionLevel ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
-      dip::ImageWriteICS( tmp, filename, history, significantBits, options );
-   }, "image"_a, "filename"_a, "history"_a = dip::StringArray{}, "significantBits"_a = 0, "options"_a = dip::StringSet{}, doc_strings::dip·ImageWriteICS·Image·CL·String·CL·StringArray·CL·dip·uint··StringSet·CL );
+      dip::ImageWriteICS( tmp, filename, history, significantBits, options, compressionLevel );
+   }, "image"_a, "filename"_a, "history"_a = dip::StringArray{}, "significantBits"_a = 0, "options"_a = dip::StringSet{}, "compressionLevel"_a = 9, release_gil(), doc_strings::dip·ImageWriteICS·Image·CL·String·CL·StringArray·CL·dip·uint··StringSet·CL );
 
    m.def( "ImageReadTIFF", []( dip::String const& filename, dip::Range const& imageNumbers, dip::RangeArray const& roi, dip::Range const& channels, dip::String const& useColorMap ) {
       auto out = dip::ImageReadTIFF( filename, imageNumbers, roi, channels, useColorMap );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, "imageNumbers"_a = dip::Range{ 0 }, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "useColorMap"_a = dip::S::APPLY, doc_strings::dip·ImageReadTIFF·Image·L·String·CL·Range··RangeArray·CL·Range·CL·String·CL );
+   }, "filename"_a, "imageNumbers"_a = dip::Range{ 0 }, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "useColorMap"_a = dip::S::APPLY, release_gil(), doc_strings::dip·ImageReadTIFF·Image·L·String·CL·Range··RangeArray·CL·Range·CL·String·CL );
    m.def( "ImageReadTIFF", []( dip::Image& out, dip::String const& filename, dip::Range const& imageNumbers, dip::RangeArray const& roi, dip::Range const& channels, dip::String const& useColorMap ) {
       auto fi = dip::ImageReadTIFF( out, filename, imageNumbers, roi, channels, useColorMap );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, "imageNumbers"_a = dip::Range{ 0 }, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "useColorMap"_a = dip::S::APPLY, doc_strings::dip·ImageReadTIFF·Image·L·String·CL·Range··RangeArray·CL·Range·CL·String·CL );
+   }, py::kw_only(), "out"_a, "filename"_a, "imageNumbers"_a = dip::Range{ 0 }, "roi"_a = dip::RangeArray{}, "channels"_a = dip::Range{}, "useColorMap"_a = dip::S::APPLY, release_gil(), doc_strings::dip·ImageReadTIFF·Image·L·String·CL·Range··RangeArray·CL·Range·CL·String·CL );
    m.def( "ImageReadTIFFSeries", []( dip::StringArray const& filenames, dip::String const& useColorMap ) {
       auto out = dip::ImageReadTIFFSeries( filenames, useColorMap );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filenames"_a, "useColorMap"_a = dip::S::APPLY, doc_strings::dip·ImageReadTIFFSeries·Image·L·StringArray·CL·String·CL );
+   }, "filenames"_a, "useColorMap"_a = dip::S::APPLY, release_gil(), doc_strings::dip·ImageReadTIFFSeries·Image·L·StringArray·CL·String·CL );
    m.def( "ImageReadTIFFSeries", []( dip::Image& out, dip::StringArray const& filenames, dip::String const& useColorMap ) {
       dip::ImageReadTIFFSeries( out, filenames, useColorMap );
       OptionallyReverseDimensions( out );
-   }, py::kw_only(), "out"_a, "filenames"_a, "useColorMap"_a = dip::S::APPLY, doc_strings::dip·ImageReadTIFFSeries·Image·L·StringArray·CL·String·CL );
+   }, py::kw_only(), "out"_a, "filenames"_a, "useColorMap"_a = dip::S::APPLY, release_gil(), doc_strings::dip·ImageReadTIFFSeries·Image·L·StringArray·CL·String·CL );
    m.def( "ImageReadTIFFInfo", []( dip::String const& filename, dip::uint imageNumber ) {
       auto fi = dip::ImageReadTIFFInfo( filename, imageNumber );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, "filename"_a, "imageNumber"_a = 0, doc_strings::dip·ImageReadTIFFInfo·String·CL·dip·uint· );
-   m.def( "ImageIsTIFF", &dip::ImageIsTIFF, "filename"_a, doc_strings::dip·ImageIsTIFF·String·CL );
+   }, "filename"_a, "imageNumber"_a = 0, release_gil(), doc_strings::dip·ImageReadTIFFInfo·String·CL·dip·uint· );
+   m.def( "ImageIsTIFF", &dip::ImageIsTIFF, "filename"_a, release_gil(), doc_strings::dip·ImageIsTIFF·String·CL );
    m.def( "ImageWriteTIFF", []( dip::Image const& image, dip::String const& filename, dip::String const& compression, dip::uint jpegLevel ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
       dip::ImageWriteTIFF( tmp, filename, compression, jpegLevel );
-   }, "image"_a, "filename"_a, "compression"_a = "", "jpegLevel"_a = 80, doc_strings::dip·ImageWriteTIFF·Image·CL·String·CL·String·CL·dip·uint· );
+   }, "image"_a, "filename"_a, "compression"_a = "", "jpegLevel"_a = 80, release_gil(), doc_strings::dip·ImageWriteTIFF·Image·CL·String·CL·String·CL·dip·uint· );
 
    m.def( "ImageReadJPEG", []( py::bytes* buffer ) {
       auto buf = GetBytesPointerAndLength( buffer );
@@ -227,13 +227,13 @@ void init_assorted( py::module& m ) {
       auto out = dip::ImageReadJPEG( filename );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, doc_strings::dip·ImageReadJPEG·Image·L·String·CL );
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadJPEG·Image·L·String·CL );
    m.def( "ImageReadJPEG", []( dip::Image& out, dip::String const& filename ) {
       auto fi = dip::ImageReadJPEG( out, filename );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, doc_strings::dip·ImageReadJPEG·Image·L·String·CL );
+   }, py::kw_only(), "out"_a, "filename"_a, release_gil(), doc_strings::dip·ImageReadJPEG·Image·L·String·CL );
    m.def( "ImageReadJPEGInfo", []( py::bytes* buffer ) {
       auto buf = GetBytesPointerAndLength( buffer );
       auto fi = dip::ImageReadJPEGInfo( buf.ptr, buf.length );
@@ -244,13 +244,13 @@ void init_assorted( py::module& m ) {
       auto fi = dip::ImageReadJPEGInfo( filename );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, "filename"_a, doc_strings::dip·ImageReadJPEGInfo·String·CL );
-   m.def( "ImageIsJPEG", &dip::ImageIsJPEG, "filename"_a, doc_strings::dip·ImageIsJPEG·String·CL );
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadJPEGInfo·String·CL );
+   m.def( "ImageIsJPEG", &dip::ImageIsJPEG, "filename"_a, release_gil(), doc_strings::dip·ImageIsJPEG·String·CL );
    m.def( "ImageWriteJPEG", []( dip::Image const& image, dip::String const& filename, dip::uint jpegLevel ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
       dip::ImageWriteJPEG( tmp, filename, jpegLevel );
-   }, "image"_a, "filename"_a, "jpegLevel"_a = 80, doc_strings::dip·ImageWriteJPEG·Image·CL·String·CL·dip·uint· );
+   }, "image"_a, "filename"_a, "jpegLevel"_a = 80, release_gil(), doc_strings::dip·ImageWriteJPEG·Image·CL·String·CL·dip·uint· );
    m.def( "ImageWriteJPEG", []( dip::Image const& image, dip::uint jpegLevel ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
@@ -275,13 +275,13 @@ void init_assorted( py::module& m ) {
       auto out = dip::ImageReadPNG( filename );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, doc_strings::dip·ImageReadPNG·Image·L·String·CL );
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadPNG·Image·L·String·CL );
    m.def( "ImageReadPNG", []( dip::Image& out, dip::String const& filename ) {
       auto fi = dip::ImageReadPNG( out, filename );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, doc_strings::dip·ImageReadPNG·Image·L·String·CL );
+   }, py::kw_only(), "out"_a, "filename"_a, release_gil(), doc_strings::dip·ImageReadPNG·Image·L·String·CL );
    m.def( "ImageReadPNGInfo", []( py::bytes* buffer ) {
       auto buf = GetBytesPointerAndLength( buffer );
       auto fi = dip::ImageReadPNGInfo( buf.ptr, buf.length );
@@ -292,8 +292,8 @@ void init_assorted( py::module& m ) {
       auto fi = dip::ImageReadPNGInfo( filename );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, "filename"_a, doc_strings::dip·ImageReadPNGInfo·String·CL );
-   m.def( "ImageIsPNG", &dip::ImageIsPNG, "filename"_a, doc_strings::dip·ImageIsPNG·String·CL );
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadPNGInfo·String·CL );
+   m.def( "ImageIsPNG", &dip::ImageIsPNG, "filename"_a, release_gil(), doc_strings::dip·ImageIsPNG·String·CL );
    m.def( "ImageWritePNG", []( dip::Image const& image,
                                dip::String const& filename,
                                dip::sint compressionLevel,
@@ -302,7 +302,7 @@ void init_assorted( py::module& m ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
       dip::ImageWritePNG( tmp, filename, compressionLevel, filterChoice, significantBits );
-   }, "image"_a, "filename"_a, "compressionLevel"_a = 6, "filterChoice"_a = dip::StringSet{ dip::S::ALL }, "significantBits"_a = 0, doc_strings::dip·ImageWritePNG·Image·CL·String·CL·dip·sint··StringSet·CL·dip·uint· );
+   }, "image"_a, "filename"_a, "compressionLevel"_a = 6, "filterChoice"_a = dip::StringSet{ dip::S::ALL }, "significantBits"_a = 0, release_gil(), doc_strings::dip·ImageWritePNG·Image·CL·String·CL·dip·sint··StringSet·CL·dip·uint· );
    m.def( "ImageWritePNG", []( dip::Image const& image,
                                dip::sint compressionLevel,
                                dip::StringSet const& filterChoice,
@@ -317,138 +317,138 @@ void init_assorted( py::module& m ) {
       auto out = dip::ImageReadNPY( filename );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, doc_strings::dip·ImageReadNPY·Image·L·String·CL );
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadNPY·Image·L·String·CL );
    m.def( "ImageReadNPY", []( dip::Image& out, dip::String const& filename ) {
       auto fi = dip::ImageReadNPY( out, filename );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, doc_strings::dip·ImageReadNPY·Image·L·String·CL );
+   }, py::kw_only(), "out"_a, "filename"_a, release_gil(), doc_strings::dip·ImageReadNPY·Image·L·String·CL );
    m.def( "ImageReadNPYInfo", []( dip::String const& filename ) {
       auto fi = dip::ImageReadNPYInfo( filename );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, "filename"_a, doc_strings::dip·ImageReadNPYInfo·String·CL );
-   m.def( "ImageIsNPY", &dip::ImageIsNPY, "filename"_a, doc_strings::dip·ImageIsNPY·String·CL );
+   }, "filename"_a, release_gil(), doc_strings::dip·ImageReadNPYInfo·String·CL );
+   m.def( "ImageIsNPY", &dip::ImageIsNPY, "filename"_a, release_gil(), doc_strings::dip·ImageIsNPY·String·CL );
    m.def( "ImageWriteNPY", []( dip::Image const& image, dip::String const& filename ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
       dip::ImageWriteNPY( tmp, filename );
-   }, "image"_a, "filename"_a, doc_strings::dip·ImageWriteNPY·Image·CL·String·CL );
+   }, "image"_a, "filename"_a, release_gil(), doc_strings::dip·ImageWriteNPY·Image·CL·String·CL );
 
    // diplib/simple_file_io.h
    m.def( "ImageRead", []( dip::String const& filename, dip::String const& format ) {
       auto out = dip::ImageRead( filename, format );
       OptionallyReverseDimensions( out );
       return out;
-   }, "filename"_a, "format"_a = "", doc_strings::dip·ImageRead·Image·L·String·CL·String· );
+   }, "filename"_a, "format"_a = "", release_gil(), doc_strings::dip·ImageRead·Image·L·String·CL·String· );
    m.def( "ImageRead", []( dip::Image& out, dip::String const& filename, dip::String const& format ) {
       auto fi = dip::ImageRead( out, filename, format );
       OptionallyReverseDimensions( out );
       OptionallyReverseDimensions( fi );
       return fi;
-   }, py::kw_only(), "out"_a, "filename"_a, "format"_a = "", doc_strings::dip·ImageRead·Image·L·String·CL·String· );
+   }, py::kw_only(), "out"_a, "filename"_a, "format"_a = "", release_gil(), doc_strings::dip·ImageRead·Image·L·String·CL·String· );
    m.def( "ImageWrite", []( dip::Image const& image, dip::String const& filename, dip::String const& format, dip::String const& compression ) {
       auto tmp = image;
       OptionallyReverseDimensions( tmp );
       dip::ImageWrite( tmp, filename, format, compression );
-   }, "image"_a, "filename"_a, "format"_a = "", "compression"_a = "", doc_strings::dip·ImageWrite·Image·CL·String·CL·String··String·CL );
+   }, "image"_a, "filename"_a, "format"_a = "", "compression"_a = "", release_gil(), doc_strings::dip·ImageWrite·Image·CL·String·CL·String··String·CL );
 
    // diplib/geometry.h
    m.def( "Wrap", py::overload_cast< dip::Image const&, dip::IntegerArray >( &dip::Wrap ),
-          "in"_a, "wrap"_a, doc_strings::dip·Wrap·Image·CL·Image·L·IntegerArray· );
+          "in"_a, "wrap"_a, release_gil(), doc_strings::dip·Wrap·Image·CL·Image·L·IntegerArray· );
    m.def( "Wrap", py::overload_cast< dip::Image const&, dip::Image&, dip::IntegerArray >( &dip::Wrap ),
-          "in"_a, py::kw_only(), "out"_a, "wrap"_a, doc_strings::dip·Wrap·Image·CL·Image·L·IntegerArray· );
+          "in"_a, py::kw_only(), "out"_a, "wrap"_a, release_gil(), doc_strings::dip·Wrap·Image·CL·Image·L·IntegerArray· );
    m.def( "Subsampling", py::overload_cast< dip::Image const&, dip::UnsignedArray const& >( &dip::Subsampling ),
-          "in"_a, "sample"_a, doc_strings::dip·Subsampling·Image·CL·Image·L·UnsignedArray·CL );
+          "in"_a, "sample"_a, release_gil(), doc_strings::dip·Subsampling·Image·CL·Image·L·UnsignedArray·CL );
    m.def( "Subsampling", py::overload_cast< dip::Image const&, dip::Image&, dip::UnsignedArray const& >( &dip::Subsampling ),
-          "in"_a, py::kw_only(), "out"_a, "sample"_a, doc_strings::dip·Subsampling·Image·CL·Image·L·UnsignedArray·CL );
+          "in"_a, py::kw_only(), "out"_a, "sample"_a, release_gil(), doc_strings::dip·Subsampling·Image·CL·Image·L·UnsignedArray·CL );
    m.def( "Resampling", py::overload_cast< dip::Image const&, dip::FloatArray, dip::FloatArray, dip::String const&, dip::StringArray const& >( &dip::Resampling ),
-          "in"_a, "zoom"_a = dip::FloatArray{ 1.0 }, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·Resampling·Image·CL·Image·L·FloatArray··FloatArray··String·CL·StringArray·CL );
+          "in"_a, "zoom"_a = dip::FloatArray{ 1.0 }, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·Resampling·Image·CL·Image·L·FloatArray··FloatArray··String·CL·StringArray·CL );
    m.def( "Resampling", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray, dip::FloatArray, dip::String const&, dip::StringArray const& >( &dip::Resampling ),
-          "in"_a, py::kw_only(), "out"_a, "zoom"_a = dip::FloatArray{ 1.0 }, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·Resampling·Image·CL·Image·L·FloatArray··FloatArray··String·CL·StringArray·CL );
+          "in"_a, py::kw_only(), "out"_a, "zoom"_a = dip::FloatArray{ 1.0 }, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·Resampling·Image·CL·Image·L·FloatArray··FloatArray··String·CL·StringArray·CL );
    m.def( "Shift", py::overload_cast< dip::Image const&, dip::FloatArray const&, dip::String const&, dip::StringArray const& >( &dip::Shift ),
-          "in"_a, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = dip::S::FOURIER, "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·Shift·Image·CL·Image·L·FloatArray·CL·String·CL·StringArray·CL );
+          "in"_a, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = dip::S::FOURIER, "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·Shift·Image·CL·Image·L·FloatArray·CL·String·CL·StringArray·CL );
    m.def( "Shift", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray const&, dip::String const&, dip::StringArray const& >( &dip::Shift ),
-          "in"_a, py::kw_only(), "out"_a, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = dip::S::FOURIER, "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·Shift·Image·CL·Image·L·FloatArray·CL·String·CL·StringArray·CL );
+          "in"_a, py::kw_only(), "out"_a, "shift"_a = dip::FloatArray{ 0.0 }, "interpolationMethod"_a = dip::S::FOURIER, "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·Shift·Image·CL·Image·L·FloatArray·CL·String·CL·StringArray·CL );
    m.def( "ShiftFT", py::overload_cast< dip::Image const&, dip::FloatArray >( &dip::ShiftFT ),
-          "in"_a, "shift"_a = dip::FloatArray{ 0.0 }, doc_strings::dip·ShiftFT·Image·CL·Image·L·FloatArray· );
+          "in"_a, "shift"_a = dip::FloatArray{ 0.0 }, release_gil(), doc_strings::dip·ShiftFT·Image·CL·Image·L·FloatArray· );
    m.def( "ShiftFT", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray >( &dip::ShiftFT ),
-          "in"_a, py::kw_only(), "out"_a, "shift"_a = dip::FloatArray{ 0.0 }, doc_strings::dip·ShiftFT·Image·CL·Image·L·FloatArray· );
+          "in"_a, py::kw_only(), "out"_a, "shift"_a = dip::FloatArray{ 0.0 }, release_gil(), doc_strings::dip·ShiftFT·Image·CL·Image·L·FloatArray· );
    m.def( "ResampleAt", py::overload_cast< dip::Image const&, dip::FloatCoordinateArray const&, dip::String const&, dip::Image::Pixel const& >( &dip::ResampleAt ),
-          "in"_a, "coordinates"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, doc_strings::dip·ResampleAt·Image·CL·Image·L·FloatCoordinateArray·CL·String·CL·Image·Pixel·CL );
+          "in"_a, "coordinates"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, release_gil(), doc_strings::dip·ResampleAt·Image·CL·Image·L·FloatCoordinateArray·CL·String·CL·Image·Pixel·CL );
    m.def( "ResampleAt", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatCoordinateArray const&, dip::String const&, dip::Image::Pixel const& >( &dip::ResampleAt ),
-          "in"_a, py::kw_only(), "out"_a, "coordinates"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, doc_strings::dip·ResampleAt·Image·CL·Image·L·FloatCoordinateArray·CL·String·CL·Image·Pixel·CL );
+          "in"_a, py::kw_only(), "out"_a, "coordinates"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, release_gil(), doc_strings::dip·ResampleAt·Image·CL·Image·L·FloatCoordinateArray·CL·String·CL·Image·Pixel·CL );
    m.def( "ResampleAt", py::overload_cast< dip::Image const&, dip::FloatArray const&, dip::String const&, dip::Image::Pixel const& >( &dip::ResampleAt ),
-          "in"_a, "coordinates"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, doc_strings::dip·ResampleAt·Image·CL·FloatArray·CL·String·CL·Image·Pixel·CL );
+          "in"_a, "coordinates"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, release_gil(), doc_strings::dip·ResampleAt·Image·CL·FloatArray·CL·String·CL·Image·Pixel·CL );
    m.def( "ResampleAt", py::overload_cast< dip::Image const&, dip::Image const&, dip::String const&, dip::Image::Pixel const& >( &dip::ResampleAt ),
-          "in"_a, "map"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, doc_strings::dip·ResampleAt·Image·CL·Image·CL·Image·L·String·CL·Image·Pixel·CL );
+          "in"_a, "map"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, release_gil(), doc_strings::dip·ResampleAt·Image·CL·Image·CL·Image·L·String·CL·Image·Pixel·CL );
    m.def( "ResampleAt", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::String const&, dip::Image::Pixel const& >( &dip::ResampleAt ),
-          "in"_a, "map"_a, py::kw_only(), "out"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, doc_strings::dip·ResampleAt·Image·CL·Image·CL·Image·L·String·CL·Image·Pixel·CL );
+          "in"_a, "map"_a, py::kw_only(), "out"_a, "method"_a = dip::S::LINEAR, "fill"_a = dip::Image::Pixel{ 0 }, release_gil(), doc_strings::dip·ResampleAt·Image·CL·Image·CL·Image·L·String·CL·Image·Pixel·CL );
    m.def( "Skew", py::overload_cast< dip::Image const&, dip::FloatArray const&, dip::uint, dip::String const&, dip::StringArray const& >( &dip::Skew ),
-          "in"_a, "shearArray"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·Skew·Image·CL·Image·L·FloatArray·CL·dip·uint··String·CL·StringArray·CL );
+          "in"_a, "shearArray"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·Skew·Image·CL·Image·L·FloatArray·CL·dip·uint··String·CL·StringArray·CL );
    m.def( "Skew", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray const&, dip::uint, dip::String const&, dip::StringArray const& >( &dip::Skew ),
-          "in"_a, py::kw_only(), "out"_a, "shearArray"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·Skew·Image·CL·Image·L·FloatArray·CL·dip·uint··String·CL·StringArray·CL );
+          "in"_a, py::kw_only(), "out"_a, "shearArray"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·Skew·Image·CL·Image·L·FloatArray·CL·dip·uint··String·CL·StringArray·CL );
    m.def( "Skew", py::overload_cast< dip::Image const&, dip::dfloat, dip::uint, dip::uint, dip::String const&, dip::String const& >( &dip::Skew ),
-          "in"_a, "shear"_a, "skew"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Skew·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
+          "in"_a, "shear"_a, "skew"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Skew·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
    m.def( "Skew", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::uint, dip::uint, dip::String const&, dip::String const& >( &dip::Skew ),
-          "in"_a, py::kw_only(), "out"_a, "shear"_a, "skew"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Skew·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "shear"_a, "skew"_a, "axis"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Skew·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
    m.def( "Rotation", py::overload_cast< dip::Image const&, dip::dfloat, dip::uint, dip::uint, dip::String const&, dip::String const& >( &dip::Rotation ),
-          "in"_a, "angle"_a, "dimension1"_a, "dimension2"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::S::ADD_ZEROS, doc_strings::dip·Rotation·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
+          "in"_a, "angle"_a, "dimension1"_a, "dimension2"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::S::ADD_ZEROS, release_gil(), doc_strings::dip·Rotation·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
    m.def( "Rotation", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::uint, dip::uint, dip::String const&, dip::String const& >( &dip::Rotation ),
-          "in"_a, py::kw_only(), "out"_a, "angle"_a, "dimension1"_a, "dimension2"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::S::ADD_ZEROS, doc_strings::dip·Rotation·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "angle"_a, "dimension1"_a, "dimension2"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = dip::S::ADD_ZEROS, release_gil(), doc_strings::dip·Rotation·Image·CL·Image·L·dfloat··dip·uint··dip·uint··String·CL·String·CL );
    m.def( "Rotation2D", py::overload_cast< dip::Image const&, dip::dfloat, dip::String const&, dip::String const& >( &dip::Rotation2D ),
-          "in"_a, "angle"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Rotation2D·Image·CL·Image·L·dfloat··String·CL·String·CL );
+          "in"_a, "angle"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Rotation2D·Image·CL·Image·L·dfloat··String·CL·String·CL );
    m.def( "Rotation2D", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::String const&, dip::String const& >( &dip::Rotation2D ),
-          "in"_a, py::kw_only(), "out"_a, "angle"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Rotation2D·Image·CL·Image·L·dfloat··String·CL·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "angle"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Rotation2D·Image·CL·Image·L·dfloat··String·CL·String·CL );
    m.def( "Rotation3D", py::overload_cast< dip::Image const&, dip::dfloat, dip::uint, dip::String const&, dip::String const& >( &dip::Rotation3D ),
-          "in"_a, "angle"_a, "axis"_a = 2, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dip·uint··String·CL·String·CL );
+          "in"_a, "angle"_a, "axis"_a = 2, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dip·uint··String·CL·String·CL );
    m.def( "Rotation3D", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::uint, dip::String const&, dip::String const& >( &dip::Rotation3D ),
-          "in"_a, py::kw_only(), "out"_a, "angle"_a, "axis"_a = 2, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dip·uint··String·CL·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "angle"_a, "axis"_a = 2, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dip·uint··String·CL·String·CL );
    m.def( "Rotation3D", py::overload_cast< dip::Image const&, dip::dfloat, dip::dfloat, dip::dfloat, dip::String const&, dip::String const& >( &dip::Rotation3D ),
-          "in"_a, "alpha"_a, "beta"_a, "gamma"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL·String·CL );
+          "in"_a, "alpha"_a, "beta"_a, "gamma"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL·String·CL );
    m.def( "Rotation3D", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::dfloat, dip::dfloat, dip::String const&, dip::String const& >( &dip::Rotation3D ),
-          "in"_a, py::kw_only(), "out"_a, "alpha"_a, "beta"_a, "gamma"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "alpha"_a, "beta"_a, "gamma"_a, "interpolationMethod"_a = "", "boundaryCondition"_a = "", release_gil(), doc_strings::dip·Rotation3D·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL·String·CL );
    m.def( "RotationMatrix2D", py::overload_cast< dip::dfloat >( &dip::RotationMatrix2D ),
-          "angle"_a, doc_strings::dip·RotationMatrix2D·Image·L·dfloat· );
+          "angle"_a, release_gil(), doc_strings::dip·RotationMatrix2D·Image·L·dfloat· );
    m.def( "RotationMatrix3D", py::overload_cast< dip::dfloat, dip::dfloat, dip::dfloat >( &dip::RotationMatrix3D ),
-          "alpha"_a, "beta"_a, "gamma"_a, doc_strings::dip·RotationMatrix3D·Image·L·dfloat··dfloat··dfloat· );
+          "alpha"_a, "beta"_a, "gamma"_a, release_gil(), doc_strings::dip·RotationMatrix3D·Image·L·dfloat··dfloat··dfloat· );
    m.def( "RotationMatrix3D", py::overload_cast< dip::FloatArray const&, dip::dfloat >( &dip::RotationMatrix3D ),
-          "vector"_a, "angle"_a, doc_strings::dip·RotationMatrix3D·Image·L·FloatArray·CL·dfloat· );
+          "vector"_a, "angle"_a, release_gil(), doc_strings::dip·RotationMatrix3D·Image·L·FloatArray·CL·dfloat· );
    m.def( "AffineTransform", py::overload_cast< dip::Image const&, dip::FloatArray const&, dip::String const& >( &dip::AffineTransform ),
-          "in"_a, "matrix"_a, "interpolationMethod"_a = dip::S::LINEAR, doc_strings::dip·AffineTransform·Image·CL·Image·L·FloatArray·CL·String·CL );
+          "in"_a, "matrix"_a, "interpolationMethod"_a = dip::S::LINEAR, release_gil(), doc_strings::dip·AffineTransform·Image·CL·Image·L·FloatArray·CL·String·CL );
    m.def( "AffineTransform", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray const&, dip::String const& >( &dip::AffineTransform ),
-          "in"_a, py::kw_only(), "out"_a, "matrix"_a, "interpolationMethod"_a = dip::S::LINEAR, doc_strings::dip·AffineTransform·Image·CL·Image·L·FloatArray·CL·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "matrix"_a, "interpolationMethod"_a = dip::S::LINEAR, release_gil(), doc_strings::dip·AffineTransform·Image·CL·Image·L·FloatArray·CL·String·CL );
    m.def( "WarpControlPoints", py::overload_cast< dip::Image const&, dip::FloatCoordinateArray const&, dip::FloatCoordinateArray const&, dip::dfloat, dip::String const& >( &dip::WarpControlPoints ),
-          "in"_a, "inCoordinates"_a, "outCoordinates"_a, "regularizationLambda"_a = 0.0, "interpolationMethod"_a = dip::S::LINEAR, doc_strings::dip·WarpControlPoints·Image·CL·Image·L·FloatCoordinateArray·CL·FloatCoordinateArray·CL·dfloat··String·CL );
+          "in"_a, "inCoordinates"_a, "outCoordinates"_a, "regularizationLambda"_a = 0.0, "interpolationMethod"_a = dip::S::LINEAR, release_gil(), doc_strings::dip·WarpControlPoints·Image·CL·Image·L·FloatCoordinateArray·CL·FloatCoordinateArray·CL·dfloat··String·CL );
    m.def( "WarpControlPoints", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatCoordinateArray const&, dip::FloatCoordinateArray const&, dip::dfloat, dip::String const& >( &dip::WarpControlPoints ),
-          "in"_a, py::kw_only(), "out"_a, "inCoordinates"_a, "outCoordinates"_a, "regularizationLambda"_a = 0.0, "interpolationMethod"_a = dip::S::LINEAR, doc_strings::dip·WarpControlPoints·Image·CL·Image·L·FloatCoordinateArray·CL·FloatCoordinateArray·CL·dfloat··String·CL );
+          "in"_a, py::kw_only(), "out"_a, "inCoordinates"_a, "outCoordinates"_a, "regularizationLambda"_a = 0.0, "interpolationMethod"_a = dip::S::LINEAR, release_gil(), doc_strings::dip·WarpControlPoints·Image·CL·Image·L·FloatCoordinateArray·CL·FloatCoordinateArray·CL·dfloat··String·CL );
    m.def( "LogPolarTransform2D", py::overload_cast< dip::Image const&, dip::String const& >( &dip::LogPolarTransform2D ),
-          "in"_a, "interpolationMethod"_a = dip::S::LINEAR, doc_strings::dip·LogPolarTransform2D·Image·CL·Image·L·String·CL );
+          "in"_a, "interpolationMethod"_a = dip::S::LINEAR, release_gil(), doc_strings::dip·LogPolarTransform2D·Image·CL·Image·L·String·CL );
    m.def( "LogPolarTransform2D", py::overload_cast< dip::Image const&, dip::Image&, dip::String const& >( &dip::LogPolarTransform2D ),
-          "in"_a, py::kw_only(), "out"_a, "interpolationMethod"_a = dip::S::LINEAR, doc_strings::dip·LogPolarTransform2D·Image·CL·Image·L·String·CL );
+          "in"_a, py::kw_only(), "out"_a, "interpolationMethod"_a = dip::S::LINEAR, release_gil(), doc_strings::dip·LogPolarTransform2D·Image·CL·Image·L·String·CL );
 
    m.def( "Tile", py::overload_cast< dip::ImageConstRefArray const&, dip::UnsignedArray >( &dip::Tile ),
-          "in_array"_a, "tiling"_a = dip::UnsignedArray{}, doc_strings::dip·Tile·ImageConstRefArray·CL·Image·L·UnsignedArray· );
+          "in_array"_a, "tiling"_a = dip::UnsignedArray{}, release_gil(), doc_strings::dip·Tile·ImageConstRefArray·CL·Image·L·UnsignedArray· );
    m.def( "Tile", py::overload_cast< dip::ImageConstRefArray const&, dip::Image&, dip::UnsignedArray >( &dip::Tile ),
-          "in_array"_a, py::kw_only(), "out"_a, "tiling"_a = dip::UnsignedArray{}, doc_strings::dip·Tile·ImageConstRefArray·CL·Image·L·UnsignedArray· );
+          "in_array"_a, py::kw_only(), "out"_a, "tiling"_a = dip::UnsignedArray{}, release_gil(), doc_strings::dip·Tile·ImageConstRefArray·CL·Image·L·UnsignedArray· );
    m.def( "TileTensorElements", py::overload_cast< dip::Image const& >( &dip::TileTensorElements ),
-          "in"_a, doc_strings::dip·TileTensorElements·Image·CL·Image·L );
+          "in"_a, release_gil(), doc_strings::dip·TileTensorElements·Image·CL·Image·L );
    m.def( "TileTensorElements", py::overload_cast< dip::Image const&, dip::Image& >( &dip::TileTensorElements ),
-          "in"_a, py::kw_only(), "out"_a, doc_strings::dip·TileTensorElements·Image·CL·Image·L );
+          "in"_a, py::kw_only(), "out"_a, release_gil(), doc_strings::dip·TileTensorElements·Image·CL·Image·L );
    m.def( "Concatenate", py::overload_cast< dip::ImageConstRefArray const&, dip::uint >( &dip::Concatenate ),
-          "in_array"_a, "dimension"_a = 0, doc_strings::dip·Concatenate·ImageConstRefArray·CL·Image·L·dip·uint· );
+          "in_array"_a, "dimension"_a = 0, release_gil(), doc_strings::dip·Concatenate·ImageConstRefArray·CL·Image·L·dip·uint· );
    m.def( "Concatenate", py::overload_cast< dip::ImageConstRefArray const&, dip::Image&, dip::uint >( &dip::Concatenate ),
-          "in_array"_a, py::kw_only(), "out"_a, "dimension"_a = 0, doc_strings::dip·Concatenate·ImageConstRefArray·CL·Image·L·dip·uint· );
+          "in_array"_a, py::kw_only(), "out"_a, "dimension"_a = 0, release_gil(), doc_strings::dip·Concatenate·ImageConstRefArray·CL·Image·L·dip·uint· );
    m.def( "Concatenate", py::overload_cast< dip::Image const&, dip::Image const&, dip::uint >( &dip::Concatenate ),
-          "in1"_a, "in2"_a, "dimension"_a = 0, doc_strings::dip·Concatenate·Image·CL·Image·CL·Image·L·dip·uint· );
+          "in1"_a, "in2"_a, "dimension"_a = 0, release_gil(), doc_strings::dip·Concatenate·Image·CL·Image·CL·Image·L·dip·uint· );
    m.def( "Concatenate", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::uint >( &dip::Concatenate ),
-          "in1"_a, "in2"_a, py::kw_only(), "out"_a, "dimension"_a = 0, doc_strings::dip·Concatenate·Image·CL·Image·CL·Image·L·dip·uint· );
+          "in1"_a, "in2"_a, py::kw_only(), "out"_a, "dimension"_a = 0, release_gil(), doc_strings::dip·Concatenate·Image·CL·Image·CL·Image·L·dip·uint· );
    m.def( "JoinChannels", py::overload_cast< dip::ImageConstRefArray const& >( &dip::JoinChannels ),
-          "in_array"_a, doc_strings::dip·JoinChannels·ImageConstRefArray·CL·Image·L );
+          "in_array"_a, release_gil(), doc_strings::dip·JoinChannels·ImageConstRefArray·CL·Image·L );
    m.def( "JoinChannels", py::overload_cast< dip::ImageConstRefArray const&, dip::Image& >( &dip::JoinChannels ),
-          "in_array"_a, py::kw_only(), "out"_a, doc_strings::dip·JoinChannels·ImageConstRefArray·CL·Image·L );
-   m.def( "SplitChannels", &dip::SplitChannels, "in"_a, doc_strings::dip·SplitChannels·Image·CL );
+          "in_array"_a, py::kw_only(), "out"_a, release_gil(), doc_strings::dip·JoinChannels·ImageConstRefArray·CL·Image·L );
+   m.def( "SplitChannels", &dip::SplitChannels, "in"_a, release_gil(), doc_strings::dip·SplitChannels·Image·CL );
 
    // diplib/testing.h
    auto mtesting = m.def_submodule( "testing", doc_strings::dip·testing );
@@ -26,46 +26,46 @@ void init_generation( py::module& m ) {
 
    // diplib/boundary.h
    m.def( "ExtendImage", py::overload_cast< dip::Image const&, dip::UnsignedArray, dip::StringArray const&, dip::StringSet const& >( &dip::ExtendImage ),
-          "in"_a, "borderSizes"_a, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, doc_strings::dip·ExtendImage·Image·CL·Image·L·UnsignedArray··StringArray·CL·StringSet·CL );
+          "in"_a, "borderSizes"_a, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·ExtendImage·Image·CL·Image·L·UnsignedArray··StringArray·CL·StringSet·CL );
    m.def( "ExtendImage", py::overload_cast< dip::Image const&, dip::Image&, dip::UnsignedArray, dip::StringArray const&, dip::StringSet const& >( &dip::ExtendImage ),
-          "in"_a, py::kw_only(), "out"_a, "borderSizes"_a, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, doc_strings::dip·ExtendImage·Image·CL·Image·L·UnsignedArray··StringArray·CL·StringSet·CL );
+          "in"_a, py::kw_only(), "out"_a, "borderSizes"_a, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·ExtendImage·Image·CL·Image·L·UnsignedArray··StringArray·CL·StringSet·CL );
    m.def( "ExtendImageToSize", py::overload_cast< dip::Image const&, dip::UnsignedArray const&, dip::String const&, dip::StringArray const&, dip::StringSet const& >( &dip::ExtendImageToSize ),
-          "in"_a, "sizes"_a, "cropLocation"_a = dip::S::CENTER, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, doc_strings::dip·ExtendImageToSize·Image·CL·Image·L·UnsignedArray·CL·String·CL·StringArray·CL·StringSet·CL );
+          "in"_a, "sizes"_a, "cropLocation"_a = dip::S::CENTER, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·ExtendImageToSize·Image·CL·Image·L·UnsignedArray·CL·String·CL·StringArray·CL·StringSet·CL );
    m.def( "ExtendImageToSize", py::overload_cast< dip::Image const&, dip::Image&, dip::UnsignedArray const&, dip::String const&, dip::StringArray const&, dip::StringSet const& >( &dip::ExtendImageToSize ),
-          "in"_a, py::kw_only(), "out"_a, "sizes"_a, "cropLocation"_a = dip::S::CENTER, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, doc_strings::dip·ExtendImageToSize·Image·CL·Image·L·UnsignedArray·CL·String·CL·StringArray·CL·StringSet·CL );
+          "in"_a, py::kw_only(), "out"_a, "sizes"_a, "cropLocation"_a = dip::S::CENTER, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·ExtendImageToSize·Image·CL·Image·L·UnsignedArray·CL·String·CL·StringArray·CL·StringSet·CL );
    m.def( "ExtendRegion", py::overload_cast< dip::Image&, dip::RangeArray const&, dip::StringArray const& >( &dip::ExtendRegion ),
-          "image"_a, "ranges"_a, "boundaryCondition"_a = dip::StringArray{}, doc_strings::dip·ExtendRegion·Image·L·RangeArray·CL·StringArray·CL );
+          "image"_a, "ranges"_a, "boundaryCondition"_a = dip::StringArray{}, release_gil(), doc_strings::dip·ExtendRegion·Image·L·RangeArray·CL·StringArray·CL );
 
    // diplib/generation.h
    m.def( "SetBorder", &dip::SetBorder,
-          "out"_a, "value"_a = dip::Image::Pixel{ 0 }, "sizes"_a = dip::UnsignedArray{ 1 }, doc_strings::dip·SetBorder·Image·L·Image·Pixel·CL·UnsignedArray·CL );
+          "out"_a, "value"_a = dip::Image::Pixel{ 0 }, "sizes"_a = dip::UnsignedArray{ 1 }, release_gil(), doc_strings::dip·SetBorder·Image·L·Image·Pixel·CL·UnsignedArray·CL );
    m.def( "ApplyWindow", py::overload_cast< dip::Image const&, dip::String const&, dip::dfloat >( &dip::ApplyWindow ),
-          "in"_a, "type"_a = "Hamming", "parameter"_a = 0.5, doc_strings::dip·ApplyWindow·Image·CL·Image·L·String·CL·dfloat· );
+          "in"_a, "type"_a = "Hamming", "parameter"_a = 0.5, release_gil(), doc_strings::dip·ApplyWindow·Image·CL·Image·L·String·CL·dfloat· );
    m.def( "ApplyWindow", py::overload_cast< dip::Image const&, dip::Image&, dip::String const&, dip::dfloat >( &dip::ApplyWindow ),
-          "in"_a, py::kw_only(), "out"_a, "type"_a = "Hamming", "parameter"_a = 0.5, doc_strings::dip·ApplyWindow·Image·CL·Image·L·String·CL·dfloat· );
+          "in"_a, py::kw_only(), "out"_a, "type"_a = "Hamming", "parameter"_a = 0.5, release_gil(), doc_strings::dip·ApplyWindow·Image·CL·Image·L·String·CL·dfloat· );
 
    m.def( "DrawLine", &dip::DrawLine,
-          "out"_a, "start"_a, "end"_a, "value"_a = dip::Image::Pixel{ 1 }, "blend"_a = dip::S::ASSIGN, doc_strings::dip·DrawLine·Image·L·UnsignedArray·CL·UnsignedArray·CL·Image·Pixel·CL·String·CL );
+          "out"_a, "start"_a, "end"_a, "value"_a = dip::Image::Pixel{ 1 }, "blend"_a = dip::S::ASSIGN, release_gil(), doc_strings::dip·DrawLine·Image·L·UnsignedArray·CL·UnsignedArray·CL·Image·Pixel·CL·String·CL );
    m.def( "DrawLines", &dip::DrawLines,
-          "out"_a, "points"_a, "value"_a = dip::Image::Pixel{ 1 }, "blend"_a = dip::S::ASSIGN, doc_strings::dip·DrawLines·Image·L·CoordinateArray·CL·Image·Pixel·CL·String·CL );
+          "out"_a, "points"_a, "value"_a = dip::Image::Pixel{ 1 }, "blend"_a = dip::S::ASSIGN, release_gil(), doc_strings::dip·DrawLines·Image·L·CoordinateArray·CL·Image·Pixel·CL·String·CL );
    m.def( "DrawPolygon2D", &dip::DrawPolygon2D,
-          "out"_a, "polygon"_a, "value"_a = dip::Image::Pixel{ 1 }, "mode"_a = dip::S::FILLED, doc_strings::dip·DrawPolygon2D·Image·L·Polygon·CL·Image·Pixel·CL·String·CL );
+          "out"_a, "polygon"_a, "value"_a = dip::Image::Pixel{ 1 }, "mode"_a = dip::S::FILLED, release_gil(), doc_strings::dip·DrawPolygon2D·Image·L·Polygon·CL·Image·Pixel·CL·String·CL );
    m.def( "DrawEllipsoid", &dip::DrawEllipsoid,
-          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, doc_strings::dip·DrawEllipsoid·Image·L·FloatArray·CL·FloatArray·CL·Image·Pixel·CL );
+          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, release_gil(), doc_strings::dip·DrawEllipsoid·Image·L·FloatArray·CL·FloatArray·CL·Image·Pixel·CL );
    m.def( "DrawDiamond", &dip::DrawDiamond,
-          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, doc_strings::dip·DrawDiamond·Image·L·FloatArray·CL·FloatArray·CL·Image·Pixel·CL );
+          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, release_gil(), doc_strings::dip·DrawDiamond·Image·L·FloatArray·CL·FloatArray·CL·Image·Pixel·CL );
    m.def( "DrawBox", &dip::DrawBox,
-          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, doc_strings::dip·DrawBox·Image·L·FloatArray·CL·FloatArray·CL·Image·Pixel·CL );
+          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, release_gil(), doc_strings::dip·DrawBox·Image·L·FloatArray·CL·FloatArray·CL·Image·Pixel·CL );
    m.def( "DrawBandlimitedPoint", &dip::DrawBandlimitedPoint,
-          "out"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigmas"_a = dip::FloatArray{ 1.0 }, "truncation"_a = 3.0, doc_strings::dip·DrawBandlimitedPoint·Image·L·FloatArray··Image·Pixel·CL·FloatArray··dfloat· );
+          "out"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigmas"_a = dip::FloatArray{ 1.0 }, "truncation"_a = 3.0, release_gil(), doc_strings::dip·DrawBandlimitedPoint·Image·L·FloatArray··Image·Pixel·CL·FloatArray··dfloat· );
    m.def( "DrawBandlimitedLine", &dip::DrawBandlimitedLine,
-          "out"_a, "start"_a, "end"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·DrawBandlimitedLine·Image·L·FloatArray··FloatArray··Image·Pixel·CL·dfloat··dfloat· );
+          "out"_a, "start"_a, "end"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·DrawBandlimitedLine·Image·L·FloatArray··FloatArray··Image·Pixel·CL·dfloat··dfloat· );
    m.def( "DrawBandlimitedBall", &dip::DrawBandlimitedBall,
-          "out"_a, "diameter"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "mode"_a = dip::S::FILLED, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·DrawBandlimitedBall·Image·L·dfloat··FloatArray··Image·Pixel·CL·String·CL·dfloat··dfloat· );
+          "out"_a, "diameter"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "mode"_a = dip::S::FILLED, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·DrawBandlimitedBall·Image·L·dfloat··FloatArray··Image·Pixel·CL·String·CL·dfloat··dfloat· );
    m.def( "DrawBandlimitedBox", &dip::DrawBandlimitedBox,
-          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "mode"_a = dip::S::FILLED, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·DrawBandlimitedBox·Image·L·FloatArray··FloatArray··Image·Pixel·CL·String·CL·dfloat··dfloat· );
+          "out"_a, "sizes"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "mode"_a = dip::S::FILLED, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·DrawBandlimitedBox·Image·L·FloatArray··FloatArray··Image·Pixel·CL·String·CL·dfloat··dfloat· );
    m.def( "BlendBandlimitedMask", &dip::BlendBandlimitedMask,
-          "out"_a, "mask"_a, "value"_a = dip::Image( { 255 } ), "pos"_a = dip::IntegerArray{}, doc_strings::dip·BlendBandlimitedMask·Image·L·Image·CL·Image·CL·IntegerArray· );
+          "out"_a, "mask"_a, "value"_a = dip::Image( { 255 } ), "pos"_a = dip::IntegerArray{}, release_gil(), doc_strings::dip·BlendBandlimitedMask·Image·L·Image·CL·Image·CL·IntegerArray· );
    m.def( "DrawText", []( dip::Image& out,
                           dip::String const& text,
                           dip::FloatArray const& origin,
@@ -77,59 +77,59 @@ void init_generation( py::module& m ) {
              dip::FreeTypeTool freeTypeTool( font );
              freeTypeTool.SetSize( size );
              freeTypeTool.DrawText( out, text, origin, value, orientation, align );
-          }, "out"_a, "text"_a, "origin"_a, "font"_a, "size"_a = 12.0, "value"_a = dip::Image::Pixel{ 1 }, "orientation"_a = 0, "align"_a = dip::S::LEFT,
+          }, "out"_a, "text"_a, "origin"_a, "font"_a, "size"_a = 12.0, "value"_a = dip::Image::Pixel{ 1 }, "orientation"_a = 0, "align"_a = dip::S::LEFT, release_gil(),
           "Function that calls `dip::FreeTypeTool::DrawText`." );
    m.def( "DrawText", []( dip::String const& text, dip::String const& font, dip::dfloat size, dip::dfloat orientation ) {
              dip::FreeTypeTool freeTypeTool( font );
              freeTypeTool.SetSize( size );
              return freeTypeTool.DrawText( text, orientation ).image;
-          }, "text"_a, "font"_a, "size"_a = 12.0, "orientation"_a = 0,
+          }, "text"_a, "font"_a, "size"_a = 12.0, "orientation"_a = 0, release_gil(),
           "Function that calls the alternate version of `dip::FreeTypeTool::DrawText`,\n"
           "returning a tightly cropped image around the rendered text." );
    m.def( "DrawText", py::overload_cast< dip::Image&, dip::String const&, dip::FloatArray, dip::Image::Pixel const&, dip::dfloat, dip::String const& >( &dip::DrawText ),
-          "out"_a, "text"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "orientation"_a = 0, "align"_a = dip::S::LEFT, doc_strings::dip·DrawText·Image·L·String·CL·FloatArray··Image·Pixel·CL·dfloat··String·CL );
-   m.def( "DrawText", py::overload_cast< dip::String const&, dip::dfloat >( &dip::DrawText ), "text"_a, "orientation"_a = 0, doc_strings::dip·DrawText·String·CL·dfloat· );
+          "out"_a, "text"_a, "origin"_a, "value"_a = dip::Image::Pixel{ 1 }, "orientation"_a = 0, "align"_a = dip::S::LEFT, release_gil(), doc_strings::dip·DrawText·Image·L·String·CL·FloatArray··Image·Pixel·CL·dfloat··String·CL );
+   m.def( "DrawText", py::overload_cast< dip::String const&, dip::dfloat >( &dip::DrawText ), "text"_a, "orientation"_a = 0, release_gil(), doc_strings::dip·DrawText·String·CL·dfloat· );
 
    m.def( "GaussianEdgeClip", py::overload_cast< dip::Image const&, dip::Image::Pixel const&, dip::dfloat, dip::dfloat >( &dip::GaussianEdgeClip ),
-          "in"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·GaussianEdgeClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
+          "in"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·GaussianEdgeClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
    m.def( "GaussianEdgeClip", py::overload_cast< dip::Image const&, dip::Image&, dip::Image::Pixel const&, dip::dfloat, dip::dfloat >( &dip::GaussianEdgeClip ),
-          "in"_a, py::kw_only(), "out"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·GaussianEdgeClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
+          "in"_a, py::kw_only(), "out"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·GaussianEdgeClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
    m.def( "GaussianLineClip", py::overload_cast< dip::Image const&, dip::Image::Pixel const&, dip::dfloat, dip::dfloat >( &dip::GaussianLineClip ),
-          "in"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·GaussianLineClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
+          "in"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·GaussianLineClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
    m.def( "GaussianLineClip", py::overload_cast< dip::Image const&, dip::Image&, dip::Image::Pixel const&, dip::dfloat, dip::dfloat >( &dip::GaussianLineClip ),
-          "in"_a, py::kw_only(), "out"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, doc_strings::dip·GaussianLineClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
+          "in"_a, py::kw_only(), "out"_a, "value"_a = dip::Image::Pixel{ 1 }, "sigma"_a = 1.0, "truncation"_a = 3.0, release_gil(), doc_strings::dip·GaussianLineClip·Image·CL·Image·L·Image·Pixel·CL·dfloat··dfloat· );
 
    m.def( "FillDelta", &dip::FillDelta,
-          "out"_a, "origin"_a = "", doc_strings::dip·FillDelta·Image·L·String·CL );
+          "out"_a, "origin"_a = "", release_gil(), doc_strings::dip·FillDelta·Image·L·String·CL );
    m.def( "CreateDelta", py::overload_cast< dip::UnsignedArray const&, dip::String const& >( &dip::CreateDelta ),
-          "sizes"_a, "origin"_a = "", doc_strings::dip·CreateDelta·UnsignedArray·CL·String·CL );
+          "sizes"_a, "origin"_a = "", release_gil(), doc_strings::dip·CreateDelta·UnsignedArray·CL·String·CL );
    m.def( "CreateDelta", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::String const& >( &dip::CreateDelta ),
-          py::kw_only(), "out"_a, "sizes"_a, "origin"_a = "", doc_strings::dip·CreateDelta·Image·L·UnsignedArray·CL·String·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "origin"_a = "", release_gil(), doc_strings::dip·CreateDelta·Image·L·UnsignedArray·CL·String·CL );
    m.def( "CreateGauss", py::overload_cast< dip::FloatArray const&, dip::UnsignedArray, dip::dfloat, dip::UnsignedArray >( &dip::CreateGauss ),
-          "sigmas"_a, "order"_a = dip::UnsignedArray{ 0 }, "truncation"_a = 3.0, "exponents"_a = dip::UnsignedArray{ 0 }, doc_strings::dip·CreateGauss·Image·L·FloatArray·CL·UnsignedArray··dfloat··UnsignedArray· );
+          "sigmas"_a, "order"_a = dip::UnsignedArray{ 0 }, "truncation"_a = 3.0, "exponents"_a = dip::UnsignedArray{ 0 }, release_gil(), doc_strings::dip·CreateGauss·Image·L·FloatArray·CL·UnsignedArray··dfloat··UnsignedArray· );
    m.def( "CreateGauss", py::overload_cast< dip::Image&, dip::FloatArray const&, dip::UnsignedArray, dip::dfloat, dip::UnsignedArray >( &dip::CreateGauss ),
-          py::kw_only(), "out"_a, "sigmas"_a, "order"_a = dip::UnsignedArray{ 0 }, "truncation"_a = 3.0, "exponents"_a = dip::UnsignedArray{ 0 }, doc_strings::dip·CreateGauss·Image·L·FloatArray·CL·UnsignedArray··dfloat··UnsignedArray· );
+          py::kw_only(), "out"_a, "sigmas"_a, "order"_a = dip::UnsignedArray{ 0 }, "truncation"_a = 3.0, "exponents"_a = dip::UnsignedArray{ 0 }, release_gil(), doc_strings::dip·CreateGauss·Image·L·FloatArray·CL·UnsignedArray··dfloat··UnsignedArray· );
    m.def( "CreateGabor", py::overload_cast< dip::FloatArray const&, dip::FloatArray const&, dip::dfloat >( &dip::CreateGabor ),
-          "sigmas"_a, "frequencies"_a, "truncation"_a = 3.0, doc_strings::dip·CreateGabor·Image·L·FloatArray·CL·FloatArray·CL·dfloat· );
+          "sigmas"_a, "frequencies"_a, "truncation"_a = 3.0, release_gil(), doc_strings::dip·CreateGabor·Image·L·FloatArray·CL·FloatArray·CL·dfloat· );
    m.def( "CreateGabor", py::overload_cast< dip::Image&, dip::FloatArray const&, dip::FloatArray const&, dip::dfloat >( &dip::CreateGabor ),
-          py::kw_only(), "out"_a, "sigmas"_a, "frequencies"_a, "truncation"_a = 3.0, doc_strings::dip·CreateGabor·Image·L·FloatArray·CL·FloatArray·CL·dfloat· );
+          py::kw_only(), "out"_a, "sigmas"_a, "frequencies"_a, "truncation"_a = 3.0, release_gil(), doc_strings::dip·CreateGabor·Image·L·FloatArray·CL·FloatArray·CL·dfloat· );
 
    m.def( "FTEllipsoid", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray, dip::dfloat >( &dip::FTEllipsoid ),
-          "sizes"_a, "radius"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, doc_strings::dip·FTEllipsoid·UnsignedArray·CL·FloatArray··dfloat· );
+          "sizes"_a, "radius"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, release_gil(), doc_strings::dip·FTEllipsoid·UnsignedArray·CL·FloatArray··dfloat· );
    m.def( "FTEllipsoid", py::overload_cast< dip::Image&, dip::FloatArray, dip::dfloat >( &dip::FTEllipsoid ),
-          py::kw_only(), "out"_a, "radius"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, doc_strings::dip·FTEllipsoid·Image·L·FloatArray··dfloat· );
+          py::kw_only(), "out"_a, "radius"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, release_gil(), doc_strings::dip·FTEllipsoid·Image·L·FloatArray··dfloat· );
    m.def( "FTBox", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray, dip::dfloat >( &dip::FTBox ),
-          "sizes"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, doc_strings::dip·FTBox·UnsignedArray·CL·FloatArray··dfloat· );
+          "sizes"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, release_gil(), doc_strings::dip·FTBox·UnsignedArray·CL·FloatArray··dfloat· );
    m.def( "FTBox", py::overload_cast< dip::Image&, dip::FloatArray, dip::dfloat >( &dip::FTBox ),
-          py::kw_only(), "out"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, doc_strings::dip·FTBox·Image·L·FloatArray··dfloat· );
+          py::kw_only(), "out"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, release_gil(), doc_strings::dip·FTBox·Image·L·FloatArray··dfloat· );
    m.def( "FTCross", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray, dip::dfloat >( &dip::FTCross ),
-          "sizes"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, doc_strings::dip·FTCross·UnsignedArray·CL·FloatArray··dfloat· );
+          "sizes"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, release_gil(), doc_strings::dip·FTCross·UnsignedArray·CL·FloatArray··dfloat· );
    m.def( "FTCross", py::overload_cast< dip::Image&, dip::FloatArray, dip::dfloat >( &dip::FTCross ),
-          py::kw_only(), "out"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, doc_strings::dip·FTCross·Image·L·FloatArray··dfloat· );
+          py::kw_only(), "out"_a, "length"_a = dip::FloatArray{ 1 }, "amplitude"_a = 1, release_gil(), doc_strings::dip·FTCross·Image·L·FloatArray··dfloat· );
    m.def( "FTGaussian", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray, dip::dfloat, dip::dfloat >( &dip::FTGaussian ),
-          "sizes"_a, "sigma"_a, "amplitude"_a = 1, "truncation"_a = 3, doc_strings::dip·FTGaussian·UnsignedArray·CL·FloatArray··dfloat··dfloat· );
+          "sizes"_a, "sigma"_a, "amplitude"_a = 1, "truncation"_a = 3, release_gil(), doc_strings::dip·FTGaussian·UnsignedArray·CL·FloatArray··dfloat··dfloat· );
    m.def( "FTGaussian", py::overload_cast< dip::Image&, dip::FloatArray, dip::dfloat, dip::dfloat >( &dip::FTGaussian ),
-          py::kw_only(), "out"_a, "sigma"_a, "amplitude"_a = 1, "truncation"_a = 3, doc_strings::dip·FTGaussian·Image·L·FloatArray··dfloat··dfloat· );
+          py::kw_only(), "out"_a, "sigma"_a, "amplitude"_a = 1, "truncation"_a = 3, release_gil(), doc_strings::dip·FTGaussian·Image·L·FloatArray··dfloat··dfloat· );
    m.def( "TestObject", [](
                 dip::UnsignedArray const& sizes,
                 dip::String objectShape,
@@ -265,73 +265,73 @@ void init_generation( py::module& m ) {
           "Like the C++ function, but using an internal `dip::Random` object." );
 
    m.def( "FillRamp", &dip::FillRamp,
-          "out"_a, "dimension"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillRamp·Image·L·dip·uint··StringSet·CL );
+          "out"_a, "dimension"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillRamp·Image·L·dip·uint··StringSet·CL );
    m.def( "CreateRamp", py::overload_cast< dip::UnsignedArray const&, dip::uint, dip::StringSet const& >( &dip::CreateRamp ),
-          "sizes"_a, "dimension"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateRamp·Image·L·UnsignedArray·CL·dip·uint··StringSet·CL );
+          "sizes"_a, "dimension"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateRamp·Image·L·UnsignedArray·CL·dip·uint··StringSet·CL );
    m.def( "CreateRamp", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::uint, dip::StringSet const& >( &dip::CreateRamp ),
-          py::kw_only(), "out"_a, "sizes"_a, "dimension"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateRamp·Image·L·UnsignedArray·CL·dip·uint··StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "dimension"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateRamp·Image·L·UnsignedArray·CL·dip·uint··StringSet·CL );
    m.def( "FillXCoordinate", &dip::FillXCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillXCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillXCoordinate·Image·L·StringSet·CL );
    m.def( "CreateXCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateXCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateXCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateXCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreateXCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateXCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateXCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateXCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillYCoordinate", &dip::FillYCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillYCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillYCoordinate·Image·L·StringSet·CL );
    m.def( "CreateYCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateYCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateYCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateYCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreateYCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateYCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateYCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateYCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillZCoordinate", &dip::FillZCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillZCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillZCoordinate·Image·L·StringSet·CL );
    m.def( "CreateZCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateZCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateZCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateZCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreateZCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateZCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateZCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateZCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillRadiusCoordinate", &dip::FillRadiusCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillRadiusCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillRadiusCoordinate·Image·L·StringSet·CL );
    m.def( "CreateRadiusCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateRadiusCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateRadiusCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateRadiusCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreateRadiusCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateRadiusCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateRadiusCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateRadiusCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillRadiusSquareCoordinate", &dip::FillRadiusSquareCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillRadiusSquareCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillRadiusSquareCoordinate·Image·L·StringSet·CL );
    m.def( "CreateRadiusSquareCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateRadiusSquareCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateRadiusSquareCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateRadiusSquareCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreateRadiusSquareCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateRadiusSquareCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateRadiusSquareCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateRadiusSquareCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillPhiCoordinate", &dip::FillPhiCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillPhiCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillPhiCoordinate·Image·L·StringSet·CL );
    m.def( "CreatePhiCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreatePhiCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreatePhiCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreatePhiCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreatePhiCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreatePhiCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreatePhiCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreatePhiCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillThetaCoordinate", &dip::FillThetaCoordinate,
-          "out"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·FillThetaCoordinate·Image·L·StringSet·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·FillThetaCoordinate·Image·L·StringSet·CL );
    m.def( "CreateThetaCoordinate", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateThetaCoordinate ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateThetaCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateThetaCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "CreateThetaCoordinate", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const& >( &dip::CreateThetaCoordinate ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, doc_strings::dip·CreateThetaCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, release_gil(), doc_strings::dip·CreateThetaCoordinate·Image·L·UnsignedArray·CL·StringSet·CL );
    m.def( "FillCoordinates", &dip::FillCoordinates,
-          "out"_a, "mode"_a = dip::StringSet{}, "system"_a = dip::S::CARTESIAN, doc_strings::dip·FillCoordinates·Image·L·StringSet·CL·String·CL );
+          "out"_a, "mode"_a = dip::StringSet{}, "system"_a = dip::S::CARTESIAN, release_gil(), doc_strings::dip·FillCoordinates·Image·L·StringSet·CL·String·CL );
    m.def( "CreateCoordinates", py::overload_cast< dip::UnsignedArray const&, dip::StringSet const&, dip::String const& >( &dip::CreateCoordinates ),
-          "sizes"_a, "mode"_a = dip::StringSet{}, "system"_a = dip::S::CARTESIAN, doc_strings::dip·CreateCoordinates·Image·L·UnsignedArray·CL·StringSet·CL·String·CL );
+          "sizes"_a, "mode"_a = dip::StringSet{}, "system"_a = dip::S::CARTESIAN, release_gil(), doc_strings::dip·CreateCoordinates·Image·L·UnsignedArray·CL·StringSet·CL·String·CL );
    m.def( "CreateCoordinates", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::StringSet const&, dip::String const& >( &dip::CreateCoordinates ),
-          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, "system"_a = dip::S::CARTESIAN, doc_strings::dip·CreateCoordinates·Image·L·UnsignedArray·CL·StringSet·CL·String·CL );
+          py::kw_only(), "out"_a, "sizes"_a, "mode"_a = dip::StringSet{}, "system"_a = dip::S::CARTESIAN, release_gil(), doc_strings::dip·CreateCoordinates·Image·L·UnsignedArray·CL·StringSet·CL·String·CL );
    m.def( "FillDistanceToPoint", &dip::FillDistanceToPoint,
-          "out"_a, "point"_a, "distance"_a = dip::S::EUCLIDEAN, "scaling"_a = dip::FloatArray{}, doc_strings::dip·FillDistanceToPoint·Image·L·FloatArray·CL·String·CL·FloatArray· );
+          "out"_a, "point"_a, "distance"_a = dip::S::EUCLIDEAN, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·FillDistanceToPoint·Image·L·FloatArray·CL·String·CL·FloatArray· );
    m.def( "DistanceToPoint", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray const&, dip::String const&, dip::FloatArray >( &dip::DistanceToPoint ),
-          "sizes"_a, "point"_a, "distance"_a = dip::S::EUCLIDEAN, "scaling"_a = dip::FloatArray{}, doc_strings::dip·DistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·String·CL·FloatArray· );
+          "sizes"_a, "point"_a, "distance"_a = dip::S::EUCLIDEAN, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·DistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·String·CL·FloatArray· );
    m.def( "DistanceToPoint", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::FloatArray const&, dip::String const&, dip::FloatArray >( &dip::DistanceToPoint ),
-          py::kw_only(), "out"_a, "sizes"_a, "point"_a, "distance"_a = dip::S::EUCLIDEAN, "scaling"_a = dip::FloatArray{}, doc_strings::dip·DistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·String·CL·FloatArray· );
+          py::kw_only(), "out"_a, "sizes"_a, "point"_a, "distance"_a = dip::S::EUCLIDEAN, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·DistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·String·CL·FloatArray· );
    m.def( "EuclideanDistanceToPoint", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray const&, dip::FloatArray >( &dip::EuclideanDistanceToPoint ),
-          "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, doc_strings::dip·EuclideanDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
+          "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·EuclideanDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
    m.def( "EuclideanDistanceToPoint", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::FloatArray const&, dip::FloatArray >( &dip::EuclideanDistanceToPoint ),
-          py::kw_only(), "out"_a, "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, doc_strings::dip·EuclideanDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
+          py::kw_only(), "out"_a, "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·EuclideanDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
    m.def( "CityBlockDistanceToPoint", py::overload_cast< dip::UnsignedArray const&, dip::FloatArray const&, dip::FloatArray >( &dip::CityBlockDistanceToPoint ),
-          "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, doc_strings::dip·CityBlockDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
+          "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·CityBlockDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
    m.def( "CityBlockDistanceToPoint", py::overload_cast< dip::Image&, dip::UnsignedArray const&, dip::FloatArray const&, dip::FloatArray >( &dip::CityBlockDistanceToPoint ),
-          py::kw_only(), "out"_a, "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, doc_strings::dip·CityBlockDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
+          py::kw_only(), "out"_a, "sizes"_a, "point"_a, "scaling"_a = dip::FloatArray{}, release_gil(), doc_strings::dip·CityBlockDistanceToPoint·Image·L·UnsignedArray·CL·FloatArray·CL·FloatArray· );
 
    m.def( "UniformNoise", []( dip::Image const& in, dip::dfloat lowerBound, dip::dfloat upperBound ) {
              return dip::UniformNoise( in, RandomNumberGenerator(), lowerBound, upperBound );
@@ -159,7 +159,7 @@ void init_histogram( py::module& m ) {
    hist.def( "OptimalConfigurationWithFullRange", &dip::Histogram::OptimalConfigurationWithFullRange, doc_strings::dip·Histogram·OptimalConfigurationWithFullRange );
 
    hist.def( py::init< dip::Image const&, dip::Image const&, dip::Histogram::ConfigurationArray >(),
-             "input"_a, "mask"_a = dip::Image{}, "configuration"_a = dip::Histogram::ConfigurationArray{}, doc_strings::dip·Histogram·Histogram·Image·CL·Image·CL·ConfigurationArray· );
+             "input"_a, "mask"_a = dip::Image{}, "configuration"_a = dip::Histogram::ConfigurationArray{}, release_gil(), doc_strings::dip·Histogram·Histogram·Image·CL·Image·CL·ConfigurationArray· );
    hist.def( py::init( []( dip::Image const& input, dip::Image const& mask, dip::FloatArray const& bounds, dip::uint nBins, bool boundsArePercentile ) {
                 DIP_THROW_IF( bounds.size() != 2, dip::E::ARRAY_PARAMETER_WRONG_LENGTH );
                 dip::Histogram::Configuration config( bounds[ 0 ], bounds[ 1 ], nBins );
@@ -168,10 +168,10 @@ void init_histogram( py::module& m ) {
                 }
                 return dip::Histogram( input, mask, config );
              } ),
-             "input"_a, "mask"_a = dip::Image{}, "bounds"_a = dip::FloatArray{ 0, 255 }, "nBins"_a = 256, "boundsArePercentile"_a = false,
+             "input"_a, "mask"_a = dip::Image{}, "bounds"_a = dip::FloatArray{ 0, 255 }, "nBins"_a = 256, "boundsArePercentile"_a = false, release_gil(),
              "A constructor that creates a `dip::Histogram::Configuration` object for you." );
    hist.def( py::init< dip::Image const&, dip::Image const&, dip::Image const&, dip::Histogram::ConfigurationArray >(),
-             "input1"_a, "input2"_a, "mask"_a = dip::Image{}, "configuration"_a = dip::Histogram::ConfigurationArray{}, doc_strings::dip·Histogram·Histogram·Image·CL·Image·CL·Image·CL·ConfigurationArray· );
+             "input1"_a, "input2"_a, "mask"_a = dip::Image{}, "configuration"_a = dip::Histogram::ConfigurationArray{}, release_gil(), doc_strings::dip·Histogram·Histogram·Image·CL·Image·CL·Image·CL·ConfigurationArray· );
    hist.def( py::init( []( dip::Image const& input1,
                            dip::Image const& input2,
                            dip::Image const& mask,
@@ -193,7 +193,7 @@ void init_histogram( py::module& m ) {
                 return dip::Histogram( input1, input2, mask, config );
              } ),
              "input1"_a, "input2"_a, "mask"_a = dip::Image{}, "bounds1"_a = dip::FloatArray{ 0, 255 }, "bounds2"_a = dip::FloatArray{ 0, 100 },
-             "nBins1"_a = 256, "nBins2"_a = 256, "boundsArePercentile"_a = false,
+             "nBins1"_a = 256, "nBins2"_a = 256, "boundsArePercentile"_a = false, release_gil(),
              "A constructor that creates a `dip::Histogram::Configuration` object for you." );
    hist.def( py::init< dip::Histogram::ConfigurationArray >(), "configuration"_a, doc_strings::dip·Histogram·Histogram·ConfigurationArray· );
    hist.def( "__repr__", []( dip::Histogram const& self ) {
@@ -212,9 +212,9 @@ void init_histogram( py::module& m ) {
    hist.def( "IsInitialized", &dip::Histogram::IsInitialized, doc_strings::dip·Histogram·IsInitialized·C );
    hist.def( "Copy", &dip::Histogram::Copy, doc_strings::dip·Histogram·Copy·C );
    hist.def( "ReverseLookup", py::overload_cast< dip::Image const&, dip::BooleanArray >( &dip::Histogram::ReverseLookup ),
-             "input"_a, "excludeOutOfBoundValues"_a = dip::BooleanArray{ false }, doc_strings::dip·Histogram·ReverseLookup·Image·CL·Image·L·BooleanArray· );
+             "input"_a, "excludeOutOfBoundValues"_a = dip::BooleanArray{ false }, release_gil(), doc_strings::dip·Histogram·ReverseLookup·Image·CL·Image·L·BooleanArray· );
    hist.def( "ReverseLookup", py::overload_cast< dip::Image const&, dip::Image&, dip::BooleanArray >( &dip::Histogram::ReverseLookup ),
-             "input"_a, py::kw_only(), "out"_a, "excludeOutOfBoundValues"_a = dip::BooleanArray{ false }, doc_strings::dip·Histogram·ReverseLookup·Image·CL·Image·L·BooleanArray· );
+             "input"_a, py::kw_only(), "out"_a, "excludeOutOfBoundValues"_a = dip::BooleanArray{ false }, release_gil(), doc_strings::dip·Histogram·ReverseLookup·Image·CL·Image·L·BooleanArray· );
    hist.def( py::self += py::self, doc_strings::dip·Histogram·operatorpluseq·Histogram·CL );
    hist.def( py::self + py::self, doc_strings::dip·operatorplus·Histogram·CL·Histogram·CL );
    hist.def( py::self -= py::self, doc_strings::dip·Histogram·operatorminuseq·Histogram·CL );
@@ -241,44 +241,44 @@ void init_histogram( py::module& m ) {
    hist.def( "GetMarginal", &dip::Histogram::GetMarginal, "dim"_a, doc_strings::dip·Histogram·GetMarginal·dip·uint··C );
    hist.def( "Smooth", py::overload_cast< dip::FloatArray >( &dip::Histogram::Smooth ), "sigma"_a = dip::FloatArray{ 1 }, doc_strings::dip·Histogram·Smooth·FloatArray· );
 
-   m.def( "CumulativeHistogram", &dip::CumulativeHistogram, "in"_a, doc_strings::dip·CumulativeHistogram·Histogram·CL );
+   m.def( "CumulativeHistogram", &dip::CumulativeHistogram, "in"_a, release_gil(), doc_strings::dip·CumulativeHistogram·Histogram·CL );
    m.def( "Smooth", py::overload_cast< dip::Histogram const&, dip::FloatArray const& >( &dip::Smooth ),
-          "in"_a, "sigma"_a = dip::FloatArray{ 1 }, doc_strings::dip·Smooth·Histogram·CL·FloatArray·CL );
-   m.def( "Mean", py::overload_cast< dip::Histogram const& >( &dip::Mean ), "in"_a, doc_strings::dip·Mean·Histogram·CL );
-   m.def( "Covariance", py::overload_cast< dip::Histogram const& >( &dip::Covariance ), "in"_a, doc_strings::dip·Covariance·Histogram·CL );
-   m.def( "MarginalPercentile", &dip::MarginalPercentile, "in"_a, "percentile"_a = 50, doc_strings::dip·MarginalPercentile·Histogram·CL·dfloat· );
-   m.def( "MarginalMedian", &dip::MarginalMedian, "in"_a, doc_strings::dip·MarginalMedian·Histogram·CL );
-   m.def( "Mode", py::overload_cast< dip::Histogram const& >( &dip::Mode ), "in"_a, doc_strings::dip·Mode·Histogram·CL );
-   m.def( "PearsonCorrelation", py::overload_cast< dip::Histogram const& >( &dip::PearsonCorrelation ), "in"_a, doc_strings::dip·PearsonCorrelation·Histogram·CL );
-   m.def( "Regression", py::overload_cast< dip::Histogram const& >( &dip::Regression ), "in"_a, doc_strings::dip·Regression·Histogram·CL );
-   m.def( "MutualInformation", py::overload_cast< dip::Histogram const& >( &dip::MutualInformation ), "in"_a, doc_strings::dip·MutualInformation·Histogram·CL );
-   m.def( "Entropy", py::overload_cast< dip::Histogram const& >( &dip::Entropy ), "in"_a, doc_strings::dip·Entropy·Histogram·CL );
+          "in"_a, "sigma"_a = dip::FloatArray{ 1 }, release_gil(), doc_strings::dip·Smooth·Histogram·CL·FloatArray·CL );
+   m.def( "Mean", py::overload_cast< dip::Histogram const& >( &dip::Mean ), "in"_a, release_gil(), doc_strings::dip·Mean·Histogram·CL );
+   m.def( "Covariance", py::overload_cast< dip::Histogram const& >( &dip::Covariance ), "in"_a, release_gil(), doc_strings::dip·Covariance·Histogram·CL );
+   m.def( "MarginalPercentile", &dip::MarginalPercentile, "in"_a, "percentile"_a = 50, release_gil(), doc_strings::dip·MarginalPercentile·Histogram·CL·dfloat· );
+   m.def( "MarginalMedian", &dip::MarginalMedian, "in"_a, release_gil(), doc_strings::dip·MarginalMedian·Histogram·CL );
+   m.def( "Mode", py::overload_cast< dip::Histogram const& >( &dip::Mode ), "in"_a, release_gil(), doc_strings::dip·Mode·Histogram·CL );
+   m.def( "PearsonCorrelation", py::overload_cast< dip::Histogram const& >( &dip::PearsonCorrelation ), "in"_a, release_gil(), doc_strings::dip·PearsonCorrelation·Histogram·CL );
+   m.def( "Regression", py::overload_cast< dip::Histogram const& >( &dip::Regression ), "in"_a, release_gil(), doc_strings::dip·Regression·Histogram·CL );
+   m.def( "MutualInformation", py::overload_cast< dip::Histogram const& >( &dip::MutualInformation ), "in"_a, release_gil(), doc_strings::dip·MutualInformation·Histogram·CL );
+   m.def( "Entropy", py::overload_cast< dip::Histogram const& >( &dip::Entropy ), "in"_a, release_gil(), doc_strings::dip·Entropy·Histogram·CL );
    m.def( "GaussianMixtureModel", py::overload_cast< dip::Histogram const&, dip::uint, dip::uint >( &dip::GaussianMixtureModel ),
-          "in"_a, "numberOfGaussians"_a, "maxIter"_a = 20, doc_strings::dip·GaussianMixtureModel·Histogram·CL·dip·uint··dip·uint· );
+          "in"_a, "numberOfGaussians"_a, "maxIter"_a = 20, release_gil(), doc_strings::dip·GaussianMixtureModel·Histogram·CL·dip·uint··dip·uint· );
 
    m.def( "IsodataThreshold", py::overload_cast< dip::Histogram const&, dip::uint >( &dip::IsodataThreshold ),
-          "in"_a, "nThresholds"_a = 1, doc_strings::dip·IsodataThreshold·Histogram·CL·dip·uint· );
+          "in"_a, "nThresholds"_a = 1, release_gil(), doc_strings::dip·IsodataThreshold·Histogram·CL·dip·uint· );
    m.def( "OtsuThreshold", py::overload_cast< dip::Histogram const& >( &dip::OtsuThreshold ),
-          "in"_a, doc_strings::dip·OtsuThreshold·Histogram·CL );
+          "in"_a, release_gil(), doc_strings::dip·OtsuThreshold·Histogram·CL );
    m.def( "MinimumErrorThreshold", py::overload_cast< dip::Histogram const& >( &dip::MinimumErrorThreshold ),
-          "in"_a, doc_strings::dip·MinimumErrorThreshold·Histogram·CL );
+          "in"_a, release_gil(), doc_strings::dip·MinimumErrorThreshold·Histogram·CL );
    m.def( "GaussianMixtureModelThreshold", py::overload_cast< dip::Histogram const&, dip::uint >( &dip::GaussianMixtureModelThreshold ),
-          "in"_a, "nThresholds"_a = 1, doc_strings::dip·GaussianMixtureModelThreshold·Histogram·CL·dip·uint· );
+          "in"_a, "nThresholds"_a = 1, release_gil(), doc_strings::dip·GaussianMixtureModelThreshold·Histogram·CL·dip·uint· );
    m.def( "TriangleThreshold", py::overload_cast< dip::Histogram const&, dip::dfloat >( &dip::TriangleThreshold ),
-          "in"_a, "sigma"_a = 4.0, doc_strings::dip·TriangleThreshold·Histogram·CL·dfloat· );
+          "in"_a, "sigma"_a = 4.0, release_gil(), doc_strings::dip·TriangleThreshold·Histogram·CL·dfloat· );
    m.def( "BackgroundThreshold", py::overload_cast< dip::Histogram const&, dip::dfloat, dip::dfloat >( &dip::BackgroundThreshold ),
-          "in"_a, "distance"_a = 2.0, "sigma"_a = 4.0, doc_strings::dip·BackgroundThreshold·Histogram·CL·dfloat··dfloat· );
+          "in"_a, "distance"_a = 2.0, "sigma"_a = 4.0, release_gil(), doc_strings::dip·BackgroundThreshold·Histogram·CL·dfloat··dfloat· );
    m.def( "KMeansClustering", py::overload_cast< dip::Histogram const&, dip::uint >( &dip::KMeansClustering ),
-          "in"_a, "nClusters"_a = 2, doc_strings::dip·KMeansClustering·Histogram·CL·dip·uint· );
+          "in"_a, "nClusters"_a = 2, release_gil(), doc_strings::dip·KMeansClustering·Histogram·CL·dip·uint· );
    m.def( "MinimumVariancePartitioning", py::overload_cast< dip::Histogram const&, dip::uint >( &dip::MinimumVariancePartitioning ),
-          "in"_a, "nClusters"_a = 2, doc_strings::dip·MinimumVariancePartitioning·Histogram·CL·dip·uint· );
+          "in"_a, "nClusters"_a = 2, release_gil(), doc_strings::dip·MinimumVariancePartitioning·Histogram·CL·dip·uint· );
    m.def( "EqualizationLookupTable", &dip::EqualizationLookupTable,
-          "in"_a, doc_strings::dip·EqualizationLookupTable·Histogram·CL );
+          "in"_a, release_gil(), doc_strings::dip·EqualizationLookupTable·Histogram·CL );
    m.def( "MatchingLookupTable", &dip::MatchingLookupTable,
-          "in"_a, "example"_a, doc_strings::dip·MatchingLookupTable·Histogram·CL·Histogram·CL );
+          "in"_a, "example"_a, release_gil(), doc_strings::dip·MatchingLookupTable·Histogram·CL·Histogram·CL );
 
    m.def( "PerObjectHistogram", &dip::PerObjectHistogram,
-          "grey"_a, "label"_a, "mask"_a = dip::Image{}, "configuration"_a = dip::Histogram::Configuration{}, "mode"_a = dip::S::FRACTION, "background"_a = dip::S::EXCLUDE, doc_strings::dip·PerObjectHistogram·Image·CL·Image·CL·Image·CL·Histogram·Configuration··String·CL·String·CL );
+          "grey"_a, "label"_a, "mask"_a = dip::Image{}, "configuration"_a = dip::Histogram::Configuration{}, "mode"_a = dip::S::FRACTION, "background"_a = dip::S::EXCLUDE, release_gil(), doc_strings::dip·PerObjectHistogram·Image·CL·Image·CL·Image·CL·Histogram·Configuration··String·CL·String·CL );
 
    // These next two functions are the old implementation of `dip.Histogram`, which we keep
    // here for backwards compatibility. Setting `dip.Histogram = dip.Histogram_old` in Python
@@ -361,7 +361,7 @@ void init_histogram( py::module& m ) {
                 DIP_THROW_INVALID_FLAG( mode );
              }
              return lookupTable.Apply( in, interpolation );
-          }, "in"_a, "lut"_a, "index"_a = dip::FloatArray{}, "interpolation"_a = dip::S::LINEAR, "mode"_a = "clamp", "lowerValue"_a = 0.0, "upperValue"_a = 0.0,
+          }, "in"_a, "lut"_a, "index"_a = dip::FloatArray{}, "interpolation"_a = dip::S::LINEAR, "mode"_a = "clamp", "lowerValue"_a = 0.0, "upperValue"_a = 0.0, release_gil(),
           "This function exists for backwards compatibility. It takes an image `lut`, and\n"
           "optional `index`, that are converted to a `dip::LookupTable` object, parameters\n"
           "are set, and the lookup table is applied to `in`, returning the result.\n\n"
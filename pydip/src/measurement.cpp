@@ -16,6 +16,7 @@
  */
 
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <tuple>
 #include <type_traits>
@@ -154,11 +155,34 @@ class type_caster< dip::BoundingBoxInteger > {
 
 namespace {
 
+// Features keep state while measuring, so a `dip::MeasurementTool` cannot be used by multiple threads at the same
+// time. Because `Measure()` releases the GIL, each Python thread gets its own tool. Calls to `Configure()` are
+// recorded, and replayed on each thread's tool before it is used.
+struct FeatureConfiguration {
+   dip::String feature;
+   dip::String parameter;
+   dip::dfloat value;
+};
+std::mutex featureConfigurationMutex;
+std::vector< FeatureConfiguration > featureConfiguration;
+
 dip::MeasurementTool& measurementTool() {
-   static dip::MeasurementTool tool;
+   thread_local dip::MeasurementTool tool;
+   thread_local dip::uint nConfigured = 0;
+   std::lock_guard< std::mutex > guard( featureConfigurationMutex );
+   for( ; nConfigured < featureConfiguration.size(); ++nConfigured ) {
+      auto const& config = featureConfiguration[ nConfigured ];
+      tool.Configure( config.feature, config.parameter, config.value );
+   }
    return tool;
 }
 
+void ConfigureMeasurementTool( dip::String const& feature, dip::String const& parameter, dip::dfloat value ) {
+   measurementTool().Configure( feature, parameter, value ); // Throws if the feature doesn't exist
+   std::lock_guard< std::mutex > guard( featureConfigurationMutex );
+   featureConfiguration.push_back( { feature, parameter, value } );
+}
+
 template< typename MeasurementValues >
 py::object MeasurementValuesToList( MeasurementValues values ) {
    py::list list( values.size() );
@@ -313,12 +337,10 @@ void init_measurement( py::module& m ) {
                                 "A tool to quantify objects in an image.\n\n"
                                 "This is a submodule that uses a static `dip::Measurement` object. Functions\n"
                                 "defined in this module correspond to the object member functions in C++." );
-   tool.def( "Configure", []( dip::String const& feature, dip::String const& parameter, dip::dfloat value ) {
-      measurementTool().Configure( feature, parameter, value );
-   }, "feature"_a, "parameter"_a, "value"_a, doc_strings::dip·MeasurementTool·Configure·String·CL·String·CL·dfloat··C );
+   tool.def( "Configure", &ConfigureMeasurementTool, "feature"_a, "parameter"_a, "value"_a, doc_strings::dip·MeasurementTool·Configure·String·CL·String·CL·dfloat··C );
    tool.def( "Measure", []( dip::Image const& label, dip::Image const& grey, dip::StringArray const& features, dip::UnsignedArray const& objectIDs, dip::uint connectivity ) {
       return measurementTool().Measure( label, grey, features, objectIDs, connectivity );
-   }, "label"_a, "grey"_a = dip::Image{}, "features"_a = dip::StringArray{ "Size" }, "objectIDs"_a = dip::StringArray{}, "connectivity"_a = 0, doc_strings::dip·MeasurementTool·Measure·Image·CL·Image·CL·StringArray··UnsignedArray·CL·dip·uint··C );
+   }, "label"_a, "grey"_a = dip::Image{}, "features"_a = dip::StringArray{ "Size" }, "objectIDs"_a = dip::StringArray{}, "connectivity"_a = 0, release_gil(), doc_strings::dip·MeasurementTool·Measure·Image·CL·Image·CL·StringArray··UnsignedArray·CL·dip·uint··C );
    tool.def( "Features", []() {
                 auto features = measurementTool().Features();
                 std::vector< std::tuple< dip::String, dip::String >> out;
@@ -482,21 +504,21 @@ void init_measurement( py::module& m ) {
    } );
 
    // Other functions
-   m.def( "ObjectToMeasurement", py::overload_cast< dip::Image const&, dip::Measurement::IteratorFeature const& >( &dip::ObjectToMeasurement ), "label"_a, "featureValues"_a, doc_strings::dip·ObjectToMeasurement·Image·CL·Image·L·Measurement·IteratorFeature·CL );
-   m.def( "MeasurementWriteCSV", &dip::MeasurementWriteCSV, "measurement"_a, "filename"_a, "options"_a = dip::StringSet{}, doc_strings::dip·MeasurementWriteCSV·Measurement·CL·String·CL·StringSet·CL );
+   m.def( "ObjectToMeasurement", py::overload_cast< dip::Image const&, dip::Measurement::IteratorFeature const& >( &dip::ObjectToMeasurement ), "label"_a, "featureValues"_a, release_gil(), doc_strings::dip·ObjectToMeasurement·Image·CL·Image·L·Measurement·IteratorFeature·CL );
+   m.def( "MeasurementWriteCSV", &dip::MeasurementWriteCSV, "measurement"_a, "filename"_a, "options"_a = dip::StringSet{}, release_gil(), doc_strings::dip·MeasurementWriteCSV·Measurement·CL·String·CL·StringSet·CL );
    // (Note that most of the functions below are resolved correctly because we don't include diplib/statistics.h,
    // which defines functions with the same name but different arguments.)
-   m.def( "Minimum", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Minimum ), "featureValues"_a, doc_strings::dip·Minimum·Measurement·IteratorFeature·CL );
-   m.def( "Maximum", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Maximum ), "featureValues"_a, doc_strings::dip·Maximum·Measurement·IteratorFeature·CL );
-   m.def( "Percentile", py::overload_cast< dip::Measurement::IteratorFeature const&, dip::dfloat >( &dip::Percentile ), "featureValues"_a, "percentile"_a, doc_strings::dip·Percentile·Measurement·IteratorFeature·CL·dfloat· );
-   m.def( "Median", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Median ), "featureValues"_a, doc_strings::dip·Median·Measurement·IteratorFeature·CL );
-   m.def( "Mean", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Mean ), "featureValues"_a, doc_strings::dip·Mean·Measurement·IteratorFeature·CL );
+   m.def( "Minimum", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Minimum ), "featureValues"_a, release_gil(), doc_strings::dip·Minimum·Measurement·IteratorFeature·CL );
+   m.def( "Maximum", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Maximum ), "featureValues"_a, release_gil(), doc_strings::dip·Maximum·Measurement·IteratorFeature·CL );
+   m.def( "Percentile", py::overload_cast< dip::Measurement::IteratorFeature const&, dip::dfloat >( &dip::Percentile ), "featureValues"_a, "percentile"_a, release_gil(), doc_strings::dip·Percentile·Measurement·IteratorFeature·CL·dfloat· );
+   m.def( "Median", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Median ), "featureValues"_a, release_gil(), doc_strings::dip·Median·Measurement·IteratorFeature·CL );
+   m.def( "Mean", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::Mean ), "featureValues"_a, release_gil(), doc_strings::dip·Mean·Measurement·IteratorFeature·CL );
    m.def( "MaximumAndMinimum", py::overload_cast< dip::Measurement::IteratorFeature const& >( &dip::MaximumAndMinimum ),
-          "featureValues"_a, doc_strings::dip·MaximumAndMinimum·Measurement·IteratorFeature·CL );
-   m.def( "Quartiles", &dip::Quartiles, "featureValues"_a, doc_strings::dip·Quartiles·Measurement·IteratorFeature·CL );
-   m.def( "SampleStatistics", &dip::SampleStatistics, "featureValues"_a, doc_strings::dip·SampleStatistics·Measurement·IteratorFeature·CL );
-   m.def( "ObjectMinimum", &dip::ObjectMinimum, "featureValues"_a, doc_strings::dip·ObjectMinimum·Measurement·IteratorFeature·CL );
-   m.def( "ObjectMaximum", &dip::ObjectMaximum, "featureValues"_a, doc_strings::dip·ObjectMaximum·Measurement·IteratorFeature·CL );
+          "featureValues"_a, release_gil(), doc_strings::dip·MaximumAndMinimum·Measurement·IteratorFeature·CL );
+   m.def( "Quartiles", &dip::Quartiles, "featureValues"_a, release_gil(), doc_strings::dip·Quartiles·Measurement·IteratorFeature·CL );
+   m.def( "SampleStatistics", &dip::SampleStatistics, "featureValues"_a, release_gil(), doc_strings::dip·SampleStatistics·Measurement·IteratorFeature·CL );
+   m.def( "ObjectMinimum", &dip::ObjectMinimum, "featureValues"_a, release_gil(), doc_strings::dip·ObjectMinimum·Measurement·IteratorFeature·CL );
+   m.def( "ObjectMaximum", &dip::ObjectMaximum, "featureValues"_a, release_gil(), doc_strings::dip·ObjectMaximum·Measurement·IteratorFeature·CL );
 
    // dip::Polygon
    auto poly = py::class_< dip::Polygon >( m, "Polygon", py::buffer_protocol(),
@@ -601,7 +623,7 @@ void init_measurement( py::module& m ) {
 
    // Chain code functions
    m.def( "GetImageChainCodes", py::overload_cast< dip::Image const&, std::vector< dip::LabelType > const&, dip::uint >( &dip::GetImageChainCodes ),
-          "labels"_a, "objectIDs"_a = dip::UnsignedArray{}, "connectivity"_a = 2, doc_strings::dip·GetImageChainCodes·Image·CL·std·vectorgtLabelTypelt·CL·dip·uint· );
-   m.def( "GetSingleChainCode", &dip::GetSingleChainCode, "labels"_a, "startCoord"_a, "connectivity"_a = 2, doc_strings::dip·GetSingleChainCode·Image·CL·UnsignedArray·CL·dip·uint· );
+          "labels"_a, "objectIDs"_a = dip::UnsignedArray{}, "connectivity"_a = 2, release_gil(), doc_strings::dip·GetImageChainCodes·Image·CL·std·vectorgtLabelTypelt·CL·dip·uint· );
+   m.def( "GetSingleChainCode", &dip::GetSingleChainCode, "labels"_a, "startCoord"_a, "connectivity"_a = 2, release_gil(), doc_strings::dip·GetSingleChainCode·Image·CL·UnsignedArray·CL·dip·uint· );
 
 }
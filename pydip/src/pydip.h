@@ -38,6 +38,12 @@
 using namespace pybind11::literals;
 namespace py = pybind11;
 
+// Add `release_gil()` as an extra argument to `def()` to release the GIL while the DIPlib function runs, so that
+// other Python threads can run in parallel. The GIL is held during argument conversion and when casting the return
+// value to a Python object. Do not use it for functions that create or manipulate Python objects, that call
+// `PyErr_WarnEx()` or similar, or that use the shared `RandomNumberGenerator()`.
+using release_gil = py::call_guard< py::gil_scoped_release >;
+
 /* THINGS I'VE LEARNED SO FAR ABOUT PYBIND11:
  *
  * - Default parameter values seem to be converted to Python types, and then translated back to C++ when needed.
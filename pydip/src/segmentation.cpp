@@ -16,6 +16,7 @@
  */
 
 #include <sstream>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -43,63 +44,63 @@ void init_segmentation( py::module& m ) {
           "Applies k-means clustering to an image, yielding `nClusters` labeled regions.\n"
           "Like the C++ function, but using an internal `dip::Random` object." );
    m.def( "MinimumVariancePartitioning", py::overload_cast< dip::Image const&, dip::uint >( &dip::MinimumVariancePartitioning ),
-          "in"_a, "nClusters"_a = 2, doc_strings::dip·MinimumVariancePartitioning·Image·CL·Image·L·dip·uint· );
+          "in"_a, "nClusters"_a = 2, release_gil(), doc_strings::dip·MinimumVariancePartitioning·Image·CL·Image·L·dip·uint· );
    m.def( "MinimumVariancePartitioning", py::overload_cast< dip::Image const&, dip::Image&, dip::uint >( &dip::MinimumVariancePartitioning ),
-          "in"_a, py::kw_only(), "out"_a, "nClusters"_a = 2, doc_strings::dip·MinimumVariancePartitioning·Image·CL·Image·L·dip·uint· );
+          "in"_a, py::kw_only(), "out"_a, "nClusters"_a = 2, release_gil(), doc_strings::dip·MinimumVariancePartitioning·Image·CL·Image·L·dip·uint· );
    m.def( "IsodataThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::uint >( &dip::IsodataThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, "nThresholds"_a = 1, doc_strings::dip·IsodataThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
+          "in"_a, "mask"_a = dip::Image{}, "nThresholds"_a = 1, release_gil(), doc_strings::dip·IsodataThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
    m.def( "IsodataThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::uint >( &dip::IsodataThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "nThresholds"_a = 1, doc_strings::dip·IsodataThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "nThresholds"_a = 1, release_gil(), doc_strings::dip·IsodataThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
    m.def( "OtsuThreshold", py::overload_cast< dip::Image const&, dip::Image const& >( &dip::OtsuThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, doc_strings::dip·OtsuThreshold·Image·CL·Image·CL·Image·L );
+          "in"_a, "mask"_a = dip::Image{}, release_gil(), doc_strings::dip·OtsuThreshold·Image·CL·Image·CL·Image·L );
    m.def( "OtsuThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image& >( &dip::OtsuThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, doc_strings::dip·OtsuThreshold·Image·CL·Image·CL·Image·L );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, release_gil(), doc_strings::dip·OtsuThreshold·Image·CL·Image·CL·Image·L );
    m.def( "MinimumErrorThreshold", py::overload_cast< dip::Image const&, dip::Image const& >( &dip::MinimumErrorThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, doc_strings::dip·MinimumErrorThreshold·Image·CL·Image·CL·Image·L );
+          "in"_a, "mask"_a = dip::Image{}, release_gil(), doc_strings::dip·MinimumErrorThreshold·Image·CL·Image·CL·Image·L );
    m.def( "MinimumErrorThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image& >( &dip::MinimumErrorThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, doc_strings::dip·MinimumErrorThreshold·Image·CL·Image·CL·Image·L );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, release_gil(), doc_strings::dip·MinimumErrorThreshold·Image·CL·Image·CL·Image·L );
    m.def( "GaussianMixtureModelThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::uint >( &dip::GaussianMixtureModelThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, "nThresholds"_a = 1, doc_strings::dip·GaussianMixtureModelThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
+          "in"_a, "mask"_a = dip::Image{}, "nThresholds"_a = 1, release_gil(), doc_strings::dip·GaussianMixtureModelThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
    m.def( "GaussianMixtureModelThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::uint >( &dip::GaussianMixtureModelThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "nThresholds"_a = 1, doc_strings::dip·GaussianMixtureModelThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "nThresholds"_a = 1, release_gil(), doc_strings::dip·GaussianMixtureModelThreshold·Image·CL·Image·CL·Image·L·dip·uint· );
    m.def( "TriangleThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::dfloat >( &dip::TriangleThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, "sigma"_a = 4.0, doc_strings::dip·TriangleThreshold·Image·CL·Image·CL·Image·L·dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, "sigma"_a = 4.0, release_gil(), doc_strings::dip·TriangleThreshold·Image·CL·Image·CL·Image·L·dfloat· );
    m.def( "TriangleThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::dfloat >( &dip::TriangleThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "sigma"_a = 4.0, doc_strings::dip·TriangleThreshold·Image·CL·Image·CL·Image·L·dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "sigma"_a = 4.0, release_gil(), doc_strings::dip·TriangleThreshold·Image·CL·Image·CL·Image·L·dfloat· );
    m.def( "BackgroundThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::dfloat, dip::dfloat >( &dip::BackgroundThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, "distance"_a = 2.0, "sigma"_a = 4.0, doc_strings::dip·BackgroundThreshold·Image·CL·Image·CL·Image·L·dfloat··dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, "distance"_a = 2.0, "sigma"_a = 4.0, release_gil(), doc_strings::dip·BackgroundThreshold·Image·CL·Image·CL·Image·L·dfloat··dfloat· );
    m.def( "BackgroundThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::dfloat, dip::dfloat >( &dip::BackgroundThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "distance"_a = 2.0, "sigma"_a = 4.0, doc_strings::dip·BackgroundThreshold·Image·CL·Image·CL·Image·L·dfloat··dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "distance"_a = 2.0, "sigma"_a = 4.0, release_gil(), doc_strings::dip·BackgroundThreshold·Image·CL·Image·CL·Image·L·dfloat··dfloat· );
    m.def( "VolumeThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::dfloat >( &dip::VolumeThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, "volumeFraction"_a = 0.5, doc_strings::dip·VolumeThreshold·Image·CL·Image·CL·Image·L·dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, "volumeFraction"_a = 0.5, release_gil(), doc_strings::dip·VolumeThreshold·Image·CL·Image·CL·Image·L·dfloat· );
    m.def( "VolumeThreshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::dfloat >( &dip::VolumeThreshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "volumeFraction"_a = 0.5, doc_strings::dip·VolumeThreshold·Image·CL·Image·CL·Image·L·dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "volumeFraction"_a = 0.5, release_gil(), doc_strings::dip·VolumeThreshold·Image·CL·Image·CL·Image·L·dfloat· );
    m.def( "FixedThreshold", py::overload_cast< dip::Image const&, dip::dfloat, dip::dfloat, dip::dfloat, dip::String const& >( &dip::FixedThreshold ),
-          "in"_a, "threshold"_a, "foreground"_a = 1.0, "background"_a = 0.0, "output"_a = dip::S::BINARY, doc_strings::dip·FixedThreshold·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL );
+          "in"_a, "threshold"_a, "foreground"_a = 1.0, "background"_a = 0.0, "output"_a = dip::S::BINARY, release_gil(), doc_strings::dip·FixedThreshold·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL );
    m.def( "FixedThreshold", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::dfloat, dip::dfloat, dip::String const& >( &dip::FixedThreshold ),
-          "in"_a, py::kw_only(), "out"_a, "threshold"_a, "foreground"_a = 1.0, "background"_a = 0.0, "output"_a = dip::S::BINARY, doc_strings::dip·FixedThreshold·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL );
+          "in"_a, py::kw_only(), "out"_a, "threshold"_a, "foreground"_a = 1.0, "background"_a = 0.0, "output"_a = dip::S::BINARY, release_gil(), doc_strings::dip·FixedThreshold·Image·CL·Image·L·dfloat··dfloat··dfloat··String·CL );
    m.def( "RangeThreshold", py::overload_cast< dip::Image const&, dip::dfloat, dip::dfloat, dip::String const&, dip::dfloat, dip::dfloat >( &dip::RangeThreshold ),
-          "in"_a, "lowerBound"_a, "upperBound"_a, "output"_a = dip::S::BINARY, "foreground"_a = 1.0, "background"_a = 0.0, doc_strings::dip·RangeThreshold·Image·CL·Image·L·dfloat··dfloat··String·CL·dfloat··dfloat· );
+          "in"_a, "lowerBound"_a, "upperBound"_a, "output"_a = dip::S::BINARY, "foreground"_a = 1.0, "background"_a = 0.0, release_gil(), doc_strings::dip·RangeThreshold·Image·CL·Image·L·dfloat··dfloat··String·CL·dfloat··dfloat· );
    m.def( "RangeThreshold", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::dfloat, dip::String const&, dip::dfloat, dip::dfloat >( &dip::RangeThreshold ),
-          "in"_a, py::kw_only(), "out"_a, "lowerBound"_a, "upperBound"_a, "output"_a = dip::S::BINARY, "foreground"_a = 1.0, "background"_a = 0.0, doc_strings::dip·RangeThreshold·Image·CL·Image·L·dfloat··dfloat··String·CL·dfloat··dfloat· );
+          "in"_a, py::kw_only(), "out"_a, "lowerBound"_a, "upperBound"_a, "output"_a = dip::S::BINARY, "foreground"_a = 1.0, "background"_a = 0.0, release_gil(), doc_strings::dip·RangeThreshold·Image·CL·Image·L·dfloat··dfloat··String·CL·dfloat··dfloat· );
    m.def( "HysteresisThreshold", py::overload_cast< dip::Image const&, dip::dfloat, dip::dfloat >( &dip::HysteresisThreshold ),
-          "in"_a, "lowThreshold"_a, "highThreshold"_a, doc_strings::dip·HysteresisThreshold·Image·CL·Image·L·dfloat··dfloat· );
+          "in"_a, "lowThreshold"_a, "highThreshold"_a, release_gil(), doc_strings::dip·HysteresisThreshold·Image·CL·Image·L·dfloat··dfloat· );
    m.def( "HysteresisThreshold", py::overload_cast< dip::Image const&, dip::Image&, dip::dfloat, dip::dfloat >( &dip::HysteresisThreshold ),
-          "in"_a, py::kw_only(), "out"_a, "lowThreshold"_a, "highThreshold"_a, doc_strings::dip·HysteresisThreshold·Image·CL·Image·L·dfloat··dfloat· );
+          "in"_a, py::kw_only(), "out"_a, "lowThreshold"_a, "highThreshold"_a, release_gil(), doc_strings::dip·HysteresisThreshold·Image·CL·Image·L·dfloat··dfloat· );
    m.def( "MultipleThresholds", py::overload_cast< dip::Image const&, dip::FloatArray const& >( &dip::MultipleThresholds ),
-          "in"_a, "thresholds"_a, doc_strings::dip·MultipleThresholds·Image·CL·Image·L·FloatArray·CL );
+          "in"_a, "thresholds"_a, release_gil(), doc_strings::dip·MultipleThresholds·Image·CL·Image·L·FloatArray·CL );
    m.def( "MultipleThresholds", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray const& >( &dip::MultipleThresholds ),
-          "in"_a, py::kw_only(), "out"_a, "thresholds"_a, doc_strings::dip·MultipleThresholds·Image·CL·Image·L·FloatArray·CL );
+          "in"_a, py::kw_only(), "out"_a, "thresholds"_a, release_gil(), doc_strings::dip·MultipleThresholds·Image·CL·Image·L·FloatArray·CL );
    m.def( "Threshold", []( dip::Image const& in, dip::Image const& mask, dip::String const& method, dip::dfloat parameter ) {
              dip::Image out;
              dip::dfloat threshold = Threshold( in, mask, out, method, parameter );
-             return py::make_tuple( out, threshold );
-          }, "in"_a, "mask"_a = dip::Image{}, "method"_a = dip::S::OTSU, "parameter"_a = dip::infinity,
+             return std::make_tuple( out, threshold );
+          }, "in"_a, "mask"_a = dip::Image{}, "method"_a = dip::S::OTSU, "parameter"_a = dip::infinity, release_gil(),
           "Automated threshold using `method`.\n"
           "Returns a tuple, the first element is the thresholded image, the second one\n"
           "is the threshold value." );
    m.def( "Threshold", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::String const&, dip::dfloat >( &dip::Threshold ),
-          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "method"_a = dip::S::OTSU, "parameter"_a = dip::infinity, doc_strings::dip·Threshold·Image·CL·Image·CL·Image·L·String·CL·dfloat· );
+          "in"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "method"_a = dip::S::OTSU, "parameter"_a = dip::infinity, release_gil(), doc_strings::dip·Threshold·Image·CL·Image·CL·Image·L·String·CL·dfloat· );
    m.def( "PerObjectEllipsoidFit", []( dip::Image const& in,
                                        std::pair< dip::uint, dip::uint > sizeBounds,
                                        dip::dfloat minEllipsoidFit,
@@ -108,14 +109,14 @@ void init_segmentation( py::module& m ) {
              return dip::PerObjectEllipsoidFit( in, { sizeBounds.first, sizeBounds.second, minEllipsoidFit, aspectRatioBounds.first,
                                                       aspectRatioBounds.second, thresholdBounds.first, thresholdBounds.second } );
           }, "in"_a, "sizeBounds"_a = std::pair< dip::uint, dip::uint >{ 6, 30000 }, "minEllipsoidFit"_a = 0.88,
-          "aspectRatioBounds"_a = std::pair< dip::dfloat, dip::dfloat >{ 1.0, 10.0 }, "thresholdBounds"_a = std::pair< dip::dfloat, dip::dfloat >{ 0.0, 255.0 },
+          "aspectRatioBounds"_a = std::pair< dip::dfloat, dip::dfloat >{ 1.0, 10.0 }, "thresholdBounds"_a = std::pair< dip::dfloat, dip::dfloat >{ 0.0, 255.0 }, release_gil(),
           "Finds a per-object threshold such that found objects are maximally\nellipsoidal.\n"
           "Like the C++ function, but with individual input values rather than a single\n"
           "`dip::PerObjectEllipsoidFitParameters` object collecting all algorithm parameters." );
    m.def( "Canny", py::overload_cast< dip::Image const&, dip::FloatArray const&, dip::dfloat, dip::dfloat, dip::String const& >( &dip::Canny ),
-          "in"_a, "sigmas"_a = dip::FloatArray{ 1 }, "lower"_a = 0.5, "upper"_a = 0.9, "selection"_a = dip::S::ALL, doc_strings::dip·Canny·Image·CL·Image·L·FloatArray·CL·dfloat··dfloat··String·CL );
+          "in"_a, "sigmas"_a = dip::FloatArray{ 1 }, "lower"_a = 0.5, "upper"_a = 0.9, "selection"_a = dip::S::ALL, release_gil(), doc_strings::dip·Canny·Image·CL·Image·L·FloatArray·CL·dfloat··dfloat··String·CL );
    m.def( "Canny", py::overload_cast< dip::Image const&, dip::Image&, dip::FloatArray const&, dip::dfloat, dip::dfloat, dip::String const& >( &dip::Canny ),
-          "in"_a, py::kw_only(), "out"_a, "sigmas"_a = dip::FloatArray{ 1 }, "lower"_a = 0.5, "upper"_a = 0.9, "selection"_a = dip::S::ALL, doc_strings::dip·Canny·Image·CL·Image·L·FloatArray·CL·dfloat··dfloat··String·CL );
+          "in"_a, py::kw_only(), "out"_a, "sigmas"_a = dip::FloatArray{ 1 }, "lower"_a = 0.5, "upper"_a = 0.9, "selection"_a = dip::S::ALL, release_gil(), doc_strings::dip·Canny·Image·CL·Image·L·FloatArray·CL·dfloat··dfloat··String·CL );
    m.def( "Superpixels", []( dip::Image const& in, dip::dfloat density, dip::dfloat compactness, dip::String const& method, dip::StringSet const& flags ) {
              return dip::Superpixels( in, RandomNumberGenerator(), density, compactness, method, flags );
           },
@@ -129,9 +130,9 @@ void init_segmentation( py::module& m ) {
           "Generates superpixels (oversegmentation)\n"
           "Like the C++ function, but using an internal `dip::Random` object." );
    m.def( "GraphCut", py::overload_cast< dip::Image const&, dip::Image const&, dip::dfloat, dip::dfloat, dip::dfloat >( &dip::GraphCut ),
-          "in"_a, "markers"_a, "sigma"_a = 30.0, "tLambda"_a = 1.0, "gamma"_a = 0.0, doc_strings::dip·GraphCut·Image·CL·Image·CL·Image·L·dfloat··dfloat··dfloat· );
+          "in"_a, "markers"_a, "sigma"_a = 30.0, "tLambda"_a = 1.0, "gamma"_a = 0.0, release_gil(), doc_strings::dip·GraphCut·Image·CL·Image·CL·Image·L·dfloat··dfloat··dfloat· );
    m.def( "GraphCut", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::dfloat, dip::dfloat, dip::dfloat >( &dip::GraphCut ),
-          "in"_a, "markers"_a, py::kw_only(), "out"_a, "sigma"_a = 30.0, "tLambda"_a = 1.0, "gamma"_a = 0.0, doc_strings::dip·GraphCut·Image·CL·Image·CL·Image·L·dfloat··dfloat··dfloat· );
+          "in"_a, "markers"_a, py::kw_only(), "out"_a, "sigma"_a = 30.0, "tLambda"_a = 1.0, "gamma"_a = 0.0, release_gil(), doc_strings::dip·GraphCut·Image·CL·Image·CL·Image·L·dfloat··dfloat··dfloat· );
 
    // diplib/graph.h
    auto graph = py::class_< dip::Graph >( m, "Graph", doc_strings::dip·Graph );
@@ -197,47 +198,47 @@ void init_segmentation( py::module& m ) {
    dgraph.def( "UpdateEdgeWeights", static_cast< void ( dip::DirectedGraph::* )() const >( &dip::DirectedGraph::UpdateEdgeWeights ), doc_strings::dip·DirectedGraph·UpdateEdgeWeights·C );
    dgraph.def( "IsConnectedTo", &dip::DirectedGraph::IsConnectedTo, "root"_a, doc_strings::dip·DirectedGraph·IsConnectedTo·VertexIndex· );
 
-   m.def( "MinimumSpanningForest", &dip::MinimumSpanningForest, "graph"_a, "roots"_a, doc_strings::dip·MinimumSpanningForest·Graph·CL·std·vectorgtGraph·VertexIndexlt·CL );
-   m.def( "GraphCut", py::overload_cast< dip::DirectedGraph&, dip::DirectedGraph::VertexIndex, dip::DirectedGraph::VertexIndex >( &dip::GraphCut ), "graph"_a, "sourceIndex"_a, "sinkIndex"_a, doc_strings::dip·GraphCut·DirectedGraph·L·DirectedGraph·VertexIndex··DirectedGraph·VertexIndex· );
-   m.def( "Label", py::overload_cast< dip::Graph const& >( &dip::Label ), "graph"_a, doc_strings::dip·Label·Graph·CL );
-   m.def( "Label", py::overload_cast< dip::DirectedGraph const& >( &dip::Label ), "graph"_a, doc_strings::dip·Label·DirectedGraph·CL );
+   m.def( "MinimumSpanningForest", &dip::MinimumSpanningForest, "graph"_a, "roots"_a, release_gil(), doc_strings::dip·MinimumSpanningForest·Graph·CL·std·vectorgtGraph·VertexIndexlt·CL );
+   m.def( "GraphCut", py::overload_cast< dip::DirectedGraph&, dip::DirectedGraph::VertexIndex, dip::DirectedGraph::VertexIndex >( &dip::GraphCut ), "graph"_a, "sourceIndex"_a, "sinkIndex"_a, release_gil(), doc_strings::dip·GraphCut·DirectedGraph·L·DirectedGraph·VertexIndex··DirectedGraph·VertexIndex· );
+   m.def( "Label", py::overload_cast< dip::Graph const& >( &dip::Label ), "graph"_a, release_gil(), doc_strings::dip·Label·Graph·CL );
+   m.def( "Label", py::overload_cast< dip::DirectedGraph const& >( &dip::Label ), "graph"_a, release_gil(), doc_strings::dip·Label·DirectedGraph·CL );
 
    // diplib/regions.h
    m.def( "Label", py::overload_cast< dip::Image const&, dip::uint, dip::uint, dip::uint, dip::StringArray, dip::String const& >( &dip::Label ),
-          "binary"_a, "connectivity"_a = 0, "minSize"_a = 0, "maxSize"_a = 0, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::S::ALL, doc_strings::dip·Label·Image·CL·Image·L·dip·uint··dip·uint··dip·uint··StringArray··String·CL );
+          "binary"_a, "connectivity"_a = 0, "minSize"_a = 0, "maxSize"_a = 0, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::S::ALL, release_gil(), doc_strings::dip·Label·Image·CL·Image·L·dip·uint··dip·uint··dip·uint··StringArray··String·CL );
    m.def( "Label", py::overload_cast< dip::Image const&, dip::Image&, dip::uint, dip::uint, dip::uint, dip::StringArray, dip::String const& >( &dip::Label ),
-          "binary"_a, py::kw_only(), "out"_a, "connectivity"_a = 0, "minSize"_a = 0, "maxSize"_a = 0, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::S::ALL, doc_strings::dip·Label·Image·CL·Image·L·dip·uint··dip·uint··dip·uint··StringArray··String·CL );
+          "binary"_a, py::kw_only(), "out"_a, "connectivity"_a = 0, "minSize"_a = 0, "maxSize"_a = 0, "boundaryCondition"_a = dip::StringArray{}, "mode"_a = dip::S::ALL, release_gil(), doc_strings::dip·Label·Image·CL·Image·L·dip·uint··dip·uint··dip·uint··StringArray··String·CL );
    m.def( "ListObjectLabels", py::overload_cast< dip::Image const&, dip::Image const&, dip::String const&, dip::String const& >( &dip::ListObjectLabels ),
-          "label"_a, "mask"_a = dip::Image{}, "background"_a = dip::S::EXCLUDE, "region"_a = "", doc_strings::dip·ListObjectLabels·Image·CL·Image·CL·String·CL·String·CL );
+          "label"_a, "mask"_a = dip::Image{}, "background"_a = dip::S::EXCLUDE, "region"_a = "", release_gil(), doc_strings::dip·ListObjectLabels·Image·CL·Image·CL·String·CL·String·CL );
    // Deprecated function May 4, 2024 (after release 3.4.3) TODO: remove eventually.
    m.def( "GetObjectLabels", []( dip::Image const& label, dip::Image const& mask, dip::String const& background ) {
           PyErr_WarnEx( PyExc_DeprecationWarning, "`GetObjectLabels()` is deprecated, use `ListObjectLabels() instead`.", 1 );
           return dip::ListObjectLabels( label, mask, background );
    }, "label"_a, "mask"_a = dip::Image{}, "background"_a = dip::S::EXCLUDE, doc_strings::dip·ListObjectLabels·Image·CL·Image·CL·String·CL·String·CL );
    m.def( "Relabel", py::overload_cast< dip::Image const& >( &dip::Relabel ),
-          "label"_a, doc_strings::dip·Relabel·Image·CL·Image·L );
+          "label"_a, release_gil(), doc_strings::dip·Relabel·Image·CL·Image·L );
    m.def( "Relabel", py::overload_cast< dip::Image const&, dip::Image& >( &dip::Relabel ),
-          "label"_a, py::kw_only(), "out"_a, doc_strings::dip·Relabel·Image·CL·Image·L );
+          "label"_a, py::kw_only(), "out"_a, release_gil(), doc_strings::dip·Relabel·Image·CL·Image·L );
    m.def( "Relabel", py::overload_cast< dip::Image const&, dip::Graph const& >( &dip::Relabel ),
-          "label"_a, "graph"_a, doc_strings::dip·Relabel·Image·CL·Image·L·Graph·CL );
+          "label"_a, "graph"_a, release_gil(), doc_strings::dip·Relabel·Image·CL·Image·L·Graph·CL );
    m.def( "Relabel", py::overload_cast< dip::Image const&, dip::Image&, dip::Graph const& >( &dip::Relabel ),
-          "label"_a, py::kw_only(), "out"_a, "graph"_a, doc_strings::dip·Relabel·Image·CL·Image·L·Graph·CL );
+          "label"_a, py::kw_only(), "out"_a, "graph"_a, release_gil(), doc_strings::dip·Relabel·Image·CL·Image·L·Graph·CL );
    m.def( "Relabel", py::overload_cast< dip::Image const&, dip::DirectedGraph const& >( &dip::Relabel ),
-          "label"_a, "graph"_a, doc_strings::dip·Relabel·Image·CL·Image·L·DirectedGraph·CL );
+          "label"_a, "graph"_a, release_gil(), doc_strings::dip·Relabel·Image·CL·Image·L·DirectedGraph·CL );
    m.def( "Relabel", py::overload_cast< dip::Image const&, dip::Image&, dip::DirectedGraph const& >( &dip::Relabel ),
-          "label"_a, py::kw_only(), "out"_a, "graph"_a, doc_strings::dip·Relabel·Image·CL·Image·L·DirectedGraph·CL );
+          "label"_a, py::kw_only(), "out"_a, "graph"_a, release_gil(), doc_strings::dip·Relabel·Image·CL·Image·L·DirectedGraph·CL );
    m.def( "SmallObjectsRemove", py::overload_cast< dip::Image const&, dip::uint, dip::uint >( &dip::SmallObjectsRemove ),
-          "in"_a, "threshold"_a, "connectivity"_a = 0, doc_strings::dip·SmallObjectsRemove·Image·CL·Image·L·dip·uint··dip·uint· );
+          "in"_a, "threshold"_a, "connectivity"_a = 0, release_gil(), doc_strings::dip·SmallObjectsRemove·Image·CL·Image·L·dip·uint··dip·uint· );
    m.def( "SmallObjectsRemove", py::overload_cast< dip::Image const&, dip::Image&, dip::uint, dip::uint >( &dip::SmallObjectsRemove ),
-          "in"_a, py::kw_only(), "out"_a, "threshold"_a, "connectivity"_a = 0, doc_strings::dip·SmallObjectsRemove·Image·CL·Image·L·dip·uint··dip·uint· );
+          "in"_a, py::kw_only(), "out"_a, "threshold"_a, "connectivity"_a = 0, release_gil(), doc_strings::dip·SmallObjectsRemove·Image·CL·Image·L·dip·uint··dip·uint· );
    m.def( "GrowRegions", py::overload_cast< dip::Image const&, dip::Image const&, dip::sint, dip::uint >( &dip::GrowRegions ),
-          "label"_a, "mask"_a = dip::Image{}, "connectivity"_a = -1, "iterations"_a = 0, doc_strings::dip·GrowRegions·Image·CL·Image·CL·Image·L·dip·sint··dip·uint· );
+          "label"_a, "mask"_a = dip::Image{}, "connectivity"_a = -1, "iterations"_a = 0, release_gil(), doc_strings::dip·GrowRegions·Image·CL·Image·CL·Image·L·dip·sint··dip·uint· );
    m.def( "GrowRegions", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image&, dip::sint, dip::uint >( &dip::GrowRegions ),
-          "label"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "connectivity"_a = -1, "iterations"_a = 0, doc_strings::dip·GrowRegions·Image·CL·Image·CL·Image·L·dip·sint··dip·uint· );
+          "label"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "connectivity"_a = -1, "iterations"_a = 0, release_gil(), doc_strings::dip·GrowRegions·Image·CL·Image·CL·Image·L·dip·sint··dip·uint· );
    m.def( "GrowRegionsWeighted", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image const&, dip::dfloat >( &dip::GrowRegionsWeighted ),
-          "label"_a, "grey"_a, "mask"_a = dip::Image{}, "distance"_a = dip::infinity, doc_strings::dip·GrowRegionsWeighted·Image·CL·Image·CL·Image·CL·Image·L·dfloat· );
+          "label"_a, "grey"_a, "mask"_a = dip::Image{}, "distance"_a = dip::infinity, release_gil(), doc_strings::dip·GrowRegionsWeighted·Image·CL·Image·CL·Image·CL·Image·L·dfloat· );
    m.def( "GrowRegionsWeighted", py::overload_cast< dip::Image const&, dip::Image const&, dip::Image const&, dip::Image&, dip::dfloat >( &dip::GrowRegionsWeighted ),
-          "label"_a, "grey"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "distance"_a = dip::infinity, doc_strings::dip·GrowRegionsWeighted·Image·CL·Image·CL·Image·CL·Image·L·dfloat· );
+          "label"_a, "grey"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "distance"_a = dip::infinity, release_gil(), doc_strings::dip·GrowRegionsWeighted·Image·CL·Image·CL·Image·CL·Image·L·dfloat· );
    // Deprecated functions April 25, 2024 (after release 3.4.3) TODO: remove eventually.
    m.def( "GrowRegionsWeighted", []( dip::Image const& label, dip::Image const& grey, dip::Image const& mask, dip::Metric const& /*metric*/ ) {
           PyErr_WarnEx( PyExc_DeprecationWarning, "The `metric` argument is deprecated, and will be ignored.", 1 );
@@ -248,19 +249,19 @@ void init_segmentation( py::module& m ) {
           dip::GrowRegionsWeighted( label, grey, mask, out );
    }, "label"_a, "grey"_a, "mask"_a = dip::Image{}, py::kw_only(), "out"_a, "metric"_a, doc_strings::dip·GrowRegionsWeighted·Image·CL·Image·CL·Image·CL·Image·L·dfloat· );
    m.def( "SplitRegions", py::overload_cast< dip::Image const&, dip::uint >( &dip::SplitRegions ),
-          "label"_a, "connectivity"_a = 0, doc_strings::dip·SplitRegions·Image·CL·Image·L·dip·uint· );
+          "label"_a, "connectivity"_a = 0, release_gil(), doc_strings::dip·SplitRegions·Image·CL·Image·L·dip·uint· );
    m.def( "SplitRegions", py::overload_cast< dip::Image const&, dip::Image&, dip::uint >( &dip::SplitRegions ),
-          "label"_a, py::kw_only(), "out"_a, "connectivity"_a = 0, doc_strings::dip·SplitRegions·Image·CL·Image·L·dip·uint· );
+          "label"_a, py::kw_only(), "out"_a, "connectivity"_a = 0, release_gil(), doc_strings::dip·SplitRegions·Image·CL·Image·L·dip·uint· );
    m.def( "MakeRegionsConvex2D", py::overload_cast< dip::Image const&, dip::String const& >( &dip::MakeRegionsConvex2D ),
-          "label"_a, "mode"_a = dip::S::FILLED, doc_strings::dip·MakeRegionsConvex2D·Image·CL·Image·L·String·CL );
+          "label"_a, "mode"_a = dip::S::FILLED, release_gil(), doc_strings::dip·MakeRegionsConvex2D·Image·CL·Image·L·String·CL );
    m.def( "MakeRegionsConvex2D", py::overload_cast< dip::Image const&, dip::Image&, dip::String const& >( &dip::MakeRegionsConvex2D ),
-          "label"_a, py::kw_only(), "out"_a, "mode"_a = dip::S::FILLED, doc_strings::dip·MakeRegionsConvex2D·Image·CL·Image·L·String·CL );
+          "label"_a, py::kw_only(), "out"_a, "mode"_a = dip::S::FILLED, release_gil(), doc_strings::dip·MakeRegionsConvex2D·Image·CL·Image·L·String·CL );
    m.def( "GetLabelBoundingBox", py::overload_cast< dip::Image const&, dip::LabelType >( &dip::GetLabelBoundingBox ),
-          "label"_a, "objectID"_a, doc_strings::dip·GetLabelBoundingBox·Image·CL·LabelType· );
+          "label"_a, "objectID"_a, release_gil(), doc_strings::dip·GetLabelBoundingBox·Image·CL·LabelType· );
    m.def( "RegionAdjacencyGraph", py::overload_cast< dip::Image const&, dip::String const& >( &dip::RegionAdjacencyGraph ),
-          "label"_a, "mode"_a = "touching", doc_strings::dip·RegionAdjacencyGraph·Image·CL·String·CL );
+          "label"_a, "mode"_a = "touching", release_gil(), doc_strings::dip·RegionAdjacencyGraph·Image·CL·String·CL );
    m.def( "RegionAdjacencyGraph", py::overload_cast< dip::Image const&, dip::Measurement::IteratorFeature const&, dip::String const& >( &dip::RegionAdjacencyGraph ),
-          "label"_a, "featureValues"_a, "mode"_a = "touching", doc_strings::dip·RegionAdjacencyGraph·Image·CL·Measurement·IteratorFeature·CL·String·CL );
+          "label"_a, "featureValues"_a, "mode"_a = "touching", release_gil(), doc_strings::dip·RegionAdjacencyGraph·Image·CL·Measurement·IteratorFeature·CL·String·CL );
 
    // diplib/label_map.h
    auto lmap = py::class_< dip::LabelMap >( m, "LabelMap", doc_strings::dip·LabelMap );
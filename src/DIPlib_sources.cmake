@@ -21,6 +21,7 @@ set(DIPlib_sources_bogus
 ../include/diplib/geometry.h
 ../include/diplib/graph.h
 ../include/diplib/histogram.h
+../include/diplib/integral_image.h
 ../include/diplib/iterators.h
 ../include/diplib/javaio.h
 ../include/diplib/kernel.h
@@ -44,7 +45,9 @@ set(DIPlib_sources_bogus
 ../include/diplib/lookup_table.h
 ../include/diplib/mapping.h
 ../include/diplib/math.h
+../include/diplib/max_tree.h
 ../include/diplib/measurement.h
+../include/diplib/memory_pool.h
 ../include/diplib/microscopy.h
 ../include/diplib/morphology.h
 ../include/diplib/multithreading.h
@@ -115,6 +118,7 @@ distance/find_neighbors.h
 distance/gdt.cpp
 distance/separable_dt.cpp
 distance/separable_dt.h
+distance/sweep.h
 distance/vdt.cpp
 file_io/file_io_support.cpp
 file_io/file_io_support.h
@@ -161,6 +165,7 @@ library/image_manip.cpp
 library/image_views.cpp
 library/information.cpp
 library/iterators.cpp
+library/memory_pool.cpp
 library/multithreading.cpp
 library/neighborhood.cpp
 library/physical_dimensions.cpp
@@ -174,6 +179,7 @@ linear/gabor.cpp
 linear/gaboriir.cpp
 linear/gauss.cpp
 linear/gaussiir.cpp
+linear/integral_image.cpp
 linear/separate_filter.cpp
 linear/sharpen.cpp
 linear/uniform.cpp
@@ -248,6 +254,7 @@ microscopy/unmix_stains.cpp
 morphology/areaopening.cpp
 morphology/basic.cpp
 morphology/filters.cpp
+morphology/max_tree.cpp
 morphology/maxima.cpp
 morphology/one_dimensional.cpp
 morphology/one_dimensional.h
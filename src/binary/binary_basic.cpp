@@ -17,9 +17,14 @@
 
 #include "diplib/binary.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "diplib.h"
 #include "diplib/distance.h"
-#include "diplib/neighborlist.h"
+#include "diplib/generic_iterators.h"
+#include "diplib/multithreading.h"
 #include "diplib/regions.h"
 
 #include "binary_support.h"
@@ -29,16 +34,238 @@ namespace dip {
 namespace {
 
 
-// Worker function for both dilation and erosion, since they are very alike
-template< typename F >
+// A binary image packed into 64-bit words, one bit per pixel. Each image line along dimension 0 (a row) is
+// stored in `wordsPerRow` consecutive words, bit `ii` of word `jj` in a row is the pixel at `x = 64 * jj + ii`.
+// The unused bits at the end of each row are padding.
+class PackedBinaryImage {
+   public:
+      static constexpr dip::uint bitsPerWord = 64;
+
+      explicit PackedBinaryImage( UnsignedArray const& sizes ) :
+            sizes_( sizes ),
+            wordsPerRow_( div_ceil( sizes[ 0 ], bitsPerWord )),
+            nRows_( sizes.product() / sizes[ 0 ] ),
+            data_( wordsPerRow_ * nRows_, 0 ) {}
+
+      dip::uint WordsPerRow() const { return wordsPerRow_; }
+      dip::uint NumberOfRows() const { return nRows_; }
+      uint64* Row( dip::uint row ) { return data_.data() + row * wordsPerRow_; }
+      uint64 const* Row( dip::uint row ) const { return data_.data() + row * wordsPerRow_; }
+
+      // Rows are in the order that a `GenericImageIterator` over dimension 0 visits them.
+      void Pack( Image const& in ) {
+         DIP_ASSERT( in.Sizes() == sizes_ );
+         dip::sint stride = in.Stride( 0 );
+         dip::uint row = 0;
+         GenericImageIterator<> it( in, 0 );
+         do {
+            bin const* src = static_cast< bin const* >( it.Pointer() );
+            uint64* dest = Row( row );
+            for( dip::uint jj = 0; jj < wordsPerRow_; ++jj ) {
+               dip::uint end = std::min( bitsPerWord, sizes_[ 0 ] - jj * bitsPerWord );
+               uint64 word = 0;
+               for( dip::uint ii = 0; ii < end; ++ii, src += stride ) {
+                  word |= static_cast< uint64 >( static_cast< bool >( *src )) << ii;
+               }
+               dest[ jj ] = word;
+            }
+            ++row;
+         } while( ++it );
+      }
+
+      void Unpack( Image& out ) const {
+         DIP_ASSERT( out.Sizes() == sizes_ );
+         dip::sint stride = out.Stride( 0 );
+         dip::uint row = 0;
+         GenericImageIterator<> it( out, 0 );
+         do {
+            bin* dest = static_cast< bin* >( it.Pointer() );
+            uint64 const* src = Row( row );
+            for( dip::uint jj = 0; jj < wordsPerRow_; ++jj ) {
+               dip::uint end = std::min( bitsPerWord, sizes_[ 0 ] - jj * bitsPerWord );
+               uint64 word = src[ jj ];
+               for( dip::uint ii = 0; ii < end; ++ii, dest += stride ) {
+                  *dest = static_cast< bool >(( word >> ii ) & 1u );
+               }
+            }
+            ++row;
+         } while( ++it );
+      }
+
+      // Sets the padding bits at the end of each row to `value`
+      void SetPadding( bool value ) {
+         dip::uint used = sizes_[ 0 ] % bitsPerWord;
+         if( used == 0 ) {
+            return;
+         }
+         uint64 mask = ~uint64( 0 ) << used;
+         for( dip::uint row = 0; row < nRows_; ++row ) {
+            uint64& word = Row( row )[ wordsPerRow_ - 1 ];
+            word = value ? ( word | mask ) : ( word & ~mask );
+         }
+      }
+
+      void swap( PackedBinaryImage& other ) noexcept {
+         data_.swap( other.data_ );
+      }
+
+   private:
+      UnsignedArray sizes_;
+      dip::uint wordsPerRow_;
+      dip::uint nRows_;
+      std::vector< uint64 > data_;
+};
+
+// A neighbor of a row: the offsets along dimensions 1 and up, and whether the left and right neighbors along
+// dimension 0 are included (if not, only the pixel directly above/below is).
+struct PackedRowNeighbor {
+   IntegerArray offsets;   // -1, 0 or 1 for each of dimensions 1 and up
+   dip::sint rowOffset;
+   bool horizontal;
+};
+
+// Lists the rows that contribute to the neighborhood of a row, for the given connectivity
+std::vector< PackedRowNeighbor > PackedRowNeighbors( UnsignedArray const& sizes, dip::uint connectivity ) {
+   dip::uint nDims = sizes.size();
+   std::vector< PackedRowNeighbor > neighbors;
+   IntegerArray offsets( nDims - 1, -1 );
+   while( true ) {
+      dip::uint nonZero = 0;
+      dip::sint rowOffset = 0;
+      dip::sint rowStride = 1;
+      for( dip::uint ii = 0; ii < nDims - 1; ++ii ) {
+         nonZero += offsets[ ii ] != 0;
+         rowOffset += offsets[ ii ] * rowStride;
+         rowStride *= static_cast< dip::sint >( sizes[ ii + 1 ] );
+      }
+      if( nonZero <= connectivity ) {
+         neighbors.push_back( { offsets, rowOffset, nonZero < connectivity } );
+      }
+      dip::uint ii = 0;
+      for( ; ii < nDims - 1; ++ii ) {
+         if( ++offsets[ ii ] <= 1 ) {
+            break;
+         }
+         offsets[ ii ] = -1;
+      }
+      if( ii == nDims - 1 ) {
+         break;
+      }
+   }
+   return neighbors;
+}
+
+// One iteration of dilation (OR over the neighborhood) or erosion (AND over the neighborhood) of `in`, written
+// to `out`. Pixels outside the image have the value `edge`. The padding bits of `in` must be set to `edge`.
+template< bool dilation >
+void PackedDilationErosionStep(
+      PackedBinaryImage const& in,
+      PackedBinaryImage& out,
+      UnsignedArray const& sizes,
+      std::vector< PackedRowNeighbor > const& neighbors,
+      bool edge,
+      dip::uint nThreads
+) {
+   auto op = []( uint64 a, uint64 b ) { return dilation ? ( a | b ) : ( a & b ); };
+   dip::uint nWords = in.WordsPerRow();
+   dip::uint nRows = in.NumberOfRows();
+   dip::uint nDims = sizes.size();
+   uint64 edgeWord = edge ? ~uint64( 0 ) : 0;
+   uint64 identity = dilation ? 0 : ~uint64( 0 );
+   std::vector< uint64 > edgeRow( nWords, edgeWord );
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   {
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nActualThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      dip::uint first = thread * nRows / nActualThreads;
+      dip::uint last = ( thread + 1 ) * nRows / nActualThreads;
+      // Coordinates of row `first` along dimensions 1 and up
+      UnsignedArray coords( nDims - 1 );
+      dip::uint tmp = first;
+      for( dip::uint ii = 0; ii < nDims - 1; ++ii ) {
+         coords[ ii ] = tmp % sizes[ ii + 1 ];
+         tmp /= sizes[ ii + 1 ];
+      }
+      for( dip::uint row = first; row < last; ++row ) {
+         uint64* dest = out.Row( row );
+         std::fill( dest, dest + nWords, identity );
+         for( auto const& neighbor : neighbors ) {
+            bool inImage = true;
+            for( dip::uint ii = 0; ii < nDims - 1; ++ii ) {
+               dip::sint pos = static_cast< dip::sint >( coords[ ii ] ) + neighbor.offsets[ ii ];
+               if(( pos < 0 ) || ( pos >= static_cast< dip::sint >( sizes[ ii + 1 ] ))) {
+                  inImage = false;
+                  break;
+               }
+            }
+            uint64 const* src = inImage ? in.Row( static_cast< dip::uint >( static_cast< dip::sint >( row ) + neighbor.rowOffset ))
+                                        : edgeRow.data();
+            if( neighbor.horizontal ) {
+               for( dip::uint jj = 0; jj < nWords; ++jj ) {
+                  uint64 left = ( src[ jj ] << 1u ) | ( jj > 0 ? src[ jj - 1 ] >> 63u : edgeWord >> 63u );
+                  uint64 right = ( src[ jj ] >> 1u ) | ( jj + 1 < nWords ? src[ jj + 1 ] << 63u : edgeWord << 63u );
+                  dest[ jj ] = op( dest[ jj ], op( src[ jj ], op( left, right )));
+               }
+            } else {
+               for( dip::uint jj = 0; jj < nWords; ++jj ) {
+                  dest[ jj ] = op( dest[ jj ], src[ jj ] );
+               }
+            }
+         }
+         for( dip::uint ii = 0; ii < nDims - 1; ++ii ) {
+            if( ++coords[ ii ] < sizes[ ii + 1 ] ) {
+               break;
+            }
+            coords[ ii ] = 0;
+         }
+      }
+   }
+}
+
+// Dilation or erosion using a packed binary image, `iterations` times.
+template< bool dilation >
+void PackedDilationErosion(
+      Image const& in,
+      Image& out,
+      dip::sint connectivity,
+      dip::uint iterations,
+      bool outsideImageIsObject
+) {
+   UnsignedArray sizes = in.Sizes(); // copy, `out` could be `in`
+   PixelSize pixelSize = in.PixelSize();
+   String colorSpace = in.ColorSpace();
+   dip::uint nDims = sizes.size();
+   PackedBinaryImage image( sizes );
+   image.Pack( in );
+   if( iterations > 0 ) {
+      PackedBinaryImage buffer( sizes );
+      // Connectivity 0 means full connectivity
+      dip::uint connectivity0 = GetAbsBinaryConnectivity( nDims, connectivity, 0 );
+      dip::uint connectivity1 = GetAbsBinaryConnectivity( nDims, connectivity, 1 );
+      std::vector< PackedRowNeighbor > neighbors0 = PackedRowNeighbors( sizes, connectivity0 == 0 ? nDims : connectivity0 );
+      std::vector< PackedRowNeighbor > neighbors1 = PackedRowNeighbors( sizes, connectivity1 == 0 ? nDims : connectivity1 );
+      dip::uint work = image.NumberOfRows() * image.WordsPerRow() * std::max( neighbors0.size(), neighbors1.size() );
+      dip::uint nThreads = work < threadingThreshold ? 1 : std::min( GetNumberOfThreads(), image.NumberOfRows() );
+      for( dip::uint iter = 0; iter < iterations; ++iter ) {
+         image.SetPadding( outsideImageIsObject );
+         PackedDilationErosionStep< dilation >( image, buffer, sizes, iter & 1u ? neighbors1 : neighbors0, outsideImageIsObject, nThreads );
+         image.swap( buffer );
+      }
+   }
+   out.ReForge( sizes, 1, DT_BIN ); // reforging first in case `out` is the right size but a different data type
+   image.Unpack( out );
+   out.SetPixelSize( std::move( pixelSize ));
+   out.SetColorSpace( std::move( colorSpace ));
+}
+
+// Checks the input image and parameters, and calls `PackedDilationErosion`
+template< bool dilation >
 void BinaryDilationErosion(
       Image const& in,
       Image& out,
       dip::sint connectivity,
       dip::uint iterations,
-      String const& s_edgeCondition,
-      bool findObjectPixels,
-      F const& propagationOperation
+      String const& s_edgeCondition
 ) {
    // Verify that the image is forged, scalar and binary
    DIP_THROW_IF( !in.IsForged(), E::IMAGE_NOT_FORGED );
@@ -51,84 +278,14 @@ void BinaryDilationErosion(
    bool outsideImageIsObject{};
    DIP_STACK_TRACE_THIS( outsideImageIsObject = BooleanFromString( s_edgeCondition, S::OBJECT, S::BACKGROUND ));
 
-   // Copy input plane to output plane. Operation takes place directly in the output plane.
-   Image c_in = in; // temporary copy of image header, so we can strip out. NOLINT(*-unnecessary-copy-initialization)
-   out.ReForge( in.Sizes(), 1, DT_BIN ); // reforging first in case `out` is the right size but a different data type
-   out.Copy( c_in );
-
-   // Negative connectivity means: alternate between two different connectivities
-
-   // Create arrays with offsets to neighbours for even iterations
-   dip::uint iterConnectivity0 = GetAbsBinaryConnectivity( nDims, connectivity, 0 );
-   NeighborList neighborList0( { Metric::TypeCode::CONNECTED, iterConnectivity0 }, nDims );
-   IntegerArray neighborOffsetsOut0 = neighborList0.ComputeOffsets( out.Strides() );
-
-   // Create arrays with offsets to neighbours for odd iterations
-   dip::uint iterConnectivity1 = GetAbsBinaryConnectivity( nDims, connectivity, 1 );
-   NeighborList neighborList1( { Metric::TypeCode::CONNECTED, iterConnectivity1 }, nDims );
-   IntegerArray neighborOffsetsOut1 = neighborList1.ComputeOffsets( out.Strides() );
-
-   // Data mask: the pixel data is in the first 'plane'
-   uint8 dataMask = 1;
-
-   // Use border mask to mark pixels of the image border
-   uint8 borderMask = uint8( 1 << 2 );
-   ApplyBinaryBorderMask( out, borderMask );
-
-   // The edge pixel queue
-   BinaryFifoQueue edgePixels;
-
-   // Initialize the queue by finding all edge pixels of the type according to findObjectPixels
-   FindBinaryEdgePixels( out, findObjectPixels, neighborList0, neighborOffsetsOut0, dataMask, borderMask, outsideImageIsObject, edgePixels );
-
-   // First iteration: simply process the queue
-   if( iterations > 0 ) {
-      for( BinaryFifoQueue::const_iterator itEP = edgePixels.begin(); itEP != edgePixels.end(); ++itEP ) {
-         propagationOperation( static_cast< uint8& >( **itEP ), dataMask );
-      }
-   }
-
-   // Create a coordinates computer for bounds checking of border pixels
-   CoordinatesComputer const coordsComputer = out.OffsetToCoordinatesComputer();
-
-   // Second and further iterations
-   for( dip::uint iDilIter = 1; iDilIter < iterations; ++iDilIter ) {
-      // Obtain neighbor list and offsets for this iteration
-      NeighborList const& neighborList = iDilIter & 1 ? neighborList1 : neighborList0;
-      IntegerArray const& neighborOffsetsOut = iDilIter & 1 ? neighborOffsetsOut1 : neighborOffsetsOut0;
-
-      // Process all elements currently in the queue
-      dip::sint count = static_cast< dip::sint >( edgePixels.size() );
-
-      while( --count >= 0 ) {
-         // Get front pixel from the queue
-         dip::bin* pPixel = edgePixels.front();
-         uint8& pixelByte = static_cast< uint8& >( *pPixel );
-         bool isBorderPixel = TestAnyBit( pixelByte, borderMask );
-
-         // Propagate to all neighbours which are not yet processed
-         dip::IntegerArray::const_iterator itNeighborOffset = neighborOffsetsOut.begin();
-         for( NeighborList::Iterator itNeighbor = neighborList.begin(); itNeighbor != neighborList.end(); ++itNeighbor, ++itNeighborOffset ) {
-            if( !isBorderPixel || itNeighbor.IsInImage( coordsComputer( pPixel - static_cast< dip::bin* >( out.Origin() )), out.Sizes() )) { // IsInImage() is not evaluated for non-border pixels
-               dip::bin* pNeighbor = pPixel + *itNeighborOffset;
-               uint8& neighborByte = static_cast< uint8& >( *pNeighbor );
-               bool neighborIsObject = TestAnyBit( neighborByte, dataMask );
-               if( neighborIsObject == findObjectPixels ) {
-                  // Propagate to the neighbor pixel
-                  propagationOperation( neighborByte, dataMask );
-                  // Add neighbor to the queue
-                  edgePixels.push_back( pNeighbor );
-               }
-            }
-         }
-
-         // Remove the front pixel from the queue
-         edgePixels.pop_front();
-      }
+   if( nDims == 0 ) {
+      // A 0D image has no neighbors
+      Image c_in = in; // NOLINT(*-unnecessary-copy-initialization)
+      out.ReForge( c_in.Sizes(), 1, DT_BIN );
+      out.Copy( c_in );
+      return;
    }
-
-   // Clear the edge mask of the image border
-   ClearBinaryBorderMask( out, borderMask );
+   DIP_STACK_TRACE_THIS( PackedDilationErosion< dilation >( in, out, connectivity, iterations, outsideImageIsObject ));
 }
 
 } // namespace
@@ -140,9 +297,7 @@ void BinaryDilation(
       dip::uint iterations,
       String const& edgeCondition
 ) {
-   bool findObjectPixels = false; // Dilation propagates to background pixels
-   auto propagationFunc = []( uint8& pixel, uint8 dataMask ) { SetBits( pixel, dataMask ); };   // Propagate by adding the data mask
-   BinaryDilationErosion( in, out, connectivity, iterations, edgeCondition, findObjectPixels, propagationFunc );
+   BinaryDilationErosion< true >( in, out, connectivity, iterations, edgeCondition );
 }
 
 void BinaryErosion(
@@ -152,9 +307,7 @@ void BinaryErosion(
       dip::uint iterations,
       String const& edgeCondition
 ) {
-   bool findObjectPixels = true; // Erosion propagates to object pixels
-   auto propagationFunc = []( uint8& pixel, uint8 dataMask ) { ResetBits( pixel, dataMask ); };  // Propagate by removing the data mask
-   BinaryDilationErosion( in, out, connectivity, iterations, edgeCondition, findObjectPixels, propagationFunc );
+   BinaryDilationErosion< false >( in, out, connectivity, iterations, edgeCondition );
 }
 
 void BinaryOpening(
@@ -249,7 +402,11 @@ void BinaryAreaOpening(
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
 #include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/morphology.h"
+#include "diplib/random.h"
 #include "diplib/statistics.h"
+#include "diplib/testing.h"
 
 DOCTEST_TEST_CASE( "[DIPlib] testing the binary morphological filters" ) {
    dip::Image in( { 64, 41 }, 1, dip::DT_BIN );
@@ -284,6 +441,51 @@ DOCTEST_TEST_CASE( "[DIPlib] testing the binary morphological filters" ) {
    dip::BinaryErosion( out, out, -2, 7 );
    DOCTEST_CHECK( dip::Count( out ) == 1 );
    DOCTEST_CHECK( out.At( 32, 20 ) == 1 );
+
+   // edge condition, image width not a multiple of 64: the last word of each line has 36 pixels
+   dip::Image edge( { 100, 41 }, 1, dip::DT_BIN );
+   edge = 1;
+   dip::BinaryErosion( edge, out, 1, 3, "background" );
+   DOCTEST_CHECK( dip::Count( out ) == ( 100 - 6 ) * ( 41 - 6 ));
+   DOCTEST_CHECK( out.At( 96, 20 ) == 1 );
+   DOCTEST_CHECK( out.At( 97, 20 ) == 0 );
+   DOCTEST_CHECK( out.At( 99, 20 ) == 0 );
+   dip::BinaryErosion( edge, out, 1, 3, "object" );
+   DOCTEST_CHECK( dip::Count( out ) == 100 * 41 );
+   DOCTEST_CHECK( out.At( 99, 0 ) == 1 );
+   DOCTEST_CHECK( out.At( 99, 40 ) == 1 );
+   edge = 0;
+   dip::BinaryDilation( edge, out, 1, 3, "object" );
+   DOCTEST_CHECK( dip::Count( out ) == 100 * 41 - ( 100 - 6 ) * ( 41 - 6 ));
+   DOCTEST_CHECK( out.At( 96, 20 ) == 0 );
+   DOCTEST_CHECK( out.At( 97, 20 ) == 1 );
+   DOCTEST_CHECK( out.At( 99, 20 ) == 1 );
+
+   // 3D, 0 means full connectivity, the output doesn't depend on the number of threads
+   dip::Random random( 0 );
+   dip::Image in3( { 300, 100, 30 }, 1, dip::DT_SFLOAT );
+   in3.Fill( 0 );
+   dip::UniformNoise( in3, in3, random );
+   in3 = in3 > 0.99;
+   dip::Image out3;
+   dip::BinaryDilation( in3, out3, 0, 2 );
+   dip::Image ref = dip::Dilation( in3, { 5, "rectangular" } );
+   DOCTEST_CHECK( dip::testing::CompareImages( out3, ref, dip::Option::CompareImagesMode::EXACT ));
+   dip::uint nThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 );
+   dip::BinaryErosion( out3, ref, -3, 2, "object" );
+   dip::SetNumberOfThreads( nThreads );
+   dip::BinaryErosion( out3, out3, -3, 2, "object" );
+   DOCTEST_CHECK( dip::testing::CompareImages( out3, ref, dip::Option::CompareImagesMode::EXACT ));
+
+   // Image properties are preserved
+   in.SetPixelSize( dip::PhysicalQuantity( 2.0, dip::Units::Micrometer() ));
+   dip::BinaryDilation( in, out, 1, 2 );
+   DOCTEST_CHECK( out.PixelSize() == in.PixelSize() );
+   dip::BinaryOpening( in, out, 1, 2 );
+   DOCTEST_CHECK( out.PixelSize() == in.PixelSize() );
+   dip::BinaryErosion( in, in, 1, 2 );
+   DOCTEST_CHECK( in.PixelSize()[ 0 ] == dip::PhysicalQuantity( 2.0, dip::Units::Micrometer() ));
 }
 
 #endif // DIP_CONFIG_ENABLE_DOCTEST
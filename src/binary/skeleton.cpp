@@ -17,9 +17,11 @@
 
 #include "diplib/binary.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "diplib.h"
+#include "diplib/multithreading.h"
 
 #include "bucket.h"
 #include "hilditch_condition_lut.h"
@@ -3890,6 +3892,123 @@ bool EulerOk( dip::sint const* local ) {
    return oldnumb == newnumb;
 }
 
+// Tests whether the pixel `pim` can be removed. The tests in the old image (mask mo) preserve the topology and
+// the end pixels, the tests in the recursive image (masks mi and mo) take into account pixels removed earlier
+// in the scan.
+bool Eusk3DCanRemove(
+      uint8 const* pim,
+      dip::sint sX,
+      dip::sint sY,
+      dip::sint sZ,
+      uint8 mi,
+      uint8 mo,
+      dip::sint const* bvcontour,
+      int end,
+      dip::sint endpixel[ 64 ][ 4 ]
+) {
+   // can be obtained from direction as well?
+   if(( *( pim + bvcontour[ 0 ] ) & mo ) &&
+      ( *( pim + bvcontour[ 1 ] ) & mo ) &&
+      ( *( pim + bvcontour[ 2 ] ) & mo )) {
+      return false;
+   }
+
+   // put neighbourhood in local tables
+   dip::sint oldlocal[ 27 ]; // old local neighbourhood
+   dip::sint newlocal[ 27 ]; // new local neighbourhood
+   PutInLocal( pim, sX, sY, sZ, mo, uint8( mi | mo ), oldlocal, newlocal );
+
+   // test in the old image on edge and end voxels
+   if( end && EndOk( oldlocal, end, endpixel )) { return false; }
+
+   // euler number must not change upon removal of central pixel
+   if( !EulerOk( oldlocal )) { return false; }
+
+   // number of objects must not change upon removal of pixel
+   if( !ToriwakiOk( oldlocal )) { return false; }
+
+   // now the same in recursive image, first euler
+   if( !EulerOk( newlocal )) { return false; }
+
+   // and toriwaki
+   return ToriwakiOk( newlocal );
+}
+
+// Rough cost of `Eusk3DCanRemove`, to decide on the number of threads
+constexpr dip::uint EUSK3D_COST_PER_PIXEL = 1000;
+
+// While grouping, the level of a pixel is stored in the upper 5 bits of the image (the lower 3 are masks mi, mo, mp)
+constexpr uint8 EUSK3D_LEVEL_SHIFT = 3;
+constexpr dip::uint EUSK3D_MAX_LEVEL = 255u >> EUSK3D_LEVEL_SHIFT;
+
+// Reads bucket `dist` into `pixels`, and reorders it into groups of pixels that can be processed in parallel.
+// The level of a pixel is one more than the highest level of its neighbours earlier in the bucket, pixels with
+// the same level are never neighbours. A pixel that would get a level larger than `EUSK3D_MAX_LEVEL` starts a new
+// set of levels. The pixels are sorted by set, then by level; `groups` gets the index of the first pixel of each
+// group, and the total number of pixels.
+void Eusk3DGroupPixels(
+      Bucket& b,
+      dip::sint dist,
+      dip::sint sX,
+      dip::sint sY,
+      dip::sint sZ,
+      std::vector< uint8* >& pixels,
+      std::vector< dip::uint >& groups
+) {
+   pixels.clear();
+   b.startread( dist );
+   while( b.go ) {
+      uint8* pim{};
+      b.RCLP( pim );
+      pixels.push_back( pim );
+   }
+   groups.assign( 1, 0 );
+   std::vector< uint8 > levels( pixels.size() );
+   std::vector< uint8* > sorted( pixels.size() );
+   dip::uint first = 0; // first pixel in the current set of levels
+   dip::uint nLevels = 0;
+   auto closeSet = [ & ]( dip::uint last ) {
+      // counting sort by level
+      std::vector< dip::uint > offsets( nLevels + 1, 0 );
+      for( dip::uint ii = first; ii < last; ++ii ) {
+         ++offsets[ levels[ ii ] ];
+      }
+      dip::uint offset = first;
+      for( dip::uint ll = 1; ll <= nLevels; ++ll ) {
+         dip::uint n = offsets[ ll ];
+         offsets[ ll ] = offset;
+         offset += n;
+         groups.push_back( offset );
+      }
+      for( dip::uint ii = first; ii < last; ++ii ) {
+         sorted[ offsets[ levels[ ii ]]++ ] = pixels[ ii ];
+         *pixels[ ii ] &= uint8( ~( EUSK3D_MAX_LEVEL << EUSK3D_LEVEL_SHIFT ));
+      }
+      first = last;
+      nLevels = 0;
+   };
+   for( dip::uint ii = 0; ii < pixels.size(); ++ii ) {
+      uint8* pim = pixels[ ii ];
+      uint8 level = 0;
+      for( dip::sint zz = -1; zz <= 1; ++zz ) {
+         for( dip::sint yy = -1; yy <= 1; ++yy ) {
+            uint8 const* p = pim + zz * sZ + yy * sY;
+            level = std::max( { level, *( p - sX ), *p, *( p + sX ) } );
+         }
+      }
+      level = uint8(( level >> EUSK3D_LEVEL_SHIFT ) + 1 );
+      if( level > EUSK3D_MAX_LEVEL ) {
+         closeSet( ii );
+         level = 1;
+      }
+      levels[ ii ] = level;
+      nLevels = std::max( nLevels, static_cast< dip::uint >( level ));
+      *pim |= uint8( level << EUSK3D_LEVEL_SHIFT );
+   }
+   closeSet( pixels.size() );
+   pixels.swap( sorted );
+}
+
 void Eusk3D(
       uint8* pimb1,
       uint8 mi,
@@ -3904,9 +4023,6 @@ void Eusk3D(
       dip::sint strideY,
       dip::sint strideZ
 ) {
-   dip::sint oldlocal[ 27 ]; // old local neighbourhood
-   dip::sint newlocal[ 27 ]; // new local neighbourhood
-
    dip::sint sX2 = 2 * strideX;
    dip::sint sY2 = 2 * strideY;
    dip::sint sZ2 = 2 * strideZ;
@@ -3931,6 +4047,11 @@ void Eusk3D(
    // create bucket structure buckets
    Bucket b( nbuckets, QUEUE_SIZE_3D );
 
+   // pixels with the current distance grouped for parallel processing
+   dip::uint nThreads = static_cast< dip::uint >( sizex * sizey * sizez ) < threadingThreshold ? 1 : GetNumberOfThreads();
+   std::vector< uint8* > pixels;
+   std::vector< dip::uint > groups;
+
    // fill bucket 0
    EuskFillBucketZero( b, pimb1, mi, edge, sizex, sizey, sizez, strideX, strideY, strideZ );
 
@@ -4602,47 +4723,58 @@ void Eusk3D(
       b.closewrite();
       b.Free( dist - d9 );
 
-      for( dip::uint ii = 0; ii < 3; ++ii ) {
-         b.startread( dist );
-         while( b.go ) {
-            b.RCL( pim, dirc );
-
-            // can be obtained from direction as well?
-            if(( *( pim + bvcontour[ ii ][ 0 ] ) & mo ) &&
-               ( *( pim + bvcontour[ ii ][ 1 ] ) & mo ) &&
-               ( *( pim + bvcontour[ ii ][ 2 ] ) & mo )) {
-                  continue;
+      if( nThreads == 1 ) {
+         for( dip::uint ii = 0; ii < 3; ++ii ) {
+            b.startread( dist );
+            while( b.go ) {
+               b.RCL( pim, dirc );
+               if( Eusk3DCanRemove( pim, strideX, strideY, strideZ, mi, mo, bvcontour[ ii ], end, endpixel )) {
+                  // REMOVE
+                  *pim &= ~mi;
+               }
             }
 
-            // put neighbourhood in local tables
-            PutInLocal( pim, strideX, strideY, strideZ, mo, uint8( mi | mo ), oldlocal, newlocal );
-
-            // test in the old image on edge and end voxels
-            if( end && EndOk( oldlocal, end, endpixel )) { continue; }
-
-            // euler number must not change upon removal of central pixel
-            if( !EulerOk( oldlocal )) { continue; }
-
-            // number of objects must not change upon removal of pixel
-            if( !ToriwakiOk( oldlocal )) { continue; }
-
-            // now the same in recursive image, first euler
-            if( !EulerOk( newlocal )) { continue; }
-
-            // and toriwaki
-            if( !ToriwakiOk( newlocal )) { continue; }
-
-            // REMOVE
-            *pim &= ~mi;
+            // update image, if pixel may be removed: remove mo, restore mi
+            b.startread( dist );
+            while( b.go ) {
+               b.RCLP( pim );
+               if( !( *pim & mi )) {
+                  *pim |= mi;
+                  *pim &= ~mo;
+               }
+            }
          }
+      } else {
+         // Whether a pixel can be removed depends on the pixels removed before it in bucket order. Pixels that
+         // are not neighbours of any pixel before them in the same group can be tested in parallel, the groups
+         // are processed in order. This produces the same result as the loop above.
+         Eusk3DGroupPixels( b, dist, strideX, strideY, strideZ, pixels, groups );
+         for( dip::uint ii = 0; ii < 3; ++ii ) {
+            for( dip::uint gg = 1; gg < groups.size(); ++gg ) {
+               dip::sint first = static_cast< dip::sint >( groups[ gg - 1 ] );
+               dip::sint last = static_cast< dip::sint >( groups[ gg ] );
+               int groupThreads = static_cast< dip::uint >( last - first ) * EUSK3D_COST_PER_PIXEL < threadingThreshold
+                                  ? 1 : static_cast< int >( nThreads );
+               #pragma omp parallel for num_threads( groupThreads ) schedule( static )
+               for( dip::sint jj = first; jj < last; ++jj ) {
+                  uint8* ppix = pixels[ static_cast< dip::uint >( jj ) ];
+                  if( Eusk3DCanRemove( ppix, strideX, strideY, strideZ, mi, mo, bvcontour[ ii ], end, endpixel )) {
+                     // REMOVE
+                     *ppix &= ~mi;
+                  }
+               }
+            }
 
-         // update image, if pixel may be removed: remove mo, restore mi
-         b.startread( dist );
-         while( b.go ) {
-            b.RCLP( pim );
-            if( !( *pim & mi )) {
-               *pim |= mi;
-               *pim &= ~mo;
+            // update image, if pixel may be removed: remove mo, restore mi
+            dip::sint nPixels = static_cast< dip::sint >( pixels.size() );
+            int updateThreads = pixels.size() < threadingThreshold ? 1 : static_cast< int >( nThreads );
+            #pragma omp parallel for num_threads( updateThreads ) schedule( static )
+            for( dip::sint jj = 0; jj < nPixels; ++jj ) {
+               uint8* ppix = pixels[ static_cast< dip::uint >( jj ) ];
+               if( !( *ppix & mi )) {
+                  *ppix |= mi;
+                  *ppix &= ~mo;
+               }
             }
          }
       }
@@ -4728,3 +4860,41 @@ void EuclideanSkeleton(
 }
 
 } // namespace dip
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/linear.h"
+#include "diplib/multithreading.h"
+#include "diplib/random.h"
+#include "diplib/regions.h"
+#include "diplib/statistics.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing dip::EuclideanSkeleton" ) {
+   // 3D: the output doesn't depend on the number of threads
+   dip::uint nThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 );
+   dip::Random random( 0 );
+   dip::Image in( { 64, 50, 40 }, 1, dip::DT_SFLOAT );
+   in.Fill( 0 );
+   dip::UniformNoise( in, in, random );
+   in = dip::Gauss( in, { 3 } ) > 0.5;
+   dip::Image ref1 = dip::EuclideanSkeleton( in, "natural", "background" );
+   dip::Image ref2 = dip::EuclideanSkeleton( in, "loose ends away", "object" );
+   dip::SetNumberOfThreads( nThreads );
+   dip::Image out = dip::EuclideanSkeleton( in, "natural", "background" );
+   DOCTEST_CHECK( dip::testing::CompareImages( out, ref1, dip::Option::CompareImagesMode::EXACT ));
+   out = dip::EuclideanSkeleton( in, "loose ends away", "object" );
+   DOCTEST_CHECK( dip::testing::CompareImages( out, ref2, dip::Option::CompareImagesMode::EXACT ));
+   DOCTEST_CHECK( dip::Count( out ) < dip::Count( in ));
+
+   // A skeleton of a solid box is a single connected object
+   dip::Image box( { 30, 20, 10 }, 1, dip::DT_BIN );
+   box = 0;
+   box.At( dip::Range{ 5, 24 }, dip::Range{ 5, 14 }, dip::Range{ 2, 7 } ) = 1;
+   out = dip::EuclideanSkeleton( box );
+   DOCTEST_CHECK( dip::Count( out ) > 0 );
+   DOCTEST_CHECK( dip::Maximum( dip::Label( out, 3 )).As< dip::uint >() == 1 );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
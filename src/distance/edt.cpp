@@ -23,9 +23,11 @@
 
 #include "diplib.h"
 #include "diplib/math.h"
+#include "diplib/multithreading.h"
 
 #include "find_neighbors.h"
 #include "separable_dt.h"
+#include "sweep.h"
 
 namespace dip {
 
@@ -36,7 +38,8 @@ void EDTFast2D(
       UnsignedArray const& sizes,
       IntegerArray const& stride,
       FloatArray const& distance,
-      bool border
+      bool border,
+      dip::uint nThreads
 ) {
    dip::sint nx = static_cast< dip::sint >( sizes[ 0 ] );
    dip::sint ny = static_cast< dip::sint >( sizes[ 1 ] );
@@ -68,12 +71,9 @@ void EDTFast2D(
          fsdy[ ii ] = d * d * dyy;
       }
    }
-   std::vector< XYPosition > d( static_cast< dip::uint >(( nx + 2 ) * 2 ));
    sfloat maxDistance = fsdx[ 0 ] + fsdy[ 0 ];
 
    // Initialize
-   XYPosition* d1 = d.data();
-   XYPosition* d2 = d.data() + ( nx + 2 );
    XYPosition infd = { 0, 0 };
    XYPosition zero = { nx, ny };
    XYPosition x0y_1 = { nx, ny - 1 };
@@ -82,17 +82,16 @@ void EDTFast2D(
    XYPosition dx1 = { 1, 0 };
    XYPosition dy1 = { 0, 1 };
    XYPosition bp = border ? infd : zero;
+   // The state for each step is the line of vectors computed in the previous step
+   using State = std::vector< XYPosition >;
+   State initial( static_cast< dip::uint >( nx + 2 ), bp );
+   auto equal = []( State const& a, State const& b ) { return a == b; };
 
    // Forward scan
-   XYPosition* dbl = &d1[ 1 ];
-   for( dip::sint ii = 0; ii < nx; ii++ ) {
-      dbl[ ii ] = bp;
-   }
-
-   for( dip::sint yy = 0, py = 0; yy < ny; yy++, py += sy ) {
-      // We split d into buffers that are swapped to read or write from
-      XYPosition* dcl = ( yy & 1 ? d1 : d2 );
-      XYPosition* dbl = ( yy & 1 ? d2 + 1 : d1 + 1 );
+   auto forwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = static_cast< dip::sint >( index ) * sy;
+      XYPosition* dcl = current.data();
+      XYPosition const* dbl = previous.data() + 1;
 
       *dcl++ = bp;
       for( dip::sint xx = 0, px = py; xx < nx; xx++, dcl++, dbl++, px += sx ) {
@@ -132,10 +131,14 @@ void EDTFast2D(
          if(( dcl->x != zero.x ) || ( dcl->y != zero.y )) {
             if((( dcl + 1 )->x == infd.x ) && (( dcl + 1 )->y == infd.y )) {
                if(( dcl->x == infd.x ) && ( dcl->y == infd.y )) {
-                  oi[ px ] = maxDistance;
+                  if( write ) {
+                     oi[ px ] = maxDistance;
+                  }
                } else {
                   XYPosition* c = dcl;
-                  oi[ px ] = fsdx[ c->x ] + fsdy[ c->y ];
+                  if( write ) {
+                     oi[ px ] = fsdx[ c->x ] + fsdy[ c->y ];
+                  }
                }
             } else {
                XYPosition* c = dcl;
@@ -145,24 +148,23 @@ void EDTFast2D(
                if( fdc > fdb ) {
                   dcl->x = ( dcl + 1 )->x + dx1.x;
                   dcl->y = ( dcl + 1 )->y + dx1.y;
-                  oi[ px ] = fdb;
-               } else {
+                  if( write ) {
+                     oi[ px ] = fdb;
+                  }
+               } else if( write ) {
                   oi[ px ] = fdc;
                }
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, forwardStep, equal, nThreads );
 
    // Backward scan
-   dbl = d1 + 1;
-   for( dip::sint ii = 0; ii < nx; ii++ ) {
-      dbl[ ii ] = bp;
-   }
-
-   for( dip::sint ii = 0, py = ny1sy; ii < ny; ii++, py -= sy ) {
-      XYPosition* dcl = ( ii & 1 ? d1 + nx + 1 : d2 + nx + 1 );
-      XYPosition* dbl = ( ii & 1 ? d2 + nx : d1 + nx );
+   auto backwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = ny1sy - static_cast< dip::sint >( index ) * sy;
+      XYPosition* dcl = current.data() + nx + 1;
+      XYPosition const* dbl = previous.data() + nx;
       *dcl-- = bp;
 
       for( dip::sint xx = 0, px = py + nx1sx; xx < nx; xx++, dcl--, dbl--, px -= sx ) {
@@ -199,7 +201,7 @@ void EDTFast2D(
                if( dcl->x != infd.x || dcl->y != infd.y ) {
                   XYPosition* c = dcl;
                   sfloat fdc = fsdx[ c->x ] + fsdy[ c->y ];
-                  if( oi[ px ] > fdc ) {
+                  if( write && ( oi[ px ] > fdc )) {
                      oi[ px ] = fdc;
                   }
                }
@@ -211,18 +213,19 @@ void EDTFast2D(
                if( fdc > fdb ) {
                   dcl->x = ( dcl - 1 )->x - dx1.x;
                   dcl->y = ( dcl - 1 )->y - dx1.y;
-                  if( oi[ px ] > fdb ) {
+                  if( write && ( oi[ px ] > fdb )) {
                      oi[ px ] = fdb;
                   }
                } else {
-                  if( oi[ px ] > fdc ) {
+                  if( write && ( oi[ px ] > fdc )) {
                      oi[ px ] = fdc;
                   }
                }
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, backwardStep, equal, nThreads );
 }
 
 void EDTFast3D(
@@ -230,7 +233,8 @@ void EDTFast3D(
       UnsignedArray const& sizes,
       IntegerArray const& stride,
       FloatArray const& distance,
-      bool border
+      bool border,
+      dip::uint nThreads
 ) {
    dip::sint nx = static_cast< dip::sint >( sizes[ 0 ] );
    dip::sint ny = static_cast< dip::sint >( sizes[ 1 ] );
@@ -283,25 +287,22 @@ void EDTFast3D(
          }
       }
    }
-   std::vector< XYZPosition > d( static_cast< dip::uint >(( nx + 2 ) * ( ny + 2 ) * 2));
    sfloat maxdist = fsdx[ 0 ] + fsdy[ 0 ] + fsdz[ 0 ];
 
    // Initialize
-   XYZPosition* d1 = d.data();
-   XYZPosition* d2 = d1 + ( nx + 2 ) * ( ny + 2 );
    XYZPosition infd = { 0, 0, 0 };
    XYZPosition zero = { nx, ny, nz };
    XYZPosition bp = border ? infd : zero;
+   // The state for each step is the plane of vectors computed in the previous step
+   using State = std::vector< XYZPosition >;
+   State initial( static_cast< dip::uint >(( nx + 2 ) * ( ny + 2 )), bp );
+   auto equal = []( State const& a, State const& b ) { return a == b; };
 
-   XYZPosition* dbl = d1;
-   for( dip::sint ii = ( nx + 2 ) * ( ny + 2 ); --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint zz = 0, pz = 0; zz < nz; zz++, pz += sz ) {
-
-      XYZPosition* dcl = ( zz & 1 ? d1 : d2 );
-      XYZPosition* dbl = ( zz & 1 ? d2 + nx + 3 : d1 + nx + 3 );
+   // Forward scan
+   auto forwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint pz = static_cast< dip::sint >( index ) * sz;
+      XYZPosition* dcl = current.data();
+      XYZPosition const* dbl = previous.data() + nx + 3;
 
       for( dip::sint ii = nx + 2; --ii >= 0; ) {
          *dcl++ = bp;
@@ -381,8 +382,10 @@ void EDTFast3D(
 
                if( dbt->x == infd.x && dbt->y == infd.y && dbt->z == infd.z ) {
                   if( dcl->x == infd.x && dcl->y == infd.y && dcl->z == infd.z ) {
-                     oi[ px ] = maxdist;
-                  } else {
+                     if( write ) {
+                        oi[ px ] = maxdist;
+                     }
+                  } else if( write ) {
                      oi[ px ] = fsdx[ dcl->x ] + fsdy[ dcl->y ] + fsdz[ dcl->z ];
                   }
                } else {
@@ -392,26 +395,26 @@ void EDTFast3D(
                      dcl->x = dbt->x;
                      dcl->y = dbt->y + 1;
                      dcl->z = dbt->z;
-                     oi[ px ] = fdb;
-                  } else {
+                     if( write ) {
+                        oi[ px ] = fdb;
+                     }
+                  } else if( write ) {
                      oi[ px ] = fdc;
                   }
                }
-            } else {
+            } else if( write ) {
                oi[ px ] = 0.0;
             }
          }
       }
-   }
-
-   dbl = d1;
-   for( dip::sint ii = ( nx + 2 ) * ( ny + 2 ); --ii >= 0; ) {
-      *dbl++ = bp;
-   }
+   };
+   RunSweep( static_cast< dip::uint >( nz ), initial, forwardStep, equal, nThreads );
 
-   for( dip::sint zz = 0, pz = nz1sz; zz < nz; zz++, pz -= sz ) {
-      XYZPosition* dcl = ( zz & 1 ? ( d1 + ( nx + 2 ) * ( ny + 2 ) - 1 ) : ( d2 + ( nx + 2 ) * ( ny + 2 ) - 1 ));
-      XYZPosition* dbl = ( zz & 1 ? ( d2 + ( nx + 2 ) * ( ny + 1 ) - 2 ) : ( d1 + ( nx + 2 ) * ( ny + 1 ) - 2 ));
+   // Backward scan
+   auto backwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint pz = nz1sz - static_cast< dip::sint >( index ) * sz;
+      XYZPosition* dcl = current.data() + ( nx + 2 ) * ( ny + 2 ) - 1;
+      XYZPosition const* dbl = previous.data() + ( nx + 2 ) * ( ny + 1 ) - 2;
 
       for( dip::sint ii = nx + 2; --ii >= 0; ) {
          *dcl-- = bp;
@@ -494,7 +497,7 @@ void EDTFast3D(
                if( dbt->x == infd.x && dbt->y == infd.y && dbt->z == infd.z ) {
                   if( dcl->x != infd.x || dcl->y != infd.y || dcl->z != infd.z ) {
                      sfloat fdc = fsdx[ dcl->x ] + fsdy[ dcl->y ] + fsdz[ dcl->z ];
-                     if( oi[ px ] > fdc ) {
+                     if( write && ( oi[ px ] > fdc )) {
                         oi[ px ] = fdc;
                      }
                   }
@@ -505,11 +508,11 @@ void EDTFast3D(
                      dcl->x = dbt->x;
                      dcl->y = dbt->y - 1;
                      dcl->z = dbt->z;
-                     if( oi[ px ] > fdb ) {
+                     if( write && ( oi[ px ] > fdb )) {
                         oi[ px ] = fdb;
                      }
                   } else {
-                     if( oi[ px ] > fdc ) {
+                     if( write && ( oi[ px ] > fdc )) {
                         oi[ px ] = fdc;
                      }
                   }
@@ -517,7 +520,8 @@ void EDTFast3D(
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( nz ), initial, backwardStep, equal, nThreads );
 }
 
 void EDTTies2D(
@@ -526,7 +530,8 @@ void EDTTies2D(
       IntegerArray const& stride,
       FloatArray const& distance,
       bool border,
-      bool useTrue
+      bool useTrue,
+      dip::uint nThreads
 ) {
    dip::sint dim = 2;
    dip::sint nx = static_cast< dip::sint >( sizes[ 0 ] );
@@ -564,32 +569,29 @@ void EDTTies2D(
          fsdy[ ii ] = d * d * dyy;
       }
    }
-   std::vector< sfloat > fdnbBuffer( static_cast< dip::uint >( 10 * ( nx + ny )));
-   sfloat* fdnb = fdnbBuffer.data();
-   std::vector< dip::sint > nb( static_cast< dip::uint >( nx * 2 * ( dim * guess + 2 )));
-   std::vector< XYPosition > pnbBuffer( static_cast< dip::uint >( 10 * ( nx + ny )));
-   XYPosition* pnb = pnbBuffer.data();
-   std::vector< dip::sint* > d( static_cast< dip::uint >(( nx + 2 ) * 2 ));
    sfloat maxdist = fsdx[ 0 ] + fsdy[ 0 ];
 
    // Initialize
-   dip::sint* nb0 = nb.data();
-   dip::sint* nb1 = nb0 + nx * ( guess * dim + 2 );
-   dip::sint** d1 = d.data();
-   dip::sint** d2 = d1 + ( nx + 2 );
    dip::sint zero = 0;
    dip::sint* bp = ( border ? &zero : nullptr );
+   // The state for each step is the line of neighbor lists computed in the previous step
+   using State = NeighborListState< XYPosition >;
+   State initial{
+         std::vector< dip::sint* >( static_cast< dip::uint >( nx + 2 ), bp ),
+         std::vector< dip::sint >( static_cast< dip::uint >( nx * ( guess * dim + 2 ))),
+         std::vector< XYPosition >( static_cast< dip::uint >( 10 * ( nx + ny ))),
+         std::vector< sfloat >( static_cast< dip::uint >( 10 * ( nx + ny )))
+   };
+   auto equal = []( State const& a, State const& b ) { return a == b; };
 
-   dip::sint** dbl = d1 + 1;
-   for( dip::sint ii = nx; --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint yy = 0, py = 0; yy < ny; yy++, py += sy ) {
-
-      dip::sint* nbp = ( yy & 1 ? nb1 : nb0 );
-      dip::sint** dcl = ( yy & 1 ? d1 : d2 );
-      dip::sint** dbl = ( yy & 1 ? d2 + 1 : d1 + 1 );
+   // Forward scan
+   auto forwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = static_cast< dip::sint >( index ) * sy;
+      XYPosition* pnb = current.pnb.data();
+      sfloat* fdnb = current.fdnb.data();
+      dip::sint* nbp = current.nb.data();
+      dip::sint** dcl = current.d.data();
+      dip::sint* const* dbl = previous.d.data() + 1;
 
       *dcl++ = bp;
       for( dip::sint xx = 0, px = py; xx < nx; xx++, dcl++, dbl++, px += sx ) {
@@ -668,7 +670,9 @@ void EDTTies2D(
             *dcl = nbp;
             if( kk == 0 ) {
                *nbp++ = 0;
-               oi[ px ] = maxdist;
+               if( write ) {
+                  oi[ px ] = maxdist;
+               }
             } else {
                sfloat mindist{};
                dip::sint minpos{};
@@ -679,24 +683,26 @@ void EDTTies2D(
                for( dip::sint jj = kk; --jj >= 0; nbs++, pnbp++ ) {
                   *nbs = *pnbp;
                }
-               oi[ px ] = mindist;
+               if( write ) {
+                  oi[ px ] = mindist;
+               }
                nbp += kk * dim;
             }
-         } else {
+         } else if( write ) {
             oi[ px ] = 0.0;
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, forwardStep, equal, nThreads );
 
-   dbl = d1 + 1;
-   for( dip::sint ii = nx; --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint yy = 0, py = ny1sy; yy < ny; yy++, py -= sy ) {
-      dip::sint* nbp = ( yy & 1 ? nb1 : nb0 );
-      dip::sint** dcl = ( yy & 1 ? d1 + nx + 1 : d2 + nx + 1 );
-      dip::sint** dbl = ( yy & 1 ? d2 + nx : d1 + nx );
+   // Backward scan
+   auto backwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = ny1sy - static_cast< dip::sint >( index ) * sy;
+      XYPosition* pnb = current.pnb.data();
+      sfloat* fdnb = current.fdnb.data();
+      dip::sint* nbp = current.nb.data();
+      dip::sint** dcl = current.d.data() + nx + 1;
+      dip::sint* const* dbl = previous.d.data() + nx;
 
       *dcl-- = bp;
       for( dip::sint xx = 0, px = py + nx1sx; xx < nx; xx++, dcl--, dbl--, px -= sx ) {
@@ -775,7 +781,9 @@ void EDTTies2D(
             *dcl = nbp;
             if( kk == 0 ) {
                *nbp++ = 0;
-               oi[ px ] = std::sqrt( oi[ px ] );
+               if( write ) {
+                  oi[ px ] = std::sqrt( oi[ px ] );
+               }
             } else {
                sfloat mindist{};
                dip::sint minpos{};
@@ -786,16 +794,19 @@ void EDTTies2D(
                for( dip::sint jj = kk; --jj >= 0; nbs++, pnbp++ ) {
                   *nbs = *pnbp;
                }
-               if( mindist < oi[ px ] ) {
-                  oi[ px ] = std::sqrt( mindist );
-               } else {
-                  oi[ px ] = std::sqrt( oi[ px ] );
+               if( write ) {
+                  if( mindist < oi[ px ] ) {
+                     oi[ px ] = std::sqrt( mindist );
+                  } else {
+                     oi[ px ] = std::sqrt( oi[ px ] );
+                  }
                }
                nbp += kk * dim;
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, backwardStep, equal, nThreads );
 }
 
 void EDTTies3D(
@@ -1483,18 +1494,20 @@ void EuclideanDistanceTransform(
       IntegerArray const& stride = out.Strides();
       sfloat* data = static_cast< sfloat* >( out.Origin() );
 
+      dip::uint nThreads = std::min( GetNumberOfThreads(), out.NumberOfPixels() / threadingThreshold );
+
       // Call the real guts function
       if( method == S::FAST ) {
          if( dim == 2 ) {
-            EDTFast2D( data, sizes, stride, dist, objectBorder );
+            EDTFast2D( data, sizes, stride, dist, objectBorder, nThreads );
          } else {
-            EDTFast3D( data, sizes, stride, dist, objectBorder );
+            EDTFast3D( data, sizes, stride, dist, objectBorder, nThreads );
          }
          Sqrt( out, out );
       } else if(( method == S::TIES ) || ( method == S::TRUE )) {
          bool useTrue = method == S::TRUE;
          if( dim == 2 ) {
-            EDTTies2D( data, sizes, stride, dist, objectBorder, useTrue );
+            EDTTies2D( data, sizes, stride, dist, objectBorder, useTrue, nThreads );
          } else {
             EDTTies3D( data, sizes, stride, dist, objectBorder, useTrue );
          }
@@ -1512,3 +1525,67 @@ void EuclideanDistanceTransform(
 }
 
 } // namespace dip
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/random.h"
+#include "diplib/statistics.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing the vector propagation distance transforms in parallel" ) {
+   // Processing the image in multiple slabs must yield exactly the same result as processing it in one go
+   dip::Random random( 0 );
+   dip::FloatArray dist{ 1.0, 1.3, 0.8 };
+   for( dip::dfloat probability : { 0.001, 0.05 } ) {
+      dip::Image img2D( { 173, 158 }, 1, dip::DT_SFLOAT );
+      img2D.Fill( 0 );
+      img2D = dip::UniformNoise( img2D, random ) >= probability;
+      dip::Image img3D( { 31, 24, 45 }, 1, dip::DT_SFLOAT );
+      img3D.Fill( 0 );
+      img3D = dip::UniformNoise( img3D, random ) >= probability;
+      for( bool border : { false, true } ) {
+         dip::Image ref2D = dip::Convert( img2D, dip::DT_SFLOAT );
+         dip::EDTFast2D( static_cast< dip::sfloat* >( ref2D.Origin() ), ref2D.Sizes(), ref2D.Strides(), dist, border, 1 );
+         dip::Image ref3D = dip::Convert( img3D, dip::DT_SFLOAT );
+         dip::EDTFast3D( static_cast< dip::sfloat* >( ref3D.Origin() ), ref3D.Sizes(), ref3D.Strides(), dist, border, 1 );
+         dip::Image refTies = dip::Convert( img2D, dip::DT_SFLOAT );
+         dip::EDTTies2D( static_cast< dip::sfloat* >( refTies.Origin() ), refTies.Sizes(), refTies.Strides(), dist, border, false, 1 );
+         dip::Image refTrue = dip::Convert( img2D, dip::DT_SFLOAT );
+         dip::EDTTies2D( static_cast< dip::sfloat* >( refTrue.Origin() ), refTrue.Sizes(), refTrue.Strides(), dist, border, true, 1 );
+         for( dip::uint nThreads : { 3u, 4u, 7u } ) {
+            dip::Image out = dip::Convert( img2D, dip::DT_SFLOAT );
+            dip::EDTFast2D( static_cast< dip::sfloat* >( out.Origin() ), out.Sizes(), out.Strides(), dist, border, nThreads );
+            DOCTEST_CHECK( dip::All( out == ref2D ).As< bool >() );
+            out = dip::Convert( img3D, dip::DT_SFLOAT );
+            dip::EDTFast3D( static_cast< dip::sfloat* >( out.Origin() ), out.Sizes(), out.Strides(), dist, border, nThreads );
+            DOCTEST_CHECK( dip::All( out == ref3D ).As< bool >() );
+            out = dip::Convert( img2D, dip::DT_SFLOAT );
+            dip::EDTTies2D( static_cast< dip::sfloat* >( out.Origin() ), out.Sizes(), out.Strides(), dist, border, false, nThreads );
+            DOCTEST_CHECK( dip::All( out == refTies ).As< bool >() );
+            out = dip::Convert( img2D, dip::DT_SFLOAT );
+            dip::EDTTies2D( static_cast< dip::sfloat* >( out.Origin() ), out.Sizes(), out.Strides(), dist, border, true, nThreads );
+            DOCTEST_CHECK( dip::All( out == refTrue ).As< bool >() );
+         }
+      }
+   }
+   // A single background pixel affects all slabs, the slabs can't be corrected and the sweep is run serially
+   dip::Image img( { 173, 158 }, 1, dip::DT_SFLOAT );
+   img.Fill( 1 );
+   img.At( 80, 0 ) = 0;
+   dip::Image ref = img.Copy();
+   dip::EDTFast2D( static_cast< dip::sfloat* >( ref.Origin() ), ref.Sizes(), ref.Strides(), dist, false, 1 );
+   dip::Image out = img.Copy();
+   dip::EDTFast2D( static_cast< dip::sfloat* >( out.Origin() ), out.Sizes(), out.Strides(), dist, false, 4 );
+   DOCTEST_CHECK( dip::All( out == ref ).As< bool >() );
+   // Fewer than two lines per thread, the correction of a slab is limited to a single line and doesn't converge
+   img = dip::Image( { 100, 4 }, 1, dip::DT_SFLOAT );
+   img.Fill( 1 );
+   img.At( 50, 0 ) = 0;
+   ref = img.Copy();
+   dip::EDTFast2D( static_cast< dip::sfloat* >( ref.Origin() ), ref.Sizes(), ref.Strides(), dist, true, 1 );
+   out = img.Copy();
+   dip::EDTFast2D( static_cast< dip::sfloat* >( out.Origin() ), out.Sizes(), out.Strides(), dist, true, 4 );
+   DOCTEST_CHECK( dip::All( out == ref ).As< bool >() );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -18,6 +18,12 @@
 #ifndef DIP_FIND_NEIGHBORS_H
 #define DIP_FIND_NEIGHBORS_H
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "diplib.h"
+
 namespace dip {
 
 namespace {
@@ -33,6 +39,43 @@ struct XYZPosition {
    dip::sint z;
 };
 
+inline bool operator==( XYPosition const& a, XYPosition const& b ) {
+   return ( a.x == b.x ) && ( a.y == b.y );
+}
+
+inline bool operator==( XYZPosition const& a, XYZPosition const& b ) {
+   return ( a.x == b.x ) && ( a.y == b.y ) && ( a.z == b.z );
+}
+
+// The state of the "ties" and "true" algorithms for one image line or plane. For each pixel, `d` has a pointer to
+// the list of vectors to the nearest background pixels, or `nullptr` for background pixels. The lists are stored
+// in `nb`, each is a count followed by that many positions. `pnb` and `fdnb` are scratch buffers.
+template< typename Position >
+struct NeighborListState {
+   std::vector< dip::sint* > d;
+   std::vector< dip::sint > nb;
+   std::vector< Position > pnb;
+   std::vector< sfloat > fdnb;
+};
+
+// Compares the lists pointed to by the two states, not the pointers themselves.
+template< typename Position >
+bool operator==( NeighborListState< Position > const& a, NeighborListState< Position > const& b ) {
+   constexpr dip::sint dim = static_cast< dip::sint >( sizeof( Position ) / sizeof( dip::sint ));
+   for( dip::uint ii = 0; ii < a.d.size(); ++ii ) {
+      dip::sint const* pa = a.d[ ii ];
+      dip::sint const* pb = b.d[ ii ];
+      if(( pa == nullptr ) || ( pb == nullptr )) {
+         if( pa != pb ) {
+            return false;
+         }
+      } else if(( *pa != *pb ) || !std::equal( pa + 1, pa + 1 + *pa * dim, pb + 1 )) {
+         return false;
+      }
+   }
+   return true;
+}
+
 inline dip::sint FindNeighbors2D(
    XYPosition* p,
    sfloat* mindist,
@@ -0,0 +1,177 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DIP_SWEEP_H
+#define DIP_SWEEP_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "diplib.h"
+#include "diplib/multithreading.h"
+
+namespace dip {
+
+namespace {
+
+// The vector propagation algorithms in `edt.cpp` and `vdt.cpp` are raster scans: each step of a sweep processes
+// one image line (2D) or plane (3D), and depends only on the "state" left by the previous step (the vectors to the
+// nearest background pixels found for the previous line or plane). `RunSweep()` splits the sweep into `nThreads`
+// slabs of consecutive steps, and processes these in parallel:
+//
+//  1. Each slab (except the last one) is run without writing the output, starting from the initial state (the state
+//     before the first step of the sweep). This yields a guess for the state at the end of each slab.
+//  2. The state at the end of each slab is corrected in order. The slab is run from its correct starting state
+//     (the corrected end state of the previous slab), side by side with the guessed starting state. As soon as the
+//     two states become identical, the remainder of the slab will also be identical, and the guessed end state
+//     from step 1 is the correct one. For most images this happens within a few steps. The correction of a slab
+//     is serial, if it doesn't converge within a fraction of the slab's steps, the parallel algorithm is abandoned
+//     and the whole sweep is run serially, such that the work is never much more than twice that of the serial sweep.
+//  3. Each slab is run again, starting from its correct state, writing the output.
+//
+// The result is identical to that of a single pass over the whole image, but the work is roughly doubled.
+//
+// `step( index, previous, current, write )` processes step `index`, reading the state from `previous` and writing
+// the new state to `current`; the output image is only written to if `write` is true. It must not read output pixels
+// other than those of step `index`. `equal( a, b )` compares two states. `initial` is the state before the first step,
+// copies of it are used as buffers for the state. If the state contains pointers, these must not point into the
+// state itself for the initial state.
+template< typename State, typename StepFunction, typename EqualFunction >
+void RunSweep(
+      dip::uint nSteps,
+      State const& initial,
+      StepFunction const& step,
+      EqualFunction const& equal,
+      dip::uint nThreads
+) {
+   nThreads = std::min( nThreads, nSteps );
+   if( nThreads < 3 ) {
+      // With two threads, we'd be doing twice the work in two threads, which gains nothing.
+      nThreads = 1;
+   }
+
+   // Runs steps [first, last), starting at state `start`, using `a` and `b` as buffers.
+   // Returns a pointer to the state after the last step (which is `a` or `b`).
+   auto runSlab = [ & ]( dip::uint first, dip::uint last, State const& start, State& a, State& b, bool write ) {
+      State const* previous = &start;
+      State* current = &a;
+      State* other = &b;
+      for( dip::uint ii = first; ii < last; ++ii ) {
+         step( ii, *previous, *current, write );
+         previous = current;
+         std::swap( current, other );
+      }
+      return previous;
+   };
+
+   // Runs the whole sweep in the current thread.
+   auto runSerial = [ & ]() {
+      State a = initial;
+      State b = initial;
+      runSlab( 0, nSteps, initial, a, b, true );
+   };
+
+   if( nThreads == 1 ) {
+      runSerial();
+      return;
+   }
+
+   std::vector< dip::uint > starts( nThreads + 1 );
+   for( dip::uint ii = 0; ii <= nThreads; ++ii ) {
+      starts[ ii ] = nSteps * ii / nThreads;
+   }
+   std::vector< State > bufferA;
+   std::vector< State > bufferB;
+   bufferA.reserve( nThreads );
+   bufferB.reserve( nThreads );
+   for( dip::uint ii = 0; ii < nThreads; ++ii ) {
+      bufferA.push_back( initial );
+      bufferB.push_back( initial );
+   }
+   std::vector< State const* > ends( nThreads, nullptr );
+
+   // Step 1: guess the state at the end of each slab
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nActualThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      for( dip::uint ii = thread; ii < nThreads - 1; ii += nActualThreads ) {
+         ends[ ii ] = runSlab( starts[ ii ], starts[ ii + 1 ], initial, bufferA[ ii ], bufferB[ ii ], false );
+      }
+   DIP_PARALLEL_ERROR_END
+
+   // Step 2: correct the state at the start of each slab
+   // `ends[ 0 ]` is correct, as slab 0 started with the correct state.
+   // The correction of a slab is limited to a quarter of its steps.
+   constexpr dip::uint maxCorrectionFraction = 4;
+   State trueA = initial;
+   State trueB = initial;
+   State guessA = initial;
+   State guessB = initial;
+   for( dip::uint ii = 1; ii < nThreads - 1; ++ii ) {
+      if( equal( *ends[ ii - 1 ], initial )) {
+         continue; // The slab started with the correct state
+      }
+      State const* trueState = ends[ ii - 1 ];
+      State const* guessState = &initial;
+      State* trueCurrent = &trueA;
+      State* trueOther = &trueB;
+      State* guessCurrent = &guessA;
+      State* guessOther = &guessB;
+      dip::uint maxCorrection = std::max( ( starts[ ii + 1 ] - starts[ ii ] ) / maxCorrectionFraction, dip::uint( 1 ));
+      bool converged = false;
+      for( dip::uint jj = starts[ ii ]; jj < starts[ ii ] + maxCorrection; ++jj ) {
+         step( jj, *trueState, *trueCurrent, false );
+         step( jj, *guessState, *guessCurrent, false );
+         if( equal( *trueCurrent, *guessCurrent )) {
+            converged = true; // The guessed end state is correct
+            break;
+         }
+         trueState = trueCurrent;
+         guessState = guessCurrent;
+         std::swap( trueCurrent, trueOther );
+         std::swap( guessCurrent, guessOther );
+      }
+      if( !converged ) {
+         // The slabs depend on each other too much to be processed in parallel. Note that the guessed end state
+         // of this slab is wrong, and all later slabs would start from a wrong state.
+         runSerial();
+         return;
+      }
+   }
+
+   // Step 3: process each slab, writing the output
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nActualThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      for( dip::uint ii = thread; ii < nThreads; ii += nActualThreads ) {
+         // We use new buffers here, `ends` points into `bufferA` and `bufferB`.
+         State const& start = ii == 0 ? initial : *ends[ ii - 1 ];
+         State a = initial;
+         State b = initial;
+         runSlab( starts[ ii ], starts[ ii + 1 ], start, a, b, true );
+      }
+   DIP_PARALLEL_ERROR_END
+}
+
+} // namespace
+
+} // namespace dip
+
+#endif // DIP_SWEEP_H
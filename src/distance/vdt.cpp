@@ -22,8 +22,10 @@
 #include <vector>
 
 #include "diplib.h"
+#include "diplib/multithreading.h"
 
 #include "find_neighbors.h"
+#include "sweep.h"
 
 namespace dip {
 
@@ -35,7 +37,8 @@ void VDTFast2D(
       UnsignedArray const& sizes,
       IntegerArray const& stride,
       FloatArray const& distance,
-      bool border
+      bool border,
+      dip::uint nThreads
 ) {
    dip::sint nx = static_cast< dip::sint >( sizes[ 0 ] );
    dip::sint ny = static_cast< dip::sint >( sizes[ 1 ] );
@@ -67,11 +70,7 @@ void VDTFast2D(
          fsdy[ ii ] = d * d * dyy;
       }
    }
-   std::vector< XYPosition > d( static_cast< dip::uint >(( nx + 2 ) * 2 ));
-
    // Initialize
-   XYPosition* d1 = d.data();
-   XYPosition* d2 = d.data() + ( nx + 2 );
    XYPosition infd = { 0, 0 };
    XYPosition zero = { nx, ny };
    XYPosition x0y_1 = { nx, ny - 1 };
@@ -80,17 +79,16 @@ void VDTFast2D(
    XYPosition dx1 = { 1, 0 };
    XYPosition dy1 = { 0, 1 };
    XYPosition bp = border ? infd : zero;
+   // The state for each step is the line of vectors computed in the previous step
+   using State = std::vector< XYPosition >;
+   State initial( static_cast< dip::uint >( nx + 2 ), bp );
+   auto equal = []( State const& a, State const& b ) { return a == b; };
 
    // Forward scan
-   XYPosition* dbl = &d1[ 1 ];
-   for( dip::sint ii = 0; ii < nx; ii++ ) {
-      dbl[ ii ] = bp;
-   }
-
-   for( dip::sint yy = 0, py = 0; yy < ny; yy++, py += sy ) {
-      // We split d into buffers that are swapped to read or write from
-      XYPosition* dcl = ( yy & 1 ? d1 : d2 );
-      XYPosition* dbl = ( yy & 1 ? d2 + 1 : d1 + 1 );
+   auto forwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = static_cast< dip::sint >( index ) * sy;
+      XYPosition* dcl = current.data();
+      XYPosition const* dbl = previous.data() + 1;
 
       *dcl++ = bp;
       for( dip::sint xx = 0, px = py; xx < nx; xx++, dcl++, dbl++, px += sx ) {
@@ -129,13 +127,15 @@ void VDTFast2D(
       for( dip::sint xx = 0, px = py + nx1sx; xx < nx; xx++, dcl--, px -= sx ) {
          if(( dcl->x != zero.x ) || ( dcl->y != zero.y )) {
             if((( dcl + 1 )->x == infd.x ) && (( dcl + 1 )->y == infd.y )) {
-               if(( dcl->x == infd.x ) && ( dcl->y == infd.y )) {
-                  ox[ px ] = 0;
-                  oy[ px ] = 0;
-               } else {
-                  XYPosition* c = dcl;
-                  ox[ px ] = static_cast< sfloat >( c->x );
-                  oy[ px ] = static_cast< sfloat >( c->y );
+               if( write ) {
+                  if(( dcl->x == infd.x ) && ( dcl->y == infd.y )) {
+                     ox[ px ] = 0;
+                     oy[ px ] = 0;
+                  } else {
+                     XYPosition* c = dcl;
+                     ox[ px ] = static_cast< sfloat >( c->x );
+                     oy[ px ] = static_cast< sfloat >( c->y );
+                  }
                }
             } else {
                XYPosition* c = dcl;
@@ -145,31 +145,30 @@ void VDTFast2D(
                if( fdc > fdb ) {
                   dcl->x = ( dcl + 1 )->x + dx1.x;
                   dcl->y = ( dcl + 1 )->y + dx1.y;
-                  ox[ px ] = static_cast< sfloat >( b->x + 1 );
-                  oy[ px ] = static_cast< sfloat >( b->y );
-               } else {
+                  if( write ) {
+                     ox[ px ] = static_cast< sfloat >( b->x + 1 );
+                     oy[ px ] = static_cast< sfloat >( b->y );
+                  }
+               } else if( write ) {
                   ox[ px ] = static_cast< sfloat >( c->x );
                   oy[ px ] = static_cast< sfloat >( c->y );
                }
             }
          }
             // Will be set to zero and the end
-         else {
+         else if( write ) {
             ox[ px ] = static_cast< sfloat >( nx );
             oy[ px ] = static_cast< sfloat >( ny );
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, forwardStep, equal, nThreads );
 
    // Backward scan
-   dbl = d1 + 1;
-   for( dip::sint ii = 0; ii < nx; ii++ ) {
-      dbl[ ii ] = bp;
-   }
-
-   for( dip::sint ii = 0, py = ny1sy; ii < ny; ii++, py -= sy ) {
-      XYPosition* dcl = ( ii & 1 ? d1 + nx + 1 : d2 + nx + 1 );
-      XYPosition* dbl = ( ii & 1 ? d2 + nx : d1 + nx );
+   auto backwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = ny1sy - static_cast< dip::sint >( index ) * sy;
+      XYPosition* dcl = current.data() + nx + 1;
+      XYPosition const* dbl = previous.data() + nx;
       *dcl-- = bp;
 
       for( dip::sint xx = 0, px = py + nx1sx; xx < nx; xx++, dcl--, dbl--, px -= sx ) {
@@ -203,7 +202,7 @@ void VDTFast2D(
       for( dip::sint xx = 0, px = py; xx < nx; xx++, dcl++, px += sx ) {
          if( dcl->x != zero.x || dcl->y != zero.y ) {
             if(( dcl - 1 )->x == infd.x && ( dcl - 1 )->y == infd.y ) {
-               if( dcl->x != infd.x || dcl->y != infd.y ) {
+               if( write && ( dcl->x != infd.x || dcl->y != infd.y )) {
                   XYPosition* c = dcl;
                   sfloat fdc = fsdx[ c->x ] + fsdy[ c->y ];
                   if( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) ] > fdc ) {
@@ -219,12 +218,12 @@ void VDTFast2D(
                if( fdc > fdb ) {
                   dcl->x = ( dcl - 1 )->x - dx1.x;
                   dcl->y = ( dcl - 1 )->y - dx1.y;
-                  if( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) ] > fdb ) {
+                  if( write && ( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) ] > fdb )) {
                      ox[ px ] = static_cast< sfloat >( b->x - 1 );
                      oy[ px ] = static_cast< sfloat >( b->y );
                   }
                } else {
-                  if( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) ] > fdc ) {
+                  if( write && ( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) ] > fdc )) {
                      ox[ px ] = static_cast< sfloat >( c->x );
                      oy[ px ] = static_cast< sfloat >( c->y );
                   }
@@ -232,7 +231,8 @@ void VDTFast2D(
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, backwardStep, equal, nThreads );
 
    for( dip::sint yy = 0, py = 0; yy < ny; yy++, py += sy ) {
       for( dip::sint xx = 0, px = py; xx < nx; xx++, px += sx ) {
@@ -249,7 +249,8 @@ void VDTFast3D(
       UnsignedArray const& sizes,
       IntegerArray const& stride,
       FloatArray const& distance,
-      bool border
+      bool border,
+      dip::uint nThreads
 ) {
    dip::sint nx = static_cast< dip::sint >( sizes[ 0 ] );
    dip::sint ny = static_cast< dip::sint >( sizes[ 1 ] );
@@ -302,24 +303,21 @@ void VDTFast3D(
          }
       }
    }
-   std::vector< XYZPosition > d( static_cast< dip::uint >(( nx + 2 ) * ( ny + 2 ) * 2));
 
    // Initialize
-   XYZPosition* d1 = d.data();
-   XYZPosition* d2 = d1 + ( nx + 2 ) * ( ny + 2 );
    XYZPosition infd = { 0, 0, 0 };
    XYZPosition zero = { nx, ny, nz };
    XYZPosition bp = border ? infd : zero;
+   // The state for each step is the plane of vectors computed in the previous step
+   using State = std::vector< XYZPosition >;
+   State initial( static_cast< dip::uint >(( nx + 2 ) * ( ny + 2 )), bp );
+   auto equal = []( State const& a, State const& b ) { return a == b; };
 
-   XYZPosition* dbl = d1;
-   for( dip::sint ii = ( nx + 2 ) * ( ny + 2 ); --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint zz = 0, pz = 0; zz < nz; zz++, pz += sz ) {
-
-      XYZPosition* dcl = ( zz & 1 ? d1 : d2 );
-      XYZPosition* dbl = ( zz & 1 ? d2 + nx + 3 : d1 + nx + 3 );
+   // Forward scan
+   auto forwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint pz = static_cast< dip::sint >( index ) * sz;
+      XYZPosition* dcl = current.data();
+      XYZPosition const* dbl = previous.data() + nx + 3;
 
       for( dip::sint ii = nx + 2; --ii >= 0; ) {
          *dcl++ = bp;
@@ -398,6 +396,9 @@ void VDTFast3D(
                XYZPosition* dbt = dcl + ( nx + 2 );
 
                if( dbt->x == infd.x && dbt->y == infd.y && dbt->z == infd.z ) {
+                  if( !write ) {
+                     continue;
+                  }
                   if( dcl->x == infd.x && dcl->y == infd.y && dcl->z == infd.z ) {
                      ox[ px ] = 0.0;
                      oy[ px ] = 0.0;
@@ -411,32 +412,31 @@ void VDTFast3D(
                   sfloat fdc = fsdx[ dcl->x ] + fsdy[ dcl->y ] + fsdz[ dcl->z ];
                   sfloat fdb = fsdx[ dbt->x ] + fsdy[ dbt->y + 1 ] + fsdz[ dbt->z ];
                   if( fdc > fdb ) {
-                     ox[ px ] = static_cast< sfloat >( dcl->x = dbt->x );
-                     oy[ px ] = static_cast< sfloat >( dcl->y = dbt->y + 1 );
-                     oz[ px ] = static_cast< sfloat >( dcl->z = dbt->z );
-                  } else {
+                     dcl->x = dbt->x;
+                     dcl->y = dbt->y + 1;
+                     dcl->z = dbt->z;
+                  }
+                  if( write ) {
                      ox[ px ] = static_cast< sfloat >( dcl->x );
                      oy[ px ] = static_cast< sfloat >( dcl->y );
                      oz[ px ] = static_cast< sfloat >( dcl->z );
                   }
                }
-            } else {
+            } else if( write ) {
                ox[ px ] = static_cast< sfloat >( nx );
                oy[ px ] = static_cast< sfloat >( ny );
                oz[ px ] = static_cast< sfloat >( nz );
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( nz ), initial, forwardStep, equal, nThreads );
 
-   dbl = d1;
-   for( dip::sint ii = ( nx + 2 ) * ( ny + 2 ); --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint zz = 0, pz = nz1sz; zz < nz; zz++, pz -= sz ) {
-      XYZPosition* dcl = ( zz & 1 ? ( d1 + ( nx + 2 ) * ( ny + 2 ) - 1 ) : ( d2 + ( nx + 2 ) * ( ny + 2 ) - 1 ));
-      XYZPosition* dbl = ( zz & 1 ? ( d2 + ( nx + 2 ) * ( ny + 1 ) - 2 ) : ( d1 + ( nx + 2 ) * ( ny + 1 ) - 2 ));
+   // Backward scan
+   auto backwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint pz = nz1sz - static_cast< dip::sint >( index ) * sz;
+      XYZPosition* dcl = current.data() + ( nx + 2 ) * ( ny + 2 ) - 1;
+      XYZPosition const* dbl = previous.data() + ( nx + 2 ) * ( ny + 1 ) - 2;
 
       for( dip::sint ii = nx + 2; --ii >= 0; ) {
          *dcl-- = bp;
@@ -521,9 +521,9 @@ void VDTFast3D(
                if( dbt->x == infd.x && dbt->y == infd.y && dbt->z == infd.z ) {
                   if( dcl->x != infd.x || dcl->y != infd.y || dcl->z != infd.z ) {
                      sfloat fdc = fsdx[ dcl->x ] + fsdy[ dcl->y ] + fsdz[ dcl->z ];
-                     if( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] +
-                         fsdy[ static_cast< dip::sint >( oy[ px ] ) ] +
-                         fsdz[ static_cast< dip::sint >( oz[ px ] ) ] > fdc ) {
+                     if( write && ( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] +
+                                    fsdy[ static_cast< dip::sint >( oy[ px ] ) ] +
+                                    fsdz[ static_cast< dip::sint >( oz[ px ] ) ] > fdc )) {
                         ox[ px ] = static_cast< sfloat >( dcl->x );
                         oy[ px ] = static_cast< sfloat >( dcl->y );
                         oz[ px ] = static_cast< sfloat >( dcl->z );
@@ -536,17 +536,17 @@ void VDTFast3D(
                      dcl->x = dbt->x;
                      dcl->y = dbt->y - 1;
                      dcl->z = dbt->z;
-                     if( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] +
-                         fsdy[ static_cast< dip::sint >( oy[ px ] ) ] +
-                         fsdz[ static_cast< dip::sint >( oz[ px ] ) ] > fdb ) {
+                     if( write && ( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] +
+                                    fsdy[ static_cast< dip::sint >( oy[ px ] ) ] +
+                                    fsdz[ static_cast< dip::sint >( oz[ px ] ) ] > fdb )) {
                         ox[ px ] = static_cast< sfloat >( dcl->x );
                         oy[ px ] = static_cast< sfloat >( dcl->y );
                         oz[ px ] = static_cast< sfloat >( dcl->z );
                      }
                   } else {
-                     if( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] +
-                         fsdy[ static_cast< dip::sint >( oy[ px ] ) ] +
-                         fsdz[ static_cast< dip::sint >( oz[ px ] ) ] > fdc ) {
+                     if( write && ( fsdx[ static_cast< dip::sint >( ox[ px ] ) ] +
+                                    fsdy[ static_cast< dip::sint >( oy[ px ] ) ] +
+                                    fsdz[ static_cast< dip::sint >( oz[ px ] ) ] > fdc )) {
                         ox[ px ] = static_cast< sfloat >( dcl->x );
                         oy[ px ] = static_cast< sfloat >( dcl->y );
                         oz[ px ] = static_cast< sfloat >( dcl->z );
@@ -556,7 +556,8 @@ void VDTFast3D(
             }
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( nz ), initial, backwardStep, equal, nThreads );
 
    for( dip::sint zz = 0, pz = 0; zz < nz; zz++, pz += sz ) {
       for( dip::sint yy = 0, py = 0; yy < ny; yy++, py += sy ) {
@@ -576,7 +577,8 @@ void VDTTies2D(
       IntegerArray const& stride,
       FloatArray const& distance,
       bool border,
-      bool useTrue
+      bool useTrue,
+      dip::uint nThreads
 ) {
    dip::sint dim = 2;
    dip::sint nx = static_cast< dip::sint >( sizes[ 0 ] );
@@ -614,31 +616,28 @@ void VDTTies2D(
          fsdy[ ii ] = d * d * dyy;
       }
    }
-   std::vector< sfloat > fdnbBuffer( static_cast< dip::uint >( 10 * ( nx + ny )));
-   sfloat* fdnb = fdnbBuffer.data();
-   std::vector< dip::sint > nb( static_cast< dip::uint >( nx * 2 * ( dim * guess + 2 )));
-   std::vector< XYPosition > pnbBuffer( static_cast< dip::uint >( 10 * ( nx + ny )));
-   XYPosition* pnb = pnbBuffer.data();
-   std::vector< dip::sint* > d( static_cast< dip::uint >(( nx + 2 ) * 2 ));
 
    // Initialize
-   dip::sint* nb0 = nb.data();
-   dip::sint* nb1 = nb0 + nx * ( guess * dim + 2 );
-   dip::sint** d1 = d.data();
-   dip::sint** d2 = d1 + ( nx + 2 );
    dip::sint zero = 0;
    dip::sint* bp = ( border ? &zero : nullptr );
+   // The state for each step is the line of neighbor lists computed in the previous step
+   using State = NeighborListState< XYPosition >;
+   State initial{
+         std::vector< dip::sint* >( static_cast< dip::uint >( nx + 2 ), bp ),
+         std::vector< dip::sint >( static_cast< dip::uint >( nx * ( guess * dim + 2 ))),
+         std::vector< XYPosition >( static_cast< dip::uint >( 10 * ( nx + ny ))),
+         std::vector< sfloat >( static_cast< dip::uint >( 10 * ( nx + ny )))
+   };
+   auto equal = []( State const& a, State const& b ) { return a == b; };
 
-   dip::sint** dbl = d1 + 1;
-   for( dip::sint ii = nx; --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint yy = 0, py = 0; yy < ny; yy++, py += sy ) {
-
-      dip::sint* nbp = ( yy & 1 ? nb1 : nb0 );
-      dip::sint** dcl = ( yy & 1 ? d1 : d2 );
-      dip::sint** dbl = ( yy & 1 ? d2 + 1 : d1 + 1 );
+   // Forward scan
+   auto forwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = static_cast< dip::sint >( index ) * sy;
+      XYPosition* pnb = current.pnb.data();
+      sfloat* fdnb = current.fdnb.data();
+      dip::sint* nbp = current.nb.data();
+      dip::sint** dcl = current.d.data();
+      dip::sint* const* dbl = previous.d.data() + 1;
 
       *dcl++ = bp;
       for( dip::sint xx = 0, px = py; xx < nx; xx++, dcl++, dbl++, px += sx ) {
@@ -717,8 +716,10 @@ void VDTTies2D(
             *dcl = nbp;
             if( kk == 0 ) {
                *nbp++ = 0;
-               ox[ px ] = static_cast< sfloat >( -nx );
-               oy[ px ] = static_cast< sfloat >( -ny );
+               if( write ) {
+                  ox[ px ] = static_cast< sfloat >( -nx );
+                  oy[ px ] = static_cast< sfloat >( -ny );
+               }
             } else {
                sfloat mindist{};
                dip::sint minpos{};
@@ -729,26 +730,28 @@ void VDTTies2D(
                for( dip::sint jj = kk; --jj >= 0; nbs++, pnbp++ ) {
                   *nbs = *pnbp;
                }
-               ox[ px ] = static_cast< sfloat >( pnb[ minpos ].x );
-               oy[ px ] = static_cast< sfloat >( pnb[ minpos ].y );
+               if( write ) {
+                  ox[ px ] = static_cast< sfloat >( pnb[ minpos ].x );
+                  oy[ px ] = static_cast< sfloat >( pnb[ minpos ].y );
+               }
                nbp += kk * dim;
             }
-         } else {
+         } else if( write ) {
             ox[ px ] = static_cast< sfloat >( nx );
             oy[ px ] = static_cast< sfloat >( ny );
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, forwardStep, equal, nThreads );
 
-   dbl = d1 + 1;
-   for( dip::sint ii = nx; --ii >= 0; ) {
-      *dbl++ = bp;
-   }
-
-   for( dip::sint yy = 0, py = ny1sy; yy < ny; yy++, py -= sy ) {
-      dip::sint* nbp = ( yy & 1 ? nb1 : nb0 );
-      dip::sint** dcl = ( yy & 1 ? d1 + nx + 1 : d2 + nx + 1 );
-      dip::sint** dbl = ( yy & 1 ? d2 + nx : d1 + nx );
+   // Backward scan
+   auto backwardStep = [ & ]( dip::uint index, State const& previous, State& current, bool write ) {
+      dip::sint py = ny1sy - static_cast< dip::sint >( index ) * sy;
+      XYPosition* pnb = current.pnb.data();
+      sfloat* fdnb = current.fdnb.data();
+      dip::sint* nbp = current.nb.data();
+      dip::sint** dcl = current.d.data() + nx + 1;
+      dip::sint* const* dbl = previous.d.data() + nx;
 
       *dcl-- = bp;
       for( dip::sint xx = 0, px = py + nx1sx; xx < nx; xx++, dcl--, dbl--, px -= sx ) {
@@ -828,8 +831,10 @@ void VDTTies2D(
             *dcl = nbp;
             if( kk == 0 ) {
                *nbp++ = 0;
-               ox[ px ] *= dx;
-               oy[ px ] *= dy;
+               if( write ) {
+                  ox[ px ] *= dx;
+                  oy[ px ] *= dy;
+               }
             } else {
                sfloat mindist{};
                dip::sint minpos{};
@@ -840,21 +845,24 @@ void VDTTies2D(
                for( dip::sint jj = kk; --jj >= 0; nbs++, pnbp++ ) {
                   *nbs = *pnbp;
                }
-               if( mindist < ( fsdx[ static_cast< dip::sint >( ox[ px ] ) + nx ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) + ny ] )) {
-                  ox[ px ] = static_cast< sfloat >( pnb[ minpos ].x ) * dx;
-                  oy[ px ] = static_cast< sfloat >( pnb[ minpos ].y ) * dy;
-               } else {
-                  ox[ px ] *= dx;
-                  oy[ px ] *= dy;
+               if( write ) {
+                  if( mindist < ( fsdx[ static_cast< dip::sint >( ox[ px ] ) + nx ] + fsdy[ static_cast< dip::sint >( oy[ px ] ) + ny ] )) {
+                     ox[ px ] = static_cast< sfloat >( pnb[ minpos ].x ) * dx;
+                     oy[ px ] = static_cast< sfloat >( pnb[ minpos ].y ) * dy;
+                  } else {
+                     ox[ px ] *= dx;
+                     oy[ px ] *= dy;
+                  }
                }
                nbp += kk * dim;
             }
-         } else {
+         } else if( write ) {
             ox[ px ] = 0.0;
             oy[ px ] = 0.0;
          }
       }
-   }
+   };
+   RunSweep( static_cast< dip::uint >( ny ), initial, backwardStep, equal, nThreads );
 }
 
 void VDTTies3D(
@@ -1569,17 +1577,19 @@ void VectorDistanceTransform(
    dip::sint tensorStride = out.TensorStride();
    sfloat* data = static_cast< sfloat* >( out.Origin() );
 
+   dip::uint nThreads = std::min( GetNumberOfThreads(), out.NumberOfPixels() / threadingThreshold );
+
    // Call the real guts function
    if( method == S::FAST ) {
       if( dim == 2 ) {
-         VDTFast2D( data, data + tensorStride, sizes, stride, dist, objectBorder );
+         VDTFast2D( data, data + tensorStride, sizes, stride, dist, objectBorder, nThreads );
       } else {
-         VDTFast3D( data, data + tensorStride, data + tensorStride + tensorStride, sizes, stride, dist, objectBorder );
+         VDTFast3D( data, data + tensorStride, data + tensorStride + tensorStride, sizes, stride, dist, objectBorder, nThreads );
       }
    } else if(( method == S::TIES ) || ( method == S::TRUE )) {
       bool useTrue = method == S::TRUE;
       if( dim == 2 ) {
-         VDTTies2D( data, data + tensorStride, sizes, stride, dist, objectBorder, useTrue );
+         VDTTies2D( data, data + tensorStride, sizes, stride, dist, objectBorder, useTrue, nThreads );
       } else {
          VDTTies3D( data, data + tensorStride, data + tensorStride + tensorStride, sizes, stride, dist, objectBorder, useTrue );
       }
@@ -1595,3 +1605,79 @@ void VectorDistanceTransform(
 }
 
 } // namespace dip
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/random.h"
+#include "diplib/statistics.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing the vector distance transforms in parallel" ) {
+   // Processing the image in multiple slabs must yield exactly the same result as processing it in one go
+   dip::Random random( 0 );
+   dip::FloatArray dist{ 1.0, 1.3, 0.8 };
+   for( dip::dfloat probability : { 0.001, 0.05 } ) {
+      dip::Image img2D( { 173, 158 }, 1, dip::DT_SFLOAT );
+      img2D.Fill( 0 );
+      img2D = dip::UniformNoise( img2D, random ) >= probability;
+      dip::Image img3D( { 31, 24, 45 }, 1, dip::DT_SFLOAT );
+      img3D.Fill( 0 );
+      img3D = dip::UniformNoise( img3D, random ) >= probability;
+      auto prepare = []( dip::Image const& img ) {
+         dip::Image out( img.Sizes(), img.Dimensionality(), dip::DT_SFLOAT );
+         out.Fill( 0 );
+         out[ 0 ].Copy( img );
+         return out;
+      };
+      auto fast2D = [ & ]( dip::Image& out, bool border, dip::uint nThreads ) {
+         dip::sfloat* data = static_cast< dip::sfloat* >( out.Origin() );
+         dip::VDTFast2D( data, data + out.TensorStride(), out.Sizes(), out.Strides(), dist, border, nThreads );
+      };
+      auto fast3D = [ & ]( dip::Image& out, bool border, dip::uint nThreads ) {
+         dip::sfloat* data = static_cast< dip::sfloat* >( out.Origin() );
+         dip::VDTFast3D( data, data + out.TensorStride(), data + 2 * out.TensorStride(), out.Sizes(), out.Strides(), dist, border, nThreads );
+      };
+      auto ties2D = [ & ]( dip::Image& out, bool border, bool useTrue, dip::uint nThreads ) {
+         dip::sfloat* data = static_cast< dip::sfloat* >( out.Origin() );
+         dip::VDTTies2D( data, data + out.TensorStride(), out.Sizes(), out.Strides(), dist, border, useTrue, nThreads );
+      };
+      for( bool border : { false, true } ) {
+         dip::Image ref2D = prepare( img2D );
+         fast2D( ref2D, border, 1 );
+         dip::Image ref3D = prepare( img3D );
+         fast3D( ref3D, border, 1 );
+         dip::Image refTies = prepare( img2D );
+         ties2D( refTies, border, false, 1 );
+         dip::Image refTrue = prepare( img2D );
+         ties2D( refTrue, border, true, 1 );
+         for( dip::uint nThreads : { 3u, 4u, 7u } ) {
+            dip::Image out = prepare( img2D );
+            fast2D( out, border, nThreads );
+            DOCTEST_CHECK( dip::All( out == ref2D ).As< bool >() );
+            out = prepare( img3D );
+            fast3D( out, border, nThreads );
+            DOCTEST_CHECK( dip::All( out == ref3D ).As< bool >() );
+            out = prepare( img2D );
+            ties2D( out, border, false, nThreads );
+            DOCTEST_CHECK( dip::All( out == refTies ).As< bool >() );
+            out = prepare( img2D );
+            ties2D( out, border, true, nThreads );
+            DOCTEST_CHECK( dip::All( out == refTrue ).As< bool >() );
+         }
+      }
+   }
+   // Fewer than two lines per thread, the correction of a slab is limited to a single line and doesn't converge
+   dip::FloatArray unitDist{ 1.0, 1.0 };
+   dip::Image ref( { 100, 4 }, 2, dip::DT_SFLOAT );
+   ref.Fill( 0 );
+   ref[ 0 ].Fill( 1 );
+   ref[ 0 ].At( 50, 0 ) = 0;
+   dip::Image out = ref.Copy();
+   dip::sfloat* data = static_cast< dip::sfloat* >( ref.Origin() );
+   dip::VDTFast2D( data, data + ref.TensorStride(), ref.Sizes(), ref.Strides(), unitDist, false, 1 );
+   data = static_cast< dip::sfloat* >( out.Origin() );
+   dip::VDTFast2D( data, data + out.TensorStride(), out.Sizes(), out.Strides(), unitDist, false, 4 );
+   DOCTEST_CHECK( dip::All( out == ref ).As< bool >() );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -23,6 +23,17 @@
 
 #include "file_io_support.h"
 
+#ifdef _WIN32
+#define NOMINMAX // windows.h must not define min() and max(), which conflict with std::min() and std::max()
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace dip {
 
 RangeArray ConvertRoiSpec(
@@ -104,4 +115,68 @@ RoiSpec CheckAndConvertRoi(
    return roiSpec;
 }
 
+#ifdef _WIN32
+
+DataSegment MapFile( String const& filename, dip::uint offset, dip::uint length, bool copyOnWrite ) {
+   if( length == 0 ) {
+      return {};
+   }
+   HANDLE file = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+   if( file == INVALID_HANDLE_VALUE ) {
+      return {};
+   }
+   LARGE_INTEGER fileSize;
+   if( !GetFileSizeEx( file, &fileSize ) || ( static_cast< dip::uint >( fileSize.QuadPart ) < offset + length )) {
+      CloseHandle( file );
+      return {};
+   }
+   HANDLE mapping = CreateFileMappingA( file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr );
+   CloseHandle( file ); // The mapping object keeps the file open
+   if( mapping == nullptr ) {
+      return {};
+   }
+   // The view must start at a multiple of the allocation granularity
+   SYSTEM_INFO systemInfo;
+   GetSystemInfo( &systemInfo );
+   dip::uint delta = offset % systemInfo.dwAllocationGranularity;
+   dip::uint start = offset - delta;
+   void* view = MapViewOfFile( mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ,
+                               static_cast< DWORD >( start >> 32u ), static_cast< DWORD >( start & 0xFFFFFFFFu ),
+                               static_cast< SIZE_T >( length + delta ));
+   CloseHandle( mapping ); // The view keeps the mapping object alive
+   if( view == nullptr ) {
+      return {};
+   }
+   return DataSegment{ static_cast< uint8* >( view ) + delta, [ view ]( void* ) { UnmapViewOfFile( view ); }};
+}
+
+#else // _WIN32
+
+DataSegment MapFile( String const& filename, dip::uint offset, dip::uint length, bool copyOnWrite ) {
+   if( length == 0 ) {
+      return {};
+   }
+   int fd = open( filename.c_str(), O_RDONLY );
+   if( fd < 0 ) {
+      return {};
+   }
+   struct stat fileStat{};
+   if(( fstat( fd, &fileStat ) != 0 ) || ( static_cast< dip::uint >( fileStat.st_size ) < offset + length )) {
+      close( fd );
+      return {};
+   }
+   // The mapping must start at a multiple of the page size
+   dip::uint delta = offset % static_cast< dip::uint >( sysconf( _SC_PAGESIZE ));
+   dip::uint mapLength = length + delta;
+   void* map = mmap( nullptr, mapLength, copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ,
+                     copyOnWrite ? MAP_PRIVATE : MAP_SHARED, fd, static_cast< off_t >( offset - delta ));
+   close( fd ); // The mapping keeps the file open
+   if( map == MAP_FAILED ) {
+      return {};
+   }
+   return DataSegment{ static_cast< uint8* >( map ) + delta, [ map, mapLength ]( void* ) { munmap( map, mapLength ); }};
+}
+
+#endif // _WIN32
+
 } // namespace
@@ -45,6 +45,12 @@ RoiSpec CheckAndConvertRoi(
       dip::uint nDims
 );
 
+// Maps `length` bytes of the file `filename`, starting at byte `offset`, into memory. The returned data segment
+// points at the byte at `offset`, and unmaps the file when released. If `copyOnWrite`, the memory can be written to,
+// but changes are private to the process and not written to the file. Otherwise the memory is read-only.
+// Returns an empty data segment if the file cannot be mapped, the caller should then read the file instead.
+DataSegment MapFile( String const& filename, dip::uint offset, dip::uint length, bool copyOnWrite );
+
 } // namespace dip
 
 #endif //DIP_FILE_IO_SUPPORT_H
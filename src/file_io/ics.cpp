@@ -23,6 +23,9 @@
 #include <cctype>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,10 +33,16 @@
 #include "diplib.h"
 #include "diplib/generic_iterators.h"
 #include "diplib/library/copy_buffer.h"
+#include "diplib/multithreading.h"
 
 #include "file_io_support.h"
 
 #include "libics.h"
+#include "libics_ll.h"
+
+#ifdef ICS_ZLIB
+#include <zlib.h>
+#endif
 
 namespace dip {
 
@@ -49,6 +58,26 @@ constexpr char const* CANNOT_WRITE_ICS_PIXELS = "Couldn't write data to ICS file
 #define CALL_ICS( function_call, message ) do { Ics_Error error_ = function_call; if( error_ != IcsErr_Ok ) \
 { DIP_THROW_RUNTIME( String( message ) + ": " + IcsGetErrorText( error_ )); }} while(false)
 
+#ifdef ICS_ZLIB
+
+// With the "chunked" option, `ImageWriteICS` compresses the pixel data in independent chunks of `icsChunkSize`
+// bytes. Each chunk is a raw deflate stream that ends with a full flush (the last one ends the stream instead),
+// such that their concatenation is a single deflate stream, and the file is a valid gzip file. An index into the
+// stream is written as history lines with key `ICS_GZIP_INDEX`: the values are the chunk size, the offset of
+// each chunk in the deflate stream, and the length of the deflate stream.
+constexpr char const* ICS_GZIP_INDEX = "gzip_index";
+constexpr dip::uint icsChunkSize = 1024 * 1024;
+constexpr dip::uint icsIndexValuesPerLine = 60;
+constexpr dip::uint gzipHeaderSize = 10;
+constexpr unsigned char gzipHeader[ gzipHeaderSize ] = { 0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 0xff };
+
+bool IsICSGzipIndex( char const* historyLine ) {
+   dip::uint length = std::strlen( ICS_GZIP_INDEX );
+   return ( std::strncmp( historyLine, ICS_GZIP_INDEX, length ) == 0 ) && ( historyLine[ length ] == '\t' );
+}
+
+#endif // ICS_ZLIB
+
 dip::uint FindTensorDimension(
       ICS* ics,
       UnsignedArray const& sizes,
@@ -294,6 +323,11 @@ class IcsFile {
             }
          }
       }
+      // Writes only the header to file, the caller writes the pixel data. Call Close() afterwards.
+      void WriteHeader() {
+         CALL_ICS( IcsWriteIcs( ics_, nullptr ), CANNOT_WRITE_ICS_METADATA );
+         ics_->fileMode = IcsFileMode_read; // Prevents IcsClose() from writing the file again
+      }
       // Implicit cast to ICS*
       operator ICS*() { return ics_; }
    private:
@@ -417,14 +451,19 @@ GetICSInfoData GetICSInfo( IcsFile& icsFile ) {
    // History tags
    int history_lines{};
    CALL_ICS( IcsGetNumHistoryStrings( icsFile, &history_lines ), CANNOT_READ_ICS_METADATA );
-   data.fileInformation.history.resize( static_cast< dip::uint >( history_lines ));
+   data.fileInformation.history.reserve( static_cast< dip::uint >( history_lines ));
    if( history_lines > 0 ) {
       Ics_HistoryIterator it;
       CALL_ICS( IcsNewHistoryIterator( icsFile, &it, nullptr ), CANNOT_READ_ICS_METADATA );
       char const* hist{};
       for( dip::uint ii = 0; ii < static_cast< dip::uint >( history_lines ); ++ii ) {
          CALL_ICS( IcsGetHistoryStringIF( icsFile, &it, &hist ), CANNOT_READ_ICS_METADATA );
-         data.fileInformation.history[ ii ] = hist;
+#ifdef ICS_ZLIB
+         if( IsICSGzipIndex( hist )) {
+            continue; // The chunk index is not metadata
+         }
+#endif
+         data.fileInformation.history.emplace_back( hist );
       }
    }
 
@@ -432,6 +471,401 @@ GetICSInfoData GetICSInfo( IcsFile& icsFile ) {
    return data;
 }
 
+// Returns true if the pixel data in the file is stored in the machine's byte order
+bool ICSHasNativeByteOrder( ICS const* ics ) {
+   int bytes = static_cast< int >( IcsGetImelSize( ics ));
+   for( int ii = 0; ii < bytes; ++ii ) {
+      if( ics->byteOrder[ ii ] == 0 ) {
+         return true; // Byte order not specified, libics reads the data as-is
+      }
+   }
+   int one = 1;
+   bool littleEndian = reinterpret_cast< char* >( &one )[ 0 ] == 1;
+   bool isComplex = ( ics->imel.dataType == Ics_complex32 ) || ( ics->imel.dataType == Ics_complex64 );
+   int half = bytes / 2;
+   for( int ii = 0; ii < bytes; ++ii ) {
+      int expected{};
+      if( littleEndian ) {
+         expected = ii + 1;
+      } else if( isComplex ) {
+         expected = ii < half ? half - ii : bytes - ( ii - half );
+      } else {
+         expected = bytes - ii;
+      }
+      if( ics->byteOrder[ ii ] != expected ) {
+         return false;
+      }
+   }
+   return true;
+}
+
+// Finds the file that contains the pixel data, and the offset of the data within that file
+void FindICSDataFile( ICS const* ics, String& filename, dip::uint& offset ) {
+   if( ics->version == 1 ) {
+      char idsName[ ICS_MAXPATHLEN ];
+      IcsGetIdsName( idsName, ics->filename );
+      filename = idsName;
+      offset = 0;
+   } else {
+      filename = ics->srcFile;
+      offset = ics->srcOffset;
+   }
+}
+
+// Maps the pixel data of the ICS file into memory. Returns an empty data segment if the data cannot be
+// mapped: it is compressed, not in the machine's byte order, or not aligned.
+DataSegment MapICSData( IcsFile& icsFile, dip::uint sizeOf, bool copyOnWrite ) {
+   ICS* ics = icsFile;
+   if(( ics->compression != IcsCompr_uncompressed ) || !ICSHasNativeByteOrder( ics )) {
+      return {};
+   }
+   String filename;
+   dip::uint offset{};
+   FindICSDataFile( ics, filename, offset );
+   if( offset % sizeOf != 0 ) {
+      return {};
+   }
+   return MapFile( filename, offset, IcsGetDataSize( ics ), copyOnWrite );
+}
+
+#ifdef ICS_ZLIB
+
+std::vector< uint8 > DeflateChunk( uint8 const* src, dip::uint length, int level, bool last ) {
+   z_stream stream{};
+   if( deflateInit2( &stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) != Z_OK ) {
+      DIP_THROW_RUNTIME( CANNOT_WRITE_ICS_PIXELS );
+   }
+   std::vector< uint8 > out( deflateBound( &stream, static_cast< uLong >( length )) + 16 ); // room for the flush marker
+   stream.next_in = const_cast< Bytef* >( src );
+   stream.avail_in = static_cast< uInt >( length );
+   stream.next_out = out.data();
+   stream.avail_out = static_cast< uInt >( out.size() );
+   int error = deflate( &stream, last ? Z_FINISH : Z_FULL_FLUSH );
+   out.resize( out.size() - stream.avail_out );
+   deflateEnd( &stream );
+   if(( error != ( last ? Z_STREAM_END : Z_OK )) || ( stream.avail_in != 0 )) {
+      DIP_THROW_RUNTIME( CANNOT_WRITE_ICS_PIXELS );
+   }
+   return out;
+}
+
+void InflateChunk( uint8 const* src, dip::uint srcLength, uint8* dest, dip::uint destLength ) {
+   z_stream stream{};
+   if( inflateInit2( &stream, -MAX_WBITS ) != Z_OK ) {
+      DIP_THROW_RUNTIME( CANNOT_READ_ICS_PIXELS );
+   }
+   stream.next_in = const_cast< Bytef* >( src );
+   stream.avail_in = static_cast< uInt >( srcLength );
+   stream.next_out = dest;
+   stream.avail_out = static_cast< uInt >( destLength );
+   int error = inflate( &stream, Z_SYNC_FLUSH );
+   inflateEnd( &stream );
+   if((( error != Z_OK ) && ( error != Z_STREAM_END )) || ( stream.avail_out != 0 )) {
+      DIP_THROW_RUNTIME( CANNOT_READ_ICS_PIXELS );
+   }
+}
+
+// Calls `process( job )` for each `job` in [0, nJobs), distributing the jobs over multiple threads.
+template< typename F >
+void ForEachICSChunk( dip::uint nJobs, F const& process ) {
+   dip::uint nThreads = std::min( GetNumberOfThreads(), nJobs );
+   if( nThreads <= 1 ) {
+      for( dip::uint job = 0; job < nJobs; ++job ) {
+         process( job );
+      }
+      return;
+   }
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nActualThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      for( dip::uint job = thread; job < nJobs; job += nActualThreads ) {
+         process( job );
+      }
+   DIP_PARALLEL_ERROR_END
+}
+
+// Copies `n` samples of `image`, starting at sample `start` in file order (linear index), to `dest`.
+void GatherICSSamples( Image const& image, dip::uint start, dip::uint n, uint8* dest ) {
+   dip::uint sizeOf = image.DataType().SizeOf();
+   UnsignedArray const& sizes = image.Sizes();
+   dip::sint stride = image.Stride( 0 ) * static_cast< dip::sint >( sizeOf );
+   dip::uint nDims = sizes.size();
+   UnsignedArray coords( nDims );
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      coords[ ii ] = start % sizes[ ii ];
+      start /= sizes[ ii ];
+   }
+   while( n > 0 ) {
+      dip::uint run = std::min( n, sizes[ 0 ] - coords[ 0 ] );
+      uint8 const* src = static_cast< uint8 const* >( image.Pointer( coords ));
+      if( stride == static_cast< dip::sint >( sizeOf )) {
+         std::memcpy( dest, src, run * sizeOf );
+         dest += run * sizeOf;
+      } else {
+         for( dip::uint jj = 0; jj < run; ++jj, src += stride, dest += sizeOf ) {
+            std::memcpy( dest, src, sizeOf );
+         }
+      }
+      n -= run;
+      coords[ 0 ] = 0;
+      for( dip::uint ii = 1; ii < nDims; ++ii ) {
+         if( ++coords[ ii ] < sizes[ ii ] ) {
+            break;
+         }
+         coords[ ii ] = 0;
+      }
+   }
+}
+
+struct ICSCompressedData {
+   std::vector< std::vector< uint8 >> chunks;
+   uLong crc = 0;
+   dip::uint length = 0;
+};
+
+// Compresses the pixels of `image`, in the order of its dimensions, in chunks of `icsChunkSize` bytes.
+ICSCompressedData CompressICSChunks( Image const& image, int level ) {
+   ICSCompressedData data;
+   dip::uint sizeOf = image.DataType().SizeOf();
+   data.length = image.NumberOfPixels() * sizeOf;
+   dip::uint nChunks = div_ceil( data.length, icsChunkSize );
+   data.chunks.resize( nChunks );
+   std::vector< uLong > crcs( nChunks );
+   bool normal = image.HasNormalStrides();
+   uint8 const* origin = static_cast< uint8 const* >( image.Origin() );
+   ForEachICSChunk( nChunks, [ & ]( dip::uint chunk ) {
+      dip::uint start = chunk * icsChunkSize;
+      dip::uint length = std::min( icsChunkSize, data.length - start );
+      uint8 const* src = origin + start;
+      std::vector< uint8 > buffer;
+      if( !normal ) {
+         buffer.resize( length );
+         GatherICSSamples( image, start / sizeOf, length / sizeOf, buffer.data() );
+         src = buffer.data();
+      }
+      crcs[ chunk ] = crc32( crc32( 0, nullptr, 0 ), src, static_cast< uInt >( length ));
+      data.chunks[ chunk ] = DeflateChunk( src, length, level, chunk == nChunks - 1 );
+   } );
+   data.crc = crcs[ 0 ];
+   for( dip::uint ii = 1; ii < nChunks; ++ii ) {
+      data.crc = crc32_combine( data.crc, crcs[ ii ], static_cast< z_off_t >( std::min( icsChunkSize, data.length - ii * icsChunkSize )));
+   }
+   return data;
+}
+
+// Adds the index of the chunks to the history lines
+void AddICSChunkIndex( ICS* ics, ICSCompressedData const& data ) {
+   std::vector< dip::uint > values( 1, icsChunkSize );
+   dip::uint offset = 0;
+   for( auto const& chunk : data.chunks ) {
+      values.push_back( offset );
+      offset += chunk.size();
+   }
+   values.push_back( offset );
+   for( dip::uint ii = 0; ii < values.size(); ii += icsIndexValuesPerLine ) {
+      String line = std::to_string( values[ ii ] );
+      for( dip::uint jj = ii + 1; jj < std::min( ii + icsIndexValuesPerLine, values.size() ); ++jj ) {
+         line += '\t' + std::to_string( values[ jj ] );
+      }
+      CALL_ICS( IcsAddHistory( ics, ICS_GZIP_INDEX, line.c_str() ), CANNOT_WRITE_ICS_METADATA );
+   }
+}
+
+void PutLittleEndian32( std::ofstream& file, uLong value ) {
+   unsigned char bytes[ 4 ];
+   for( auto& b : bytes ) {
+      b = static_cast< unsigned char >( value & 0xFFu );
+      value >>= 8u;
+   }
+   file.write( reinterpret_cast< char const* >( bytes ), 4 );
+}
+
+// Writes the compressed data as a gzip stream, after the header has been written
+void WriteICSChunks( ICS const* ics, ICSCompressedData const& data ) {
+   String filename;
+   std::ios::openmode mode = std::ios::binary;
+   if( ics->version == 1 ) {
+      char idsName[ ICS_MAXPATHLEN ];
+      IcsGetIdsName( idsName, ics->filename );
+      filename = idsName;
+      mode |= std::ios::out | std::ios::trunc;
+   } else {
+      filename = ics->filename;
+      mode |= std::ios::app;
+   }
+   std::ofstream file( filename, mode );
+   if( !file ) {
+      DIP_THROW_RUNTIME( CANNOT_WRITE_ICS_PIXELS );
+   }
+   file.write( reinterpret_cast< char const* >( gzipHeader ), gzipHeaderSize );
+   for( auto const& chunk : data.chunks ) {
+      file.write( reinterpret_cast< char const* >( chunk.data() ), static_cast< std::streamsize >( chunk.size() ));
+   }
+   PutLittleEndian32( file, data.crc );
+   PutLittleEndian32( file, static_cast< uLong >( data.length & 0xFFFFFFFFu ));
+   if( !file ) {
+      DIP_THROW_RUNTIME( CANNOT_WRITE_ICS_PIXELS );
+   }
+}
+
+// The index of the chunks in a file written with the "chunked" option
+class ICSChunkIndex {
+   public:
+      // Reads the index from the header. Returns false if there is no usable index.
+      bool Read( ICS* ics ) {
+         if(( ics->compression != IcsCompr_gzip ) || !ICSHasNativeByteOrder( ics )) {
+            return false;
+         }
+         Ics_HistoryIterator it;
+         if( IcsNewHistoryIterator( ics, &it, ICS_GZIP_INDEX ) != IcsErr_Ok ) {
+            return false;
+         }
+         std::vector< dip::uint > values;
+         char line[ ICS_LINE_LENGTH ];
+         while( IcsGetHistoryKeyValueI( ics, &it, nullptr, line ) == IcsErr_Ok ) {
+            for( char* ptr = std::strtok( line, "\t" ); ptr != nullptr; ptr = std::strtok( nullptr, "\t" )) {
+               values.push_back( std::strtoull( ptr, nullptr, 10 ));
+            }
+         }
+         if( values.size() < 3 ) {
+            return false;
+         }
+         chunkSize_ = values[ 0 ];
+         dataSize_ = IcsGetDataSize( ics );
+         if(( chunkSize_ == 0 ) || ( chunkSize_ > std::numeric_limits< uInt >::max() / 2 )) {
+            return false;
+         }
+         offsets_.assign( values.begin() + 1, values.end() );
+         if(( offsets_.size() != div_ceil( dataSize_, chunkSize_ ) + 1 ) || ( offsets_[ 0 ] != 0 ) ||
+            !std::is_sorted( offsets_.begin(), offsets_.end() )) {
+            return false;
+         }
+         // The deflate stream must start right after a gzip header without optional fields
+         FindICSDataFile( ics, filename_, dataOffset_ );
+         std::ifstream file( filename_, std::ios::binary );
+         file.seekg( static_cast< std::streamoff >( dataOffset_ ));
+         char header[ gzipHeaderSize ];
+         file.read( header, gzipHeaderSize );
+         if( !file || ( std::memcmp( header, gzipHeader, 4 ) != 0 )) {
+            return false;
+         }
+         dataOffset_ += gzipHeaderSize;
+         return true;
+      }
+
+      dip::uint NumberOfChunks() const { return offsets_.size() - 1; }
+      dip::uint ChunkSize() const { return chunkSize_; }
+      dip::uint ChunkLength( dip::uint chunk ) const { return std::min( chunkSize_, dataSize_ - chunk * chunkSize_ ); }
+
+      // Decompresses chunk `chunks[ ii ]` into `dest[ ii ]`, in parallel. `chunks` must be sorted.
+      void Decompress( std::vector< dip::uint > const& chunks, std::vector< uint8* > const& dest ) const {
+         dip::uint n = chunks.size();
+         std::vector< dip::uint > start( n + 1, 0 );
+         for( dip::uint ii = 0; ii < n; ++ii ) {
+            start[ ii + 1 ] = start[ ii ] + offsets_[ chunks[ ii ] + 1 ] - offsets_[ chunks[ ii ]];
+         }
+         std::vector< uint8 > compressed( start[ n ] );
+         std::ifstream file( filename_, std::ios::binary );
+         for( dip::uint ii = 0; ii < n; ++ii ) {
+            if(( ii == 0 ) || ( chunks[ ii ] != chunks[ ii - 1 ] + 1 )) {
+               file.seekg( static_cast< std::streamoff >( dataOffset_ + offsets_[ chunks[ ii ]] ));
+            }
+            file.read( reinterpret_cast< char* >( compressed.data() + start[ ii ] ), static_cast< std::streamsize >( start[ ii + 1 ] - start[ ii ] ));
+         }
+         if( !file ) {
+            DIP_THROW_RUNTIME( CANNOT_READ_ICS_PIXELS );
+         }
+         ForEachICSChunk( n, [ & ]( dip::uint ii ) {
+            InflateChunk( compressed.data() + start[ ii ], start[ ii + 1 ] - start[ ii ], dest[ ii ], ChunkLength( chunks[ ii ] ));
+         } );
+      }
+
+      // Decompresses all the data into `dest`, a few chunks per thread at the time.
+      void DecompressAll( uint8* dest ) const {
+         dip::uint batch = 4 * GetNumberOfThreads();
+         for( dip::uint first = 0; first < NumberOfChunks(); first += batch ) {
+            dip::uint last = std::min( first + batch, NumberOfChunks() );
+            std::vector< dip::uint > chunks( last - first );
+            std::vector< uint8* > pointers( last - first );
+            for( dip::uint ii = first; ii < last; ++ii ) {
+               chunks[ ii - first ] = ii;
+               pointers[ ii - first ] = dest + ii * chunkSize_;
+            }
+            Decompress( chunks, pointers );
+         }
+      }
+
+   private:
+      String filename_;
+      dip::uint dataOffset_ = 0; // offset of the deflate stream in the file
+      dip::uint chunkSize_ = 0;
+      dip::uint dataSize_ = 0;
+      std::vector< dip::uint > offsets_;
+};
+
+// Reads data from a file written with the "chunked" option. Only the chunks listed in `needed` are decompressed,
+// a few chunks per thread at the time. Reading must go forward through the file.
+class ICSChunkReader {
+   public:
+      ICSChunkReader( ICSChunkIndex const& index, std::vector< dip::uint > needed )
+            : index_( index ), needed_( std::move( needed )), batch_( 4 * GetNumberOfThreads() ) {}
+
+      void Read( dip::uint location, uint8* dest, dip::uint length ) {
+         dip::uint chunkSize = index_.ChunkSize();
+         dip::uint first = location / chunkSize;
+         dip::uint last = ( location + length - 1 ) / chunkSize;
+         // Drop the chunks we've gone past
+         dip::uint keep = 0;
+         while(( keep < loaded_.size() ) && ( loaded_[ keep ] < first )) {
+            ++keep;
+         }
+         loaded_.erase( loaded_.begin(), loaded_.begin() + static_cast< dip::sint >( keep ));
+         buffers_.erase( buffers_.begin(), buffers_.begin() + static_cast< dip::sint >( keep ));
+         for( dip::uint chunk = first; chunk <= last; ++chunk ) {
+            dip::uint index = Find( chunk );
+            dip::uint begin = std::max( location, chunk * chunkSize );
+            dip::uint end = std::min( location + length, ( chunk + 1 ) * chunkSize );
+            std::memcpy( dest + ( begin - location ), buffers_[ index ].data() + ( begin - chunk * chunkSize ), end - begin );
+         }
+      }
+
+   private:
+      ICSChunkIndex const& index_;
+      std::vector< dip::uint > needed_;   // sorted
+      dip::uint batch_;
+      std::vector< dip::uint > loaded_;   // sorted
+      std::vector< std::vector< uint8 >> buffers_;
+
+      // Returns the index into `buffers_` for `chunk`, decompressing it and the next few needed chunks if necessary
+      dip::uint Find( dip::uint chunk ) {
+         auto it = std::lower_bound( loaded_.begin(), loaded_.end(), chunk );
+         if(( it != loaded_.end() ) && ( *it == chunk )) {
+            return static_cast< dip::uint >( it - loaded_.begin() );
+         }
+         auto pos = std::lower_bound( needed_.begin(), needed_.end(), chunk );
+         DIP_ASSERT(( pos != needed_.end() ) && ( *pos == chunk ));
+         std::vector< dip::uint > chunks;
+         for( ; ( pos != needed_.end() ) && ( chunks.size() < batch_ ); ++pos ) {
+            if( loaded_.empty() || ( *pos > loaded_.back() )) {
+               chunks.push_back( *pos );
+            }
+         }
+         dip::uint index = loaded_.size();
+         std::vector< uint8* > pointers( chunks.size() );
+         for( dip::uint ii = 0; ii < chunks.size(); ++ii ) {
+            loaded_.push_back( chunks[ ii ] );
+            buffers_.emplace_back( index_.ChunkLength( chunks[ ii ] ));
+            pointers[ ii ] = buffers_.back().data();
+         }
+         index_.Decompress( chunks, pointers );
+         return index;
+      }
+};
+
+#endif // ICS_ZLIB
+
 } // namespace
 
 FileInformation ImageReadICS(
@@ -441,8 +875,19 @@ FileInformation ImageReadICS(
       Range const& channels,
       String const& mode
 ) {
-   bool fast{};
-   DIP_STACK_TRACE_THIS( fast = BooleanFromString( mode, "fast", "" ));
+   bool fast = false;
+   bool map = false;
+   bool copyOnWrite = false;
+   if( mode == "fast" ) {
+      fast = true;
+   } else if( mode == "mmap" ) {
+      map = true;
+   } else if( mode == "mmap copy-on-write" ) {
+      map = true;
+      copyOnWrite = true;
+   } else if( !mode.empty() ) {
+      DIP_THROW_INVALID_FLAG( mode );
+   }
 
    // open the ICS file
    IcsFile icsFile( filename, "r" );
@@ -480,6 +925,29 @@ FileInformation ImageReadICS(
    // if there's a tensor dimension, it's sorted last in `strides`.
    //std::cout << "[ImageReadICS] strides = " << strides << std::endl;
 
+   // if "mmap", try to map the file into memory, and create an image that refers to the ROI within it
+   bool mapped = false;
+   if( map && !out.IsProtected() && !out.HasExternalInterface() ) {
+      DataSegment segment = MapICSData( icsFile, data.fileInformation.dataType.SizeOf(), copyOnWrite );
+      if( segment ) {
+         dip::sint offset = 0;
+         IntegerArray outStrides( nDims );
+         for( dip::uint ii = 0; ii < nDims; ++ii ) {
+            offset += static_cast< dip::sint >( roiSpec.roi[ ii ].Offset() ) * strides[ ii ];
+            outStrides[ ii ] = strides[ ii ] * static_cast< dip::sint >( roiSpec.roi[ ii ].step );
+         }
+         dip::sint outTensorStride = 1;
+         if( data.fileInformation.tensorElements > 1 ) {
+            offset += static_cast< dip::sint >( roiSpec.channels.Offset() ) * strides.back();
+            outTensorStride = strides.back() * static_cast< dip::sint >( roiSpec.channels.step );
+         }
+         void* origin = static_cast< uint8* >( segment.get() ) + offset * static_cast< dip::sint >( data.fileInformation.dataType.SizeOf() );
+         DIP_STACK_TRACE_THIS( out = Image( segment, origin, data.fileInformation.dataType, roiSpec.sizes, std::move( outStrides ),
+                                            Tensor( roiSpec.tensorElements ), outTensorStride ));
+         mapped = true;
+      }
+   }
+
    // if "fast", try to match strides with those in the file
    if( fast ) {
       IntegerArray reqStrides( nDims );
@@ -501,7 +969,9 @@ FileInformation ImageReadICS(
    }
 
    // forge the image
-   out.ReForge( roiSpec.sizes, roiSpec.tensorElements, data.fileInformation.dataType );
+   if( !mapped ) {
+      out.ReForge( roiSpec.sizes, roiSpec.tensorElements, data.fileInformation.dataType );
+   }
    if( roiSpec.tensorElements == data.fileInformation.tensorElements ) {
       out.SetColorSpace( data.fileInformation.colorSpace );
    }
@@ -538,12 +1008,25 @@ FileInformation ImageReadICS(
    }
    //std::cout << "[ImageReadICS] out = " << out << std::endl;
 
+   if( mapped ) {
+      out.Mirror( roiSpec.mirror );
+      icsFile.Close();
+      return data.fileInformation;
+   }
+
+   // if the file was written with the "chunked" option, we can decompress chunks independently
+   bool chunked = false;
+#ifdef ICS_ZLIB
+   ICSChunkIndex chunkIndex;
+   chunked = chunkIndex.Read( icsFile );
+#endif
+
    // make a quick copy and place the tensor dimension at the back
    Image outRef = out.QuickCopy();
    if( data.fileInformation.tensorElements > 1 ) {
       outRef.TensorToSpatial();
       roiSpec.roi.push_back( roiSpec.channels );
-      sizes.push_back( roiSpec.tensorElements );
+      sizes.push_back( data.fileInformation.tensorElements );
       ++nDims;
    }
    //std::cout << "[ImageReadICS] outRef = " << outRef << std::endl;
@@ -552,7 +1035,13 @@ FileInformation ImageReadICS(
       // Fast reading!
       //std::cout << "[ImageReadICS] fast reading!\n";
 
-      CALL_ICS( IcsGetData( icsFile, outRef.Origin(), outRef.NumberOfPixels() * outRef.DataType().SizeOf() ), CANNOT_READ_ICS_PIXELS );
+      if( chunked ) {
+#ifdef ICS_ZLIB
+         DIP_STACK_TRACE_THIS( chunkIndex.DecompressAll( static_cast< uint8* >( outRef.Origin() )));
+#endif
+      } else {
+         CALL_ICS( IcsGetData( icsFile, outRef.Origin(), outRef.NumberOfPixels() * outRef.DataType().SizeOf() ), CANNOT_READ_ICS_PIXELS );
+      }
 
    } else {
       // Reading using strides
@@ -593,12 +1082,8 @@ FileInformation ImageReadICS(
       dip::uint bufSize = sizeOf * (( outRef.Size( procDim ) - 1 ) * roiSpec.roi[ procDim ].step + 1 );
       std::vector< uint8 > buffer( bufSize );
 
-      // read the data
-      dip::uint cur_loc = 0;
-      GenericImageIterator<> it( outRef, procDim );
-      do {
-         // find location in file to read at
-         UnsignedArray const& curipos = it.Coordinates();
+      // find location in file to read at
+      auto fileLocation = [ & ]( UnsignedArray const& curipos ) {
          dip::uint new_loc = sizeOf * roiSpec.roi[ procDim ].Offset();
          for( dip::uint ii = 0; ii < nDims; ++ii ) {
             if( ii != procDim ) {
@@ -606,14 +1091,45 @@ FileInformation ImageReadICS(
                new_loc += sizeOf * curfpos * static_cast< dip::uint >( strides[ ii ] );
             }
          }
+         return new_loc;
+      };
+
+#ifdef ICS_ZLIB
+      // find which chunks we need to decompress
+      std::unique_ptr< ICSChunkReader > chunkReader;
+      if( chunked ) {
+         std::vector< dip::uint > needed;
+         GenericImageIterator<> it( outRef, procDim );
+         do {
+            dip::uint new_loc = fileLocation( it.Coordinates() );
+            dip::uint first = new_loc / chunkIndex.ChunkSize();
+            dip::uint last = ( new_loc + bufSize - 1 ) / chunkIndex.ChunkSize();
+            for( dip::uint chunk = needed.empty() ? first : std::max( first, needed.back() + 1 ); chunk <= last; ++chunk ) {
+               needed.push_back( chunk );
+            }
+         } while( ++it );
+         chunkReader = std::make_unique< ICSChunkReader >( chunkIndex, std::move( needed ));
+      }
+#endif
+
+      // read the data
+      dip::uint cur_loc = 0;
+      GenericImageIterator<> it( outRef, procDim );
+      do {
+         dip::uint new_loc = fileLocation( it.Coordinates() );
          // read line portion into buffer
          DIP_ASSERT( new_loc >= cur_loc ); // we cannot move backwards!
-         if( new_loc > cur_loc ) {
-            IcsSkipDataBlock( icsFile, new_loc - cur_loc );
-            cur_loc = new_loc;
+         if( chunked ) {
+#ifdef ICS_ZLIB
+            DIP_STACK_TRACE_THIS( chunkReader->Read( new_loc, buffer.data(), bufSize ));
+#endif
+         } else {
+            if( new_loc > cur_loc ) {
+               IcsSkipDataBlock( icsFile, new_loc - cur_loc );
+            }
+            CALL_ICS( IcsGetDataBlock( icsFile, buffer.data(), bufSize ), CANNOT_READ_ICS_PIXELS );
          }
-         CALL_ICS( IcsGetDataBlock( icsFile, buffer.data(), bufSize ), CANNOT_READ_ICS_PIXELS );
-         cur_loc += bufSize;
+         cur_loc = new_loc + bufSize;
          // copy buffer to image
          detail::CopyBuffer( buffer.data(), data.fileInformation.dataType, static_cast< dip::sint >( roiSpec.roi[ procDim ].step ), 1,
                              it.Pointer(), outRef.DataType(), outRef.Stride( procDim ), 1,
@@ -684,12 +1200,15 @@ void ImageWriteICS(
       String const& filename,
       StringArray const& history,
       dip::uint significantBits,
-      StringSet const& options
+      StringSet const& options,
+      dip::uint compressionLevel
 ) {
    DIP_THROW_IF( !c_image.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF(( compressionLevel < 1 ) || ( compressionLevel > 9 ), E::PARAMETER_OUT_OF_RANGE );
    // parse options
    bool oldStyle = false; // true if v1
    bool compress = true;
+   bool chunked = false;
    bool fast = false;
    for( auto& option : options ) {
       if( option == "v1" ) {
@@ -700,12 +1219,19 @@ void ImageWriteICS(
          compress = false;
       } else if( option == "gzip" ) {
          compress = true;
+      } else if( option == "chunked" ) {
+         chunked = true;
       } else if( option == "fast" ) {
          fast = true;
       } else {
          DIP_THROW_INVALID_FLAG( option );
       }
    }
+#ifdef ICS_ZLIB
+   chunked &= compress;
+#else
+   chunked = false; // libics will complain about the compression
+#endif
 
    // should we reorder dimensions?
    if( fast ) {
@@ -782,7 +1308,7 @@ void ImageWriteICS(
    }
 
    // set type of compression
-   CALL_ICS( IcsSetCompression( icsFile, compress ? IcsCompr_gzip : IcsCompr_uncompressed, 9 ), CANNOT_WRITE_ICS_FILE );
+   CALL_ICS( IcsSetCompression( icsFile, compress ? IcsCompr_gzip : IcsCompr_uncompressed, static_cast< int >( compressionLevel )), CANNOT_WRITE_ICS_FILE );
 
    // set the image data
    if( fast ) {
@@ -797,7 +1323,15 @@ void ImageWriteICS(
       }
       std::memcpy( ics->dim, dim, sizeof( Ics_DataRepresentation ) * nd ); // Copy only the dimensions we've set.
    }
-   if( image.HasNormalStrides() ) {
+#ifdef ICS_ZLIB
+   ICSCompressedData compressed;
+#endif
+   if( chunked ) {
+#ifdef ICS_ZLIB
+      DIP_STACK_TRACE_THIS( compressed = CompressICSChunks( image, static_cast< int >( compressionLevel )));
+      DIP_STACK_TRACE_THIS( AddICSChunkIndex( icsFile, compressed ));
+#endif
+   } else if( image.HasNormalStrides() ) {
       CALL_ICS( IcsSetData( icsFile, image.Origin(), image.NumberOfPixels() * image.DataType().SizeOf() ), CANNOT_WRITE_ICS_PIXELS );
    } else {
       CALL_ICS( IcsSetDataWithStrides( icsFile, image.Origin(), image.NumberOfPixels() * image.DataType().SizeOf(),
@@ -818,12 +1352,20 @@ void ImageWriteICS(
    }
 
    // write everything to file by closing it
+   if( chunked ) {
+#ifdef ICS_ZLIB
+      icsFile.WriteHeader();
+      DIP_STACK_TRACE_THIS( WriteICSChunks( icsFile, compressed ));
+#endif
+   }
    icsFile.Close();
 }
 
 } // namespace dip
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include <cstdio>
+
 #include "doctest.h"
 #include "diplib/testing.h"
 
@@ -880,6 +1422,84 @@ DOCTEST_TEST_CASE( "[DIPlib] testing ICS file reading and writing" ) {
    DOCTEST_CHECK( result.At( 11 ).As< dip::sint64 >() == 1234567890ll );
 }
 
+DOCTEST_TEST_CASE( "[DIPlib] testing memory-mapped ICS file reading" ) {
+   dip::Image grey = dip::ImageReadICS( DIP_EXAMPLES_DIR "/chromo3d.ics" );
+   dip::Image image( grey.Sizes(), 2, dip::DT_UINT16 );
+   image[ 0 ] = grey;
+   image[ 1 ] = grey * 2 + 1;
+   image.SetPixelSize( dip::PhysicalQuantityArray{ 6 * dip::Units::Micrometer(), 300 * dip::Units::Nanometer() } );
+   dip::ImageWriteICS( image, "test_mmap.ics", {}, 16, { "v1", "uncompressed" } );
+
+   dip::Image result = dip::ImageReadICS( "test_mmap", dip::RangeArray{}, {}, "mmap" );
+   DOCTEST_CHECK( result.IsExternalData() );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::FULL ));
+
+   // An ROI, with mirroring and a subset of the channels, refers to the same mapped memory
+   dip::RangeArray roi{ dip::Range{ 2, 30, 3 }, dip::Range{ 20, 5 }, dip::Range{} };
+   result = dip::ImageReadICS( "test_mmap", roi, dip::Range{ 1 }, "mmap" );
+   DOCTEST_CHECK( result.IsExternalData() );
+   DOCTEST_CHECK( dip::testing::CompareImages( image[ 1 ].At( roi ), result, dip::Option::CompareImagesMode::EXACT ));
+
+   // With copy-on-write, the image can be modified without modifying the file
+   result = dip::ImageReadICS( "test_mmap", dip::RangeArray{}, {}, "mmap copy-on-write" );
+   DOCTEST_CHECK( result.IsExternalData() );
+   result.Fill( 0 );
+   result = dip::ImageReadICS( "test_mmap", dip::RangeArray{}, {}, "mmap" );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::EXACT ));
+
+   // A compressed file cannot be mapped, it is read instead
+   dip::ImageWriteICS( image, "test_mmap.ics", {}, 16, { "v1", "gzip" } );
+   result = dip::ImageReadICS( "test_mmap", dip::RangeArray{}, {}, "mmap" );
+   DOCTEST_CHECK( !result.IsExternalData() );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::FULL ));
+   std::remove( "test_mmap.ics" );
+   std::remove( "test_mmap.ids" );
+   std::remove( "test_mmap.ids.gz" );
+}
+
+#ifdef ICS_ZLIB
+DOCTEST_TEST_CASE( "[DIPlib] testing chunked gzip ICS file reading and writing" ) {
+   dip::Image grey = dip::ImageReadICS( DIP_EXAMPLES_DIR "/chromo3d.ics" );
+   dip::Image image( grey.Sizes(), 2, dip::DT_SFLOAT ); // 2.7 MiB, split into 3 chunks
+   image[ 0 ] = grey;
+   image[ 1 ] = grey * 0.5 - 10;
+   image.SetPixelSize( dip::PhysicalQuantityArray{ 6 * dip::Units::Micrometer(), 300 * dip::Units::Nanometer() } );
+   dip::ImageWriteICS( image, "test_chunked.ics", { "line1" }, 0, { "chunked" }, 1 );
+
+   dip::Image result;
+   dip::FileInformation info = dip::ImageReadICS( result, "test_chunked" );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::FULL ));
+   DOCTEST_REQUIRE( info.history.size() == 3 ); // "tensor", "software" and "line1", the chunk index is not returned
+   DOCTEST_CHECK( info.history[ 2 ] == "line1" );
+
+   // Reading a ROI decompresses only the chunks needed
+   dip::RangeArray roi{ dip::Range{ 2, 30, 3 }, dip::Range{ 5, 20 }, dip::Range{ 3, 15, 2 } };
+   result = dip::ImageReadICS( "test_chunked", roi, dip::Range{ 1 } );
+   DOCTEST_CHECK( dip::testing::CompareImages( image[ 1 ].At( roi ), result, dip::Option::CompareImagesMode::EXACT ));
+   roi = { dip::Range{ 150, 10, 7 }, dip::Range{ 20, 5 }, dip::Range{ 10, 12 } };
+   result = dip::ImageReadICS( "test_chunked", roi );
+   DOCTEST_CHECK( dip::testing::CompareImages( image.At( roi ), result, dip::Option::CompareImagesMode::EXACT ));
+
+   // ICS v1, with non-standard strides
+   image.SwapDimensions( 0, 2 );
+   dip::ImageWriteICS( image, "test_chunked.ics", {}, 0, { "v1", "chunked" } );
+   result = dip::ImageReadICS( "test_chunked", dip::RangeArray{}, {}, "fast" );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::FULL ));
+
+   // The pixel data is a valid gzip stream
+   dip::uint length = image.NumberOfSamples() * image.DataType().SizeOf();
+   std::vector< dip::uint8 > buffer( length + 1 );
+   gzFile file = gzopen( "test_chunked.ids", "rb" );
+   DOCTEST_REQUIRE( file != nullptr );
+   DOCTEST_CHECK( gzread( file, buffer.data(), static_cast< unsigned >( buffer.size() )) == static_cast< int >( length ));
+   DOCTEST_CHECK( gzclose( file ) == Z_OK );
+
+   DOCTEST_CHECK_THROWS( dip::ImageWriteICS( image, "test_chunked.ics", {}, 0, { "chunked" }, 10 ));
+   std::remove( "test_chunked.ics" );
+   std::remove( "test_chunked.ids" );
+}
+#endif // ICS_ZLIB
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST
 
 #else // DIP_CONFIG_HAS_ICS
@@ -926,7 +1546,8 @@ void ImageWriteICS(
       String const& /*filename*/,
       StringArray const& /*history*/,
       dip::uint /*significantBits*/,
-      StringSet const& /*options*/
+      StringSet const& /*options*/,
+      dip::uint /*compressionLevel*/
 ) {
    DIP_THROW( NOT_AVAILABLE );
 }
@@ -35,6 +35,8 @@
 #include "diplib.h"
 #include "diplib/generic_iterators.h"
 
+#include "file_io_support.h"
+
 namespace dip {
 
 namespace {
@@ -282,12 +284,41 @@ std::ifstream OpenNPYForReading( String filename, FileInformation& fileInformati
 
 } // namespace
 
-FileInformation ImageReadNPY( Image& out, String const& filename ) {
+FileInformation ImageReadNPY( Image& out, String const& filename, String const& mode ) {
+   bool map = false;
+   bool copyOnWrite = false;
+   if( mode == "mmap" ) {
+      map = true;
+   } else if( mode == "mmap copy-on-write" ) {
+      map = true;
+      copyOnWrite = true;
+   } else if( !mode.empty() ) {
+      DIP_THROW_INVALID_FLAG( mode );
+   }
    FileInformation fileInformation;
    bool fortranOrder = false;
    bool swapEndianness = false;
    std::ifstream istream;
    DIP_STACK_TRACE_THIS( istream = OpenNPYForReading( filename, fileInformation, fortranOrder, swapEndianness ));
+   if( map && !swapEndianness && !out.IsProtected() && !out.HasExternalInterface() ) {
+      // Map the pixel data, which follows the header, into memory. The data is aligned because the header length
+      // is a multiple of 64 bytes.
+      dip::uint offset = static_cast< dip::uint >( istream.tellg() );
+      dip::uint sizeOf = fileInformation.dataType.SizeOf();
+      dip::uint length = fileInformation.sizes.product() * sizeOf;
+      if( offset % sizeOf == 0 ) {
+         DataSegment data = MapFile( fileInformation.name, offset, length, copyOnWrite );
+         if( data ) {
+            IntegerArray strides;
+            if( fortranOrder && !fileInformation.sizes.empty() ) {
+               strides = MakeFortranOrderStrides( fileInformation.sizes );
+            }
+            DIP_STACK_TRACE_THIS( out = Image( data, data.get(), fileInformation.dataType, fileInformation.sizes, strides ));
+            return fileInformation;
+         }
+      }
+   }
+   // Otherwise, copy the data into `out`.
    DIP_STACK_TRACE_THIS( out.ReForge( fileInformation.sizes, 1, fileInformation.dataType, Option::AcceptDataTypeChange::DONT_ALLOW ));
    dip::uint nDims = fileInformation.sizes.size();
    bool matchingStrides = true;
@@ -392,4 +423,53 @@ void ImageWriteNPY( Image const& image, String const& filename ) {
 
 } // namespace dip
 
-// NOTE! This is tested in /pydip/test/npy_test.md
+// NOTE! This is tested in /pydip/test/npy_test.md, except for memory mapping
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include <cstdio>
+
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing memory-mapped NPY file reading" ) {
+   dip::Image image( { 35, 20, 8 }, 1, dip::DT_SFLOAT );
+   dip::FillXCoordinate( image );
+   image *= 3.7;
+   dip::ImageWriteNPY( image, "test_mmap.npy" );
+   dip::Image result = dip::ImageReadNPY( "test_mmap.npy", "mmap" );
+   DOCTEST_CHECK( result.IsExternalData() );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::EXACT ));
+
+   // With copy-on-write, the image can be modified without modifying the file
+   result = dip::ImageReadNPY( "test_mmap.npy", "mmap copy-on-write" );
+   DOCTEST_CHECK( result.IsExternalData() );
+   result.Fill( 0 );
+   result = dip::ImageReadNPY( "test_mmap.npy", "mmap" );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::EXACT ));
+
+   // Fortran order
+   dip::Image fortran;
+   fortran.SetSizes( image.Sizes() );
+   fortran.SetStrides( { 160, 8, 1 } );
+   fortran.SetDataType( image.DataType() );
+   fortran.Forge();
+   DOCTEST_REQUIRE( fortran.Stride( 2 ) == 1 );
+   fortran.Copy( image );
+   dip::ImageWriteNPY( fortran, "test_mmap.npy" );
+   result = dip::ImageReadNPY( "test_mmap.npy", "mmap" );
+   DOCTEST_CHECK( result.IsExternalData() );
+   DOCTEST_CHECK( result.Strides() == fortran.Strides() );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::EXACT ));
+
+   // A protected image cannot be replaced by the mapped memory, the file is read instead
+   result.Strip();
+   result.ReForge( image.Sizes(), 1, image.DataType() );
+   result.Protect();
+   dip::ImageReadNPY( result, "test_mmap.npy", "mmap" );
+   DOCTEST_CHECK( !result.IsExternalData() );
+   DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::EXACT ));
+   std::remove( "test_mmap.npy" );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
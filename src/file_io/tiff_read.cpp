@@ -21,11 +21,13 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "diplib.h"
 #include "diplib/generic_iterators.h"
+#include "diplib/multithreading.h"
 
 #include "file_io_support.h"
 
@@ -39,7 +41,7 @@ constexpr char const* TIFF_NO_TAG = "Invalid TIFF: Required tag not found";
 constexpr char const* TIFF_DIRECTORY_NOT_FOUND = "Could not find the requested image in the file";
 constexpr char const* TIFF_UNKNOWN_BIT_DEPTH = "Unsupported TIFF: Unknown bit depth";
 constexpr char const* TIFF_UNKNOWN_PLANAR_CONFIG = "Unsupported TIFF: unknown PlanarConfiguration value";
-constexpr char const* TIFF_ERROR_READING_DATA = "TIFF_UNKNOWN_BIT_DEPTH";
+constexpr char const* TIFF_ERROR_READING_DATA = "Error reading TIFF data";
 
 #define READ_REQUIRED_TIFF_TAG( tiff, tag, ... ) do { if( !TIFFGetField( tiff, tag, __VA_ARGS__ )) { DIP_THROW_RUNTIME( TIFF_NO_TAG ); }} while(false)
 
@@ -299,84 +301,204 @@ GetTIFFInfoData GetTIFFInfo( TiffFile& tiff, bool useColorMap ) {
 }
 
 //
-// Color Map
+// Strips and tiles
 //
 
-inline void ExpandColourMap4(
-      uint16* dest,
-      uint8 const* src,
-      dip::uint width,
-      dip::uint height,
-      dip::sint tensorStride,
-      IntegerArray const& strides,
-      uint16 const* ColourMapRed,
-      uint16 const* ColourMapGreen,
-      uint16 const* ColourMapBlue
+// Strips and tiles are both handled as blocks: a strip is a block as wide as the image.
+struct TIFFBlockLayout {
+   bool tiled = false;
+   dip::uint width = 0;     // Block width in pixels
+   dip::uint height = 0;    // Block height in pixels
+   dip::uint rowSize = 0;   // Bytes per row of pixels in a block (for a single plane if PLANARCONFIG_SEPARATE)
+   dip::uint blockSize = 0; // Bytes per block
+};
+
+TIFFBlockLayout GetTIFFBlockLayout( TiffFile& tiff, UnsignedArray const& sizes ) {
+   TIFFBlockLayout layout;
+   uint32 tileWidth{};
+   if( TIFFGetField( tiff, TIFFTAG_TILEWIDTH, &tileWidth )) {
+      uint32 tileLength{};
+      READ_REQUIRED_TIFF_TAG( tiff, TIFFTAG_TILELENGTH, &tileLength );
+      layout.tiled = true;
+      layout.width = tileWidth;
+      layout.height = tileLength;
+      layout.rowSize = static_cast< dip::uint >( TIFFTileRowSize( tiff ));
+      layout.blockSize = static_cast< dip::uint >( TIFFTileSize( tiff ));
+   } else {
+      uint32 rowsPerStrip{};
+      TIFFGetFieldDefaulted( tiff, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip );
+      layout.width = sizes[ 0 ];
+      layout.height = std::min< dip::uint >( rowsPerStrip, sizes[ 1 ] );
+      layout.rowSize = static_cast< dip::uint >( TIFFScanlineSize( tiff ));
+      layout.blockSize = static_cast< dip::uint >( TIFFStripSize( tiff ));
+   }
+   if(( layout.width == 0 ) || ( layout.height == 0 ) || ( layout.rowSize == 0 ) || ( layout.blockSize < layout.rowSize * layout.height )) {
+      DIP_THROW_RUNTIME( "Invalid TIFF: inconsistent strip or tile sizes" );
+   }
+   return layout;
+}
+
+// The part of a block (strip or tile) that intersects the ROI.
+struct TIFFBlock {
+   uint32 index;            // Strip or tile index
+   dip::uint plane;         // Which of the output image's tensor elements the block's plane goes to (PLANARCONFIG_SEPARATE only)
+   dip::uint x, y;          // Coordinates within the block of the first ROI pixel
+   dip::uint width, height; // Number of ROI pixels in the block along each dimension
+   dip::uint outX, outY;    // Coordinates of that first ROI pixel in the output image
+};
+
+// Finds the ROI pixels within the block that starts at `blockStart`, returns false if there are none.
+bool IntersectTIFFBlock(
+      Range const& roi,
+      dip::uint blockStart,
+      dip::uint blockEnd,
+      dip::uint& first,
+      dip::uint& count,
+      dip::uint& outIndex
 ) {
-   dip::sint green = tensorStride;
-   dip::sint blue = 2 * tensorStride;
-   for( dip::uint ii = 0; ii < height; ++ii ) {
-      uint16* dest_pixel = dest;
-      for( dip::uint jj = 0; jj < width; ) {
-         dip::uint index = ( static_cast< dip::uint >( *src ) >> 4u ) & 0x0Fu;
-         *dest_pixel = ColourMapRed[ index ];
-         *( dest_pixel + green ) = ColourMapGreen[ index ];
-         *( dest_pixel + blue ) = ColourMapBlue[ index ];
-         dest_pixel += strides[ 0 ];
-         ++jj;
-         if( jj >= width ) {
-            ++src;
-            break;
+   blockEnd = std::min( blockEnd, roi.Last() + 1 );
+   dip::uint offset = roi.Offset();
+   outIndex = blockStart > offset ? div_ceil( blockStart - offset, roi.step ) : 0;
+   dip::uint pos = offset + outIndex * roi.step;
+   if( pos >= blockEnd ) {
+      return false;
+   }
+   first = pos - blockStart;
+   count = div_ceil( blockEnd - pos, roi.step );
+   return true;
+}
+
+// Adds the blocks for sample plane `plane` that intersect the ROI to `blocks`. `plane` is always 0 for
+// PLANARCONFIG_CONTIG. `outPlane` is the corresponding tensor element in the output image.
+void FindTIFFBlocks(
+      TiffFile& tiff,
+      TIFFBlockLayout const& layout,
+      UnsignedArray const& sizes,
+      RangeArray const& roi,
+      dip::uint plane,
+      dip::uint outPlane,
+      std::vector< TIFFBlock >& blocks
+) {
+   TIFFBlock block{};
+   block.plane = outPlane;
+   for( dip::uint y0 = ( roi[ 1 ].Offset() / layout.height ) * layout.height; y0 <= roi[ 1 ].Last(); y0 += layout.height ) {
+      if( !IntersectTIFFBlock( roi[ 1 ], y0, std::min( y0 + layout.height, sizes[ 1 ] ), block.y, block.height, block.outY )) {
+         continue;
+      }
+      for( dip::uint x0 = ( roi[ 0 ].Offset() / layout.width ) * layout.width; x0 <= roi[ 0 ].Last(); x0 += layout.width ) {
+         if( !IntersectTIFFBlock( roi[ 0 ], x0, std::min( x0 + layout.width, sizes[ 0 ] ), block.x, block.width, block.outX )) {
+            continue;
          }
-         index = ( *src ) & 0x0Fu;
-         *dest_pixel = ColourMapRed[ index ];
-         *( dest_pixel + green ) = ColourMapGreen[ index ];
-         *( dest_pixel + blue ) = ColourMapBlue[ index ];
-         dest_pixel += strides[ 0 ];
-         ++jj;
-         ++src;
+         block.index = layout.tiled
+                       ? TIFFComputeTile( tiff, static_cast< uint32 >( x0 ), static_cast< uint32 >( y0 ), 0, static_cast< uint16 >( plane ))
+                       : TIFFComputeStrip( tiff, static_cast< uint32 >( y0 ), static_cast< uint16 >( plane ));
+         blocks.push_back( block );
+      }
+   }
+}
+
+void ReadTIFFBlock( TIFF* tiff, TIFFBlockLayout const& layout, uint32 index, uint8* buffer ) {
+   tmsize_t size = static_cast< tmsize_t >( layout.blockSize );
+   tmsize_t result = layout.tiled
+                     ? TIFFReadEncodedTile( tiff, index, buffer, size )
+                     : TIFFReadEncodedStrip( tiff, index, buffer, size );
+   if( result < 0 ) {
+      DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
+   }
+}
+
+// Calls `process( tiff, buffer, job )` for each `job` in [0, nJobs), where `buffer` has `bufferSize` bytes.
+// If there is enough `work` (the number of bytes to decode), the jobs are distributed over multiple threads.
+// A `TIFF*` handle cannot be shared among threads, so each additional thread opens the file again, and
+// goes to the same directory.
+template< typename F >
+void ForEachTIFFJob(
+      TiffFile& tiff,
+      dip::uint nJobs,
+      dip::uint bufferSize,
+      dip::uint work,
+      F const& process
+) {
+   dip::uint nThreads = std::min( GetNumberOfThreads(), nJobs );
+   if(( nThreads <= 1 ) || ( work < threadingThreshold )) {
+      std::vector< uint8 > buffer( bufferSize );
+      for( dip::uint job = 0; job < nJobs; ++job ) {
+         process( static_cast< TIFF* >( tiff ), buffer.data(), job );
+      }
+      return;
+   }
+   uint64 directory = TIFFCurrentDirOffset( tiff );
+   std::vector< std::unique_ptr< TiffFile >> files( nThreads - 1 );
+   for( auto& file : files ) {
+      file = std::make_unique< TiffFile >( tiff.FileName() );
+      if( TIFFSetSubDirectory( *file, directory ) == 0 ) {
+         DIP_THROW_RUNTIME( TIFF_DIRECTORY_NOT_FOUND );
       }
-      dest += strides[ 1 ];
    }
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nActualThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      TIFF* threadTiff = thread == 0 ? static_cast< TIFF* >( tiff ) : static_cast< TIFF* >( *files[ thread - 1 ] );
+      std::vector< uint8 > buffer( bufferSize );
+      for( dip::uint job = thread; job < nJobs; job += nActualThreads ) {
+         process( threadTiff, buffer.data(), job );
+      }
+   DIP_PARALLEL_ERROR_END
+}
+
+// Reads the `index`-th `bits`-bit sample from a row of packed samples, most significant bits first.
+// `bits` is 1, 4 or 8.
+inline dip::uint PackedSample( uint8 const* row, dip::uint index, dip::uint bits ) {
+   dip::uint bitIndex = index * bits;
+   dip::uint shift = 8 - bits - bitIndex % 8;
+   return ( static_cast< dip::uint >( row[ bitIndex / 8 ] ) >> shift ) & (( 1u << bits ) - 1u );
 }
 
-inline void ExpandColourMap8(
+//
+// Color Map
+//
+
+void ExpandColourMap(
       uint16* dest,
       uint8 const* src,
+      dip::uint srcStartX,
       dip::uint width,
       dip::uint height,
-      dip::sint tensorStride,
-      IntegerArray const& strides,
-      uint16 const* ColourMapRed,
-      uint16 const* ColourMapGreen,
-      uint16 const* ColourMapBlue
+      dip::uint bits,
+      dip::sint destStrideT,
+      dip::sint destStrideX,
+      dip::sint destStrideY,
+      dip::uint srcStepX,
+      dip::uint srcStrideY,
+      std::vector< uint16 const* > const& colorMap
 ) {
-   dip::sint green = tensorStride;
-   dip::sint blue = 2 * tensorStride;
-   for( dip::uint ii = 0; ii < height; ++ii ) {
+   for( dip::uint yy = 0; yy < height; ++yy ) {
       uint16* dest_pixel = dest;
-      for( dip::uint jj = 0; jj < width; ++jj ) {
-         *dest_pixel = ColourMapRed[ *src ];
-         *( dest_pixel + green ) = ColourMapGreen[ *src ];
-         *( dest_pixel + blue ) = ColourMapBlue[ *src ];
-         dest_pixel += strides[ 0 ];
-         ++src;
+      dip::uint xx = srcStartX;
+      for( dip::uint jj = 0; jj < width; ++jj, xx += srcStepX ) {
+         dip::uint index = PackedSample( src, xx, bits );
+         uint16* dest_sample = dest_pixel;
+         for( auto map : colorMap ) {
+            *dest_sample = map[ index ];
+            dest_sample += destStrideT;
+         }
+         dest_pixel += destStrideX;
       }
-      dest += strides[ 1 ];
+      dest += destStrideY;
+      src += srcStrideY;
    }
 }
 
-void ReadTIFFColorMap(
-      Image& image,
+void ReadTIFFColorMapData(
+      uint16* imagedata,
+      IntegerArray const& strides,
+      dip::sint tensorStride,
       TiffFile& tiff,
-      GetTIFFInfoData& data
+      FileInformation const& data,
+      RoiSpec const& roiSpec
 ) {
-   // Test for tiled TIFF files. These we can't handle (yet).
-   uint32 tileWidth{};
-   if( TIFFGetField( tiff, TIFFTAG_TILEWIDTH, &tileWidth )) {
-      DIP_THROW_RUNTIME( "Tiled TIFF format not supported for colormapped images" );
-   }
-
    // Read the tags
    uint16 bitsPerSample{};
    READ_REQUIRED_TIFF_TAG( tiff, TIFFTAG_BITSPERSAMPLE, &bitsPerSample );
@@ -387,138 +509,113 @@ void ReadTIFFColorMap(
    uint16* CMGreen{};
    uint16* CMBlue{};
    READ_REQUIRED_TIFF_TAG( tiff, TIFFTAG_COLORMAP, &CMRed, &CMGreen, &CMBlue );
+   std::vector< uint16 const* > colorMap;
+   for( auto channel : roiSpec.channels ) {
+      colorMap.push_back( channel == 0 ? CMRed : ( channel == 1 ? CMGreen : CMBlue ));
+   }
 
+   // Read the image data blockwise
+   TIFFBlockLayout layout;
+   DIP_STACK_TRACE_THIS( layout = GetTIFFBlockLayout( tiff, data.sizes ));
+   if( layout.rowSize != div_ceil< dip::uint >( layout.width * bitsPerSample, 8 )) {
+      DIP_THROW_RUNTIME( TIFF_UNKNOWN_BIT_DEPTH );
+   }
+   std::vector< TIFFBlock > blocks;
+   FindTIFFBlocks( tiff, layout, data.sizes, roiSpec.roi, 0, 0, blocks );
+   DIP_STACK_TRACE_THIS( ForEachTIFFJob( tiff, blocks.size(), layout.blockSize, blocks.size() * layout.blockSize,
+                                         [ & ]( TIFF* threadTiff, uint8* buffer, dip::uint job ) {
+      TIFFBlock const& block = blocks[ job ];
+      ReadTIFFBlock( threadTiff, layout, block.index, buffer );
+      ExpandColourMap( imagedata + static_cast< dip::sint >( block.outX ) * strides[ 0 ] + static_cast< dip::sint >( block.outY ) * strides[ 1 ],
+                       buffer + block.y * layout.rowSize, block.x, block.width, block.height, bitsPerSample,
+                       tensorStride, strides[ 0 ], strides[ 1 ], roiSpec.roi[ 0 ].step, layout.rowSize * roiSpec.roi[ 1 ].step,
+                       colorMap );
+   } ));
+}
+
+void ReadTIFFColorMap(
+      Image& image,
+      TiffFile& tiff,
+      GetTIFFInfoData& data,
+      RoiSpec const& roiSpec
+) {
    // Forge the image
-   image.ReForge( data.fileInformation.sizes, 3, DT_UINT16 );
+   image.ReForge( roiSpec.sizes, roiSpec.tensorElements, DT_UINT16 );
    uint16* imagedata = static_cast< uint16* >( image.Origin() );
 
-   // Read the image data stripwise
-   uint32 imageWidth = static_cast< uint32 >( image.Size( 0 ));
-   uint32 imageLength = static_cast< uint32 >( image.Size( 1 ));
-   dip::uint scanline = static_cast< dip::uint >( TIFFScanlineSize( tiff ));
-   if( bitsPerSample == 4 ) {
-      DIP_ASSERT( scanline == div_ceil< dip::uint >( image.Size( 0 ), 2 ));
-   } else {
-      DIP_ASSERT( scanline == image.Size( 0 ));
-   }
-   std::vector< uint8 > buf( static_cast< dip::uint >( TIFFStripSize( tiff )));
-   uint32 rowsPerStrip{};
-   TIFFGetFieldDefaulted( tiff, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip );
-   uint32 nStrips = TIFFNumberOfStrips( tiff );
-   uint32 row = 0;
-   for( uint32 strip = 0; strip < nStrips; ++strip ) {
-      dip::uint nrow = row + rowsPerStrip > imageLength ? imageLength - row : rowsPerStrip;
-      if( TIFFReadEncodedStrip( tiff, strip, buf.data(), static_cast< tmsize_t >( nrow * scanline )) < 0 ) {
-         DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
-      }
-      if( bitsPerSample == 4 ) {
-         ExpandColourMap4( imagedata, buf.data(), imageWidth, nrow, image.TensorStride(), image.Strides(), CMRed, CMGreen, CMBlue );
-      } else {
-         ExpandColourMap8( imagedata, buf.data(), imageWidth, nrow, image.TensorStride(), image.Strides(), CMRed, CMGreen, CMBlue );
-      }
-      imagedata += static_cast< dip::sint >( nrow ) * image.Stride( 1 );
-      row += rowsPerStrip;
-   }
+   // Read the image data
+   DIP_STACK_TRACE_THIS( ReadTIFFColorMapData( imagedata, image.Strides(), image.TensorStride(), tiff, data.fileInformation, roiSpec ));
 }
 
 //
 // Binary
 //
 
-inline void CopyBuffer1(
+void CopyBufferBinary(
       uint8* dest,
       uint8 const* src,
+      dip::uint srcStartX,
       dip::uint width,
       dip::uint height,
-      IntegerArray const& strides
+      dip::sint destStrideX,
+      dip::sint destStrideY,
+      dip::uint srcStepX,
+      dip::uint srcStrideY,
+      bool invert
 ) {
-   for( dip::uint ii = 0; ii < height; ++ii ) {
+   uint8 value = invert ? 0 : 1;
+   for( dip::uint yy = 0; yy < height; ++yy ) {
       uint8* dest_pixel = dest;
-      dip::uint kk = 7;
-      for( dip::uint jj = 0; jj < width; ++jj ) {
-         *dest_pixel = (( *src ) & ( 1u << kk )) ? 1 : 0;
-         dest_pixel += strides[ 0 ];
-         if( kk == 0 ) {
-            kk = 7;
-            ++src;
-         } else {
-            --kk;
-         }
-      }
-      if( kk != 7 ) {
-         //kk = 7;
-         ++src;
+      dip::uint xx = srcStartX;
+      for( dip::uint jj = 0; jj < width; ++jj, xx += srcStepX ) {
+         *dest_pixel = PackedSample( src, xx, 1 ) ? value : static_cast< uint8 >( 1 - value );
+         dest_pixel += destStrideX;
       }
-      dest += strides[ 1 ];
+      dest += destStrideY;
+      src += srcStrideY;
    }
 }
 
-inline void CopyBufferInv1(
-      uint8* dest,
-      uint8 const* src,
-      dip::uint width,
-      dip::uint height,
-      IntegerArray const& strides
+void ReadTIFFBinaryData(
+      uint8* imagedata,
+      IntegerArray const& strides,
+      TiffFile& tiff,
+      GetTIFFInfoData const& data,
+      RoiSpec const& roiSpec
 ) {
-   for( dip::uint ii = 0; ii < height; ++ii ) {
-      uint8* dest_pixel = dest;
-      dip::uint kk = 7;
-      for( dip::uint jj = 0; jj < width; ++jj ) {
-         *dest_pixel = (( *src ) & ( 1u << kk )) ? 0 : 1;
-         dest_pixel += strides[ 0 ];
-         if( kk == 0 ) {
-            kk = 7;
-            ++src;
-         } else {
-            --kk;
-         }
-      }
-      if( kk != 7 ) {
-         //kk = 7;
-         ++src;
-      }
-      dest += strides[ 1 ];
+   if( data.fileInformation.tensorElements != 1 ) {
+      DIP_THROW_RUNTIME( "Unsupported TIFF: binary image with multiple samples per pixel" );
+   }
+   TIFFBlockLayout layout;
+   DIP_STACK_TRACE_THIS( layout = GetTIFFBlockLayout( tiff, data.fileInformation.sizes ));
+   if( layout.rowSize != div_ceil< dip::uint >( layout.width, 8 )) {
+      DIP_THROW_RUNTIME( TIFF_UNKNOWN_BIT_DEPTH );
    }
+   bool invert = data.photometricInterpretation == PHOTOMETRIC_MINISWHITE;
+   std::vector< TIFFBlock > blocks;
+   FindTIFFBlocks( tiff, layout, data.fileInformation.sizes, roiSpec.roi, 0, 0, blocks );
+   DIP_STACK_TRACE_THIS( ForEachTIFFJob( tiff, blocks.size(), layout.blockSize, blocks.size() * layout.blockSize,
+                                         [ & ]( TIFF* threadTiff, uint8* buffer, dip::uint job ) {
+      TIFFBlock const& block = blocks[ job ];
+      ReadTIFFBlock( threadTiff, layout, block.index, buffer );
+      CopyBufferBinary( imagedata + static_cast< dip::sint >( block.outX ) * strides[ 0 ] + static_cast< dip::sint >( block.outY ) * strides[ 1 ],
+                        buffer + block.y * layout.rowSize, block.x, block.width, block.height,
+                        strides[ 0 ], strides[ 1 ], roiSpec.roi[ 0 ].step, layout.rowSize * roiSpec.roi[ 1 ].step, invert );
+   } ));
 }
 
 void ReadTIFFBinary(
       Image& image,
       TiffFile& tiff,
-      GetTIFFInfoData& data
+      GetTIFFInfoData& data,
+      RoiSpec const& roiSpec
 ) {
-   // Test for tiled TIFF files. These we can't handle (yet).
-   uint32 tileWidth{};
-   if( TIFFGetField( tiff, TIFFTAG_TILEWIDTH, &tileWidth )) {
-      DIP_THROW_RUNTIME( "Tiled TIFF format not supported for binary images" );
-   }
-
    // Forge the image
-   image.ReForge( data.fileInformation.sizes, data.fileInformation.tensorElements, DT_BIN );
+   image.ReForge( roiSpec.sizes, 1, DT_BIN );
    uint8* imagedata = static_cast< uint8* >( image.Origin() );
 
-   // Read the image data stripwise
-   uint32 imageWidth = static_cast< uint32 >( image.Size( 0 ));
-   uint32 imageLength = static_cast< uint32 >( image.Size( 1 ));
-   dip::uint scanline = static_cast< dip::uint >( TIFFScanlineSize( tiff ));
-   DIP_ASSERT( scanline == div_ceil< dip::uint >( image.Size( 0 ), 8 ));
-   std::vector< uint8 > buf( static_cast< dip::uint >( TIFFStripSize( tiff )));
-   uint32 rowsPerStrip{};
-   TIFFGetFieldDefaulted( tiff, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip );
-   uint32 nStrips = TIFFNumberOfStrips( tiff );
-   uint32 row = 0;
-   for( uint32 strip = 0; strip < nStrips; ++strip ) {
-      uint32 nrow = ( row + rowsPerStrip > imageLength ? imageLength - row : rowsPerStrip );
-      if( TIFFReadEncodedStrip( tiff, strip, buf.data(), static_cast< tmsize_t >( nrow * scanline )) < 0 ) {
-         DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
-      }
-      if( data.photometricInterpretation == PHOTOMETRIC_MINISWHITE ) {
-         CopyBufferInv1( imagedata, buf.data(), imageWidth, nrow, image.Strides() );
-      } else {
-         CopyBuffer1( imagedata, buf.data(), imageWidth, nrow, image.Strides() );
-      }
-      imagedata += static_cast< dip::sint >( nrow ) * image.Stride( 1 );
-      row += rowsPerStrip;
-   }
+   // Read the image data
+   DIP_STACK_TRACE_THIS( ReadTIFFBinaryData( imagedata, image.Strides(), tiff, data, roiSpec ));
 }
 
 //
@@ -684,229 +781,77 @@ void ReadTIFFData(
          planarConfiguration = PLANARCONFIG_CONTIG; // Default
       }
    }
+   if(( planarConfiguration != PLANARCONFIG_CONTIG ) && ( planarConfiguration != PLANARCONFIG_SEPARATE )) {
+      DIP_THROW_RUNTIME( TIFF_UNKNOWN_PLANAR_CONFIG );
+   }
+   // 1234123412341234.... (contiguous) or 1111...2222...3333...4444... (separate)
+   // We know that if tensorElements == 1, we force to PLANARCONFIG_SEPARATE
+   bool contiguous = planarConfiguration == PLANARCONFIG_CONTIG;
+   dip::uint samplesPerPixel = contiguous ? data.tensorElements : 1; // Per sample plane
+   dip::uint nPlanes = contiguous ? 1 : roiSpec.tensorElements;       // Number of sample planes to read
 
    // Strips or tiles?
-   uint32 tileWidth{};
-   if( TIFFGetField( tiff, TIFFTAG_TILEWIDTH, &tileWidth )) {
-      // --- Tiled TIFF file ---
-      uint32 tileLength{};
-      READ_REQUIRED_TIFF_TAG( tiff, TIFFTAG_TILELENGTH, &tileLength );
-      auto tileSize = TIFFTileSize( tiff );
-      std::vector< uint8 > buf( static_cast< dip::uint >( tileSize ));
-      //uint32 nTiles = TIFFNumberOfTiles( tiff );
-      dip::uint firstTileX = ( roiSpec.roi[ 0 ].Offset() / tileWidth ) * tileWidth;
-      dip::uint firstTileY = ( roiSpec.roi[ 1 ].Offset() / tileLength ) * tileLength;
-      if( planarConfiguration == PLANARCONFIG_CONTIG ) {
-         // 1234123412341234....
-         // We know that data.tensorElements > 1, otherwise we force to PLANARCONFIG_SEPARATE
-         //std::cout << "[ReadTIFFData] Tiles, Contiguous\n";
-         DIP_ASSERT( static_cast< dip::uint >( tileSize ) == static_cast< dip::uint >( tileWidth ) * tileLength * data.tensorElements * sizeOf );
-         dip::uint tileStrideY = data.tensorElements * tileWidth;
-         dip::uint yPos = roiSpec.roi[ 1 ].Offset();
-         for( dip::uint y = firstTileY; y <= roiSpec.roi[ 1 ].Last(); y += tileLength ) {
-            dip::uint tileEndY = std::min( y + tileLength, data.sizes[ 1 ] );
-            tileEndY = std::min( tileEndY, roiSpec.roi[ 1 ].Last() + 1 );
-            if( yPos >= tileEndY ) {
-               continue;
-            }
-            dip::uint copyHeight = div_ceil( tileEndY - yPos, roiSpec.roi[ 1 ].step );
-            uint8* imagedataPtr = imagedata;
-            dip::uint offsetY = ( yPos - y ) * tileStrideY;
-            dip::uint xPos = roiSpec.roi[ 0 ].Offset();
-            for( dip::uint x = firstTileX; x <= roiSpec.roi[ 0 ].Last(); x += tileWidth ) {
-               dip::uint tileEndX = std::min( x + tileWidth, data.sizes[ 0 ] );
-               tileEndX = std::min( tileEndX, roiSpec.roi[ 0 ].Last() + 1 );
-               if( xPos >= tileEndX ) {
-                  continue;
-               }
-               dip::uint copyWidth = div_ceil( tileEndX - xPos, roiSpec.roi[ 0 ].step );
-               dip::uint offset = ( offsetY + ( xPos - x ) * data.tensorElements + roiSpec.channels.Offset() );
-               uint32 tile = TIFFComputeTile( tiff, static_cast< uint32 >( x ), static_cast< uint32 >( y ), 0, 0 );
-               TIFFReadEncodedTile( tiff, tile, buf.data(), tileSize );
-               if( sizeOf == 1 ) {
-                  CopyBuffer3D_8bit( imagedataPtr, buf.data() + offset, roiSpec.tensorElements, copyWidth, copyHeight,
-                                     tensorStride, strides[ 0 ], strides[ 1 ],
-                                     roiSpec.channels.step, data.tensorElements * roiSpec.roi[ 0 ].step, tileStrideY * roiSpec.roi[ 1 ].step );
-                  imagedataPtr += static_cast< dip::sint >( copyWidth ) * strides[ 0 ];
-               } else {
-                  CopyBuffer3D( imagedataPtr, buf.data() + offset * sizeOf, roiSpec.tensorElements, copyWidth, copyHeight,
-                                tensorStride, strides[ 0 ], strides[ 1 ],
-                                roiSpec.channels.step, data.tensorElements * roiSpec.roi[ 0 ].step, tileStrideY * roiSpec.roi[ 1 ].step, sizeOf );
-                  imagedataPtr += static_cast< dip::sint >( copyWidth * sizeOf ) * strides[ 0 ];
-               }
-               xPos += roiSpec.roi[ 0 ].step * copyWidth;
-            }
-            imagedata += static_cast< dip::sint >( copyHeight * sizeOf ) * strides[ 1 ];
-            yPos += roiSpec.roi[ 1 ].step * copyHeight;
-         }
-      } else if( planarConfiguration == PLANARCONFIG_SEPARATE ) {
-         // 1111...2222...3333...4444...
-         //std::cout << "[ReadTIFFData] Tiles, Separate\n";
-         DIP_ASSERT( static_cast< dip::uint >( tileSize ) == static_cast< dip::uint >( tileWidth ) * tileLength * sizeOf );
-         dip::uint tileStrideY = tileWidth;
-         for( auto plane : roiSpec.channels ) {
-            uint8* imagedataRow = imagedata;
-            dip::uint yPos = roiSpec.roi[ 1 ].Offset();
-            for( dip::uint y = firstTileY; y <= roiSpec.roi[ 1 ].Last(); y += tileLength ) {
-               dip::uint tileEndY = std::min( y + tileLength, data.sizes[ 1 ] );
-               tileEndY = std::min( tileEndY, roiSpec.roi[ 1 ].Last() + 1 );
-               if( yPos >= tileEndY ) {
-                  continue;
-               }
-               dip::uint copyHeight = div_ceil( tileEndY - yPos, roiSpec.roi[ 1 ].step );
-               uint8* imagedataPtr = imagedataRow;
-               dip::uint offsetY = ( yPos - y ) * tileStrideY;
-               dip::uint xPos = roiSpec.roi[ 0 ].Offset();
-               for( dip::uint x = firstTileX; x <= roiSpec.roi[ 0 ].Last(); x += tileWidth ) {
-                  dip::uint tileEndX = std::min( x + tileWidth, data.sizes[ 0 ] );
-                  tileEndX = std::min( tileEndX, roiSpec.roi[ 0 ].Last() + 1 );
-                  if( xPos >= tileEndX ) {
-                     continue;
-                  }
-                  dip::uint copyWidth = div_ceil( tileEndX - xPos, roiSpec.roi[ 0 ].step );
-                  dip::uint offset = ( offsetY + ( xPos - x ));
-                  uint32 tile = TIFFComputeTile( tiff, static_cast< uint32 >( x ), static_cast< uint32 >( y ), 0, static_cast< uint16 >( plane ));
-                  TIFFReadEncodedTile( tiff, tile, buf.data(), tileSize );
-                  if( sizeOf == 1 ) {
-                     //std::cout << "Copying " << copyWidth << "x" << copyHeight << " pixels from tile, pos = " << xPos << ", " << yPos << std::endl;
-                     CopyBuffer2D_8bit( imagedataPtr, buf.data() + offset, copyWidth, copyHeight,
-                                        strides[ 0 ], strides[ 1 ],
-                                        roiSpec.roi[ 0 ].step, tileStrideY * roiSpec.roi[ 1 ].step );
-                     imagedataPtr += static_cast< dip::sint >( copyWidth ) * strides[ 0 ];
-                  } else {
-                     CopyBuffer2D( imagedataPtr, buf.data() + offset * sizeOf, copyWidth, copyHeight,
-                                   strides[ 0 ], strides[ 1 ],
-                                   roiSpec.roi[ 0 ].step, tileStrideY * roiSpec.roi[ 1 ].step, sizeOf );
-                     imagedataPtr += static_cast< dip::sint >( copyWidth * sizeOf ) * strides[ 0 ];
-                  }
-                  xPos += roiSpec.roi[ 0 ].step * copyWidth;
-               }
-               imagedataRow += static_cast< dip::sint >( copyHeight * sizeOf ) * strides[ 1 ];
-               yPos += roiSpec.roi[ 1 ].step * copyHeight;
-            }
-            imagedata += static_cast< dip::sint >( sizeOf ) * tensorStride;
+   TIFFBlockLayout layout;
+   DIP_STACK_TRACE_THIS( layout = GetTIFFBlockLayout( tiff, data.sizes ));
+   if( layout.rowSize != layout.width * samplesPerPixel * sizeOf ) {
+      DIP_THROW_RUNTIME( TIFF_UNKNOWN_BIT_DEPTH );
+   }
+
+   if( !layout.tiled && roiSpec.isFullImage && ( !contiguous || roiSpec.isAllChannels ) &&
+       StridesAreNormal( samplesPerPixel, contiguous ? tensorStride : 1, data.sizes, strides )) {
+      // --- Striped TIFF file, reading the full image: we can read directly into the output image ---
+      //std::cout << "[ReadTIFFData] Stripes, isFullImage\n";
+      dip::uint nStrips = div_ceil( data.sizes[ 1 ], layout.height );
+      DIP_STACK_TRACE_THIS( ForEachTIFFJob( tiff, nPlanes * nStrips, 0, nPlanes * data.sizes[ 1 ] * layout.rowSize,
+                                            [ & ]( TIFF* threadTiff, uint8* /*buffer*/, dip::uint job ) {
+         dip::uint plane = job / nStrips;
+         dip::uint yPos = ( job % nStrips ) * layout.height;
+         dip::uint copyHeight = std::min( layout.height, data.sizes[ 1 ] - yPos );
+         uint32 strip = TIFFComputeStrip( threadTiff, static_cast< uint32 >( yPos ),
+                                          static_cast< uint16 >( contiguous ? 0 : roiSpec.channels.Offset() + plane * roiSpec.channels.step ));
+         uint8* dest = imagedata + ( static_cast< dip::sint >( plane ) * tensorStride + static_cast< dip::sint >( yPos ) * strides[ 1 ] ) * static_cast< dip::sint >( sizeOf );
+         if( TIFFReadEncodedStrip( threadTiff, strip, dest, static_cast< tmsize_t >( copyHeight * layout.rowSize )) < 0 ) {
+            DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
          }
-      } else {
-         DIP_THROW_RUNTIME( TIFF_UNKNOWN_PLANAR_CONFIG );
-      }
-   } else {
-      // --- Striped TIFF file ---
-      uint32 stripHeight{};
-      TIFFGetFieldDefaulted( tiff, TIFFTAG_ROWSPERSTRIP, &stripHeight );
-      tsize_t stripSize = TIFFStripSize( tiff );
-      uint32 nStrips = TIFFNumberOfStrips( tiff );
-      dip::uint firstStrip = ( roiSpec.roi[ 1 ].Offset() / stripHeight ) * stripHeight;
-      if( planarConfiguration == PLANARCONFIG_CONTIG ) {
-         // 1234123412341234....
-         // We know that tensorElements > 1, otherwise we force to PLANARCONFIG_SEPARATE
-         DIP_ASSERT( static_cast< dip::uint >( TIFFScanlineSize( tiff )) == data.sizes[ 0 ] * data.tensorElements * sizeOf );
-         if( roiSpec.isFullImage && roiSpec.isAllChannels && StridesAreNormal( data.tensorElements, tensorStride, data.sizes, strides )) {
-            //std::cout << "[ReadTIFFData] Stripes, Contiguous, isFullImage\n";
-            uint32 yPos = 0;
-            for( uint32 strip = 0; strip < nStrips; ++strip ) {
-               dip::uint copyHeight = ( yPos + stripHeight > data.sizes[ 1 ] ? data.sizes[ 1 ] - yPos : stripHeight );
-               if( TIFFReadEncodedStrip( tiff, strip, imagedata, stripSize ) < 0 ) {
-                  DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
-               }
-               imagedata += static_cast< dip::sint >( copyHeight * sizeOf ) * strides[ 1 ];
-               yPos += stripHeight;
-            }
+      } ));
+      return;
+   }
+
+   // --- Striped or tiled TIFF file: read only the blocks that intersect the ROI ---
+   std::vector< TIFFBlock > blocks;
+   for( dip::uint plane = 0; plane < nPlanes; ++plane ) {
+      FindTIFFBlocks( tiff, layout, data.sizes, roiSpec.roi, contiguous ? 0 : roiSpec.channels.Offset() + plane * roiSpec.channels.step, plane, blocks );
+   }
+   dip::uint srcStrideY = layout.rowSize / sizeOf * roiSpec.roi[ 1 ].step;
+   DIP_STACK_TRACE_THIS( ForEachTIFFJob( tiff, blocks.size(), layout.blockSize, blocks.size() * layout.blockSize,
+                                         [ & ]( TIFF* threadTiff, uint8* buffer, dip::uint job ) {
+      TIFFBlock const& block = blocks[ job ];
+      ReadTIFFBlock( threadTiff, layout, block.index, buffer );
+      uint8* dest = imagedata + ( static_cast< dip::sint >( block.plane ) * tensorStride +
+                                  static_cast< dip::sint >( block.outX ) * strides[ 0 ] +
+                                  static_cast< dip::sint >( block.outY ) * strides[ 1 ] ) * static_cast< dip::sint >( sizeOf );
+      uint8 const* src = buffer + block.y * layout.rowSize + block.x * samplesPerPixel * sizeOf;
+      if( contiguous ) {
+         src += roiSpec.channels.Offset() * sizeOf;
+         if( sizeOf == 1 ) {
+            CopyBuffer3D_8bit( dest, src, roiSpec.tensorElements, block.width, block.height,
+                               tensorStride, strides[ 0 ], strides[ 1 ],
+                               roiSpec.channels.step, samplesPerPixel * roiSpec.roi[ 0 ].step, srcStrideY );
          } else {
-            //std::cout << "[ReadTIFFData] Stripes, Contiguous\n";
-            std::vector< uint8 > buf( static_cast< dip::uint >( stripSize ));
-            dip::uint yPos = roiSpec.roi[ 1 ].Offset();
-            dip::uint yStride = data.tensorElements * data.sizes[ 0 ];
-            for( dip::uint y = firstStrip; y <= roiSpec.roi[ 1 ].Last(); y += stripHeight ) {
-               dip::uint stripEnd = std::min( y + stripHeight, data.sizes[ 1 ] );
-               stripEnd = std::min( stripEnd, roiSpec.roi[ 1 ].Last() + 1 );
-               if( yPos >= stripEnd ) {
-                  continue;
-               }
-               dip::uint copyHeight = div_ceil( stripEnd - yPos, roiSpec.roi[ 1 ].step );
-               dip::uint offsetY = ( yPos - y ) * yStride;
-               dip::uint offset = ( offsetY + roiSpec.roi[ 0 ].Offset() * data.tensorElements + roiSpec.channels.Offset() );
-               uint32 strip = TIFFComputeStrip( tiff, static_cast< uint32 >( y ), 0 );
-               if( TIFFReadEncodedStrip( tiff, strip, buf.data(), stripSize ) < 0 ) {
-                  DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
-               }
-               if( sizeOf == 1 ) {
-                  //std::cout << "Copying " << roiSpec.sizes[ 0 ] << "x" << copyHeight << " pixels from stripe, pos = " << roiSpec.roi[ 0 ].Offset() << ", " << yPos << std::endl;
-                  CopyBuffer3D_8bit(
-                        imagedata, buf.data() + offset, roiSpec.tensorElements, roiSpec.sizes[ 0 ], copyHeight,
-                        tensorStride, strides[ 0 ], strides[ 1 ],
-                        roiSpec.channels.step, data.tensorElements * roiSpec.roi[ 0 ].step, yStride * roiSpec.roi[ 1 ].step );
-                  imagedata += static_cast< dip::sint >( copyHeight ) * strides[ 1 ];
-               } else {
-                  CopyBuffer3D(
-                        imagedata, buf.data() + offset * sizeOf, roiSpec.tensorElements, roiSpec.sizes[ 0 ], copyHeight,
-                        tensorStride, strides[ 0 ], strides[ 1 ],
-                        roiSpec.channels.step, data.tensorElements * roiSpec.roi[ 0 ].step, yStride * roiSpec.roi[ 1 ].step, sizeOf );
-                  imagedata += static_cast< dip::sint >( copyHeight * sizeOf ) * strides[ 1 ];
-               }
-               yPos += roiSpec.roi[ 1 ].step * copyHeight;
-            }
+            CopyBuffer3D( dest, src, roiSpec.tensorElements, block.width, block.height,
+                          tensorStride, strides[ 0 ], strides[ 1 ],
+                          roiSpec.channels.step, samplesPerPixel * roiSpec.roi[ 0 ].step, srcStrideY, sizeOf );
          }
-      } else if( planarConfiguration == PLANARCONFIG_SEPARATE ) {
-         // 1111...2222...3333...4444...
-         DIP_ASSERT( static_cast< dip::uint >( TIFFScanlineSize( tiff )) == data.sizes[ 0 ] * sizeOf );
-         DIP_ASSERT( nStrips % data.tensorElements == 0 );
-         nStrips /= static_cast< uint32 >( data.tensorElements );
-         if( roiSpec.isFullImage && StridesAreNormal( 1, 1, data.sizes, strides )) {
-            //std::cout << "[ReadTIFFData] Stripes, Separate, isFullImage\n";
-            for( auto plane : roiSpec.channels ) {
-               uint8* imagedataRow = imagedata;
-               uint32 stripOffset = TIFFComputeStrip( tiff, 0, static_cast< uint16 >( plane ));
-               uint32 yPos = 0;
-               for( uint32 strip = 0; strip < nStrips; ++strip ) {
-                  dip::uint copyHeight = ( yPos + stripHeight > data.sizes[ 1 ] ? data.sizes[ 1 ] - yPos : stripHeight );
-                  if( TIFFReadEncodedStrip( tiff, stripOffset + strip, imagedataRow, stripSize ) < 0 ) {
-                     DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
-                  }
-                  imagedataRow += static_cast< dip::sint >( copyHeight * sizeOf ) * strides[ 1 ];
-                  yPos += stripHeight;
-               }
-               imagedata += static_cast< dip::sint >( sizeOf ) * tensorStride;
-            }
+      } else {
+         if( sizeOf == 1 ) {
+            CopyBuffer2D_8bit( dest, src, block.width, block.height, strides[ 0 ], strides[ 1 ],
+                               roiSpec.roi[ 0 ].step, srcStrideY );
          } else {
-            //std::cout << "[ReadTIFFData] Stripes, Separate\n";
-            std::vector< uint8 > buf( static_cast< dip::uint >( stripSize ));
-            dip::uint yStride = data.sizes[ 0 ];
-            for( auto plane : roiSpec.channels ) {
-               uint8* imagedataRow = imagedata;
-               dip::uint yPos = roiSpec.roi[ 1 ].Offset();
-               for( dip::uint y = firstStrip; y <= roiSpec.roi[ 1 ].Last(); y += stripHeight ) {
-                  dip::uint stripEnd = std::min( y + stripHeight, data.sizes[ 1 ] );
-                  stripEnd = std::min( stripEnd, roiSpec.roi[ 1 ].Last() + 1 );
-                  if( yPos >= stripEnd ) {
-                     continue;
-                  }
-                  dip::uint copyHeight = div_ceil( stripEnd - yPos, roiSpec.roi[ 1 ].step );
-                  dip::uint offsetY = ( yPos - y ) * yStride;
-                  dip::uint offset = ( offsetY + roiSpec.roi[ 0 ].Offset() );
-                  uint32 strip = TIFFComputeStrip( tiff, static_cast< uint32 >( y ), static_cast< uint16 >( plane ));
-                  if( TIFFReadEncodedStrip( tiff, strip, buf.data(), stripSize ) < 0 ) {
-                     DIP_THROW_RUNTIME( TIFF_ERROR_READING_DATA );
-                  }
-                  if( sizeOf == 1 ) {
-                     CopyBuffer2D_8bit( imagedataRow, buf.data() + offset, roiSpec.sizes[ 0 ], copyHeight,
-                                        strides[ 0 ], strides[ 1 ],
-                                        roiSpec.roi[ 0 ].step, yStride * roiSpec.roi[ 1 ].step );
-                     imagedataRow += static_cast< dip::sint >( copyHeight ) * strides[ 1 ];
-                  } else {
-                     CopyBuffer2D( imagedataRow, buf.data() + offset * sizeOf, roiSpec.sizes[ 0 ], copyHeight,
-                                   strides[ 0 ], strides[ 1 ],
-                                   roiSpec.roi[ 0 ].step, yStride * roiSpec.roi[ 1 ].step, sizeOf );
-                     imagedataRow += static_cast< dip::sint >( copyHeight * sizeOf ) * strides[ 1 ];
-                  }
-                  yPos += roiSpec.roi[ 1 ].step * copyHeight;
-               }
-               imagedata += static_cast< dip::sint >( sizeOf ) * tensorStride;
-            }
+            CopyBuffer2D( dest, src, block.width, block.height, strides[ 0 ], strides[ 1 ],
+                          roiSpec.roi[ 0 ].step, srcStrideY, sizeOf );
          }
-      } else {
-         DIP_THROW_RUNTIME( TIFF_UNKNOWN_PLANAR_CONFIG );
       }
-   }
+   } ));
 }
 
 void ReadTIFFGreyValue(
@@ -962,15 +907,19 @@ void ImageReadTIFFStack(
    uint8* imagedata = static_cast< uint8* >( image.Origin() );
    dip::sint z_stride = image.Stride( 2 ) * static_cast< dip::sint >( data.fileInformation.dataType.SizeOf() );
 
+   // Reads the image data for the current directory into the plane at `imagedata`
+   auto readPlane = [ & ]( uint8* planeData ) {
+      if( data.photometricInterpretation == PHOTOMETRIC_PALETTE ) {
+         ReadTIFFColorMapData( reinterpret_cast< uint16* >( planeData ), image.Strides(), image.TensorStride(), tiff, data.fileInformation, roiSpec );
+      } else if( data.fileInformation.dataType.IsBinary() ) {
+         ReadTIFFBinaryData( planeData, image.Strides(), tiff, data, roiSpec );
+      } else {
+         ReadTIFFData( planeData, image.Strides(), image.TensorStride(), image.DataType(), tiff, data.fileInformation, roiSpec );
+      }
+   };
+
    // Read the image data for first plane
-   if( data.photometricInterpretation == PHOTOMETRIC_PALETTE ) {
-      // TODO: To implement this, we need to separate out the core of ReadTIFFColorMap() to a separate function we can call here
-      DIP_THROW( "Reading stacks of color-mapped images from a TIFF file is not yet implemented" );
-   }
-   if( data.fileInformation.dataType.IsBinary() ) {
-      DIP_THROW( "Reading stacks of binary images from a TIFF file is not yet implemented" );
-   }
-   DIP_STACK_TRACE_THIS( ReadTIFFData( imagedata, image.Strides(), image.TensorStride(), image.DataType(), tiff, data.fileInformation, roiSpec ));
+   DIP_STACK_TRACE_THIS( readPlane( imagedata ));
 
    // Read the image data for other planes
    dip::uint directory = imageNumbers.Offset();
@@ -1022,12 +971,37 @@ void ImageReadTIFFStack(
       }
 
       // Read the image data for this plane
-      if (data.photometricInterpretation == PHOTOMETRIC_PALETTE ) {
-         // TODO: Implement!
-         DIP_THROW( "Reading stacks of color-mapped images from a TIFF file is not yet implemented" );
+      DIP_STACK_TRACE_THIS( readPlane( imagedata ));
+   }
+}
+
+// Finds the directory offsets of the levels of a pyramidal TIFF file, the first one is the full-resolution image
+// `imageNumber`. The reduced-resolution images are either SubIFDs of this image, or the pages that follow it and
+// are marked as reduced-resolution images. Use `TIFFSetSubDirectory()` to go to one of the levels.
+std::vector< uint64 > FindTIFFPyramidLevels( TiffFile& tiff, dip::uint imageNumber ) {
+   dip::uint numberOfImages = TIFFNumberOfDirectories( tiff );
+   if(( imageNumber >= numberOfImages ) || ( TIFFSetDirectory( tiff, static_cast< uint16 >( imageNumber )) == 0 )) {
+      DIP_THROW_RUNTIME( TIFF_DIRECTORY_NOT_FOUND );
+   }
+   std::vector< uint64 > levels{ TIFFCurrentDirOffset( tiff ) };
+   uint16 nSubIFDs{};
+   uint64* subIFDs{};
+   if( TIFFGetField( tiff, TIFFTAG_SUBIFD, &nSubIFDs, &subIFDs ) && ( nSubIFDs > 0 )) {
+      // Copy the offsets, the array is owned by the current directory
+      levels.insert( levels.end(), subIFDs, subIFDs + nSubIFDs );
+      return levels;
+   }
+   for( dip::uint directory = imageNumber + 1; directory < numberOfImages; ++directory ) {
+      if( TIFFSetDirectory( tiff, static_cast< uint16 >( directory )) == 0 ) {
+         break;
+      }
+      uint32 subFileType{};
+      if( !TIFFGetField( tiff, TIFFTAG_SUBFILETYPE, &subFileType ) || !( subFileType & FILETYPE_REDUCEDIMAGE )) {
+         break;
       }
-      DIP_STACK_TRACE_THIS( ReadTIFFData( imagedata, image.Strides(), image.TensorStride(), image.DataType(), tiff, data.fileInformation, roiSpec ));
+      levels.push_back( TIFFCurrentDirOffset( tiff ));
    }
+   return levels;
 }
 
 } // namespace
@@ -1068,12 +1042,10 @@ FileInformation ImageReadTIFF(
       DIP_STACK_TRACE_THIS( ImageReadTIFFStack( out, tiff, data, imageNumbers, roiSpec, useColorMap ));
    } else {
       if( data.photometricInterpretation == PHOTOMETRIC_PALETTE ) {
-         DIP_THROW_IF( !roiSpec.isFullImage, "Reading ROI not supported for colormapped images" );
-         DIP_STACK_TRACE_THIS( ReadTIFFColorMap( out, tiff, data ));
+         DIP_STACK_TRACE_THIS( ReadTIFFColorMap( out, tiff, data, roiSpec ));
       } else {
          if( data.fileInformation.dataType.IsBinary() ) {
-            DIP_THROW_IF( !roiSpec.isFullImage, "Reading ROI not supported for binary images" );
-            DIP_STACK_TRACE_THIS( ReadTIFFBinary( out, tiff, data ));
+            DIP_STACK_TRACE_THIS( ReadTIFFBinary( out, tiff, data, roiSpec ));
          } else {
             DIP_STACK_TRACE_THIS( ReadTIFFGreyValue( out, tiff, data, roiSpec ));
          }
@@ -1170,6 +1142,78 @@ FileInformation ImageReadTIFFInfo(
    return data.fileInformation;
 }
 
+FileInformation ImageReadTIFFPyramidLevel(
+      Image& out,
+      String const& filename,
+      dip::uint level,
+      RangeArray const& roi,
+      Range const& channels,
+      dip::uint imageNumber
+) {
+   // Open TIFF file
+   TiffFile tiff( filename );
+
+   // Go to the right directory
+   std::vector< uint64 > levels;
+   DIP_STACK_TRACE_THIS( levels = FindTIFFPyramidLevels( tiff, imageNumber ));
+   DIP_THROW_IF( level >= levels.size(), "The TIFF file does not have the requested resolution level" );
+   if( TIFFSetSubDirectory( tiff, levels[ level ] ) == 0 ) {
+      DIP_THROW_RUNTIME( TIFF_DIRECTORY_NOT_FOUND );
+   }
+
+   // Get info
+   GetTIFFInfoData data{};
+   DIP_STACK_TRACE_THIS( data = GetTIFFInfo( tiff, true ));
+
+   // Check & fix ROI information
+   RoiSpec roiSpec;
+   DIP_STACK_TRACE_THIS( roiSpec = CheckAndConvertRoi( roi, channels, data.fileInformation, 2 ));
+
+   // Read the data
+   if( data.photometricInterpretation == PHOTOMETRIC_PALETTE ) {
+      DIP_STACK_TRACE_THIS( ReadTIFFColorMap( out, tiff, data, roiSpec ));
+   } else if( data.fileInformation.dataType.IsBinary() ) {
+      DIP_STACK_TRACE_THIS( ReadTIFFBinary( out, tiff, data, roiSpec ));
+   } else {
+      DIP_STACK_TRACE_THIS( ReadTIFFGreyValue( out, tiff, data, roiSpec ));
+   }
+
+   if( roiSpec.isAllChannels ) {
+      out.SetColorSpace( data.fileInformation.colorSpace );
+   }
+   out.SetPixelSize( data.fileInformation.pixelSize );
+
+   // Apply the mirroring to the output image
+   out.Mirror( roiSpec.mirror );
+
+   return data.fileInformation;
+}
+
+std::vector< FileInformation > ImageReadTIFFPyramidInfo(
+      String const& filename,
+      dip::uint imageNumber
+) {
+   // Open TIFF file
+   TiffFile tiff( filename );
+
+   // Find the levels
+   std::vector< uint64 > levels;
+   DIP_STACK_TRACE_THIS( levels = FindTIFFPyramidLevels( tiff, imageNumber ));
+
+   // Get info for each level
+   std::vector< FileInformation > out;
+   out.reserve( levels.size() );
+   for( uint64 offset : levels ) {
+      if( TIFFSetSubDirectory( tiff, offset ) == 0 ) {
+         DIP_THROW_RUNTIME( TIFF_DIRECTORY_NOT_FOUND );
+      }
+      GetTIFFInfoData data{};
+      DIP_STACK_TRACE_THIS( data = GetTIFFInfo( tiff, true ));
+      out.push_back( std::move( data.fileInformation ));
+   }
+   return out;
+}
+
 bool ImageIsTIFF(
       String const& filename
 ) {
@@ -1183,6 +1227,161 @@ bool ImageIsTIFF(
 
 } // namespace dip
 
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include <cstdio>
+
+#include "doctest.h"
+#include "diplib/testing.h"
+
+namespace {
+
+// Writes a tiled TIFF file, where `value( x, y, s )` gives the value of sample `s` of pixel (x, y).
+template< typename F >
+void WriteTiledTIFF(
+      char const* filename,
+      dip::uint width,
+      dip::uint height,
+      dip::uint samples,
+      dip::uint bits,
+      dip::uint16 photometric,
+      dip::uint16 planar,
+      F const& value,
+      dip::uint16* colorMap = nullptr
+) {
+   constexpr dip::uint tileWidth = 32;
+   constexpr dip::uint tileLength = 16;
+   TIFF* tiff = TIFFOpen( filename, "w" );
+   DOCTEST_REQUIRE( tiff != nullptr );
+   TIFFSetField( tiff, TIFFTAG_IMAGEWIDTH, static_cast< dip::uint32 >( width ));
+   TIFFSetField( tiff, TIFFTAG_IMAGELENGTH, static_cast< dip::uint32 >( height ));
+   TIFFSetField( tiff, TIFFTAG_SAMPLESPERPIXEL, static_cast< dip::uint16 >( samples ));
+   TIFFSetField( tiff, TIFFTAG_BITSPERSAMPLE, static_cast< dip::uint16 >( bits ));
+   TIFFSetField( tiff, TIFFTAG_PHOTOMETRIC, photometric );
+   TIFFSetField( tiff, TIFFTAG_PLANARCONFIG, planar );
+   TIFFSetField( tiff, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE );
+   TIFFSetField( tiff, TIFFTAG_TILEWIDTH, static_cast< dip::uint32 >( tileWidth ));
+   TIFFSetField( tiff, TIFFTAG_TILELENGTH, static_cast< dip::uint32 >( tileLength ));
+   if( colorMap ) {
+      dip::uint n = 1u << bits;
+      TIFFSetField( tiff, TIFFTAG_COLORMAP, colorMap, colorMap + n, colorMap + 2 * n );
+   }
+   bool separate = planar == PLANARCONFIG_SEPARATE;
+   dip::uint planes = separate ? samples : 1;
+   dip::uint spp = separate ? 1 : samples;
+   dip::uint rowBytes = dip::div_ceil( tileWidth * spp * bits, dip::uint( 8 ));
+   std::vector< dip::uint8 > buf( rowBytes * tileLength );
+   for( dip::uint plane = 0; plane < planes; ++plane ) {
+      for( dip::uint ty = 0; ty < height; ty += tileLength ) {
+         for( dip::uint tx = 0; tx < width; tx += tileWidth ) {
+            std::fill( buf.begin(), buf.end(), dip::uint8( 0 ));
+            for( dip::uint yy = 0; yy < tileLength; ++yy ) {
+               for( dip::uint xx = 0; xx < tileWidth; ++xx ) {
+                  if(( tx + xx >= width ) || ( ty + yy >= height )) {
+                     continue;
+                  }
+                  for( dip::uint s = 0; s < spp; ++s ) {
+                     dip::uint v = value( tx + xx, ty + yy, separate ? plane : s );
+                     dip::uint bitIndex = ( xx * spp + s ) * bits;
+                     dip::uint8* ptr = buf.data() + yy * rowBytes + bitIndex / 8;
+                     if( bits == 16 ) {
+                        dip::uint16 v16 = static_cast< dip::uint16 >( v );
+                        std::memcpy( ptr, &v16, 2 );
+                     } else {
+                        *ptr = static_cast< dip::uint8 >( *ptr | ( v << ( 8 - bits - bitIndex % 8 )));
+                     }
+                  }
+               }
+            }
+            dip::uint32 tile = TIFFComputeTile( tiff, static_cast< dip::uint32 >( tx ), static_cast< dip::uint32 >( ty ), 0, static_cast< dip::uint16 >( plane ));
+            DOCTEST_REQUIRE( TIFFWriteEncodedTile( tiff, tile, buf.data(), static_cast< tmsize_t >( buf.size() )) >= 0 );
+         }
+      }
+   }
+   TIFFClose( tiff );
+}
+
+// Creates an image with `value( x, y, s )` as sample values.
+template< typename F >
+dip::Image MakeReference( dip::uint width, dip::uint height, dip::uint samples, dip::DataType dataType, F const& value ) {
+   dip::Image out( { width, height }, samples, dip::DT_UINT16 );
+   dip::uint16* ptr = static_cast< dip::uint16* >( out.Origin() );
+   for( dip::uint y = 0; y < height; ++y ) {
+      for( dip::uint x = 0; x < width; ++x ) {
+         for( dip::uint s = 0; s < samples; ++s ) {
+            *( ptr++ ) = static_cast< dip::uint16 >( value( x, y, s ));
+         }
+      }
+   }
+   out.Convert( dataType );
+   return out;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE( "[DIPlib] testing reading ROIs from tiled TIFF files" ) {
+   dip::uint width = 150;
+   dip::uint height = 100;
+   dip::RangeArray roi{ dip::Range{ 17, 140, 3 }, dip::Range{ 91, 5, 2 }};
+   dip::Range channels{ 1, 2 };
+   dip::Image result;
+
+   // Grey-value, multiple channels, 16 bits
+   auto grey = []( dip::uint x, dip::uint y, dip::uint s ) { return ( x * 7 + y * 131 + s * 1000 ) % 65536; };
+   dip::Image ref = MakeReference( width, height, 3, dip::DT_UINT16, grey );
+   for( dip::uint16 planar : std::vector< dip::uint16 >{ PLANARCONFIG_CONTIG, PLANARCONFIG_SEPARATE } ) {
+      WriteTiledTIFF( "test_tiled.tif", width, height, 3, 16, PHOTOMETRIC_RGB, planar, grey );
+      dip::ImageReadTIFF( result, "test_tiled.tif" );
+      DOCTEST_CHECK( dip::testing::CompareImages( result, ref, dip::Option::CompareImagesMode::EXACT ));
+      result.Strip();
+      dip::ImageReadTIFF( result, "test_tiled.tif", dip::Range{ 0 }, roi, channels );
+      DOCTEST_CHECK( dip::testing::CompareImages( result, ref.At( roi )[ channels ], dip::Option::CompareImagesMode::EXACT ));
+   }
+
+   // Grey-value, 8 bits
+   auto grey8 = []( dip::uint x, dip::uint y, dip::uint ) { return ( x * 3 + y * 5 ) % 256; };
+   ref = MakeReference( width, height, 1, dip::DT_UINT8, grey8 );
+   WriteTiledTIFF( "test_tiled.tif", width, height, 1, 8, PHOTOMETRIC_MINISBLACK, PLANARCONFIG_CONTIG, grey8 );
+   result.Strip();
+   dip::ImageReadTIFF( result, "test_tiled.tif", dip::Range{ 0 }, roi );
+   DOCTEST_CHECK( dip::testing::CompareImages( result, ref.At( roi ), dip::Option::CompareImagesMode::EXACT ));
+
+   // Binary
+   auto binary = []( dip::uint x, dip::uint y, dip::uint ) { return ( x / 3 + y / 5 + x * y ) % 2; };
+   ref = MakeReference( width, height, 1, dip::DT_BIN, binary );
+   WriteTiledTIFF( "test_tiled.tif", width, height, 1, 1, PHOTOMETRIC_MINISBLACK, PLANARCONFIG_CONTIG, binary );
+   result.Strip();
+   dip::ImageReadTIFF( result, "test_tiled.tif" );
+   DOCTEST_CHECK( dip::testing::CompareImages( result, ref, dip::Option::CompareImagesMode::EXACT ));
+   result.Strip();
+   dip::ImageReadTIFF( result, "test_tiled.tif", dip::Range{ 0 }, roi );
+   DOCTEST_CHECK( dip::testing::CompareImages( result, ref.At( roi ), dip::Option::CompareImagesMode::EXACT ));
+   // Binary, striped
+   dip::ImageWriteTIFF( ref, "test_tiled.tif" );
+   result.Strip();
+   dip::ImageReadTIFF( result, "test_tiled.tif", dip::Range{ 0 }, roi );
+   DOCTEST_CHECK( dip::testing::CompareImages( result, ref.At( roi ), dip::Option::CompareImagesMode::EXACT ));
+
+   // Color-mapped, 4 bits
+   std::vector< dip::uint16 > colorMap( 3 * 16 );
+   for( dip::uint ii = 0; ii < colorMap.size(); ++ii ) {
+      colorMap[ ii ] = static_cast< dip::uint16 >( ii * 1234u );
+   }
+   auto index = []( dip::uint x, dip::uint y, dip::uint ) { return ( x + 3 * y ) % 16; };
+   auto color = [ & ]( dip::uint x, dip::uint y, dip::uint s ) { return colorMap[ s * 16 + index( x, y, 0 ) ]; };
+   ref = MakeReference( width, height, 3, dip::DT_UINT16, color );
+   WriteTiledTIFF( "test_tiled.tif", width, height, 1, 4, PHOTOMETRIC_PALETTE, PLANARCONFIG_CONTIG, index, colorMap.data() );
+   result.Strip();
+   dip::ImageReadTIFF( result, "test_tiled.tif" );
+   DOCTEST_CHECK( dip::testing::CompareImages( result, ref, dip::Option::CompareImagesMode::EXACT ));
+   result.Strip();
+   dip::ImageReadTIFF( result, "test_tiled.tif", dip::Range{ 0 }, roi, channels );
+   DOCTEST_CHECK( dip::testing::CompareImages( result, ref.At( roi )[ channels ], dip::Option::CompareImagesMode::EXACT ));
+
+   std::remove( "test_tiled.tif" );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
+
 #else // DIP_CONFIG_HAS_TIFF
 
 #include "diplib.h"
@@ -1228,6 +1427,21 @@ FileInformation ImageReadTIFFInfo( String const& /*filenames*/, dip::uint /*imag
    DIP_THROW( NOT_AVAILABLE );
 }
 
+FileInformation ImageReadTIFFPyramidLevel(
+      Image& /*out*/,
+      String const& /*filename*/,
+      dip::uint /*level*/,
+      RangeArray const& /*roi*/,
+      Range const& /*channels*/,
+      dip::uint /*imageNumber*/
+) {
+   DIP_THROW( NOT_AVAILABLE );
+}
+
+std::vector< FileInformation > ImageReadTIFFPyramidInfo( String const& /*filename*/, dip::uint /*imageNumber*/ ) {
+   DIP_THROW( NOT_AVAILABLE );
+}
+
 bool ImageIsTIFF( String const& /*filenames*/ ) {
    DIP_THROW( NOT_AVAILABLE );
 }
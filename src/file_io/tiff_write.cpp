@@ -19,11 +19,14 @@
 
 #include "diplib/file_io.h"
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "diplib.h"
+#include "diplib/geometry.h"
 
 #include <tiffio.h>
 
@@ -284,54 +287,187 @@ void WriteTIFFStrips(
    }
 }
 
-} // namespace
-
-void ImageWriteTIFF(
+void WriteTIFFTiles(
       Image const& image,
-      String const& filename,
-      String const& compression,
-      dip::uint jpegLevel
+      TiffFile& tiff,
+      dip::uint tileSize
 ) {
    DIP_THROW_IF( !image.IsForged(), E::IMAGE_NOT_FORGED );
-   DIP_THROW_IF( image.Dimensionality() != 2 && image.Dimensionality() != 3, E::DIMENSIONALITY_NOT_SUPPORTED );
-
-   dip::uint nSlices = image.Dimensionality() == 3 ? image.Size( 2 ) : 1;
-   // Get image info and quit if we can't write
-   DIP_THROW_IF(( image.Size( 0 ) > std::numeric_limits< uint32 >::max() ) ||
-                ( image.Size( 1 ) > std::numeric_limits< uint32 >::max() ) ||
-                ( nSlices > std::numeric_limits< uint32 >::max()), "Image size too large for TIFF file" );
-   uint32 imageWidth = static_cast< uint32 >( image.Size( 0 ));
-   uint32 imageLength = static_cast< uint32 >( image.Size( 1 ));
+   DIP_ASSERT( image.Dimensionality() == 2 );
+   dip::uint tensorElements = image.TensorElements();
+   dip::sint tensorStride = image.TensorStride();
+   IntegerArray const& strides = image.Strides();
    dip::uint sizeOf = image.DataType().SizeOf();
+   bool binary = image.DataType().IsBinary();
+
+   WRITE_TIFF_TAG( tiff, TIFFTAG_TILEWIDTH, static_cast< uint32 >( tileSize ));
+   WRITE_TIFF_TAG( tiff, TIFFTAG_TILELENGTH, static_cast< uint32 >( tileSize ));
+   dip::uint rowSize = static_cast< dip::uint >( TIFFTileRowSize( tiff ));
+   if( binary ) {
+      DIP_ASSERT( rowSize == div_ceil< dip::uint >( tileSize, 8 ));
+   } else {
+      DIP_ASSERT( rowSize == tileSize * tensorElements * sizeOf );
+   }
+   std::vector< uint8 > buf( static_cast< dip::uint >( TIFFTileSize( tiff )));
+
+   // Write it to the file, filling each tile row by row. Tiles that extend past the image edge are padded with zeros.
+   for( dip::uint y = 0; y < image.Size( 1 ); y += tileSize ) {
+      dip::uint height = std::min( tileSize, image.Size( 1 ) - y );
+      for( dip::uint x = 0; x < image.Size( 0 ); x += tileSize ) {
+         dip::uint width = std::min( tileSize, image.Size( 0 ) - x );
+         if(( width < tileSize ) || ( height < tileSize )) {
+            std::fill( buf.begin(), buf.end(), uint8( 0 ));
+         }
+         uint8 const* data = static_cast< uint8 const* >( image.Pointer( UnsignedArray{ x, y } ));
+         for( dip::uint row = 0; row < height; ++row ) {
+            uint8* dest = buf.data() + row * rowSize;
+            if( tensorElements == 1 ) {
+               if( binary ) {
+                  FillBuffer1( dest, data, width, 1, strides );
+               } else if( sizeOf == 1 ) {
+                  FillBuffer8( dest, data, width, 1, strides );
+               } else {
+                  FillBufferN( dest, data, width, 1, strides, sizeOf );
+               }
+            } else {
+               if( sizeOf == 1 ) {
+                  FillBufferMultiChannel8( dest, data, tensorElements, width, 1, tensorStride, strides );
+               } else {
+                  FillBufferMultiChannelN( dest, data, tensorElements, width, 1, tensorStride, strides, sizeOf );
+               }
+            }
+            data += static_cast< dip::sint >( sizeOf ) * strides[ 1 ];
+         }
+         uint32 tile = TIFFComputeTile( tiff, static_cast< uint32 >( x ), static_cast< uint32 >( y ), 0, 0 );
+         if( TIFFWriteEncodedTile( tiff, tile, buf.data(), static_cast< tmsize_t >( buf.size() )) < 0 ) {
+            DIP_THROW_RUNTIME( TIFF_WRITE_DATA );
+         }
+      }
+   }
+}
+
+// How samples are stored in the TIFF file
+struct TIFFSampleFormat {
    uint16 bitsPerSample = 0;
    uint16 sampleFormat = 0;
+   uint16 compression = 0;
+   dip::uint jpegLevel = 0;
+};
+
+TIFFSampleFormat FindTIFFSampleFormat(
+      Image const& image,
+      String const& compression,
+      dip::uint jpegLevel
+) {
+   TIFFSampleFormat format;
    if( image.DataType().IsBinary() ) {
       DIP_THROW_IF( !image.IsScalar(), E::IMAGE_NOT_SCALAR ); // Binary images should not have multiple samples per pixel
    } else {
-      bitsPerSample = static_cast< uint16 >( sizeOf * 8 );
+      format.bitsPerSample = static_cast< uint16 >( image.DataType().SizeOf() * 8 );
       switch( image.DataType() ) {
          case DT_UINT8:
          case DT_UINT16:
          case DT_UINT32:
          case DT_UINT64:
-            sampleFormat = SAMPLEFORMAT_UINT;
+            format.sampleFormat = SAMPLEFORMAT_UINT;
             break;
          case DT_SINT8:
          case DT_SINT16:
          case DT_SINT32:
          case DT_SINT64:
-            sampleFormat = SAMPLEFORMAT_INT;
+            format.sampleFormat = SAMPLEFORMAT_INT;
             break;
          case DT_SFLOAT:
          case DT_DFLOAT:
-            sampleFormat = SAMPLEFORMAT_IEEEFP;
+            format.sampleFormat = SAMPLEFORMAT_IEEEFP;
             break;
          default:
             DIP_THROW( "Data type of image is not compatible with TIFF" );
             break;
       }
    }
-   uint16 compmode = CompressionTranslate( compression );
+   format.compression = CompressionTranslate( compression );
+   format.jpegLevel = clamp< dip::uint >( jpegLevel, 1, 100 );
+   return format;
+}
+
+// Writes the tags that describe the image, must be called before writing the pixel data
+void WriteTIFFTags(
+      Image const& image,
+      TiffFile& tiff,
+      TIFFSampleFormat const& format
+) {
+   if( image.DataType().IsBinary() ) {
+      WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_MINISBLACK ));
+   } else if(( image.ColorSpace() == "RGB" ) || ( image.ColorSpace() == "sRGB" )){
+      WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_RGB )); // TODO: Both linear RGB and non-linear sRGB are mapped to 'RGB' photometric interpretation, not ideal.
+   } else if( image.ColorSpace() == "Lab" ) {
+      WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_CIELAB ));
+   } else if(( image.ColorSpace() == "CMY" ) || ( image.ColorSpace() == "CMYK" )) {
+      WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_SEPARATED ));
+   } else {
+      WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_MINISBLACK ));
+   }
+
+   WRITE_TIFF_TAG( tiff, TIFFTAG_IMAGEWIDTH, static_cast< uint32 >( image.Size( 0 )));
+   WRITE_TIFF_TAG( tiff, TIFFTAG_IMAGELENGTH, static_cast< uint32 >( image.Size( 1 )));
+
+   if( !image.DataType().IsBinary() ) {
+      WRITE_TIFF_TAG( tiff, TIFFTAG_BITSPERSAMPLE, format.bitsPerSample );
+      WRITE_TIFF_TAG( tiff, TIFFTAG_SAMPLEFORMAT, format.sampleFormat );
+      WRITE_TIFF_TAG( tiff, TIFFTAG_SAMPLESPERPIXEL, static_cast< uint16 >( image.TensorElements() ));
+      if( image.TensorElements() > 1 ) {
+         WRITE_TIFF_TAG( tiff, TIFFTAG_PLANARCONFIG, uint16( PLANARCONFIG_CONTIG ));
+         // This is the standard way of writing channels (planes), PLANARCONFIG_SEPARATE is not required to be
+         // supported by all readers.
+      }
+   }
+
+   WRITE_TIFF_TAG( tiff, TIFFTAG_COMPRESSION, format.compression );
+   if( format.compression == COMPRESSION_JPEG ) {
+      WRITE_TIFF_TAG( tiff, TIFFTAG_JPEGQUALITY, static_cast< int >( format.jpegLevel ));
+      WRITE_TIFF_TAG( tiff, TIFFTAG_JPEGCOLORMODE, int( JPEGCOLORMODE_RGB ));
+   }
+}
+
+// Writes the tags with metadata, can be called after writing the pixel data
+void WriteTIFFMetadata(
+      Image const& image,
+      TiffFile& tiff
+) {
+   TIFFSetField( tiff, TIFFTAG_SOFTWARE, "DIPlib " DIP_VERSION_STRING );
+
+   auto ps = image.PixelSize( 0 );
+   if( ps.units.HasSameDimensions( Units::Meter() )) {
+      ps.RemovePrefix();
+      TIFFSetField( tiff, TIFFTAG_XRESOLUTION, static_cast< float >( 0.01 / ps.magnitude ));
+   }
+   ps = image.PixelSize( 1 );
+   if( ps.units.HasSameDimensions( Units::Meter() )) {
+      ps.RemovePrefix();
+      TIFFSetField( tiff, TIFFTAG_YRESOLUTION, static_cast< float >( 0.01 / ps.magnitude ));
+   }
+   TIFFSetField( tiff, TIFFTAG_RESOLUTIONUNIT, uint16( RESUNIT_CENTIMETER ));
+}
+
+} // namespace
+
+void ImageWriteTIFF(
+      Image const& image,
+      String const& filename,
+      String const& compression,
+      dip::uint jpegLevel
+) {
+   DIP_THROW_IF( !image.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF( image.Dimensionality() != 2 && image.Dimensionality() != 3, E::DIMENSIONALITY_NOT_SUPPORTED );
+
+   dip::uint nSlices = image.Dimensionality() == 3 ? image.Size( 2 ) : 1;
+   // Get image info and quit if we can't write
+   DIP_THROW_IF(( image.Size( 0 ) > std::numeric_limits< uint32 >::max() ) ||
+                ( image.Size( 1 ) > std::numeric_limits< uint32 >::max() ) ||
+                ( nSlices > std::numeric_limits< uint32 >::max()), "Image size too large for TIFF file" );
+   TIFFSampleFormat format;
+   DIP_STACK_TRACE_THIS( format = FindTIFFSampleFormat( image, compression, jpegLevel ));
 
    // Create the TIFF file and set the tags
    TiffFile tiff( filename );
@@ -340,61 +476,72 @@ void ImageWriteTIFF(
       if( slice > 0 ) {
          TIFFWriteDirectory( tiff );
       }
-
-      if( image.DataType().IsBinary() ) {
-         WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_MINISBLACK ));
-      } else if(( image.ColorSpace() == "RGB" ) || ( image.ColorSpace() == "sRGB" )){
-         WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_RGB )); // TODO: Both linear RGB and non-linear sRGB are mapped to 'RGB' photometric interpretation, not ideal.
-      } else if( image.ColorSpace() == "Lab" ) {
-         WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_CIELAB ));
-      } else if(( image.ColorSpace() == "CMY" ) || ( image.ColorSpace() == "CMYK" )) {
-         WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_SEPARATED ));
-      } else {
-         WRITE_TIFF_TAG( tiff, TIFFTAG_PHOTOMETRIC, uint16( PHOTOMETRIC_MINISBLACK ));
-      }
-
-      WRITE_TIFF_TAG( tiff, TIFFTAG_IMAGEWIDTH, imageWidth );
-      WRITE_TIFF_TAG( tiff, TIFFTAG_IMAGELENGTH, imageLength );
-
-      if( !image.DataType().IsBinary() ) {
-         WRITE_TIFF_TAG( tiff, TIFFTAG_BITSPERSAMPLE, bitsPerSample );
-         WRITE_TIFF_TAG( tiff, TIFFTAG_SAMPLEFORMAT, sampleFormat );
-         WRITE_TIFF_TAG( tiff, TIFFTAG_SAMPLESPERPIXEL, static_cast< uint16 >( image.TensorElements() ));
-         if( image.TensorElements() > 1 ) {
-            WRITE_TIFF_TAG( tiff, TIFFTAG_PLANARCONFIG, uint16( PLANARCONFIG_CONTIG ));
-            // This is the standard way of writing channels (planes), PLANARCONFIG_SEPARATE is not required to be
-            // supported by all readers.
-         }
-      }
-
-      WRITE_TIFF_TAG( tiff, TIFFTAG_COMPRESSION, compmode );
-      if( compmode == COMPRESSION_JPEG ) {
-         jpegLevel = clamp< dip::uint >( jpegLevel, 1, 100 );
-         WRITE_TIFF_TAG( tiff, TIFFTAG_JPEGQUALITY, static_cast< int >( jpegLevel ));
-         WRITE_TIFF_TAG( tiff, TIFFTAG_JPEGCOLORMODE, int( JPEGCOLORMODE_RGB ));
-      }
-
+      DIP_STACK_TRACE_THIS( WriteTIFFTags( image, tiff, format ));
       DIP_STACK_TRACE_THIS( WriteTIFFStrips( image, tiff, slice ));
+      WriteTIFFMetadata( image, tiff );
+   }
+}
 
-      TIFFSetField( tiff, TIFFTAG_SOFTWARE, "DIPlib " DIP_VERSION_STRING );
+void ImageWriteTIFFPyramid(
+      Image const& image,
+      String const& filename,
+      dip::uint nLevels,
+      String const& layout,
+      String const& compression,
+      dip::uint jpegLevel,
+      dip::uint tileSize
+) {
+   DIP_THROW_IF( !image.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF( image.Dimensionality() != 2, E::DIMENSIONALITY_NOT_SUPPORTED );
+   DIP_THROW_IF(( image.Size( 0 ) > std::numeric_limits< uint32 >::max() ) ||
+                ( image.Size( 1 ) > std::numeric_limits< uint32 >::max() ), "Image size too large for TIFF file" );
+   DIP_THROW_IF(( tileSize == 0 ) || ( tileSize % 16 != 0 ), "The tile size must be a positive multiple of 16" );
+   bool useSubIFD{};
+   DIP_STACK_TRACE_THIS( useSubIFD = BooleanFromString( layout, "subifd", "pages" ));
+   TIFFSampleFormat format;
+   DIP_STACK_TRACE_THIS( format = FindTIFFSampleFormat( image, compression, jpegLevel ));
+
+   // Compute the pyramid levels, each one half the size of the previous one. Sampling the linear interpolation
+   // half-way between pixels averages each 2x2 block of pixels. Binary images use nearest neighbor interpolation.
+   std::vector< Image > levels{ image };
+   while(( nLevels == 0 ) ? ( std::max( levels.back().Size( 0 ), levels.back().Size( 1 )) > tileSize ) : ( levels.size() < nLevels )) {
+      Image const& previous = levels.back();
+      if(( previous.Size( 0 ) < 2 ) || ( previous.Size( 1 ) < 2 )) {
+         break;
+      }
+      Image next;
+      DIP_STACK_TRACE_THIS( Resampling( previous, next, { 0.5 }, { -0.5 }, S::LINEAR ));
+      PixelSize pixelSize = previous.PixelSize();
+      pixelSize.Scale( 2.0 );
+      next.SetPixelSize( std::move( pixelSize ));
+      levels.push_back( std::move( next ));
+   }
 
-      auto ps = image.PixelSize( 0 );
-      if( ps.units.HasSameDimensions( Units::Meter() )) {
-         ps.RemovePrefix();
-         TIFFSetField( tiff, TIFFTAG_XRESOLUTION, static_cast< float >( 0.01 / ps.magnitude ));
+   // Create the TIFF file and write the levels
+   TiffFile tiff( filename );
+   for( dip::uint ii = 0; ii < levels.size(); ++ii ) {
+      if( ii > 0 ) {
+         // With the SubIFD layout, libtiff writes the directories after the first one as SubIFDs of the first one.
+         TIFFWriteDirectory( tiff );
+         WRITE_TIFF_TAG( tiff, TIFFTAG_SUBFILETYPE, uint32( FILETYPE_REDUCEDIMAGE ));
       }
-      ps = image.PixelSize( 1 );
-      if( ps.units.HasSameDimensions( Units::Meter() )) {
-         ps.RemovePrefix();
-         TIFFSetField( tiff, TIFFTAG_YRESOLUTION, static_cast< float >( 0.01 / ps.magnitude ));
+      DIP_STACK_TRACE_THIS( WriteTIFFTags( levels[ ii ], tiff, format ));
+      if(( ii == 0 ) && useSubIFD && ( levels.size() > 1 )) {
+         std::vector< uint64 > offsets( levels.size() - 1, 0 ); // filled in by libtiff
+         if( !TIFFSetField( tiff, TIFFTAG_SUBIFD, static_cast< uint16 >( offsets.size() ), offsets.data() )) {
+            DIP_THROW_RUNTIME( TIFF_WRITE_TAG );
+         }
       }
-      TIFFSetField( tiff, TIFFTAG_RESOLUTIONUNIT, uint16( RESUNIT_CENTIMETER ));
+      DIP_STACK_TRACE_THIS( WriteTIFFTiles( levels[ ii ], tiff, tileSize ));
+      WriteTIFFMetadata( levels[ ii ], tiff );
    }
 }
 
 } // namespace dip
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include <cstdio>
+
 #include "doctest.h"
 #include "diplib/testing.h"
 
@@ -459,6 +606,65 @@ DOCTEST_TEST_CASE( "[DIPlib] testing TIFF file reading and writing" ) {
    DOCTEST_CHECK( dip::testing::CompareImages( image3D, result ));
 }
 
+DOCTEST_TEST_CASE( "[DIPlib] testing pyramidal TIFF file reading and writing" ) {
+   dip::Image image = dip::ImageReadTIFF( DIP_EXAMPLES_DIR "/fractal1.tiff" );
+   image.SetPixelSize( dip::PhysicalQuantityArray{ 6 * dip::Units::Micrometer(), 300 * dip::Units::Nanometer() } );
+   image.SwapDimensions( 0, 1 ); // non-standard strides, and image sizes not a multiple of the tile size
+   dip::Image level1 = dip::Resampling( image, { 0.5 }, { -0.5 }, dip::S::LINEAR );
+   dip::Image level2 = dip::Resampling( level1, { 0.5 }, { -0.5 }, dip::S::LINEAR );
+   dip::PixelSize pixelSize = image.PixelSize();
+   pixelSize.Scale( 2.0 );
+   level1.SetPixelSize( pixelSize );
+
+   for( auto const& layout : dip::StringArray{ "subifd", "pages" } ) {
+      dip::ImageWriteTIFFPyramid( image, "test_pyramid.tif", 0, layout, "deflate", 80, 64 );
+      auto info = dip::ImageReadTIFFPyramidInfo( "test_pyramid.tif" );
+      DOCTEST_REQUIRE( info.size() > 2 );
+      DOCTEST_CHECK( info[ 0 ].sizes == image.Sizes() );
+      DOCTEST_CHECK( info[ 1 ].sizes == level1.Sizes() );
+      DOCTEST_CHECK( info.back().sizes.maximum_value() <= 64 );
+      DOCTEST_CHECK( dip::ImageReadTIFFInfo( "test_pyramid.tif" ).numberOfImages == ( layout == "subifd" ? 1 : info.size() ));
+
+      dip::Image result = dip::ImageReadTIFFPyramidLevel( "test_pyramid.tif", 0 );
+      DOCTEST_CHECK( dip::testing::CompareImages( image, result, dip::Option::CompareImagesMode::EXACT ));
+      DOCTEST_CHECK( image.PixelSize( 0 ).ApproximatelyEquals( result.PixelSize( 0 )));
+      DOCTEST_CHECK( image.PixelSize( 1 ).ApproximatelyEquals( result.PixelSize( 1 )));
+      result = dip::ImageReadTIFFPyramidLevel( "test_pyramid.tif", 1 );
+      DOCTEST_CHECK( dip::testing::CompareImages( level1, result, dip::Option::CompareImagesMode::EXACT ));
+      DOCTEST_CHECK( level1.PixelSize( 0 ).ApproximatelyEquals( result.PixelSize( 0 )));
+      DOCTEST_CHECK( level1.PixelSize( 1 ).ApproximatelyEquals( result.PixelSize( 1 )));
+      result = dip::ImageReadTIFFPyramidLevel( "test_pyramid.tif", 2, { dip::Range{ 10, 80 }, dip::Range{ 50, 5, 3 } } );
+      DOCTEST_CHECK( dip::testing::CompareImages( level2.At( dip::Range{ 10, 80 }, dip::Range{ 50, 5, 3 } ), result, dip::Option::CompareImagesMode::EXACT ));
+      DOCTEST_CHECK_THROWS( dip::ImageReadTIFFPyramidLevel( result, "test_pyramid.tif", info.size() ));
+   }
+
+   // A fixed number of levels, binary image
+   dip::Image binary = image > 100;
+   dip::ImageWriteTIFFPyramid( binary, "test_pyramid.tif", 2, "subifd", "deflate", 80, 32 );
+   auto info = dip::ImageReadTIFFPyramidInfo( "test_pyramid.tif" );
+   DOCTEST_REQUIRE( info.size() == 2 );
+   dip::Image result = dip::ImageReadTIFFPyramidLevel( "test_pyramid.tif", 0 );
+   DOCTEST_CHECK( dip::testing::CompareImages( binary, result, dip::Option::CompareImagesMode::EXACT ));
+   result = dip::ImageReadTIFFPyramidLevel( "test_pyramid.tif", 1 );
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::Resampling( binary, { 0.5 }, { -0.5 } ), result, dip::Option::CompareImagesMode::EXACT ));
+
+   // A color image with 16-bit samples
+   dip::Image color( image.Sizes(), 3, dip::DT_UINT16 );
+   color[ 0 ] = image;
+   color[ 1 ] = 1000;
+   color[ 2 ] = image * 100;
+   color.SetColorSpace( "sRGB" );
+   dip::ImageWriteTIFFPyramid( color, "test_pyramid.tif", 3, "pages", "LZW", 80, 48 );
+   result = dip::ImageReadTIFFPyramidLevel( "test_pyramid.tif", 2, { dip::Range{ 5, 60 } } );
+   DOCTEST_CHECK( result.ColorSpace() == "sRGB" );
+   level2 = dip::Resampling( dip::Resampling( color, { 0.5 }, { -0.5 }, dip::S::LINEAR ), { 0.5 }, { -0.5 }, dip::S::LINEAR );
+   DOCTEST_CHECK( dip::testing::CompareImages( level2.At( dip::Range{ 5, 60 }, dip::Range{ 5, 60 } ), result, dip::Option::CompareImagesMode::EXACT ));
+
+   // A regular TIFF file has a single level
+   DOCTEST_CHECK( dip::ImageReadTIFFPyramidInfo( DIP_EXAMPLES_DIR "/fractal1.tiff" ).size() == 1 );
+   std::remove( "test_pyramid.tif" );
+}
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST
 
 #else // DIP_CONFIG_HAS_TIFF
@@ -479,6 +685,18 @@ void ImageWriteTIFF(
    DIP_THROW( NOT_AVAILABLE );
 }
 
+void ImageWriteTIFFPyramid(
+      Image const& /*image*/,
+      String const& /*filename*/,
+      dip::uint /*nLevels*/,
+      String const& /*layout*/,
+      String const& /*compression*/,
+      dip::uint /*jpegLevel*/,
+      dip::uint /*tileSize*/
+) {
+   DIP_THROW( NOT_AVAILABLE );
+}
+
 }
 
 #endif // DIP_CONFIG_HAS_TIFF
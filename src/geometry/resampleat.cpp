@@ -19,7 +19,10 @@
 #include "diplib/geometry.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -27,7 +30,9 @@
 #include "diplib/framework.h"
 #include "diplib/generation.h"
 #include "diplib/generic_iterators.h"
+#include "diplib/iterators.h"
 #include "diplib/math.h"
+#include "diplib/multithreading.h"
 #include "diplib/overload.h"
 
 namespace dip {
@@ -258,6 +263,8 @@ void ResampleAt(
    for( auto cIt = coordinates.begin(); cIt != coordinates.end(); ++cIt, ++outIt ) {
       if( in.IsInside( *cIt )) {
          function( in, *outIt, *cIt );
+      } else if( fill.IsScalar() ) {
+         *outIt = fill[ 0 ]; // Call overload that copies a sample to each pixel element
       } else {
          *outIt = fill;
       }
@@ -462,6 +469,382 @@ void ResampleAt(
 }
 
 
+namespace {
+
+constexpr uint32 invalidOffset = std::numeric_limits< uint32 >::max();
+constexpr dfloat fractionScale = 32768.0; // The fractional coordinates are stored as 15-bit fixed-point values
+constexpr uint16 fractionHalf = 16384;
+
+// Shared data for the `PreparedWarp::Apply` line filters. Offsets are in units of `pixelStride`, `strides` are the
+// input image strides, except that they're 0 for singleton dimensions (so that neighbors are never outside the image).
+// `inSizes` are the sizes of the input image before it was extended for cubic interpolation.
+template< typename TPI >
+class PreparedWarpLineFilterBase : public Framework::ScanLineFilter {
+   public:
+      PreparedWarpLineFilterBase(
+            Image const& in, UnsignedArray const& inSizes, UnsignedArray const& outSizes,
+            std::vector< uint32 > const& offsets, std::vector< uint16 > const& fractions,
+            Image::Pixel const& fill
+      ) : in_( in ), offsets_( offsets ), fractions_( fractions ) {
+         dip::uint nDims = in.Dimensionality();
+         strides_ = in.Strides();
+         for( dip::uint dd = 0; dd < nDims; ++dd ) {
+            if( inSizes[ dd ] == 1 ) {
+               strides_[ dd ] = 0;
+            }
+         }
+         outIndexStrides_.resize( outSizes.size() );
+         dip::uint stride = 1;
+         for( dip::uint dd = 0; dd < outSizes.size(); ++dd ) {
+            outIndexStrides_[ dd ] = stride;
+            stride *= outSizes[ dd ];
+         }
+         // Code below similar to the one in ResampleAtLineFilter
+         fill_.resize( in.TensorElements(), fill[ 0 ].As< TPI >() );
+         if( !fill.IsScalar() ) {
+            for( dip::uint ii = 1; ii < in.TensorElements(); ++ii ) {
+               fill_[ ii ] = fill[ ii ].As< TPI >();
+            }
+         }
+      }
+
+   protected:
+      Image const& in_;
+      std::vector< uint32 > const& offsets_;
+      std::vector< uint16 > const& fractions_;
+      IntegerArray strides_;
+      UnsignedArray outIndexStrides_;
+      std::vector< TPI > fill_;
+
+      // Returns the index into `offsets_` of the first pixel of the line, and the step to the next pixel
+      std::pair< dip::uint, dip::uint > LineIndex( Framework::ScanLineFilterParameters const& params ) const {
+         dip::uint index = 0;
+         for( dip::uint dd = 0; dd < outIndexStrides_.size(); ++dd ) {
+            index += params.position[ dd ] * outIndexStrides_[ dd ];
+         }
+         return { index, outIndexStrides_[ params.dimension ] };
+      }
+
+      void Fill( TPI* out, dip::sint tensorStride ) const {
+         for( dip::uint tt = 0; tt < fill_.size(); ++tt, out += tensorStride ) {
+            *out = fill_[ tt ];
+         }
+      }
+};
+
+// Line filter for `PreparedWarp::Apply` with nearest neighbor interpolation. If `fractions` is not empty, the offsets
+// point at the base pixel for linear interpolation, and the nearest pixel is found from the fractional coordinates.
+template< typename TPI >
+class PreparedWarpNearestLineFilter : public PreparedWarpLineFilterBase< TPI > {
+   public:
+      using PreparedWarpLineFilterBase< TPI >::PreparedWarpLineFilterBase;
+
+      dip::uint GetNumberOfOperations( dip::uint /**/, dip::uint /**/, dip::uint nTensorElements ) override {
+         return 2 * this->in_.Dimensionality() + nTensorElements + 2;
+      }
+
+      void Filter( Framework::ScanLineFilterParameters const& params ) override {
+         dip::uint nDims = this->in_.Dimensionality();
+         dip::uint nElements = this->in_.TensorElements();
+         dip::sint pixelStride = this->in_.Stride( 0 );
+         dip::sint inTensorStride = this->in_.TensorStride();
+         bool useFractions = !this->fractions_.empty();
+         auto& outBuffer = params.outBuffer[ 0 ];
+         TPI const* inPtr = static_cast< TPI const* >( this->in_.Origin() );
+         TPI* outPtr = static_cast< TPI* >( outBuffer.buffer );
+         dip::uint index{};
+         dip::uint step{};
+         std::tie( index, step ) = this->LineIndex( params );
+         for( dip::uint ii = 0; ii < params.bufferLength; ++ii, index += step, outPtr += outBuffer.stride ) {
+            uint32 offset = this->offsets_[ index ];
+            if( offset == invalidOffset ) {
+               this->Fill( outPtr, outBuffer.tensorStride );
+               continue;
+            }
+            TPI const* src = inPtr + static_cast< dip::sint >( offset ) * pixelStride;
+            if( useFractions ) {
+               uint16 const* fractions = this->fractions_.data() + index * nDims;
+               for( dip::uint dd = 0; dd < nDims; ++dd ) {
+                  if( fractions[ dd ] > fractionHalf ) {
+                     src += this->strides_[ dd ];
+                  }
+               }
+            }
+            TPI* optr = outPtr;
+            for( dip::uint tt = 0; tt < nElements; ++tt, optr += outBuffer.tensorStride, src += inTensorStride ) {
+               *optr = *src;
+            }
+         }
+      }
+};
+
+// Line filter for `PreparedWarp::Apply` with linear (`N` is 2) or third-order cubic spline (`N` is 4) interpolation.
+// The weights for each of the N^n neighbors are computed from the fractional coordinates as the product of the
+// 1D weights along each dimension, and then applied to each of the tensor elements.
+template< typename TPI, dip::uint N >
+class PreparedWarpLineFilter : public PreparedWarpLineFilterBase< TPI > {
+   public:
+      using TPF = FlexType< TPI >;     // The type in which we compute
+      using TPW = FloatType< TPI >;    // The type of the weights
+
+      PreparedWarpLineFilter(
+            Image const& in, UnsignedArray const& inSizes, UnsignedArray const& outSizes,
+            std::vector< uint32 > const& offsets, std::vector< uint16 > const& fractions,
+            Image::Pixel const& fill
+      ) : PreparedWarpLineFilterBase< TPI >( in, inSizes, outSizes, offsets, fractions, fill ) {
+         dip::uint nDims = in.Dimensionality();
+         dip::uint nNeighbors = 1;
+         for( dip::uint dd = 0; dd < nDims; ++dd ) {
+            nNeighbors *= N;
+         }
+         // Neighbor offsets, with the first dimension changing fastest (as the weights computed in `Filter`)
+         neighbors_.resize( nNeighbors, 0 );
+         dip::sint first = N == 4 ? -1 : 0;
+         dip::uint n = 1;
+         for( dip::uint dd = 0; dd < nDims; ++dd ) {
+            for( dip::uint kk = N; kk > 0; ) {
+               --kk;
+               for( dip::uint ii = 0; ii < n; ++ii ) {
+                  neighbors_[ kk * n + ii ] = neighbors_[ ii ] + ( first + static_cast< dip::sint >( kk )) * this->strides_[ dd ];
+               }
+            }
+            n *= N;
+         }
+      }
+
+      void SetNumberOfThreads( dip::uint threads ) override {
+         buffers_.resize( threads );
+      }
+
+      dip::uint GetNumberOfOperations( dip::uint /**/, dip::uint /**/, dip::uint nTensorElements ) override {
+         return neighbors_.size() * ( nTensorElements + 1 ) * 2 + 10 * this->in_.Dimensionality();
+      }
+
+      void Filter( Framework::ScanLineFilterParameters const& params ) override {
+         dip::uint nDims = this->in_.Dimensionality();
+         dip::uint nElements = this->in_.TensorElements();
+         dip::uint nNeighbors = neighbors_.size();
+         dip::sint pixelStride = this->in_.Stride( 0 );
+         dip::sint inTensorStride = this->in_.TensorStride();
+         auto& outBuffer = params.outBuffer[ 0 ];
+         std::vector< TPW >& buffer = buffers_[ params.thread ];
+         buffer.resize( nNeighbors );
+         TPW* weights = buffer.data();
+         dip::sint const* neighbors = neighbors_.data();
+         uint32 const* offsets = this->offsets_.data();
+         uint16 const* fractions = this->fractions_.data();
+         TPI const* inPtr = static_cast< TPI const* >( this->in_.Origin() );
+         TPI* outPtr = static_cast< TPI* >( outBuffer.buffer );
+         constexpr TPW scale = static_cast< TPW >( 1.0 / fractionScale );
+         dip::uint index{};
+         dip::uint step{};
+         std::tie( index, step ) = this->LineIndex( params );
+         for( dip::uint ii = 0; ii < params.bufferLength; ++ii, index += step, outPtr += outBuffer.stride ) {
+            uint32 offset = offsets[ index ];
+            if( offset == invalidOffset ) {
+               this->Fill( outPtr, outBuffer.tensorStride );
+               continue;
+            }
+            // Compute the weights for all neighbors
+            uint16 const* fraction = fractions + index * nDims;
+            weights[ 0 ] = 1;
+            dip::uint n = 1;
+            for( dip::uint dd = 0; dd < nDims; ++dd ) {
+               TPW pos = static_cast< TPW >( fraction[ dd ] ) * scale;
+               TPW weights1D[ N ];
+               if( N == 2 ) {
+                  weights1D[ 0 ] = 1 - pos;
+                  weights1D[ 1 ] = pos;
+               } else {
+                  // Same as in ThirdOrderCubicSpline1D (indices written in terms of N to avoid warnings when N is 2)
+                  TPW pos2 = pos * pos;
+                  TPW pos3 = pos2 * pos;
+                  weights1D[ 0 ] = ( -pos3 + 2 * pos2 - pos ) / 2;
+                  weights1D[ 1 ] = ( 3 * pos3 - 5 * pos2 + 2 ) / 2;
+                  weights1D[ N - 2 ] = ( -3 * pos3 + 4 * pos2 + pos ) / 2;
+                  weights1D[ N - 1 ] = ( pos3 - pos2 ) / 2;
+               }
+               for( dip::uint kk = N - 1; kk > 0; --kk ) {
+                  for( dip::uint jj = 0; jj < n; ++jj ) {
+                     weights[ kk * n + jj ] = weights[ jj ] * weights1D[ kk ];
+                  }
+               }
+               for( dip::uint jj = 0; jj < n; ++jj ) {
+                  weights[ jj ] *= weights1D[ 0 ];
+               }
+               n *= N;
+            }
+            // Apply the weights to each tensor element
+            TPI const* src = inPtr + static_cast< dip::sint >( offset ) * pixelStride;
+            TPI* optr = outPtr;
+            for( dip::uint tt = 0; tt < nElements; ++tt, optr += outBuffer.tensorStride, src += inTensorStride ) {
+               TPF value = 0;
+               for( dip::uint jj = 0; jj < nNeighbors; ++jj ) {
+                  value += weights[ jj ] * static_cast< TPF >( src[ neighbors[ jj ]] );
+               }
+               *optr = clamp_cast< TPI >( value );
+            }
+         }
+      }
+
+   private:
+      std::vector< dip::sint > neighbors_;
+      std::vector< std::vector< TPW >> buffers_; // one for each thread
+};
+
+template< typename TPI >
+std::unique_ptr< Framework::ScanLineFilter > NewPreparedWarpNearestLineFilter(
+      Image const& in, UnsignedArray const& inSizes, UnsignedArray const& outSizes,
+      std::vector< uint32 > const& offsets, std::vector< uint16 > const& fractions,
+      Image::Pixel const& fill
+) {
+   return static_cast< std::unique_ptr< Framework::ScanLineFilter >>( new PreparedWarpNearestLineFilter< TPI >( in, inSizes, outSizes, offsets, fractions, fill ));
+}
+
+template< typename TPI >
+std::unique_ptr< Framework::ScanLineFilter > NewPreparedWarpLineFilter(
+      Image const& in, UnsignedArray const& inSizes, UnsignedArray const& outSizes,
+      std::vector< uint32 > const& offsets, std::vector< uint16 > const& fractions,
+      Image::Pixel const& fill, bool cubic
+) {
+   if( cubic ) {
+      return static_cast< std::unique_ptr< Framework::ScanLineFilter >>( new PreparedWarpLineFilter< TPI, 4 >( in, inSizes, outSizes, offsets, fractions, fill ));
+   }
+   return static_cast< std::unique_ptr< Framework::ScanLineFilter >>( new PreparedWarpLineFilter< TPI, 2 >( in, inSizes, outSizes, offsets, fractions, fill ));
+}
+
+} // namespace
+
+PreparedWarp::PreparedWarp(
+      Image const& map,
+      UnsignedArray inSizes,
+      String const& interpolationMethod
+) {
+   DIP_THROW_IF( !map.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF( !map.DataType().IsReal(), E::DATA_TYPE_NOT_SUPPORTED );
+   dip::uint nDims = inSizes.size();
+   DIP_THROW_IF( nDims == 0, E::DIMENSIONALITY_NOT_SUPPORTED );
+   DIP_THROW_IF( map.TensorElements() != nDims, E::NTENSORELEM_DONT_MATCH );
+   DIP_THROW_IF( inSizes.product() == 0, E::INVALID_PARAMETER );
+   switch( ParseMethod( interpolationMethod )) {
+      case dip::Method::NEAREST_NEIGHBOR:
+         method_ = Method::NEAREST_NEIGHBOR;
+         break;
+      case dip::Method::LINEAR:
+         method_ = Method::LINEAR;
+         break;
+      case dip::Method::CUBIC_ORDER_3:
+         method_ = Method::CUBIC_ORDER_3;
+         break;
+   }
+   bool nearest = method_ == Method::NEAREST_NEIGHBOR;
+
+   // Offsets are computed for normal strides, for an input image with a 1-pixel border for cubic interpolation
+   dip::uint border = method_ == Method::CUBIC_ORDER_3 ? 1 : 0;
+   UnsignedArray strides( nDims );
+   dip::uint nInPixels = 1;
+   for( dip::uint dd = 0; dd < nDims; ++dd ) {
+      strides[ dd ] = nInPixels;
+      nInPixels *= inSizes[ dd ] + 2 * border;
+   }
+   DIP_THROW_IF( nInPixels >= invalidOffset, E::SIZE_EXCEEDS_LIMIT );
+   FloatArray limit( nDims );
+   for( dip::uint dd = 0; dd < nDims; ++dd ) {
+      limit[ dd ] = static_cast< dfloat >( inSizes[ dd ] ) - 1;
+   }
+
+   Image coords = map;
+   if( coords.DataType() != DT_DFLOAT ) {
+      coords = Convert( map, DT_DFLOAT );
+   }
+   dip::uint nOutPixels = coords.NumberOfPixels();
+   offsets_.resize( nOutPixels );
+   if( !nearest ) {
+      fractions_.resize( nOutPixels * nDims );
+   }
+   uint32* offset = offsets_.data();
+   uint16* fraction = fractions_.data();
+   ImageIterator< dfloat > it( coords );
+   do {
+      dip::uint index = 0;
+      bool valid = true;
+      for( dip::uint dd = 0; dd < nDims; ++dd ) {
+         dfloat pos = it[ dd ];
+         dip::uint coord{};
+         if(( pos >= 0 ) && ( pos < limit[ dd ] )) {
+            coord = static_cast< dip::uint >( pos );
+            pos -= static_cast< dfloat >( coord );
+         } else if( pos == limit[ dd ] ) {
+            // The last pixel is interpolated between the second-to-last and last pixel
+            coord = inSizes[ dd ] == 1 ? 0 : inSizes[ dd ] - 2;
+            pos = inSizes[ dd ] == 1 ? 0.0 : 1.0;
+         } else {
+            valid = false;
+            break;
+         }
+         if( nearest ) {
+            coord += pos > 0.5 ? 1 : 0;
+         } else {
+            fraction[ dd ] = static_cast< uint16 >( std::round( pos * fractionScale ));
+         }
+         index += ( coord + border ) * strides[ dd ];
+      }
+      *offset = valid ? static_cast< uint32 >( index ) : invalidOffset;
+      ++offset;
+      if( !nearest ) {
+         fraction += nDims;
+      }
+   } while( ++it );
+
+   inSizes_ = std::move( inSizes );
+   outSizes_ = coords.Sizes();
+}
+
+void PreparedWarp::Apply( Image const& c_in, Image& out, Image::Pixel const& fill ) const {
+   DIP_THROW_IF( !IsPrepared(), "The warp has not been prepared" );
+   DIP_THROW_IF( !c_in.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF( c_in.Sizes() != inSizes_, E::SIZES_DONT_MATCH );
+   DIP_THROW_IF( !fill.IsScalar() && ( c_in.TensorElements() != fill.TensorElements() ), E::NTENSORELEM_DONT_MATCH );
+   DataType dt = c_in.DataType();
+   dip::uint nDims = inSizes_.size();
+
+   // Get the input image with strides compatible with the prepared offsets
+   Image in;
+   if( method_ == Method::CUBIC_ORDER_3 ) {
+      DIP_STACK_TRACE_THIS( ExtendImage( c_in, in, { 1 }, { BoundaryCondition::ZERO_ORDER_EXTRAPOLATE } ));
+   } else {
+      in = c_in.QuickCopy();
+   }
+   dip::sint stride = in.Stride( 0 );
+   bool compatible = stride > 0;
+   for( dip::uint dd = 0; compatible && ( dd < nDims ); ++dd ) {
+      compatible = in.Stride( dd ) == stride;
+      stride *= static_cast< dip::sint >( in.Size( dd ));
+   }
+   if( !compatible ) {
+      in.ForceNormalStrides();
+   }
+
+   // Create output
+   if( out.Aliases( in )) {
+      out.Strip();
+   }
+   out.ReForge( outSizes_, in.TensorElements(), dt, Option::AcceptDataTypeChange::DO_ALLOW );
+   out.ReshapeTensor( c_in.Tensor() );
+   out.SetColorSpace( c_in.ColorSpace() );
+
+   std::unique_ptr< Framework::ScanLineFilter > scanLineFilter;
+   if(( method_ == Method::NEAREST_NEIGHBOR ) || ( dt == DT_BIN )) {
+      DIP_OVL_CALL_ASSIGN_ALL( scanLineFilter, NewPreparedWarpNearestLineFilter, (
+            in, inSizes_, outSizes_, offsets_, fractions_, fill ), dt );
+   } else {
+      DIP_OVL_CALL_ASSIGN_NONBINARY( scanLineFilter, NewPreparedWarpLineFilter, (
+            in, inSizes_, outSizes_, offsets_, fractions_, fill, method_ == Method::CUBIC_ORDER_3 ), dt );
+   }
+   DIP_STACK_TRACE_THIS( Framework::ScanSingleOutput( out, dt, *scanLineFilter, Framework::ScanOption::NeedCoordinates ));
+}
+
+
 namespace {
 
 // Computes p := R * p + T, where T is an nxn matrix in column-major order, and p and T are an n vector, with n in {2,3}.
@@ -479,6 +862,151 @@ FloatArray ApplyTransformation( FloatArray const& R, FloatArray const& p, FloatA
    return out;
 }
 
+// Line filter for `AffineTransform` and `WarpControlPoints`. `mapping_` computes the input image coordinates for
+// each pixel along an output image line, `interpolate_` samples the input image at those coordinates.
+// Pixels that map outside of the input image are set to 0.
+template< typename TPI, typename Interpolator, typename Mapping >
+class WarpLineFilter : public Framework::ScanLineFilter {
+   public:
+      WarpLineFilter( Image const& in, Interpolator interpolate, Mapping const& mapping, dip::uint cost )
+            : in_( in ), interpolate_( std::move( interpolate )), mapping_( mapping ), cost_( cost ) {}
+
+      void SetNumberOfThreads( dip::uint threads ) override {
+         buffers_.resize( threads );
+      }
+
+      dip::uint GetNumberOfOperations( dip::uint /**/, dip::uint /**/, dip::uint nTensorElements ) override {
+         return cost_ * nTensorElements;
+      }
+
+      void Filter( Framework::ScanLineFilterParameters const& params ) override {
+         dip::uint nDims = in_.Dimensionality();
+         dip::uint nElements = in_.TensorElements();
+         dip::sint inTensorStride = in_.TensorStride();
+         dip::uint length = params.bufferLength;
+         auto& outBuffer = params.outBuffer[ 0 ];
+         std::vector< dfloat >& positions = buffers_[ params.thread ];
+         positions.resize( length * nDims );
+         mapping_( params.position, params.dimension, length, positions.data() );
+         UnsignedArray coords( nDims );
+         FloatArray subpos( nDims );
+         FloatArray limit( nDims );
+         for( dip::uint dd = 0; dd < nDims; ++dd ) {
+            limit[ dd ] = static_cast< dfloat >( in_.Size( dd )) - 1;
+         }
+         TPI* inPtr = static_cast< TPI* >( in_.Origin() );
+         TPI* outPtr = static_cast< TPI* >( outBuffer.buffer );
+         dfloat const* pos = positions.data();
+         for( dip::uint ii = 0; ii < length; ++ii, pos += nDims, outPtr += outBuffer.stride ) {
+            bool valid = true;
+            for( dip::uint dd = 0; dd < nDims; ++dd ) {
+               if(( pos[ dd ] >= 0 ) && ( pos[ dd ] < limit[ dd ] )) {
+                  coords[ dd ] = static_cast< dip::uint >( pos[ dd ] );
+                  subpos[ dd ] = pos[ dd ] - static_cast< dfloat >( coords[ dd ] );
+               } else if( pos[ dd ] == limit[ dd ] ) {
+                  // The last pixel is interpolated between the second-to-last and last pixel
+                  coords[ dd ] = static_cast< dip::uint >( limit[ dd ] ) - 1;
+                  subpos[ dd ] = 1.0;
+               } else {
+                  valid = false;
+                  break;
+               }
+            }
+            TPI* optr = outPtr;
+            if( valid ) {
+               TPI* iptr = inPtr;
+               for( dip::uint tt = 0; tt < nElements; ++tt, optr += outBuffer.tensorStride, iptr += inTensorStride ) {
+                  *optr = clamp_cast< TPI >( interpolate_( iptr, coords, subpos ));
+               }
+            } else {
+               for( dip::uint tt = 0; tt < nElements; ++tt, optr += outBuffer.tensorStride ) {
+                  *optr = TPI( 0 );
+               }
+            }
+         }
+      }
+
+   private:
+      Image const& in_;
+      Interpolator interpolate_;
+      Mapping const& mapping_;
+      dip::uint cost_;
+      std::vector< std::vector< dfloat >> buffers_; // one for each thread
+};
+
+template< typename TPI, typename Interpolator, typename Mapping >
+std::unique_ptr< Framework::ScanLineFilter > NewWarpLineFilter( Image const& in, Interpolator interpolate, Mapping const& mapping, dip::uint cost ) {
+   return static_cast< std::unique_ptr< Framework::ScanLineFilter >>( new WarpLineFilter< TPI, Interpolator, Mapping >( in, std::move( interpolate ), mapping, cost ));
+}
+
+// Fills `out` by sampling `in` at the coordinates given by `mapping`. `out` must be forged, and have the same
+// number of tensor elements as `in`. `mappingCost` is the approximate number of clock cycles needed to compute
+// the coordinates for one pixel.
+//
+// `mapping` is called for each output image line, with the coordinates of the first pixel of the line, the dimension
+// along which the line runs, and the line length. It writes the input coordinates for each pixel on the line into
+// an array of `length * nDims` values.
+template< typename Mapping >
+void Warp( Image const& in, Image& out, Method method, Mapping const& mapping, dip::uint mappingCost ) {
+   DataType dt = in.DataType();
+   dip::uint nDims = in.Dimensionality();
+   auto m = dt == DT_BIN ? Method::NEAREST_NEIGHBOR : method;
+   IntegerArray strides = in.Strides();
+   UnsignedArray sizes = in.Sizes();
+   std::unique_ptr< Framework::ScanLineFilter > lineFilter;
+   switch( m ) {
+      case Method::NEAREST_NEIGHBOR:
+         DIP_OVL_CALL_ASSIGN_ALL( lineFilter, NewWarpLineFilter, (
+            in,
+            [ strides, nDims ]( auto* src, UnsignedArray const& coords, FloatArray const& subpos ) {
+               return NearestNeighborND( src, strides, coords, subpos, nDims );
+            },
+            mapping, mappingCost + 10 ), dt );
+         break;
+      default:
+      //case Method::LINEAR:
+         DIP_OVL_CALL_ASSIGN_NONBINARY( lineFilter, NewWarpLineFilter, (
+            in,
+            [ strides, nDims ]( auto* src, UnsignedArray const& coords, FloatArray const& subpos ) {
+               return LinearND( src, strides, coords, subpos, nDims );
+            },
+            mapping, mappingCost + ( 10u << nDims )), dt );
+         break;
+      case Method::CUBIC_ORDER_3:
+         DIP_OVL_CALL_ASSIGN_NONBINARY( lineFilter, NewWarpLineFilter, (
+            in,
+            [ strides, sizes, nDims ]( auto* src, UnsignedArray const& coords, FloatArray const& subpos ) {
+               return ThirdOrderCubicSplineND( src, sizes, strides, coords, subpos, nDims );
+            },
+            mapping, mappingCost + ( 10u << ( 2 * nDims ))), dt );
+         break;
+   }
+   DIP_STACK_TRACE_THIS( Framework::ScanSingleOutput( out, dt, *lineFilter, Framework::ScanOption::NeedCoordinates ));
+}
+
+// Computes the input coordinates for `AffineTransform`: `matrix * coord + translation`. The coordinates along an
+// image line are computed by stepping along the column of `matrix` that corresponds to the line's dimension.
+class AffineMapping {
+   public:
+      AffineMapping( FloatArray matrix, FloatArray translation )
+            : matrix_( std::move( matrix )), translation_( std::move( translation )) {}
+
+      void operator()( UnsignedArray const& position, dip::uint dimension, dip::uint length, dfloat* out ) const {
+         dip::uint nDims = translation_.size();
+         FloatArray start = ApplyTransformation( matrix_, FloatArray( position ), translation_ );
+         for( dip::uint jj = 0; jj < nDims; ++jj ) {
+            dfloat step = matrix_[ jj + dimension * nDims ];
+            for( dip::uint ii = 0; ii < length; ++ii ) {
+               out[ ii * nDims + jj ] = start[ jj ] + static_cast< dfloat >( ii ) * step;
+            }
+         }
+      }
+
+   private:
+      FloatArray matrix_;
+      FloatArray translation_;
+};
+
 } // namespace
 
 void AffineTransform(
@@ -493,8 +1021,8 @@ void AffineTransform(
    DIP_THROW_IF(( matrix.size() != nDims * nDims ) && ( matrix.size() != nDims * ( nDims + 1 )), E::ARRAY_PARAMETER_WRONG_LENGTH );
 
    // Find interpolator
-   InterpolationFunctionPointer function{};
-   DIP_STACK_TRACE_THIS( function = GetInterpFunctionPtr( method, c_in.DataType() ));
+   Method interpolationMethod{};
+   DIP_STACK_TRACE_THIS( interpolationMethod = ParseMethod( method ));
 
    // Preserve input
    Image in = c_in;
@@ -504,7 +1032,6 @@ void AffineTransform(
       out.Strip();
    }
    out.ReForge( in, Option::AcceptDataTypeChange::DO_ALLOW );
-   out.Fill( 0 );
 
    // For forward transformation: forward_transform * coord + translation
    // For inverse transformation: inverse_transform * ( coord - translation )
@@ -531,17 +1058,8 @@ void AffineTransform(
    }
 
    // Iterate over out and interpolate in in
-   // TODO: This would be better if parallelized.
-   GenericImageIterator<> it( out );
-   do {
-      FloatArray coord( it.Coordinates() );
-      coord = ApplyTransformation( transform, coord, translation );
-      if( in.IsInside( coord )) {
-         function( in, *it, coord );
-      } else {
-         *it = 0;
-      }
-   } while( ++it );
+   AffineMapping mapping( std::move( transform ), std::move( translation ));
+   DIP_STACK_TRACE_THIS( Warp( in, out, interpolationMethod, mapping, 2 * nDims ));
 }
 
 
@@ -570,8 +1088,8 @@ void WarpControlPoints(
    ThinPlateSpline thinPlateSpline( outCoordinates, inCoordinates, lambda );
 
    // Find interpolator
-   InterpolationFunctionPointer function{};
-   DIP_STACK_TRACE_THIS( function = GetInterpFunctionPtr( interpolationMethod, c_in.DataType() ));
+   Method method{};
+   DIP_STACK_TRACE_THIS( method = ParseMethod( interpolationMethod ));
 
    // Preserve input
    Image in = c_in;
@@ -581,20 +1099,283 @@ void WarpControlPoints(
       out.Strip();
    }
    out.ReForge( in, Option::AcceptDataTypeChange::DO_ALLOW );
-   out.Fill( 0 );
 
    // Iterate over out and interpolate in in
-   // TODO: This would be better if parallelized.
-   GenericImageIterator<> it( out );
-   do {
-      FloatArray coord( it.Coordinates() );
-      coord = thinPlateSpline.Evaluate( coord );
-      if( in.IsInside( coord )) {
-         function( in, *it, coord );
-      } else {
-         *it = 0;
+   auto mapping = [ &thinPlateSpline ]( UnsignedArray const& position, dip::uint dimension, dip::uint length, dfloat* out ) {
+      FloatArray pt( position );
+      dip::uint nDims = pt.size();
+      for( dip::uint ii = 0; ii < length; ++ii, out += nDims ) {
+         FloatArray coord = thinPlateSpline.Evaluate( pt );
+         std::copy( coord.begin(), coord.end(), out );
+         pt[ dimension ] += 1;
       }
-   } while( ++it );
+   };
+   DIP_STACK_TRACE_THIS( Warp( in, out, method, mapping, 10 * inCoordinates.size() ));
+}
+
+
+namespace {
+
+// Fills the coordinate map for `WarpControlPointsMap` one box at a time.
+class ThinPlateSplineMapFiller {
+   public:
+      ThinPlateSplineMapFiller( ThinPlateSpline& thinPlateSpline, Image& map, dfloat maximumError )
+            : thinPlateSpline_( thinPlateSpline ), maximumError_( maximumError ) {
+         data_ = static_cast< dfloat* >( map.Origin() );
+         strides_ = map.Strides();
+         tensorStride_ = map.TensorStride();
+      }
+
+      // Fills the pixels of the box from `lower` to `upper`. Along dimensions where `includeUpper` is false, the
+      // pixels at `upper` are not written, they belong to the neighboring box.
+      void Fill( UnsignedArray const& lower, UnsignedArray const& upper, BooleanArray const& includeUpper ) {
+         dip::uint nDims = lower.size();
+         if(( maximumError_ <= 0 ) || !IsWorthInterpolating( lower, upper, includeUpper )) {
+            FillExact( lower, upper, includeUpper );
+            return;
+         }
+         FloatArray lowerPoint( lower );
+         FloatArray upperPoint( upper );
+         if( thinPlateSpline_.InterpolationErrorBound( lowerPoint, upperPoint ) <= maximumError_ ) {
+            FillInterpolated( lower, upper, includeUpper, EvaluateCorners( lower, upper ));
+            return;
+         }
+         // Subdivide the box. The error bound is pessimistic, so we use the interpolation error measured at a few
+         // points to decide into how many pieces to split the box. The interpolation error is proportional to the
+         // square of the box size, we split the box into the number of pieces along each dimension that would
+         // bring the measured error below the tolerance, and into at least two pieces. Each piece is tested against
+         // the error bound again. If the pieces are too small for interpolation to be worthwhile, we evaluate the
+         // spline at each pixel of this box right away.
+         dfloat error = EstimateError( lower, upper, EvaluateCorners( lower, upper ));
+         dip::uint nPieces = std::max( static_cast< dip::uint >( std::ceil( std::sqrt( error / maximumError_ ))), dip::uint( 2 ));
+         UnsignedArray pieces( nDims );
+         UnsignedArray pieceUpper( nDims );
+         for( dip::uint ii = 0; ii < nDims; ++ii ) {
+            pieces[ ii ] = upper[ ii ] - lower[ ii ] > 1 ? std::min( nPieces, upper[ ii ] - lower[ ii ] ) : 1;
+            pieceUpper[ ii ] = lower[ ii ] + ( upper[ ii ] - lower[ ii ] ) / pieces[ ii ];
+         }
+         if( !IsWorthInterpolating( lower, pieceUpper, BooleanArray( nDims, false ))) {
+            FillExact( lower, upper, includeUpper );
+            return;
+         }
+         UnsignedArray piece( nDims, 0 );
+         UnsignedArray childLower( nDims );
+         UnsignedArray childUpper( nDims );
+         BooleanArray childIncludeUpper( nDims );
+         while( true ) {
+            for( dip::uint ii = 0; ii < nDims; ++ii ) {
+               dip::uint extent = upper[ ii ] - lower[ ii ];
+               childLower[ ii ] = lower[ ii ] + extent * piece[ ii ] / pieces[ ii ];
+               childUpper[ ii ] = lower[ ii ] + extent * ( piece[ ii ] + 1 ) / pieces[ ii ];
+               childIncludeUpper[ ii ] = ( piece[ ii ] == pieces[ ii ] - 1 ) && includeUpper[ ii ];
+            }
+            Fill( childLower, childUpper, childIncludeUpper );
+            dip::uint dd = 0;
+            for( ; dd < nDims; ++dd ) {
+               if( ++piece[ dd ] < pieces[ dd ] ) {
+                  break;
+               }
+               piece[ dd ] = 0;
+            }
+            if( dd == nDims ) {
+               break;
+            }
+         }
+      }
+
+   private:
+      ThinPlateSpline& thinPlateSpline_;
+      dfloat maximumError_;
+      dfloat* data_;
+      IntegerArray strides_;
+      dip::sint tensorStride_;
+
+      // Calls `function( position, pointer )` for each pixel in the box that is to be written
+      template< typename F >
+      void ForEachPixel( UnsignedArray const& lower, UnsignedArray const& upper, BooleanArray const& includeUpper, F function ) {
+         dip::uint nDims = lower.size();
+         UnsignedArray last( nDims );
+         for( dip::uint ii = 0; ii < nDims; ++ii ) {
+            last[ ii ] = includeUpper[ ii ] ? upper[ ii ] : upper[ ii ] - 1;
+         }
+         UnsignedArray position = lower;
+         while( true ) {
+            dfloat* ptr = data_;
+            for( dip::uint ii = 0; ii < nDims; ++ii ) {
+               ptr += static_cast< dip::sint >( position[ ii ] ) * strides_[ ii ];
+            }
+            function( position, ptr );
+            dip::uint dd = 0;
+            for( ; dd < nDims; ++dd ) {
+               if( position[ dd ] < last[ dd ] ) {
+                  ++position[ dd ];
+                  break;
+               }
+               position[ dd ] = lower[ dd ];
+            }
+            if( dd == nDims ) {
+               break;
+            }
+         }
+      }
+
+      void FillExact( UnsignedArray const& lower, UnsignedArray const& upper, BooleanArray const& includeUpper ) {
+         ForEachPixel( lower, upper, includeUpper, [ this ]( UnsignedArray const& position, dfloat* ptr ) {
+            FloatArray coords = thinPlateSpline_.Evaluate( FloatArray( position ));
+            for( dip::uint jj = 0; jj < coords.size(); ++jj, ptr += tensorStride_ ) {
+               *ptr = coords[ jj ];
+            }
+         } );
+      }
+
+      // Computing the error bound and evaluating the spline at the corners of the box costs about as much as
+      // evaluating it at `2^n + 1` pixels, and measuring the interpolation error when the box needs to be split
+      // costs another `2n + 1` evaluations. Interpolation is worthwhile only if the box has many more pixels.
+      static bool IsWorthInterpolating( UnsignedArray const& lower, UnsignedArray const& upper, BooleanArray const& includeUpper ) {
+         dip::uint nDims = lower.size();
+         dip::uint nPixels = 1;
+         for( dip::uint ii = 0; ii < nDims; ++ii ) {
+            nPixels *= upper[ ii ] - lower[ ii ] + ( includeUpper[ ii ] ? 1 : 0 );
+         }
+         constexpr dip::uint costFactor = 4;
+         return nPixels >= costFactor * (( 1u << nDims ) + 2 * nDims + 1 );
+      }
+
+      // Evaluates the spline at the corners of the box. Corner `c` has the upper coordinate along dimension `ii`
+      // if bit `ii` of `c` is set.
+      std::vector< FloatArray > EvaluateCorners( UnsignedArray const& lower, UnsignedArray const& upper ) {
+         dip::uint nDims = lower.size();
+         dip::uint nCorners = 1u << nDims;
+         std::vector< FloatArray > corners( nCorners );
+         FloatArray point( nDims );
+         for( dip::uint corner = 0; corner < nCorners; ++corner ) {
+            for( dip::uint ii = 0; ii < nDims; ++ii ) {
+               point[ ii ] = static_cast< dfloat >( corner & ( 1u << ii ) ? upper[ ii ] : lower[ ii ] );
+            }
+            corners[ corner ] = thinPlateSpline_.Evaluate( point );
+         }
+         return corners;
+      }
+
+      // Multilinear interpolation between the corner values, `t` is the position within the box, in the range [0,1].
+      static dfloat Interpolate( std::vector< FloatArray > const& corners, FloatArray const& t, dip::uint jj ) {
+         dip::uint nDims = t.size();
+         dfloat value = 0;
+         for( dip::uint corner = 0; corner < corners.size(); ++corner ) {
+            dfloat weight = 1;
+            for( dip::uint ii = 0; ii < nDims; ++ii ) {
+               weight *= corner & ( 1u << ii ) ? t[ ii ] : 1.0 - t[ ii ];
+            }
+            value += weight * corners[ corner ][ jj ];
+         }
+         return value;
+      }
+
+      // Measures the interpolation error within the box by comparing the interpolated value to the spline at the
+      // center of the box and at the centers of its faces. The error of multilinear interpolation is largest in
+      // these points if the second derivatives of the function are constant within the box. This is not a bound
+      // to the error, it is used only to decide how to subdivide a box.
+      dfloat EstimateError( UnsignedArray const& lower, UnsignedArray const& upper, std::vector< FloatArray > const& corners ) {
+         dip::uint nDims = lower.size();
+         FloatArray t( nDims );
+         FloatArray point( nDims );
+         dfloat maxError2 = 0;
+         for( dip::uint face = 0; face <= 2 * nDims; ++face ) {
+            t.fill( 0.5 );
+            if( face < 2 * nDims ) { // `face == 2 * nDims` is the center of the box
+               t[ face / 2 ] = static_cast< dfloat >( face % 2 );
+            }
+            for( dip::uint ii = 0; ii < nDims; ++ii ) {
+               point[ ii ] = static_cast< dfloat >( lower[ ii ] ) + t[ ii ] * static_cast< dfloat >( upper[ ii ] - lower[ ii ] );
+            }
+            FloatArray value = thinPlateSpline_.Evaluate( point );
+            dfloat error2 = 0;
+            for( dip::uint jj = 0; jj < nDims; ++jj ) {
+               dfloat error = value[ jj ] - Interpolate( corners, t, jj );
+               error2 += error * error;
+            }
+            maxError2 = std::max( maxError2, error2 );
+         }
+         return std::sqrt( maxError2 );
+      }
+
+      void FillInterpolated( UnsignedArray const& lower, UnsignedArray const& upper, BooleanArray const& includeUpper, std::vector< FloatArray > const& corners ) {
+         dip::uint nDims = lower.size();
+         FloatArray t( nDims );
+         ForEachPixel( lower, upper, includeUpper, [ & ]( UnsignedArray const& position, dfloat* ptr ) {
+            for( dip::uint ii = 0; ii < nDims; ++ii ) {
+               t[ ii ] = upper[ ii ] > lower[ ii ]
+                         ? static_cast< dfloat >( position[ ii ] - lower[ ii ] ) / static_cast< dfloat >( upper[ ii ] - lower[ ii ] )
+                         : 0.0;
+            }
+            for( dip::uint jj = 0; jj < nDims; ++jj, ptr += tensorStride_ ) {
+               *ptr = Interpolate( corners, t, jj );
+            }
+         } );
+      }
+};
+
+} // namespace
+
+void WarpControlPointsMap(
+      UnsignedArray const& sizes,
+      Image& map,
+      FloatCoordinateArray const& inCoordinates,
+      FloatCoordinateArray const& outCoordinates,
+      dfloat lambda,
+      dfloat maximumError
+) {
+   dip::uint nDims = sizes.size();
+   DIP_THROW_IF( nDims == 0, E::DIMENSIONALITY_NOT_SUPPORTED );
+   DIP_THROW_IF( inCoordinates.empty(), E::ARRAY_PARAMETER_EMPTY );
+   DIP_THROW_IF( outCoordinates.size() != inCoordinates.size(), E::ARRAY_PARAMETER_WRONG_LENGTH );
+   for( auto& c : inCoordinates ) {
+      DIP_THROW_IF( c.size() != nDims, E::ARRAY_PARAMETER_WRONG_LENGTH );
+   }
+   for( auto& c : outCoordinates ) {
+      DIP_THROW_IF( c.size() != nDims, E::ARRAY_PARAMETER_WRONG_LENGTH );
+   }
+   DIP_THROW_IF( lambda < 0, E::PARAMETER_OUT_OF_RANGE );
+   DIP_THROW_IF( maximumError < 0, E::PARAMETER_OUT_OF_RANGE );
+
+   // Build thin plate spline function
+   ThinPlateSpline thinPlateSpline( outCoordinates, inCoordinates, lambda );
+
+   // Create output
+   DIP_STACK_TRACE_THIS( map.ReForge( sizes, nDims, DT_DFLOAT ));
+
+   // Divide the image into boxes, which are filled independently
+   constexpr dip::uint boxSize = 32;
+   UnsignedArray nBoxes( nDims );
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      nBoxes[ ii ] = std::max( div_ceil( sizes[ ii ] - 1, boxSize ), dip::uint( 1 ));
+   }
+   dip::sint nTasks = static_cast< dip::sint >( nBoxes.product() );
+   dip::uint operations = map.NumberOfPixels() * inCoordinates.size() * 10;
+   if( maximumError > 0 ) {
+      operations /= boxSize;
+   }
+   dip::uint nThreads = operations < threadingThreshold ? 1 : GetNumberOfThreads();
+   ThinPlateSplineMapFiller filler( thinPlateSpline, map, maximumError );
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      UnsignedArray lower( nDims );
+      UnsignedArray upper( nDims );
+      BooleanArray includeUpper( nDims );
+      #pragma omp for schedule( dynamic, 1 )
+      for( dip::sint task = 0; task < nTasks; ++task ) {
+         dip::uint index = static_cast< dip::uint >( task );
+         for( dip::uint ii = 0; ii < nDims; ++ii ) {
+            dip::uint box = index % nBoxes[ ii ];
+            index /= nBoxes[ ii ];
+            lower[ ii ] = box * boxSize;
+            upper[ ii ] = std::min( lower[ ii ] + boxSize, sizes[ ii ] - 1 );
+            includeUpper[ ii ] = upper[ ii ] == sizes[ ii ] - 1;
+         }
+         filler.Fill( lower, upper, includeUpper );
+      }
+   DIP_PARALLEL_ERROR_END
 }
 
 
@@ -686,3 +1467,157 @@ void LogPolarTransform2D(
 }
 
 } // namespace dip
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/random.h"
+#include "diplib/statistics.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE("[DIPlib] testing dip::AffineTransform and dip::WarpControlPoints") {
+   dip::Random random( 0 );
+   dip::Image in( { 64, 49 }, 2, dip::DT_DFLOAT );
+   in.Fill( 0 );
+   dip::UniformNoise( in, in, random, 0.0, 100.0 );
+
+   // An integer translation shifts the image
+   dip::Image out = dip::AffineTransform( in, { 1, 0, 0, 1, 3, -2 }, "nn" );
+   DOCTEST_CHECK( dip::testing::CompareImages( out.At( dip::Range{ 3, -1 }, dip::Range{ 0, -3 } ),
+                                               in.At( dip::Range{ 0, -4 }, dip::Range{ 2, -1 } )));
+   DOCTEST_CHECK( dip::MaximumAbs( out.At( dip::Range{ 0, 2 }, dip::Range{} )).As< dip::dfloat >() == 0 );
+
+   // A rotation gives the same result as sampling each pixel with dip::ResampleAt
+   dip::dfloat c = std::cos( 0.3 );
+   dip::dfloat s = std::sin( 0.3 );
+   dip::FloatArray matrix{ c, s, -s, c, 1.5, -2.25 };
+   dip::FloatArray center = in.GetCenter();
+   for( auto method : { "nn", "linear", "3-cubic" } ) {
+      out = dip::AffineTransform( in, matrix, method );
+      dip::FloatCoordinateArray coordinates;
+      for( dip::uint y = 0; y < in.Size( 1 ); ++y ) {
+         for( dip::uint x = 0; x < in.Size( 0 ); ++x ) {
+            // Inverse of the rotation, applied around the image center
+            dip::dfloat px = static_cast< dip::dfloat >( x ) - center[ 0 ] - matrix[ 4 ];
+            dip::dfloat py = static_cast< dip::dfloat >( y ) - center[ 1 ] - matrix[ 5 ];
+            coordinates.push_back( { c * px + s * py + center[ 0 ], -s * px + c * py + center[ 1 ] } );
+         }
+      }
+      dip::Image expected = dip::ResampleAt( in, coordinates, method );
+      expected.ReshapeTensor( in.Tensor() );
+      dip::Image flat = out.QuickCopy();
+      flat.Flatten();
+      DOCTEST_CHECK( dip::testing::CompareImages( flat, expected, 1e-9 ));
+   }
+
+   // A thin plate spline through control points related by a translation is the same translation
+   dip::FloatCoordinateArray inCoordinates{ { 10, 10 }, { 50, 12 }, { 30, 40 }, { 5, 35 }, { 60, 45 } };
+   dip::FloatCoordinateArray outCoordinates = inCoordinates;
+   for( auto& p : outCoordinates ) {
+      p[ 0 ] -= 1.5;
+      p[ 1 ] += 0.25;
+   }
+   out = dip::WarpControlPoints( in, inCoordinates, outCoordinates, 0.0, "linear" );
+   dip::Image expected = dip::AffineTransform( in, { 1, 0, 0, 1, -1.5, 0.25 }, "linear" );
+   DOCTEST_CHECK( dip::testing::CompareImages( out, expected, 1e-8 ));
+
+   // The coordinate map gives the same result as dip::WarpControlPoints
+   for( auto& p : outCoordinates ) {
+      p[ 0 ] += static_cast< dip::dfloat >( random() % 5 ) - 2.0;
+      p[ 1 ] += static_cast< dip::dfloat >( random() % 5 ) - 2.0;
+   }
+   dip::Image map = dip::WarpControlPointsMap( in.Sizes(), inCoordinates, outCoordinates );
+   DOCTEST_REQUIRE( map.DataType() == dip::DT_DFLOAT );
+   DOCTEST_REQUIRE( map.TensorElements() == 2 );
+   out = dip::WarpControlPoints( in, inCoordinates, outCoordinates, 0.0, "3-cubic" );
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::ResampleAt( in, map, "3-cubic" ), out, 1e-12 ));
+   // The approximated map is within the requested error bound
+   for( dip::dfloat maximumError : { 0.1, 0.001 } ) {
+      dip::Image approximate = dip::WarpControlPointsMap( in.Sizes(), inCoordinates, outCoordinates, 0.0, maximumError );
+      DOCTEST_CHECK( dip::Maximum( dip::Norm( approximate - map )).As< dip::dfloat >() <= maximumError );
+   }
+   // The error bound holds for boxes that do not contain a control point
+   dip::ThinPlateSpline thinPlateSpline( outCoordinates, inCoordinates );
+   for( dip::dfloat size : { 16.0, 8.0, 4.0 } ) {
+      for( dip::FloatArray lower : { dip::FloatArray{ 12, 14 }, dip::FloatArray{ 33, 15.5 }} ) {
+         dip::FloatArray upper{ lower[ 0 ] + size, lower[ 1 ] + size };
+         dip::dfloat bound = thinPlateSpline.InterpolationErrorBound( lower, upper );
+         DOCTEST_REQUIRE( std::isfinite( bound ));
+         dip::FloatArray c00 = thinPlateSpline.Evaluate( lower );
+         dip::FloatArray c10 = thinPlateSpline.Evaluate( { upper[ 0 ], lower[ 1 ] } );
+         dip::FloatArray c01 = thinPlateSpline.Evaluate( { lower[ 0 ], upper[ 1 ] } );
+         dip::FloatArray c11 = thinPlateSpline.Evaluate( upper );
+         dip::dfloat maxError = 0;
+         for( dip::uint ii = 0; ii <= 16; ++ii ) {
+            for( dip::uint jj = 0; jj <= 16; ++jj ) {
+               dip::dfloat s = static_cast< dip::dfloat >( ii ) / 16;
+               dip::dfloat t = static_cast< dip::dfloat >( jj ) / 16;
+               dip::FloatArray value = thinPlateSpline.Evaluate( { lower[ 0 ] + s * size, lower[ 1 ] + t * size } );
+               dip::dfloat error2 = 0;
+               for( dip::uint kk = 0; kk < 2; ++kk ) {
+                  dip::dfloat error = value[ kk ] - (( 1 - s ) * ( 1 - t ) * c00[ kk ] + s * ( 1 - t ) * c10[ kk ]
+                                                   + ( 1 - s ) * t * c01[ kk ] + s * t * c11[ kk ] );
+                  error2 += error * error;
+               }
+               maxError = std::max( maxError, std::sqrt( error2 ));
+            }
+         }
+         DOCTEST_CHECK( maxError <= bound );
+      }
+   }
+}
+
+DOCTEST_TEST_CASE("[DIPlib] testing dip::PreparedWarp") {
+   dip::Random random( 0 );
+   dip::Image in( { 40, 31 }, 2, dip::DT_SFLOAT );
+   in.Fill( 0 );
+   dip::UniformNoise( in, in, random, 0.0, 100.0 );
+   // The map includes coordinates outside the image, and on its last pixel
+   dip::Image map( { 23, 17 }, 2, dip::DT_DFLOAT );
+   map.Fill( 0 );
+   dip::UniformNoise( map, map, random, -2.0, 42.0 );
+   map.At( 0, 0 ) = { 39.0, 30.0 };
+   map.At( 1, 0 ) = { 39.0, 3.5 };
+   dip::Image::Pixel fill{ 5.0f, 6.0f };
+
+   for( auto method : { "nearest", "linear", "3-cubic" } ) {
+      dip::PreparedWarp warp( map, in.Sizes(), method );
+      DOCTEST_REQUIRE( warp.IsPrepared() );
+      DOCTEST_CHECK( warp.OutputSizes() == map.Sizes() );
+      // Differences are caused by the quantization of the fractional coordinates
+      dip::dfloat tolerance = method[ 0 ] == 'n' ? 0.0 : 0.01;
+      dip::Image expected = dip::ResampleAt( in, map, method, fill );
+      dip::Image out = warp.Apply( in, fill );
+      DOCTEST_CHECK( out.DataType() == dip::DT_SFLOAT );
+      DOCTEST_CHECK( dip::testing::CompareImages( out, expected, tolerance ));
+      // An input image with strides that don't match the prepared offsets
+      dip::Image mirrored = in.QuickCopy();
+      mirrored.Mirror( { true, false } );
+      DOCTEST_CHECK( dip::testing::CompareImages( warp.Apply( mirrored ), dip::ResampleAt( mirrored, map, method ), tolerance ));
+      // Integer and binary images
+      dip::Image in8 = dip::Convert( in, dip::DT_UINT8 );
+      DOCTEST_CHECK( dip::testing::CompareImages( warp.Apply( in8 ), dip::ResampleAt( in8, map, method ), 1.0 ));
+      dip::Image bin = in[ 0 ] > 50;
+      DOCTEST_CHECK( dip::testing::CompareImages( warp.Apply( bin ), dip::ResampleAt( bin, map, method )));
+   }
+   // A singleton input dimension with cubic interpolation. The input is extended by one pixel, but the neighbors
+   // along the singleton dimension must all be the central pixel. Any pixel read along the first dimension beyond
+   // the extended image would be the next line's pixel, the infinity here would then make the output NaN.
+   dip::Image line( { 1, 40 }, 1, dip::DT_SFLOAT );
+   line.Fill( 0 );
+   dip::UniformNoise( line, line, random, 0.0, 100.0 );
+   line.At( 0, 39 ) = std::numeric_limits< dip::sfloat >::infinity();
+   dip::Image lineMap( { 20 }, 2, dip::DT_DFLOAT );
+   for( dip::uint ii = 0; ii < 20; ++ii ) {
+      lineMap.At( ii ) = { 0.0, 36.0 + 0.05 * static_cast< dip::dfloat >( ii ) };
+   }
+   dip::Image lineOut = dip::PreparedWarp( lineMap, line.Sizes(), "3-cubic" ).Apply( line );
+   DOCTEST_CHECK( dip::All( dip::IsFinite( lineOut )).As< bool >() );
+   DOCTEST_CHECK( dip::testing::CompareImages( lineOut, dip::ResampleAt( line, lineMap, "3-cubic" ), 0.01 ));
+
+   dip::PreparedWarp warp( map, { 40, 30 } );
+   dip::Image out;
+   DOCTEST_CHECK_THROWS( warp.Apply( in, out ));
+   DOCTEST_CHECK_THROWS( dip::PreparedWarp().Apply( in, out ));
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -18,13 +18,17 @@
 #include "diplib/histogram.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "diplib.h"
 #include "diplib/framework.h"
+#include "diplib/generation.h"
 #include "diplib/linear.h"
 #include "diplib/measurement.h"
 #include "diplib/multithreading.h"
@@ -199,9 +203,34 @@ class HistogramBaseLineFilter : public Framework::ScanLineFilter {
          // We don't forge the images here, the Filter() function should do that so each thread allocates its own
          // data segment. This ensures there's no false sharing.
       }
+      // Adds the per-thread histograms to `image_`. Each thread adds up a range of bins, such that the cost of
+      // the reduction doesn't grow with the number of threads.
       void Reduce() {
+         if( !image_.IsForged() ) {
+            // This happens only if the input image has no pixels
+            image_.Forge();
+            image_.Fill( 0 );
+         }
+         std::vector< CountType const* > sources;
          for( auto const& img : imageArray_ ) {
-            image_ += img;
+            if( img.IsForged() ) { // Threads that didn't process any image lines don't have a histogram
+               sources.push_back( static_cast< CountType const* >( img.Origin() ));
+            }
+         }
+         if( sources.empty() ) {
+            return;
+         }
+         // Note: `image_` and the images in `imageArray_` all have normal strides.
+         CountType* dest = static_cast< CountType* >( image_.Origin() );
+         dip::uint nBins = image_.NumberOfPixels();
+         dip::uint nThreads = nBins * sources.size() > threadingThreshold ? GetNumberOfThreads() : 1;
+         #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( static )
+         for( dip::sint ii = 0; ii < static_cast< dip::sint >( nBins ); ++ii ) {
+            CountType sum = dest[ ii ];
+            for( auto src : sources ) {
+               sum += src[ ii ];
+            }
+            dest[ ii ] = sum;
          }
       }
    protected:
@@ -331,7 +360,7 @@ class JointImageHistogramLineFilter : public HistogramBaseLineFilter {
                   if( include ) {
                      dip::sint offset = 0;
                      for( dip::uint jj = 0; jj < nDims; ++jj ) {
-                        offset += image_.Stride( jj ) * configuration_[ jj ].FindBin( static_cast< dfloat >( *( in[ jj ] )));
+                        offset += image.Stride( jj ) * configuration_[ jj ].FindBin( static_cast< dfloat >( *( in[ jj ] )));
                      }
                      ++data[ offset ];
                   }
@@ -354,7 +383,7 @@ class JointImageHistogramLineFilter : public HistogramBaseLineFilter {
                if( include ) {
                   dip::sint offset = 0;
                   for( dip::uint jj = 0; jj < nDims; ++jj ) {
-                     offset += image_.Stride( jj ) * configuration_[ jj ].FindBin( static_cast< dfloat >( *( in[ jj ] )));
+                     offset += image.Stride( jj ) * configuration_[ jj ].FindBin( static_cast< dfloat >( *( in[ jj ] )));
                   }
                   ++data[ offset ];
                }
@@ -371,6 +400,313 @@ class JointImageHistogramLineFilter : public HistogramBaseLineFilter {
       bool tensorInput_;
 };
 
+// Returns the scan options for computing a histogram with `nBins` bins, where the scan line filter does
+// `parallelOperations` operations in total. Each thread fills its own copy of the histogram, which are added
+// together in parallel by `HistogramBaseLineFilter::Reduce()`, so each thread does about `3 * nBins` operations
+// extra (zeroing its histogram, and reading and adding its share of the bins of all copies).
+Framework::ScanOptions HistogramScanOptions( dip::uint parallelOperations, dip::uint nBins ) {
+   Framework::ScanOptions opts;
+   dip::uint nThreads = GetNumberOfThreads();
+   if( nThreads > 1 ) {
+      dip::uint extraOperations = 3 * nBins + 10000;
+      if( parallelOperations / nThreads + extraOperations + threadingThreshold > parallelOperations ) {
+         opts = Framework::ScanOption::NoMultiThreading; // Turn off multithreading if we'll do a lot of work to reduce.
+      }
+   }
+   return opts;
+}
+
+// The bins of a sparse histogram, see `Histogram::sparseData_`.
+using SparseBins = tsl::robin_map< dip::uint, Histogram::CountType, detail::SparseHistogramHash >;
+
+// Returns the strides of a histogram with `sizes` bins, used to compute the linear index of a bin in a sparse
+// histogram. The first dimension changes fastest, so the linear index equals the offset into a dense histogram
+// with normal strides.
+UnsignedArray SparseStrides( UnsignedArray const& sizes ) {
+   UnsignedArray strides( sizes.size() );
+   dip::uint stride = 1;
+   for( dip::uint ii = 0; ii < sizes.size(); ++ii ) {
+      strides[ ii ] = stride;
+      DIP_THROW_IF( stride > std::numeric_limits< dip::uint >::max() / sizes[ ii ], E::SIZE_EXCEEDS_LIMIT );
+      stride *= sizes[ ii ];
+   }
+   return strides;
+}
+
+} // namespace
+
+namespace detail {
+
+// Used to compute the values of a sparse cumulative histogram. The value of a bin in the cumulative histogram is the
+// sum of the counts of all bins with equal or smaller indices along each dimension.
+// If the dense histogram is not much larger than the sparse one, the index is a dense cumulative histogram. Otherwise
+// it is a k-d tree over the stored bins, each node stores the bounding box of its bins and the sum of their counts.
+// Nodes whose bounding box is entirely within the range of a query contribute their sum, nodes entirely outside of
+// it are skipped.
+class SparseCumulativeIndex {
+   public:
+      SparseCumulativeIndex( SparseBins const& bins, UnsignedArray const& sizes ) : nDims_( sizes.size() ) {
+         dip::uint nBins = bins.size();
+         dip::uint maxDenseSize = std::max( 4 * nBins, maxDenseSizeMinimum );
+         dip::uint denseSize = 1;
+         for( auto sz : sizes ) {
+            denseSize *= sz;
+            if( denseSize > maxDenseSize ) {
+               break;
+            }
+         }
+         if( denseSize <= maxDenseSize ) {
+            BuildDense( bins, sizes, denseSize );
+            return;
+         }
+         std::vector< dip::uint > coords( nBins * nDims_ );
+         std::vector< Histogram::CountType > counts( nBins );
+         dip::uint ii = 0;
+         for( auto const& bin : bins ) {
+            dip::uint key = bin.first;
+            for( dip::uint jj = 0; jj < nDims_; ++jj ) {
+               coords[ ii * nDims_ + jj ] = key % sizes[ jj ];
+               key /= sizes[ jj ];
+            }
+            counts[ ii ] = bin.second;
+            ++ii;
+         }
+         std::vector< dip::uint > order( nBins );
+         std::iota( order.begin(), order.end(), dip::uint( 0 ));
+         if( nBins > 0 ) {
+            Build( coords, counts, order, 0, nBins );
+         }
+         // Store the bins in the order of the tree leaves
+         coords_.resize( nBins * nDims_ );
+         counts_.resize( nBins );
+         for( ii = 0; ii < nBins; ++ii ) {
+            std::copy_n( coords.begin() + static_cast< dip::sint >( order[ ii ] * nDims_ ), nDims_, coords_.begin() + static_cast< dip::sint >( ii * nDims_ ));
+            counts_[ ii ] = counts[ order[ ii ]];
+         }
+      }
+
+      // Returns the value of the cumulative histogram at the bin with coordinates `coords`.
+      Histogram::CountType Value( dip::uint const* coords ) const {
+         if( !dense_.empty() ) {
+            dip::uint offset = 0;
+            for( dip::uint jj = 0; jj < nDims_; ++jj ) {
+               offset += coords[ jj ] * strides_[ jj ];
+            }
+            return dense_[ offset ];
+         }
+         Histogram::CountType sum = 0;
+         if( nodes_.empty() ) {
+            return sum;
+         }
+         std::array< dip::uint, 2 * maxDepth > stack; // The tree is balanced, its depth is at most log2 of the number of bins
+         dip::uint top = 0;
+         stack[ top++ ] = 0;
+         while( top > 0 ) {
+            Node const& node = nodes_[ stack[ --top ]];
+            dip::uint const* lower = &bounds_[ stack[ top ] * 2 * nDims_ ];
+            dip::uint const* upper = lower + nDims_;
+            bool outside = false;
+            bool inside = true;
+            for( dip::uint jj = 0; jj < nDims_; ++jj ) {
+               if( lower[ jj ] > coords[ jj ] ) {
+                  outside = true;
+                  break;
+               }
+               if( upper[ jj ] > coords[ jj ] ) {
+                  inside = false;
+               }
+            }
+            if( outside ) {
+               continue;
+            }
+            if( inside ) {
+               sum += node.sum;
+            } else if( node.left == 0 ) {
+               // A leaf node: test each of its bins
+               for( dip::uint ii = node.begin; ii < node.end; ++ii ) {
+                  dip::uint const* binCoords = &coords_[ ii * nDims_ ];
+                  bool include = true;
+                  for( dip::uint jj = 0; jj < nDims_; ++jj ) {
+                     if( binCoords[ jj ] > coords[ jj ] ) {
+                        include = false;
+                        break;
+                     }
+                  }
+                  if( include ) {
+                     sum += counts_[ ii ];
+                  }
+               }
+            } else {
+               stack[ top++ ] = node.left;
+               stack[ top++ ] = node.right;
+            }
+         }
+         return sum;
+      }
+
+   private:
+      static constexpr dip::uint leafSize = 16;
+      static constexpr dip::uint maxDepth = 64;
+      static constexpr dip::uint maxDenseSizeMinimum = 1u << 21u;
+
+      struct Node {
+         dip::uint begin;  // range of bins in `coords_` and `counts_`
+         dip::uint end;
+         dip::uint left;   // child nodes, 0 for a leaf node (the root is never a child)
+         dip::uint right;
+         Histogram::CountType sum;
+      };
+
+      dip::uint nDims_;
+      std::vector< dip::uint > coords_;            // `nDims_` coordinates for each bin
+      std::vector< Histogram::CountType > counts_; // the count for each bin
+      std::vector< Node > nodes_;
+      std::vector< dip::uint > bounds_;            // lower and upper bounds (`2 * nDims_` values) for each node
+      std::vector< Histogram::CountType > dense_;  // the dense cumulative histogram, if not empty the other members are not used
+      UnsignedArray strides_;                      // strides for `dense_`
+
+      // Fills `dense_` with the cumulative histogram.
+      void BuildDense( SparseBins const& bins, UnsignedArray const& sizes, dip::uint denseSize ) {
+         strides_ = SparseStrides( sizes );
+         dense_.resize( denseSize, 0 );
+         for( auto const& bin : bins ) {
+            dense_[ bin.first ] = bin.second;
+         }
+         // Cumulative sum along each dimension in turn
+         for( dip::uint jj = 0; jj < nDims_; ++jj ) {
+            dip::uint stride = strides_[ jj ];
+            dip::uint length = sizes[ jj ] * stride;
+            for( dip::uint offset = 0; offset < denseSize; offset += length ) {
+               for( dip::uint ii = offset + stride; ii < offset + length; ++ii ) {
+                  dense_[ ii ] += dense_[ ii - stride ];
+               }
+            }
+         }
+      }
+
+      // Builds the node for the bins `order[ begin ]` to `order[ end - 1 ]`, returns its index.
+      dip::uint Build(
+            std::vector< dip::uint > const& coords,
+            std::vector< Histogram::CountType > const& counts,
+            std::vector< dip::uint >& order,
+            dip::uint begin,
+            dip::uint end
+      ) {
+         dip::uint index = nodes_.size();
+         nodes_.push_back( { begin, end, 0, 0, 0 } );
+         bounds_.resize( bounds_.size() + 2 * nDims_ );
+         dip::uint* lower = &bounds_[ index * 2 * nDims_ ];
+         dip::uint* upper = lower + nDims_;
+         std::copy_n( &coords[ order[ begin ] * nDims_ ], nDims_, lower );
+         std::copy_n( &coords[ order[ begin ] * nDims_ ], nDims_, upper );
+         Histogram::CountType sum = 0;
+         for( dip::uint ii = begin; ii < end; ++ii ) {
+            dip::uint const* binCoords = &coords[ order[ ii ] * nDims_ ];
+            for( dip::uint jj = 0; jj < nDims_; ++jj ) {
+               lower[ jj ] = std::min( lower[ jj ], binCoords[ jj ] );
+               upper[ jj ] = std::max( upper[ jj ], binCoords[ jj ] );
+            }
+            sum += counts[ order[ ii ]];
+         }
+         nodes_[ index ].sum = sum;
+         if( end - begin > leafSize ) {
+            // Split along the dimension with the largest extent. Bins are unique, so this extent is at least 1.
+            dip::uint dim = 0;
+            for( dip::uint jj = 1; jj < nDims_; ++jj ) {
+               if( upper[ jj ] - lower[ jj ] > upper[ dim ] - lower[ dim ] ) {
+                  dim = jj;
+               }
+            }
+            dip::uint middle = begin + ( end - begin ) / 2;
+            std::nth_element( order.begin() + static_cast< dip::sint >( begin ),
+                              order.begin() + static_cast< dip::sint >( middle ),
+                              order.begin() + static_cast< dip::sint >( end ),
+                              [ & ]( dip::uint a, dip::uint b ) { return coords[ a * nDims_ + dim ] < coords[ b * nDims_ + dim ]; } );
+            // Note: `lower` and `upper` are invalidated by the recursive calls.
+            dip::uint left = Build( coords, counts, order, begin, middle );
+            dip::uint right = Build( coords, counts, order, middle, end );
+            nodes_[ index ].left = left;
+            nodes_[ index ].right = right;
+         }
+         return index;
+      }
+};
+
+} // namespace detail
+
+namespace {
+
+class SparseHistogramBaseLineFilter : public Framework::ScanLineFilter {
+   public:
+      SparseHistogramBaseLineFilter( SparseBins& bins ) : bins_( bins ) {}
+      void SetNumberOfThreads( dip::uint threads ) override {
+         binsArray_.resize( threads - 1 );
+      }
+      // Adds the per-thread bins to `bins_`. Unlike `HistogramBaseLineFilter::Reduce()`, this is done in a single
+      // thread, as all threads would be inserting into the same hash map.
+      void Reduce() {
+         for( auto const& threadBins : binsArray_ ) {
+            for( auto const& bin : threadBins ) {
+               bins_[ bin.first ] += bin.second;
+            }
+         }
+      }
+   protected:
+      SparseBins& bins_;
+      std::vector< SparseBins > binsArray_;
+};
+
+template< typename TPI >
+class SparseHistogramLineFilter : public SparseHistogramBaseLineFilter {
+   public:
+      dip::uint GetNumberOfOperations( dip::uint /**/, dip::uint /**/, dip::uint tensorElements ) override {
+         return tensorElements * 6 + 20;
+      }
+      void Filter( Framework::ScanLineFilterParameters const& params ) override {
+         TPI const* in = static_cast< TPI const* >( params.inBuffer[ 0 ].buffer );
+         dip::sint inStride = params.inBuffer[ 0 ].stride;
+         dip::uint nDims = params.inBuffer[ 0 ].tensorLength;
+         dip::sint tensorStride = params.inBuffer[ 0 ].tensorStride;
+         bin const* mask = nullptr;
+         dip::sint maskStride = 0;
+         if( params.inBuffer.size() > 1 ) {
+            // If there's two input buffers, we have a mask image.
+            mask = static_cast< bin const* >( params.inBuffer[ 1 ].buffer );
+            maskStride = params.inBuffer[ 1 ].stride;
+         }
+         dip::uint bufferLength = params.bufferLength;
+         SparseBins& bins = params.thread == 0 ? bins_ : binsArray_[ params.thread - 1 ];
+         for( dip::uint ii = 0; ii < bufferLength; ++ii, in += inStride ) {
+            if( mask ) {
+               bool skip = !*mask;
+               mask += maskStride;
+               if( skip ) {
+                  continue;
+               }
+            }
+            dip::uint index = 0;
+            bool include = true;
+            TPI const* in_t = in;
+            for( dip::uint jj = 0; jj < nDims; ++jj, in_t += tensorStride ) {
+               dfloat value = static_cast< dfloat >( *in_t );
+               if( configuration_[ jj ].IsOutOfRange( value )) {
+                  include = false;
+                  break;
+               }
+               index += strides_[ jj ] * static_cast< dip::uint >( configuration_[ jj ].FindBin( value ));
+            }
+            if( include ) {
+               ++bins[ index ];
+            }
+         }
+      }
+      SparseHistogramLineFilter( SparseBins& bins, Histogram::ConfigurationArray const& configuration, UnsignedArray const& strides ) :
+            SparseHistogramBaseLineFilter( bins ), configuration_( configuration ), strides_( strides ) {}
+   private:
+      Histogram::ConfigurationArray const& configuration_;
+      UnsignedArray const& strides_;
+};
+
 } // namespace
 
 void Histogram::ScalarImageHistogram( Image const& input, Image const& mask, Histogram::Configuration& configuration ) {
@@ -381,14 +717,7 @@ void Histogram::ScalarImageHistogram( Image const& input, Image const& mask, His
    data_.SetDataType( DT_COUNT );
    std::unique_ptr< HistogramBaseLineFilter >scanLineFilter;
    DIP_OVL_NEW_REAL( scanLineFilter, ScalarImageHistogramLineFilter, ( data_, configuration ), input.DataType() );
-   Framework::ScanOptions opts;
-   if( GetNumberOfThreads() > 1 ) {
-      dip::uint parallelOperations = input.NumberOfPixels() * 6;
-      dip::uint sequentialOperations = ( GetNumberOfThreads() - 1 ) * ( data_.NumberOfPixels() * 2 + 10000 );
-      if( parallelOperations / GetNumberOfThreads() + sequentialOperations + threadingThreshold > parallelOperations ) {
-         opts = Framework::ScanOption::NoMultiThreading; // Turn off multithreading if we'll do a lot of work to reduce.
-      }
-   }
+   Framework::ScanOptions opts = HistogramScanOptions( input.NumberOfPixels() * 6, data_.NumberOfPixels() );
    DIP_STACK_TRACE_THIS( Framework::ScanSingleInput( input, mask, input.DataType(), *scanLineFilter, opts ));
    scanLineFilter->Reduce();
 }
@@ -408,18 +737,33 @@ void Histogram::TensorImageHistogram( Image const& input, Image const& mask, His
    data_.SetDataType( DT_COUNT );
    std::unique_ptr< HistogramBaseLineFilter >scanLineFilter;
    DIP_OVL_NEW_REAL( scanLineFilter, JointImageHistogramLineFilter, ( data_, configuration, true ), input.DataType() );
-   Framework::ScanOptions opts;
-   if( GetNumberOfThreads() > 1 ) {
-      dip::uint parallelOperations = input.NumberOfPixels() * ndims * 6;
-      dip::uint sequentialOperations = ( GetNumberOfThreads() - 1 ) * ( data_.NumberOfPixels() * 2 + 10000 );
-      if( parallelOperations / GetNumberOfThreads() + sequentialOperations + threadingThreshold > parallelOperations ) {
-         opts = Framework::ScanOption::NoMultiThreading; // Turn off multithreading if we'll do a lot of work to reduce.
-      }
-   }
+   Framework::ScanOptions opts = HistogramScanOptions( input.NumberOfPixels() * ndims * 6, data_.NumberOfPixels() );
    DIP_STACK_TRACE_THIS( Framework::ScanSingleInput( input, mask, input.DataType(), *scanLineFilter, opts ));
    scanLineFilter->Reduce();
 }
 
+void Histogram::SparseImageHistogram( Image const& input, Image const& mask, Histogram::ConfigurationArray& configuration ) {
+   dip::uint ndims = input.TensorElements();
+   lowerBounds_.resize( ndims );
+   binSizes_.resize( ndims );
+   UnsignedArray sizes( ndims, 1 );
+   for( dip::uint ii = 0; ii < ndims; ++ii ) {
+      DIP_STACK_TRACE_THIS( configuration[ ii ].Complete( input[ static_cast< dip::sint >( ii ) ], mask ));
+      lowerBounds_[ ii ] = configuration[ ii ].lowerBound;
+      binSizes_[ ii ] = configuration[ ii ].binSize;
+      sizes[ ii ] = configuration[ ii ].nBins;
+   }
+   UnsignedArray strides;
+   DIP_STACK_TRACE_THIS( strides = SparseStrides( sizes ));
+   data_.SetSizes( std::move( sizes ));
+   data_.SetDataType( DT_COUNT );
+   sparseData_ = std::make_shared< SparseData >();
+   std::unique_ptr< SparseHistogramBaseLineFilter >scanLineFilter;
+   DIP_OVL_NEW_REAL( scanLineFilter, SparseHistogramLineFilter, ( *sparseData_, configuration, strides ), input.DataType() );
+   DIP_STACK_TRACE_THIS( Framework::ScanSingleInput( input, mask, input.DataType(), *scanLineFilter ));
+   scanLineFilter->Reduce();
+}
+
 void Histogram::JointImageHistogram( Image const& input1, Image const& input2, Image const& c_mask, Histogram::ConfigurationArray& configuration ) {
    DIP_START_STACK_TRACE
       configuration[ 0 ].Complete( input1, c_mask );
@@ -446,19 +790,12 @@ void Histogram::JointImageHistogram( Image const& input1, Image const& input2, I
       inBufT.push_back( mask.DataType() );
    }
    ImageRefArray outar{};
-   Framework::ScanOptions opts;
-   if( GetNumberOfThreads() > 1 ) {
-      dip::uint parallelOperations = input1.NumberOfPixels() * 2 * 6;
-      dip::uint sequentialOperations = ( GetNumberOfThreads() - 1 ) * ( data_.NumberOfPixels() * 2 + 10000 );
-      if( parallelOperations / GetNumberOfThreads() + sequentialOperations + threadingThreshold > parallelOperations ) {
-         opts = Framework::ScanOption::NoMultiThreading; // Turn off multithreading if we'll do a lot of work to reduce.
-      }
-   }
+   Framework::ScanOptions opts = HistogramScanOptions( input1.NumberOfPixels() * 2 * 6, data_.NumberOfPixels() );
    DIP_STACK_TRACE_THIS( Framework::Scan( inar, outar, inBufT, {}, {}, {}, *scanLineFilter, opts ));
    scanLineFilter->Reduce();
 }
 
-void Histogram::MeasurementFeatureHistogram( Measurement::IteratorFeature const& featureValues, Histogram::ConfigurationArray& configuration ) {
+void Histogram::MeasurementFeatureHistogram( Measurement::IteratorFeature const& featureValues, Histogram::ConfigurationArray& configuration, bool sparse ) {
    dip::uint ndims = featureValues.NumberOfValues();
    lowerBounds_.resize( ndims );
    binSizes_.resize( ndims );
@@ -473,6 +810,32 @@ void Histogram::MeasurementFeatureHistogram( Measurement::IteratorFeature const&
       binSizes_[ ii ] = configuration[ ii ].binSize;
       sizes[ ii ] = configuration[ ii ].nBins;
    }
+   if( sparse ) {
+      UnsignedArray strides;
+      DIP_STACK_TRACE_THIS( strides = SparseStrides( sizes ));
+      data_.SetSizes( std::move( sizes ));
+      data_.SetDataType( DT_COUNT );
+      sparseData_ = std::make_shared< SparseData >();
+      auto in = featureValues.FirstObject();
+      while( in ) {
+         auto tin = in.begin();
+         dip::uint index = 0;
+         bool include = true;
+         for( dip::uint jj = 0; jj < ndims; ++jj ) {
+            if( configuration[ jj ].IsOutOfRange( *tin )) {
+               include = false;
+               break;
+            }
+            index += strides[ jj ] * static_cast< dip::uint >( configuration[ jj ].FindBin( *tin ));
+            ++tin;
+         }
+         if( include ) {
+            ++( *sparseData_ )[ index ];
+         }
+         ++in;
+      }
+      return;
+   }
    data_.SetSizes( std::move( sizes ));
    data_.SetDataType( DT_COUNT );
    data_.Forge();
@@ -524,6 +887,72 @@ void Histogram::HistogramFromDataPointer( Histogram::CountType const* data, Hist
    DIP_ASSERT( data_.DataType() == DT_COUNT );
 }
 
+Histogram Histogram::Dense() const {
+   DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+   if( !IsSparse() ) {
+      return *this;
+   }
+   Histogram out;
+   out.lowerBounds_ = lowerBounds_;
+   out.binSizes_ = binSizes_;
+   DIP_STACK_TRACE_THIS( out.data_.ReForge( data_.Sizes(), 1, DT_COUNT ));
+   out.data_.Fill( 0 );
+   // Note: `out.data_` has normal strides, so the linear index of a bin is its offset.
+   CountType* data = static_cast< CountType* >( out.data_.Origin() );
+   for( auto const& bin : *sparseData_ ) {
+      data[ bin.first ] = bin.second;
+   }
+   if( cumulativeIndex_ ) {
+      out.Cumulative();
+   }
+   return out;
+}
+
+Histogram::CountType Histogram::SparseAt( UnsignedArray const& bin ) const {
+   // `bin` was tested by the caller.
+   dip::uint index = 0;
+   dip::uint stride = 1;
+   for( dip::uint ii = 0; ii < bin.size(); ++ii ) {
+      index += bin[ ii ] * stride;
+      stride *= data_.Size( ii );
+   }
+   if( cumulativeIndex_ ) {
+      return cumulativeIndex_->Value( bin.data() );
+   }
+   auto it = sparseData_->find( index );
+   return it == sparseData_->end() ? 0 : it->second;
+}
+
+void Histogram::SparseAdd( Histogram const& other, bool subtract ) {
+   DIP_THROW_IF( cumulativeIndex_ || other.cumulativeIndex_, "Not supported for a sparse cumulative histogram" );
+   SparseData& bins = *sparseData_;
+   if( sparseData_ == other.sparseData_ ) {
+      // Adding to or subtracting from itself, iterating over `other` while modifying `bins` is not possible.
+      if( subtract ) {
+         bins.clear();
+      } else {
+         for( auto it = bins.begin(); it != bins.end(); ++it ) {
+            it.value() *= 2;
+         }
+      }
+      return;
+   }
+   for( auto const& bin : *other.sparseData_ ) {
+      if( subtract ) {
+         auto it = bins.find( bin.first );
+         if( it != bins.end() ) {
+            if( it->second <= bin.second ) {
+               bins.erase( it );
+            } else {
+               it.value() -= bin.second;
+            }
+         }
+      } else {
+         bins[ bin.first ] += bin.second;
+      }
+   }
+}
+
 namespace {
 
 template< typename TPI >
@@ -571,6 +1000,67 @@ class ReverseLookupLineFilter : public Framework::ScanLineFilter {
       Histogram::ConfigurationArray const& configuration_;
 };
 
+template< typename TPI >
+class SparseReverseLookupLineFilter : public Framework::ScanLineFilter {
+   public:
+      dip::uint GetNumberOfOperations( dip::uint /**/, dip::uint /**/, dip::uint tensorElements ) override {
+         return tensorElements * 6 + ( cumulativeIndex_ ? 200 : 20 );
+      }
+      void SetNumberOfThreads( dip::uint threads ) override {
+         if( cumulativeIndex_ ) {
+            cache_.resize( threads );
+         }
+      }
+      void Filter( Framework::ScanLineFilterParameters const& params ) override {
+         TPI const* in = static_cast< TPI const* >( params.inBuffer[ 0 ].buffer );
+         dip::sint inStride = params.inBuffer[ 0 ].stride;
+         dip::uint nDims = params.inBuffer[ 0 ].tensorLength;
+         dip::sint tensorStride = params.inBuffer[ 0 ].tensorStride;
+         CountType* out = static_cast< CountType* >( params.outBuffer[ 0 ].buffer );
+         dip::sint outStride = params.outBuffer[ 0 ].stride;
+         dip::uint bufferLength = params.bufferLength;
+         UnsignedArray coords( nDims );
+         for( dip::uint ii = 0; ii < bufferLength; ++ii ) {
+            bool include = true;
+            dip::uint index = 0;
+            TPI const* in_t = in;
+            for( dip::uint jj = 0; jj < nDims; ++jj, in_t += tensorStride ) {
+               dfloat value = static_cast< dfloat >( *in_t );
+               if( configuration_[ jj ].IsOutOfRange( value )) {
+                  include = false;
+                  break;
+               }
+               coords[ jj ] = static_cast< dip::uint >( configuration_[ jj ].FindBin( value ));
+               index += strides_[ jj ] * coords[ jj ];
+            }
+            if( !include ) {
+               *out = 0;
+            } else if( cumulativeIndex_ ) {
+               // Querying the index is expensive, each bin is queried only once per thread.
+               SparseBins& cache = cache_[ params.thread ];
+               auto it = cache.find( index );
+               if( it == cache.end() ) {
+                  it = cache.emplace( index, cumulativeIndex_->Value( coords.data() )).first;
+               }
+               *out = it->second;
+            } else {
+               auto it = bins_.find( index );
+               *out = it == bins_.end() ? 0 : it->second;
+            }
+            in += inStride;
+            out += outStride;
+         }
+      }
+      SparseReverseLookupLineFilter( SparseBins const& bins, UnsignedArray const& sizes, detail::SparseCumulativeIndex const* cumulativeIndex, Histogram::ConfigurationArray const& configuration ) :
+            bins_( bins ), strides_( SparseStrides( sizes )), cumulativeIndex_( cumulativeIndex ), configuration_( configuration ) {}
+   private:
+      SparseBins const& bins_;
+      UnsignedArray strides_;
+      detail::SparseCumulativeIndex const* cumulativeIndex_; // Null if the histogram is not cumulative
+      std::vector< SparseBins > cache_;                      // Cumulative values already computed, one map per thread
+      Histogram::ConfigurationArray const& configuration_;
+};
+
 }
 
 void Histogram::ReverseLookup( Image const& input, Image& out, BooleanArray excludeOutOfBoundValues ) {
@@ -594,18 +1084,36 @@ void Histogram::ReverseLookup( Image const& input, Image& out, BooleanArray excl
 
    // Create and call ReverseLookupLineFilter
    std::unique_ptr< Framework::ScanLineFilter >scanLineFilter;
-   DIP_OVL_NEW_REAL( scanLineFilter, ReverseLookupLineFilter, ( data_, configuration ), input.DataType() );
+   if( IsSparse() ) {
+      DIP_OVL_NEW_REAL( scanLineFilter, SparseReverseLookupLineFilter, ( *sparseData_, data_.Sizes(), cumulativeIndex_.get(), configuration ), input.DataType() );
+   } else {
+      DIP_OVL_NEW_REAL( scanLineFilter, ReverseLookupLineFilter, ( data_, configuration ), input.DataType() );
+   }
    ImageRefArray outar{ out };
    DIP_STACK_TRACE_THIS( Framework::Scan( { input }, outar, { input.DataType() }, { DT_COUNT }, { DT_COUNT }, { 1 }, *scanLineFilter ));
 }
 
 dip::uint Histogram::Count() const {
    DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+   if( IsSparse() ) {
+      DIP_THROW_IF( cumulativeIndex_, "Not supported for a sparse cumulative histogram" );
+      dip::uint count = 0;
+      for( auto const& bin : *sparseData_ ) {
+         count += bin.second;
+      }
+      return count;
+   }
    return Sum( data_ ).As< dip::uint >();
 }
 
 Histogram& Histogram::Cumulative() {
    DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+   if( IsSparse() ) {
+      // The stored bins are not modified, the cumulative value of a bin is computed from the index when it's accessed.
+      DIP_THROW_IF( cumulativeIndex_, "Not supported for a sparse cumulative histogram" );
+      DIP_STACK_TRACE_THIS( cumulativeIndex_ = std::make_shared< detail::SparseCumulativeIndex const >( *sparseData_, data_.Sizes() ));
+      return *this;
+   }
    data_.Protect();
    CumulativeSum( data_, {}, data_ );
    data_.Protect( false );
@@ -616,6 +1124,19 @@ Histogram Histogram::GetMarginal( dip::uint dim ) const {
    DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
    DIP_THROW_IF( dim >= Dimensionality(), E::INVALID_PARAMETER );
    Histogram out{ Configuration( lowerBounds_[ dim ], data_.Size( dim ), binSizes_[ dim ] ) };
+   if( IsSparse() ) {
+      DIP_THROW_IF( cumulativeIndex_, "Not supported for a sparse cumulative histogram" );
+      dip::uint stride = 1;
+      for( dip::uint ii = 0; ii < dim; ++ii ) {
+         stride *= data_.Size( ii );
+      }
+      dip::uint size = data_.Size( dim );
+      CountType* data = static_cast< CountType* >( out.data_.Origin() ); // `out.data_` is 1D with a stride of 1.
+      for( auto const& bin : *sparseData_ ) {
+         data[ ( bin.first / stride ) % size ] += bin.second;
+      }
+      return out;
+   }
    BooleanArray ps( Dimensionality(), true );
    ps[ dim ] = false;
    out.data_.Strip();
@@ -626,8 +1147,71 @@ Histogram Histogram::GetMarginal( dip::uint dim ) const {
    return out;
 }
 
+namespace {
+
+// Smooths the sparse histogram `bins` of size `sizes`, yielding a new one of size `newSizes`, which is padded
+// symmetrically along each dimension to make space for the Gaussian tails. Each bin is spread over its neighbors
+// along one dimension at a time, in the same way that `GaussFIR()` with the "add zeros" boundary condition
+// computes the smoothing for a dense histogram.
+void SparseSmooth(
+      std::shared_ptr< SparseBins >& bins,
+      UnsignedArray const& sizes,
+      UnsignedArray const& newSizes,
+      FloatArray const& sigma,
+      dfloat truncation
+) {
+   dip::uint nDims = sizes.size();
+   UnsignedArray strides = SparseStrides( newSizes );
+   using FloatBins = tsl::robin_map< dip::uint, dfloat, detail::SparseHistogramHash >;
+   FloatBins values;
+   values.reserve( bins->size() );
+   for( auto const& bin : *bins ) {
+      dip::uint key = bin.first;
+      dip::uint index = 0;
+      for( dip::uint ii = 0; ii < nDims; ++ii ) {
+         dip::uint offset = ( newSizes[ ii ] - sizes[ ii ] ) / 2;
+         index += ( key % sizes[ ii ] + offset ) * strides[ ii ];
+         key /= sizes[ ii ];
+      }
+      values.emplace( index, static_cast< dfloat >( bin.second ));
+   }
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      if(( sigma[ ii ] <= 0.0 ) || ( newSizes[ ii ] <= 1 )) {
+         continue;
+      }
+      std::vector< dfloat > kernel = MakeGaussian( sigma[ ii ], 0, truncation, DT_DFLOAT );
+      dip::sint halfSize = static_cast< dip::sint >( kernel.size() / 2 );
+      dip::sint size = static_cast< dip::sint >( newSizes[ ii ] );
+      FloatBins newValues;
+      newValues.reserve( values.size() * kernel.size() );
+      for( auto const& value : values ) {
+         dip::sint coord = static_cast< dip::sint >(( value.first / strides[ ii ] ) % newSizes[ ii ] );
+         dip::uint base = value.first - static_cast< dip::uint >( coord ) * strides[ ii ];
+         dip::sint first = std::max( coord - halfSize, dip::sint( 0 ));
+         dip::sint last = std::min( coord + halfSize, size - 1 );
+         for( dip::sint jj = first; jj <= last; ++jj ) {
+            newValues[ base + static_cast< dip::uint >( jj ) * strides[ ii ]] +=
+                  value.second * kernel[ static_cast< dip::uint >( jj - coord + halfSize ) ];
+         }
+      }
+      values = std::move( newValues );
+   }
+   auto out = std::make_shared< SparseBins >();
+   out->reserve( values.size() );
+   for( auto const& value : values ) {
+      Histogram::CountType count = clamp_cast< Histogram::CountType >( std::round( value.second ));
+      if( count > 0 ) {
+         out->emplace( value.first, count );
+      }
+   }
+   bins = std::move( out );
+}
+
+} // namespace
+
 Histogram& Histogram::Smooth( FloatArray sigma ) {
    DIP_THROW_IF( !IsInitialized(), E::HISTOGRAM_NOT_INITIALIZED );
+   DIP_THROW_IF( cumulativeIndex_, "Not supported for a sparse cumulative histogram" );
    UnsignedArray sizes = data_.Sizes();
    dip::uint nDims = sizes.size();
    DIP_STACK_TRACE_THIS( ArrayUseParameter( sigma, nDims, 1.0 ));
@@ -637,6 +1221,11 @@ Histogram& Histogram::Smooth( FloatArray sigma ) {
       sizes[ ii ] += 2 * static_cast< dip::uint >( extension );
       lowerBounds_[ ii ] -= binSizes_[ ii ] * extension;
    }
+   if( IsSparse() ) {
+      DIP_STACK_TRACE_THIS( SparseSmooth( sparseData_, data_.Sizes(), sizes, sigma, truncation ));
+      data_.SetSizes( sizes );
+      return *this;
+   }
    data_ = data_.Pad( sizes );
    data_.Protect(); // so that GaussFIR() produces a DT_COUNT image.
    GaussFIR( data_, data_, sigma, { 0 }, { S::ADD_ZEROS }, truncation );
@@ -649,8 +1238,10 @@ Histogram& Histogram::Smooth( FloatArray sigma ) {
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
 #include "doctest.h"
+#include "diplib/geometry.h"
 #include "diplib/iterators.h"
 #include "diplib/random.h"
+#include "diplib/testing.h"
 
 DOCTEST_TEST_CASE( "[DIPlib] testing dip::Histogram" ) {
    dip::Image zero( {}, 1, dip::DT_SFLOAT );
@@ -813,4 +1404,112 @@ DOCTEST_TEST_CASE( "[DIPlib] testing dip::Histogram" ) {
    DOCTEST_CHECK_THROWS( histograms[ 2 ].Count() );
 }
 
+DOCTEST_TEST_CASE( "[DIPlib] testing sparse dip::Histogram" ) {
+   dip::Image img( { 64, 48 }, 3, dip::DT_UINT8 );
+   {
+      dip::Random random( 0 );
+      dip::GaussianRandomGenerator normDist( random );
+      dip::ImageIterator< dip::uint8 > it( img );
+      do {
+         it[ 0 ] = dip::clamp_cast< dip::uint8 >( normDist( 100.0, 30.0 ));
+         it[ 1 ] = dip::clamp_cast< dip::uint8 >( normDist( 150.0, 20.0 ));
+         it[ 2 ] = dip::clamp_cast< dip::uint8 >( normDist( 50.0, 10.0 ));
+      } while( ++it );
+   }
+   dip::Image mask = img[ 0 ] > 80;
+   dip::Histogram::ConfigurationArray settings( 3, dip::Histogram::Configuration( 0.0, 256.0, 32 ));
+   dip::Histogram dense( img, mask, settings );
+   dip::Histogram sparse( img, mask, settings, dip::Histogram::Storage::SPARSE );
+   DOCTEST_REQUIRE( sparse.IsSparse() );
+   DOCTEST_CHECK( !dense.IsSparse() );
+   DOCTEST_CHECK( sparse.Dimensionality() == 3 );
+   DOCTEST_CHECK( sparse.Bins( 2 ) == 32 );
+   DOCTEST_CHECK( sparse.StoredBins() < dense.StoredBins() );
+   DOCTEST_CHECK( sparse.Count() == dense.Count() );
+   DOCTEST_CHECK( sparse.At( 12, 18, 6 ) == dense.At( 12, 18, 6 ));
+   DOCTEST_CHECK( dip::testing::CompareImages( sparse.Dense().GetImage(), dense.GetImage() ));
+   DOCTEST_CHECK( dip::testing::CompareImages( sparse.GetMarginal( 1 ).GetImage(), dense.GetMarginal( 1 ).GetImage() ));
+   DOCTEST_CHECK( dip::testing::CompareImages( sparse.ReverseLookup( img ), dense.ReverseLookup( img )));
+   DOCTEST_CHECK_THROWS( sparse.GetImage() );
+   DOCTEST_CHECK_THROWS( dense += sparse );
+
+   dip::Histogram sum = sparse + sparse;
+   DOCTEST_CHECK( sum.Count() == 2 * sparse.Count() );
+   sum -= sparse;
+   DOCTEST_CHECK( dip::testing::CompareImages( sum.Dense().GetImage(), dense.GetImage() ));
+
+   dip::Histogram denseSmooth = dense.Copy().Smooth( 1.5 );
+   dip::Histogram sparseSmooth = sparse.Copy().Smooth( 1.5 );
+   DOCTEST_CHECK( sparseSmooth.IsSparse() );
+   DOCTEST_CHECK( sparseSmooth.LowerBound( 0 ) == denseSmooth.LowerBound( 0 ));
+   DOCTEST_CHECK( sparseSmooth.Bins( 0 ) == denseSmooth.Bins( 0 ));
+   DOCTEST_CHECK( dip::testing::CompareImages( sparseSmooth.Dense().GetImage(), denseSmooth.GetImage(), 1.0 ));
+
+   dip::Histogram denseCumulative = dense.Copy().Cumulative();
+   dip::Histogram sparseCumulative = sparse.Copy().Cumulative();
+   DOCTEST_CHECK( sparseCumulative.At( 12, 18, 6 ) == denseCumulative.At( 12, 18, 6 ));
+   DOCTEST_CHECK( sparseCumulative.At( 31, 31, 31 ) == dense.Count() );
+   DOCTEST_CHECK( dip::testing::CompareImages( sparseCumulative.Dense().GetImage(), denseCumulative.GetImage() ));
+   DOCTEST_CHECK( dip::testing::CompareImages( sparseCumulative.ReverseLookup( img ), denseCumulative.ReverseLookup( img )));
+   DOCTEST_CHECK_THROWS( sparseCumulative.Count() );
+   DOCTEST_CHECK_THROWS( sparseCumulative.Smooth() );
+
+   // A 5D histogram with 256 bins along each dimension has 2^40 bins, too many to store densely.
+   dip::Image img5( { 40, 30 }, 5, dip::DT_UINT8 );
+   {
+      dip::Random random( 0 );
+      dip::ImageIterator< dip::uint8 > it( img5 );
+      do {
+         for( dip::uint ii = 0; ii < 5; ++ii ) {
+            it[ ii ] = static_cast< dip::uint8 >( random() % 256 );
+         }
+      } while( ++it );
+   }
+   dip::Histogram sparse5( img5, {}, {}, dip::Histogram::Storage::SPARSE );
+   DOCTEST_CHECK( sparse5.Dimensionality() == 5 );
+   DOCTEST_CHECK( sparse5.Bins( 4 ) == 256 );
+   DOCTEST_CHECK( sparse5.Count() == img5.NumberOfPixels() );
+   DOCTEST_CHECK( sparse5.StoredBins() <= img5.NumberOfPixels() );
+   DOCTEST_CHECK( sparse5.GetMarginal( 3 ).Count() == img5.NumberOfPixels() );
+   DOCTEST_CHECK( dip::testing::CompareImages( sparse5.GetMarginal( 3 ).GetImage(), dip::Histogram( img5[ 3 ] ).GetImage() ));
+   DOCTEST_CHECK( dip::Count( sparse5.ReverseLookup( img5 ) == 0 ) == 0 );
+}
+
+#ifdef _OPENMP
+
+DOCTEST_TEST_CASE("[DIPlib] testing the Histogram class under multithreading") {
+   // A 16-bit image pair with a joint histogram of 256x256 bins, large enough to use multiple threads
+   dip::Image img1( { 256, 256 }, 1, dip::DT_UINT16 );
+   dip::Image img2( { 256, 256 }, 1, dip::DT_UINT16 );
+   {
+      dip::Random random( 0 );
+      dip::JointImageIterator< dip::uint16, dip::uint16 > it( { img1, img2 } );
+      do {
+         it.In() = static_cast< dip::uint16 >( random() % 65536 );
+         it.Out() = static_cast< dip::uint16 >(( it.In() + random() % 4096 ) % 65536 );
+      } while( ++it );
+   }
+   dip::Histogram::ConfigurationArray settings( 2, dip::Histogram::Configuration( 0.0, 65536.0, 256 ));
+
+   dip::uint maxThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 );
+   dip::Histogram joint1( img1, img2, {}, settings );
+   dip::Histogram tensor1( dip::JoinChannels( { img1, img2 } ), {}, settings );
+   dip::dfloat mutualInformation1 = dip::MutualInformation( joint1 );
+
+   dip::SetNumberOfThreads( 4 );
+   dip::Histogram joint2( img1, img2, {}, settings );
+   dip::Histogram tensor2( dip::JoinChannels( { img1, img2 } ), {}, settings );
+   dip::dfloat mutualInformation2 = dip::MutualInformation( joint2 );
+   dip::SetNumberOfThreads( maxThreads );
+
+   DOCTEST_CHECK( joint1.Count() == img1.NumberOfPixels() );
+   DOCTEST_CHECK( dip::testing::CompareImages( joint1.GetImage(), joint2.GetImage(), dip::Option::CompareImagesMode::EXACT ));
+   DOCTEST_CHECK( dip::testing::CompareImages( joint1.GetImage(), tensor1.GetImage(), dip::Option::CompareImagesMode::EXACT ));
+   DOCTEST_CHECK( dip::testing::CompareImages( tensor1.GetImage(), tensor2.GetImage(), dip::Option::CompareImagesMode::EXACT ));
+   DOCTEST_CHECK( mutualInformation1 == doctest::Approx( mutualInformation2 ).epsilon( 1e-12 ));
+}
+
+#endif // _OPENMP
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST
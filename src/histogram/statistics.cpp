@@ -16,9 +16,11 @@
  */
 
 #include <algorithm>
+#include <vector>
 #include "diplib/histogram.h"
 
 #include "diplib.h"
+#include "diplib/multithreading.h"
 
 namespace dip {
 
@@ -176,22 +178,30 @@ dfloat MutualInformation( Histogram const& hist ) {
    DIP_ASSERT( c2Img.Stride( 0 ) == 1 );
 
    dfloat norm = 1.0 / static_cast< dfloat >( hist.Count() );
-   dfloat out = 0.0;
-   Histogram::CountType const* hPtr = static_cast< Histogram::CountType const* >( histImg.Origin() );
-   Histogram::CountType const* c2Ptr = static_cast< Histogram::CountType const* >( c2Img.Origin() );
-   for( dip::uint jj = 0; jj < n2; jj++ ) {
-      Histogram::CountType const* c1Ptr = static_cast< Histogram::CountType const* >( c1Img.Origin() );
+   Histogram::CountType const* hOrigin = static_cast< Histogram::CountType const* >( histImg.Origin() );
+   Histogram::CountType const* c1Origin = static_cast< Histogram::CountType const* >( c1Img.Origin() );
+   Histogram::CountType const* c2Origin = static_cast< Histogram::CountType const* >( c2Img.Origin() );
+   // Each histogram row is summed independently, so that rows can be processed in parallel
+   std::vector< dfloat > rowSums( n2, 0.0 );
+   dip::uint nThreads = n1 * n2 * 4 > threadingThreshold ? GetNumberOfThreads() : 1;
+   #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( static )
+   for( dip::sint jj = 0; jj < static_cast< dip::sint >( n2 ); jj++ ) {
+      Histogram::CountType const* hPtr = hOrigin + static_cast< dip::uint >( jj ) * n1;
+      dfloat c2 = static_cast< dfloat >( c2Origin[ jj ] );
+      dfloat sum = 0.0;
       for( dip::uint ii = 0; ii < n1; ii++ ) {
-         if( *hPtr > 0 ) { // This means that c1 and c2 both have data here also
+         if( hPtr[ ii ] > 0 ) { // This means that c1 and c2 both have data here also
             // out += h * norm * log2( h * norm / ( c1 * norm * c2 * norm ) )
             // =>  out/norm += h * log2( h / ( c1 * c2 * norm ) )
-            out += static_cast< dfloat >( *hPtr ) *
-                   std::log2( static_cast< dfloat >( *hPtr ) / ( static_cast< dfloat >( *c1Ptr ) * static_cast< dfloat >( *c2Ptr ) * norm ));
+            sum += static_cast< dfloat >( hPtr[ ii ] ) *
+                   std::log2( static_cast< dfloat >( hPtr[ ii ] ) / ( static_cast< dfloat >( c1Origin[ ii ] ) * c2 * norm ));
          }
-         ++hPtr;
-         ++c1Ptr;
       }
-      ++c2Ptr;
+      rowSums[ static_cast< dip::uint >( jj ) ] = sum;
+   }
+   dfloat out = 0.0;
+   for( dfloat sum : rowSums ) {
+      out += sum;
    }
    return out * norm;
 }
@@ -26,6 +26,7 @@
 #include "diplib/generic_iterators.h"
 #include "diplib/kernel.h"
 #include "diplib/library/copy_buffer.h"
+#include "diplib/memory_pool.h"
 #include "diplib/multithreading.h"
 #include "diplib/pixel_table.h"
 
@@ -208,7 +209,7 @@ void Full(
       inBuffer.buffer = nullptr;
 
       // Create output buffer data struct and allocate buffer if necessary
-      AlignedBuffer outputBuffer;
+      PooledBuffer outputBuffer;
       FullBuffer outBuffer{};
       outBuffer.tensorLength = output.TensorElements();
       if( useOutBuffer ) {
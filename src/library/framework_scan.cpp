@@ -22,6 +22,7 @@
 
 #include "diplib.h"
 #include "diplib/library/copy_buffer.h"
+#include "diplib/memory_pool.h"
 #include "diplib/multithreading.h"
 
 #include "framework_support.h"
@@ -443,7 +444,7 @@ void Scan(
    #pragma omp parallel num_threads( static_cast< int >( nThreads ))
    DIP_PARALLEL_ERROR_START
       dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
-      std::vector< AlignedBuffer > buffers; // The outer one here is not a DimensionArray, because it won't delete() its contents
+      std::vector< PooledBuffer > buffers; // The outer one here is not a DimensionArray, because it won't delete() its contents
 
       // Create input buffer data structs and allocate buffers
       std::vector< ScanBuffer > inBuffers( nIn );  // We don't use DimensionArray here either, but we could
@@ -25,6 +25,7 @@
 #include "diplib/boundary.h"
 #include "diplib/generic_iterators.h"
 #include "diplib/library/copy_buffer.h"
+#include "diplib/memory_pool.h"
 #include "diplib/multithreading.h"
 
 #include "framework_support.h"
@@ -249,8 +250,8 @@ void Separable(
       dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
 
       // The temporary buffers, if needed, will be stored here (each thread their own!)
-      AlignedBuffer inBufferStorage;
-      AlignedBuffer outBufferStorage;
+      PooledBuffer inBufferStorage;
+      PooledBuffer outBufferStorage;
 
       // Iterate over the dimensions to be processed. This loop should not parallelized!
       for( dip::uint rep = 0; rep < order.size(); ++rep ) {
@@ -568,8 +569,8 @@ void OneDimensionalLineFilter(
       dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
 
       // The temporary buffers, if needed, will be stored here (each thread their own!)
-      AlignedBuffer inBufferStorage;
-      AlignedBuffer outBufferStorage;
+      PooledBuffer inBufferStorage;
+      PooledBuffer outBufferStorage;
 
       // Create buffer data structs and (re-)allocate buffers
       SeparableBuffer inBuffer{};
@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "diplib.h"
+#include "diplib/memory_pool.h"
 
 
 namespace dip {
@@ -727,11 +728,18 @@ void Image::Forge() {
             SetNormalStrides();
          }
          dip::uint sz = dataType_.SizeOf();
-         void* p = std::malloc( size * sz );
-         if( !p ) {
-            DIP_THROW_RUNTIME( MALLOC_FAILED );
+         void* p{};
+         MemoryPool* pool = GetDefaultMemoryPool();
+         if( pool ) {
+            dataBlock_ = pool->Allocate( size * sz );
+            p = dataBlock_.get();
+         } else {
+            p = std::malloc( size * sz );
+            if( !p ) {
+               DIP_THROW_RUNTIME( MALLOC_FAILED );
+            }
+            dataBlock_ = DataSegment{ p, std::free };
          }
-         dataBlock_ = DataSegment{ p, std::free };
          //[]( void* ptr ) { std::cout << "   Successfully freed image with DataSegment " << ptr << std::endl; std::free( ptr ); }
          origin_ = static_cast< uint8* >( p ) - start * static_cast< dip::sint >( sz );
          //std::cout << "   Successfully forged image with DataSegment " << p << std::endl;
@@ -0,0 +1,327 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "diplib/memory_pool.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "diplib.h"
+
+namespace dip {
+
+namespace {
+
+// Sizes up to `minimumBlockSize` all go in the first size class.
+constexpr dip::uint minimumBlockSize = 256;
+
+// There are 4 size classes per power of two: 2^k, 1.25 * 2^k, 1.5 * 2^k, 1.75 * 2^k.
+constexpr dip::uint subClassBits = 2;
+constexpr dip::uint nSubClasses = 1u << subClassBits;
+
+dip::uint SizeClass( dip::uint size ) {
+   if( size <= minimumBlockSize ) {
+      return 0;
+   }
+   // Round `size - 1` down to the size class; the class of `size` is the next one.
+   dip::uint k = 0;
+   for( dip::uint s = ( size - 1 ) >> ( subClassBits + 1 ); s > 0; s >>= 1 ) {
+      ++k;
+   }
+   dip::uint sub = (( size - 1 ) >> k ) - nSubClasses; // in [0, nSubClasses)
+   dip::uint index = ( k - 6 ) * nSubClasses + sub + 1; // 256 = 2^(6+subClassBits) is class 0
+   return index;
+}
+
+dip::uint ClassSize( dip::uint index ) {
+   if( index == 0 ) {
+      return minimumBlockSize;
+   }
+   --index;
+   dip::uint k = index / nSubClasses + 6;
+   dip::uint sub = index % nSubClasses;
+   return ( nSubClasses + sub + 1 ) << k;
+}
+
+std::atomic< MemoryPool* > defaultMemoryPool{ nullptr };
+
+} // namespace
+
+class MemoryPool::Impl {
+   public:
+      explicit Impl( dip::uint capacity ) : capacity_( capacity ) {}
+
+      ~Impl() {
+         FreeCached();
+      }
+
+      Impl( Impl const& ) = delete;
+      Impl& operator=( Impl const& ) = delete;
+
+      void* Allocate( dip::uint sizeClass ) {
+         {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            if(( sizeClass < freeLists_.size() ) && !freeLists_[ sizeClass ].empty() ) {
+               void* ptr = freeLists_[ sizeClass ].back();
+               freeLists_[ sizeClass ].pop_back();
+               --statistics_.cachedBlocks;
+               statistics_.cachedBytes -= ClassSize( sizeClass );
+               ++statistics_.hits;
+               return ptr;
+            }
+            ++statistics_.misses;
+         }
+         // Call `malloc` outside the lock
+         void* ptr = std::malloc( ClassSize( sizeClass ));
+         if( !ptr ) {
+            // Free cached blocks and try again
+            FreeCached();
+            ptr = std::malloc( ClassSize( sizeClass ));
+            if( !ptr ) {
+               DIP_THROW_RUNTIME( "Failed to allocate memory" );
+            }
+         }
+         return ptr;
+      }
+
+      void Release( void* ptr, dip::uint sizeClass ) noexcept {
+         dip::uint size = ClassSize( sizeClass );
+         {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            if( statistics_.cachedBytes + size <= capacity_ ) {
+               try {
+                  if( sizeClass >= freeLists_.size() ) {
+                     freeLists_.resize( sizeClass + 1 );
+                  }
+                  freeLists_[ sizeClass ].push_back( ptr );
+                  ++statistics_.cachedBlocks;
+                  statistics_.cachedBytes += size;
+                  ++statistics_.releases;
+                  return;
+               } catch( ... ) {
+                  // Failed to allocate memory for the free list, free the block instead.
+               }
+            }
+            ++statistics_.discards;
+         }
+         std::free( ptr );
+      }
+
+      void SetCapacity( dip::uint capacity ) {
+         std::lock_guard< std::mutex > lock( mutex_ );
+         capacity_ = capacity;
+         // Free blocks, largest first, until we're within capacity
+         for( dip::uint ii = freeLists_.size(); ( ii > 0 ) && ( statistics_.cachedBytes > capacity_ ); ) {
+            --ii;
+            while( !freeLists_[ ii ].empty() && ( statistics_.cachedBytes > capacity_ )) {
+               std::free( freeLists_[ ii ].back() );
+               freeLists_[ ii ].pop_back();
+               --statistics_.cachedBlocks;
+               statistics_.cachedBytes -= ClassSize( ii );
+            }
+         }
+      }
+
+      dip::uint Capacity() const {
+         std::lock_guard< std::mutex > lock( mutex_ );
+         return capacity_;
+      }
+
+      void FreeCached() noexcept {
+         std::lock_guard< std::mutex > lock( mutex_ );
+         for( auto& list : freeLists_ ) {
+            for( void* ptr : list ) {
+               std::free( ptr );
+            }
+            list.clear();
+         }
+         statistics_.cachedBlocks = 0;
+         statistics_.cachedBytes = 0;
+      }
+
+      Statistics GetStatistics() const {
+         std::lock_guard< std::mutex > lock( mutex_ );
+         return statistics_;
+      }
+
+      void ResetStatistics() {
+         std::lock_guard< std::mutex > lock( mutex_ );
+         statistics_.hits = 0;
+         statistics_.misses = 0;
+         statistics_.releases = 0;
+         statistics_.discards = 0;
+      }
+
+   private:
+      mutable std::mutex mutex_;
+      dip::uint capacity_;
+      std::vector< std::vector< void* >> freeLists_; // one per size class
+      Statistics statistics_;
+};
+
+MemoryPool::MemoryPool( dip::uint capacity ) : impl_( std::make_shared< Impl >( capacity )) {}
+
+MemoryPool::~MemoryPool() {
+   // If this pool is still installed as the default pool, uninstall it.
+   MemoryPool* self = this;
+   defaultMemoryPool.compare_exchange_strong( self, nullptr );
+}
+
+DataSegment MemoryPool::Allocate( dip::uint size ) {
+   dip::uint sizeClass = SizeClass( size );
+   void* ptr = impl_->Allocate( sizeClass );
+   // The deleter holds a reference to `impl_`, so that blocks can be released after the pool is destroyed.
+   std::shared_ptr< Impl > impl = impl_;
+   return DataSegment{ ptr, [ impl, sizeClass ]( void* p ) { impl->Release( p, sizeClass ); }};
+}
+
+DataSegment MemoryPool::AllocateData(
+      void*& origin,
+      dip::DataType dataType,
+      UnsignedArray const& sizes,
+      IntegerArray& strides,
+      dip::Tensor const& tensor,
+      dip::sint& tensorStride
+) {
+   dip::uint nDims = sizes.size();
+   dip::uint size = tensor.Elements();
+   tensorStride = 1;
+   strides.resize( nDims );
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      strides[ ii ] = static_cast< dip::sint >( size );
+      size *= sizes[ ii ];
+   }
+   DataSegment dataBlock = Allocate( size * dataType.SizeOf() );
+   origin = dataBlock.get();
+   return dataBlock;
+}
+
+void MemoryPool::SetCapacity( dip::uint capacity ) {
+   impl_->SetCapacity( capacity );
+}
+
+dip::uint MemoryPool::Capacity() const {
+   return impl_->Capacity();
+}
+
+void MemoryPool::Clear() {
+   impl_->FreeCached();
+}
+
+MemoryPool::Statistics MemoryPool::GetStatistics() const {
+   return impl_->GetStatistics();
+}
+
+void MemoryPool::ResetStatistics() {
+   impl_->ResetStatistics();
+}
+
+void SetDefaultMemoryPool( MemoryPool* pool ) {
+   defaultMemoryPool = pool;
+}
+
+MemoryPool* GetDefaultMemoryPool() {
+   return defaultMemoryPool;
+}
+
+} // namespace dip
+
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/linear.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing dip::MemoryPool" ) {
+   // Size classes
+   for( dip::uint size : std::vector< dip::uint >{ 1, 100, 256, 257, 320, 321, 384, 448, 512, 513, 1000, 4096, 1000000, 1234567 } ) {
+      dip::uint sizeClass = dip::SizeClass( size );
+      DOCTEST_CHECK( dip::ClassSize( sizeClass ) >= size );
+      DOCTEST_CHECK( dip::ClassSize( sizeClass ) <= std::max( size + size / 4, dip::minimumBlockSize ));
+      if( sizeClass > 0 ) {
+         DOCTEST_CHECK( dip::ClassSize( sizeClass - 1 ) < size );
+      }
+   }
+
+   dip::MemoryPool pool;
+   {
+      dip::DataSegment a = pool.Allocate( 1000 );
+      dip::DataSegment b = pool.Allocate( 1000 );
+      DOCTEST_CHECK( a.get() != b.get() );
+   }
+   auto stats = pool.GetStatistics();
+   DOCTEST_CHECK( stats.misses == 2 );
+   DOCTEST_CHECK( stats.hits == 0 );
+   DOCTEST_CHECK( stats.releases == 2 );
+   DOCTEST_CHECK( stats.cachedBlocks == 2 );
+   {
+      dip::DataSegment a = pool.Allocate( 900 ); // same size class
+      dip::DataSegment b = pool.Allocate( 2000 ); // different size class
+   }
+   stats = pool.GetStatistics();
+   DOCTEST_CHECK( stats.hits == 1 );
+   DOCTEST_CHECK( stats.misses == 3 );
+   DOCTEST_CHECK( stats.cachedBlocks == 3 );
+   DOCTEST_CHECK( stats.HitRate() == doctest::Approx( 0.25 ));
+   pool.SetCapacity( 2048 );
+   stats = pool.GetStatistics();
+   DOCTEST_CHECK( stats.cachedBytes <= 2048 );
+   pool.SetCapacity( 1024 * 1024 );
+   pool.Clear();
+   stats = pool.GetStatistics();
+   DOCTEST_CHECK( stats.cachedBlocks == 0 );
+   DOCTEST_CHECK( stats.cachedBytes == 0 );
+
+   // As an external interface
+   dip::Image img;
+   img.SetExternalInterface( &pool );
+   img.ReForge( { 30, 20 }, 3, dip::DT_SFLOAT );
+   DOCTEST_CHECK( img.HasNormalStrides() );
+   img.Fill( 1 );
+   img.Strip();
+   DOCTEST_CHECK( pool.GetStatistics().cachedBlocks == 1 );
+
+   // As the default pool: the output of a filter reuses the memory of the previous output
+   dip::Image in( { 64, 50 }, 1, dip::DT_SFLOAT );
+   in.Fill( 0 );
+   in.At( 32, 25 ) = 1;
+   dip::Image ref = dip::Gauss( in, { 2 } );
+   pool.ResetStatistics();
+   dip::SetDefaultMemoryPool( &pool );
+   DOCTEST_CHECK( dip::GetDefaultMemoryPool() == &pool );
+   for( dip::uint ii = 0; ii < 5; ++ii ) {
+      dip::Image out = dip::Gauss( in, { 2 } );
+      DOCTEST_CHECK( dip::testing::CompareImages( out, ref, dip::Option::CompareImagesMode::EXACT ));
+   }
+   dip::SetDefaultMemoryPool( nullptr );
+   stats = pool.GetStatistics();
+   DOCTEST_CHECK( stats.hits > stats.misses );
+   {
+      // Blocks outlive the pool
+      dip::DataSegment block;
+      {
+         dip::MemoryPool tmp;
+         dip::SetDefaultMemoryPool( &tmp );
+         block = tmp.Allocate( 10 );
+      }
+      DOCTEST_CHECK( dip::GetDefaultMemoryPool() == nullptr );
+   }
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
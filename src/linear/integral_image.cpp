@@ -0,0 +1,623 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "diplib/integral_image.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "diplib.h"
+#include "diplib/boundary.h"
+#include "diplib/multithreading.h"
+#include "diplib/statistics.h"
+
+namespace dip {
+
+namespace {
+
+// Sums of signed integers are stored as `sint64`, but we compute with them as `uint64` to avoid undefined behavior
+// on overflow. Inclusion-exclusion on the table values yields the correct result modulo 2^64, which is the exact
+// result if that fits in the type.
+template< typename TPT >
+struct TableComputationType {
+   using type = TPT;
+};
+template<>
+struct TableComputationType< sint64 > {
+   using type = uint64;
+};
+
+dfloat ToFloat( uint64 value, bool isSigned ) {
+   return isSigned ? static_cast< dfloat >( static_cast< sint64 >( value )) : static_cast< dfloat >( value );
+}
+dfloat ToFloat( dfloat value, bool /**/ ) {
+   return value;
+}
+
+// Fills `squares` with the square of the values in `sums`. Both images have the same sizes and normal strides.
+template< typename TPS, typename TPQ >
+void SquareTable( Image const& sums, Image& squares ) {
+   TPS const* src = static_cast< TPS const* >( sums.Origin() );
+   TPQ* dest = static_cast< TPQ* >( squares.Origin() );
+   dip::uint n = sums.NumberOfSamples();
+   for( dip::uint ii = 0; ii < n; ++ii ) {
+      TPQ value = static_cast< TPQ >( src[ ii ] );
+      dest[ ii ] = value * value;
+   }
+}
+
+// Computes the cumulative sum of `table` along each dimension. `table` has normal strides.
+template< typename TPT >
+void IntegrateTable( Image& table ) {
+   constexpr dip::uint chunkSize = 1024; // number of samples processed together in one task
+   TPT* data = static_cast< TPT* >( table.Origin() );
+   dip::uint nSamples = table.NumberOfSamples();
+   dip::uint nThreads = nSamples < threadingThreshold ? 1 : GetNumberOfThreads();
+   for( dip::uint dim = 0; dim < table.Dimensionality(); ++dim ) {
+      // The image is seen as `nBlocks` blocks of `length` rows of `width` samples, we add each row to the next
+      dip::uint width = static_cast< dip::uint >( table.Stride( dim ));
+      dip::uint length = table.Size( dim );
+      dip::uint nBlocks = nSamples / ( width * length );
+      dip::uint nChunks = div_ceil( width, chunkSize );
+      dip::sint nTasks = static_cast< dip::sint >( nBlocks * nChunks );
+      #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( static )
+      for( dip::sint task = 0; task < nTasks; ++task ) {
+         dip::uint block = static_cast< dip::uint >( task ) / nChunks;
+         dip::uint first = ( static_cast< dip::uint >( task ) % nChunks ) * chunkSize;
+         dip::uint last = std::min( first + chunkSize, width );
+         TPT* row = data + block * width * length;
+         for( dip::uint ii = 1; ii < length; ++ii ) {
+            TPT* next = row + width;
+            for( dip::uint jj = first; jj < last; ++jj ) {
+               next[ jj ] += row[ jj ];
+            }
+            row = next;
+         }
+      }
+   }
+}
+
+// The box along one image line is given by the `lower` and `upper` table offsets along dimension 0 for each
+// pixel, and by a set of corners along the other dimensions. Corners with a positive sign add `upper` and subtract
+// `lower`, corners with a negative sign do the opposite.
+struct BoxCorners {
+   std::vector< dip::sint > positive;
+   std::vector< dip::sint > negative;
+};
+
+// Computes the box sums for all pixels along one image line, writes them into `buffer`
+template< typename TPT >
+void BoxSumsOnLine(
+      TPT const* table,
+      BoxCorners const& corners,
+      std::vector< dip::sint > const& lower,
+      std::vector< dip::sint > const& upper,
+      std::vector< typename TableComputationType< TPT >::type >& buffer
+) {
+   using TPC = typename TableComputationType< TPT >::type;
+   TPC const* ptr = reinterpret_cast< TPC const* >( table );
+   dip::uint length = buffer.size();
+   std::fill( buffer.begin(), buffer.end(), TPC( 0 ));
+   for( dip::sint offset : corners.positive ) {
+      TPC const* corner = ptr + offset;
+      for( dip::uint ii = 0; ii < length; ++ii ) {
+         buffer[ ii ] += corner[ upper[ ii ]] - corner[ lower[ ii ]];
+      }
+   }
+   for( dip::sint offset : corners.negative ) {
+      TPC const* corner = ptr + offset;
+      for( dip::uint ii = 0; ii < length; ++ii ) {
+         buffer[ ii ] += corner[ lower[ ii ]] - corner[ upper[ ii ]];
+      }
+   }
+}
+
+enum class Statistic : uint8 { SUM, MEAN, VARIANCE, STANDARD_DEVIATION, MEAN_AND_VARIANCE };
+
+struct ComputeParameters {
+   UnsignedArray const& sizes;         // image sizes
+   UnsignedArray tableSizes;           // sizes of the integral image, minus 1
+   IntegerArray lowerShift;            // add to the image coordinates to get the table coordinates of the lower bound
+   IntegerArray upperShift;            // same for the upper bound (exclusive)
+   IntegerArray tableStrides;
+   dip::uint nTensor;
+   dfloat offset;
+   bool isSigned;
+   Statistic statistic;
+};
+
+template< typename TPS, typename TPQ, typename TPO >
+void ComputeStatistic(
+      Image const& sums,
+      Image const& squares,
+      Image& out1,
+      Image& out2,
+      ComputeParameters const& params
+) {
+   using TPCS = typename TableComputationType< TPS >::type;
+   using TPCQ = typename TableComputationType< TPQ >::type;
+   TPS const* sumsPtr = static_cast< TPS const* >( sums.Origin() );
+   TPQ const* squaresPtr = squares.IsForged() ? static_cast< TPQ const* >( squares.Origin() ) : nullptr;
+   dip::uint nDims = params.sizes.size();
+   dip::uint length = params.sizes[ 0 ];
+   dip::uint nLines = params.sizes.product() / length;
+   dip::uint nCorners = dip::uint( 1 ) << ( nDims - 1 );
+   // The box limits along the line are the same for all lines
+   std::vector< dip::sint > lower( length );
+   std::vector< dip::sint > upper( length );
+   std::vector< dfloat > count( length );
+   dip::sint tableSize = static_cast< dip::sint >( params.tableSizes[ 0 ] );
+   for( dip::uint ii = 0; ii < length; ++ii ) {
+      dip::sint lb = clamp( static_cast< dip::sint >( ii ) + params.lowerShift[ 0 ], dip::sint( 0 ), tableSize );
+      dip::sint ub = clamp( static_cast< dip::sint >( ii ) + params.upperShift[ 0 ], dip::sint( 0 ), tableSize );
+      lower[ ii ] = lb * params.tableStrides[ 0 ];
+      upper[ ii ] = ub * params.tableStrides[ 0 ];
+      count[ ii ] = static_cast< dfloat >( ub - lb );
+   }
+   dip::sint outStride1 = out1.Stride( 0 );
+   dip::sint outTensorStride1 = out1.TensorStride();
+   dip::sint outStride2 = out2.IsForged() ? out2.Stride( 0 ) : 0;
+   dip::sint outTensorStride2 = out2.IsForged() ? out2.TensorStride() : 0;
+   dip::uint nThreads = nLines * length * nCorners * params.nTensor < threadingThreshold ? 1 : GetNumberOfThreads();
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      BoxCorners corners;
+      corners.positive.reserve( nCorners );
+      corners.negative.reserve( nCorners );
+      UnsignedArray coords( nDims, 0 );
+      std::vector< TPCS > sumBuffer( length );
+      std::vector< TPCQ > squareBuffer( squaresPtr ? length : 0 );
+      std::vector< dfloat > n( length );
+      #pragma omp for schedule( static )
+      for( dip::sint line = 0; line < static_cast< dip::sint >( nLines ); ++line ) {
+         // Coordinates of the first pixel of the line
+         dip::uint index = static_cast< dip::uint >( line );
+         for( dip::uint jj = 1; jj < nDims; ++jj ) {
+            coords[ jj ] = index % params.sizes[ jj ];
+            index /= params.sizes[ jj ];
+         }
+         // Corners of the box along the other dimensions
+         corners.positive.assign( 1, 0 );
+         corners.negative.clear();
+         dfloat lineCount = 1;
+         for( dip::uint jj = 1; jj < nDims; ++jj ) {
+            dip::sint size = static_cast< dip::sint >( params.tableSizes[ jj ] );
+            dip::sint lb = clamp( static_cast< dip::sint >( coords[ jj ] ) + params.lowerShift[ jj ], dip::sint( 0 ), size );
+            dip::sint ub = clamp( static_cast< dip::sint >( coords[ jj ] ) + params.upperShift[ jj ], dip::sint( 0 ), size );
+            lineCount *= static_cast< dfloat >( ub - lb );
+            lb *= params.tableStrides[ jj ];
+            ub *= params.tableStrides[ jj ];
+            dip::uint nPositive = corners.positive.size();
+            dip::uint nNegative = corners.negative.size();
+            for( dip::uint kk = 0; kk < nPositive; ++kk ) {
+               corners.negative.push_back( corners.positive[ kk ] + lb );
+               corners.positive[ kk ] += ub;
+            }
+            for( dip::uint kk = 0; kk < nNegative; ++kk ) {
+               corners.positive.push_back( corners.negative[ kk ] + lb );
+               corners.negative[ kk ] += ub;
+            }
+         }
+         for( dip::uint ii = 0; ii < length; ++ii ) {
+            n[ ii ] = count[ ii ] * lineCount;
+         }
+         for( dip::uint tt = 0; tt < params.nTensor; ++tt ) {
+            BoxSumsOnLine( sumsPtr + tt, corners, lower, upper, sumBuffer );
+            if( squaresPtr ) {
+               BoxSumsOnLine( squaresPtr + tt, corners, lower, upper, squareBuffer );
+            }
+            TPO* out1Ptr = static_cast< TPO* >( out1.Pointer( coords )) + static_cast< dip::sint >( tt ) * outTensorStride1;
+            TPO* out2Ptr = out2.IsForged()
+                           ? static_cast< TPO* >( out2.Pointer( coords )) + static_cast< dip::sint >( tt ) * outTensorStride2
+                           : nullptr;
+            switch( params.statistic ) {
+               case Statistic::SUM:
+                  for( dip::uint ii = 0; ii < length; ++ii, out1Ptr += outStride1 ) {
+                     *out1Ptr = static_cast< TPO >( ToFloat( sumBuffer[ ii ], params.isSigned ) + n[ ii ] * params.offset );
+                  }
+                  break;
+               case Statistic::MEAN:
+                  for( dip::uint ii = 0; ii < length; ++ii, out1Ptr += outStride1 ) {
+                     *out1Ptr = static_cast< TPO >( ToFloat( sumBuffer[ ii ], params.isSigned ) / n[ ii ] + params.offset );
+                  }
+                  break;
+               default:
+                  for( dip::uint ii = 0; ii < length; ++ii ) {
+                     dfloat sum = ToFloat( sumBuffer[ ii ], params.isSigned );
+                     dfloat sumSquares = ToFloat( squareBuffer[ ii ], false );
+                     dfloat variance = n[ ii ] > 1 ? std::max(( sumSquares - sum * sum / n[ ii ] ) / ( n[ ii ] - 1 ), 0.0 ) : 0.0;
+                     switch( params.statistic ) {
+                        default:
+                        case Statistic::VARIANCE:
+                           *out1Ptr = static_cast< TPO >( variance );
+                           break;
+                        case Statistic::STANDARD_DEVIATION:
+                           *out1Ptr = static_cast< TPO >( std::sqrt( variance ));
+                           break;
+                        case Statistic::MEAN_AND_VARIANCE:
+                           *out1Ptr = static_cast< TPO >( sum / n[ ii ] + params.offset );
+                           *out2Ptr = static_cast< TPO >( variance );
+                           out2Ptr += outStride2;
+                           break;
+                     }
+                     out1Ptr += outStride1;
+                  }
+                  break;
+            }
+         }
+      }
+   DIP_PARALLEL_ERROR_END
+}
+
+template< typename TPS, typename TPQ >
+void ComputeStatistic(
+      Image const& sums,
+      Image const& squares,
+      Image& out1,
+      Image& out2,
+      ComputeParameters const& params
+) {
+   if( out1.DataType() == DT_SFLOAT ) {
+      ComputeStatistic< TPS, TPQ, sfloat >( sums, squares, out1, out2, params );
+   } else {
+      ComputeStatistic< TPS, TPQ, dfloat >( sums, squares, out1, out2, params );
+   }
+}
+
+} // namespace
+
+IntegralImage::IntegralImage(
+      Image const& in,
+      UnsignedArray border,
+      StringArray const& boundaryCondition,
+      String const& statistics
+) {
+   DIP_THROW_IF( !in.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF( in.DataType().IsComplex(), E::DATA_TYPE_NOT_SUPPORTED );
+   dip::uint nDims = in.Dimensionality();
+   DIP_THROW_IF( nDims < 1, E::DIMENSIONALITY_NOT_SUPPORTED );
+   bool withSquares{};
+   DIP_STACK_TRACE_THIS( withSquares = BooleanFromString( statistics, "variance", "mean" ));
+   DIP_STACK_TRACE_THIS( ArrayUseParameter( border, nDims, dip::uint( 0 )));
+   sizes_ = in.Sizes();
+   border_ = border;
+   tensor_ = in.Tensor();
+   dataType_ = in.DataType();
+   pixelSize_ = in.PixelSize();
+   colorSpace_ = in.ColorSpace();
+
+   // Pick accumulation types that can hold the sums without overflow. The squares of 32-bit integers do not fit
+   // in a 64-bit integer, so these are accumulated in floating-point values. These must be computed relative to
+   // the mean, as for floating-point images, otherwise the variance suffers from catastrophic cancellation.
+   DataType sumType = DT_DFLOAT;
+   DataType squareType = DT_DFLOAT;
+   if( !dataType_.IsFloat() && ( dataType_.SizeOf() <= 2 )) {
+      sumType = dataType_.IsSigned() ? DT_SINT64 : DT_UINT64;
+      squareType = DT_UINT64;
+   } else if( !dataType_.IsFloat() && ( dataType_.SizeOf() <= 4 ) && !withSquares ) {
+      sumType = dataType_.IsSigned() ? DT_SINT64 : DT_UINT64;
+   }
+
+   DIP_START_STACK_TRACE
+      // Extend the image
+      Image extended;
+      if( border_.any() ) {
+         ExtendImage( in, extended, border_, StringArrayToBoundaryConditionArray( boundaryCondition ));
+      } else {
+         extended = in.QuickCopy();
+      }
+      // Copy the extended image into the table, leaving the first element along each dimension as 0
+      UnsignedArray tableSizes = extended.Sizes();
+      tableSizes += 1;
+      sums_.ReForge( tableSizes, extended.TensorElements(), sumType );
+      sums_.Fill( 0 );
+      Image interior = sums_.At( RangeArray( nDims, Range{ 1, -1 } ));
+      interior.Protect();
+      interior.Copy( extended );
+      if( sumType == DT_DFLOAT ) {
+         // Subtracting the mean reduces the magnitude of the sums, and so the round-off errors
+         Image samples = in.QuickCopy();
+         samples.TensorToSpatial();
+         offset_ = dip::Mean( samples ).As< dfloat >();
+         if( std::isfinite( offset_ )) {
+            interior -= offset_;
+         } else {
+            offset_ = 0;
+         }
+      }
+      // Compute the squares
+      if( withSquares ) {
+         squares_.ReForge( tableSizes, extended.TensorElements(), squareType );
+         if( sumType == DT_DFLOAT ) {
+            SquareTable< dfloat, dfloat >( sums_, squares_ );
+         } else if( sumType == DT_SINT64 ) {
+            SquareTable< sint64, uint64 >( sums_, squares_ );
+         } else {
+            SquareTable< uint64, uint64 >( sums_, squares_ );
+         }
+      }
+      // Integrate
+      if( sumType == DT_DFLOAT ) {
+         IntegrateTable< dfloat >( sums_ );
+      } else {
+         IntegrateTable< uint64 >( sums_ ); // also for DT_SINT64, see `TableComputationType`
+      }
+      if( withSquares ) {
+         if( squareType == DT_DFLOAT ) {
+            IntegrateTable< dfloat >( squares_ );
+         } else {
+            IntegrateTable< uint64 >( squares_ );
+         }
+      }
+   DIP_END_STACK_TRACE
+}
+
+namespace {
+
+template< typename TPT >
+dfloat BoxSumInTable( Image const& table, IntegerArray const& lower, IntegerArray const& upper, dip::uint tensorElement, bool isSigned ) {
+   using TPC = typename TableComputationType< TPT >::type;
+   TPC const* ptr = static_cast< TPC const* >( table.Pointer( static_cast< dip::sint >( tensorElement ) * table.TensorStride() ));
+   dip::uint nDims = lower.size();
+   TPC sum = 0;
+   for( dip::uint corner = 0; corner < ( dip::uint( 1 ) << nDims ); ++corner ) {
+      dip::sint offset = 0;
+      bool negative = false;
+      for( dip::uint jj = 0; jj < nDims; ++jj ) {
+         if( corner & ( dip::uint( 1 ) << jj )) {
+            offset += upper[ jj ] * table.Stride( jj );
+         } else {
+            offset += lower[ jj ] * table.Stride( jj );
+            negative = !negative;
+         }
+      }
+      if( negative ) {
+         sum -= ptr[ offset ];
+      } else {
+         sum += ptr[ offset ];
+      }
+   }
+   return ToFloat( sum, isSigned );
+}
+
+dfloat BoxSumInTable( Image const& table, IntegerArray const& lower, IntegerArray const& upper, dip::uint tensorElement ) {
+   switch( table.DataType() ) {
+      case DT_UINT64:
+         return BoxSumInTable< uint64 >( table, lower, upper, tensorElement, false );
+      case DT_SINT64:
+         return BoxSumInTable< sint64 >( table, lower, upper, tensorElement, true );
+      default:
+         return BoxSumInTable< dfloat >( table, lower, upper, tensorElement, false );
+   }
+}
+
+// Converts a box in image coordinates to table coordinates, returns the number of pixels in the box
+dfloat BoxToTable(
+      IntegerArray const& origin,
+      UnsignedArray const& sizes,
+      UnsignedArray const& border,
+      UnsignedArray const& tableSizes,
+      IntegerArray& lower,
+      IntegerArray& upper
+) {
+   dip::uint nDims = border.size();
+   DIP_THROW_IF( origin.size() != nDims, E::ARRAY_PARAMETER_WRONG_LENGTH );
+   DIP_THROW_IF( sizes.size() != nDims, E::ARRAY_PARAMETER_WRONG_LENGTH );
+   lower.resize( nDims );
+   upper.resize( nDims );
+   dfloat n = 1;
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      dip::sint size = static_cast< dip::sint >( tableSizes[ ii ] ) - 1;
+      dip::sint start = origin[ ii ] + static_cast< dip::sint >( border[ ii ] );
+      lower[ ii ] = clamp( start, dip::sint( 0 ), size );
+      upper[ ii ] = clamp( start + static_cast< dip::sint >( sizes[ ii ] ), dip::sint( 0 ), size );
+      n *= static_cast< dfloat >( upper[ ii ] - lower[ ii ] );
+   }
+   return n;
+}
+
+} // namespace
+
+dfloat IntegralImage::BoxSum( IntegerArray const& origin, UnsignedArray const& sizes, dip::uint tensorElement ) const {
+   DIP_THROW_IF( !IsComputed(), "The integral image has not been computed" );
+   DIP_THROW_IF( tensorElement >= TensorElements(), E::INDEX_OUT_OF_RANGE );
+   IntegerArray lower;
+   IntegerArray upper;
+   dfloat n{};
+   DIP_STACK_TRACE_THIS( n = BoxToTable( origin, sizes, border_, sums_.Sizes(), lower, upper ));
+   if( n == 0 ) {
+      return 0;
+   }
+   return BoxSumInTable( sums_, lower, upper, tensorElement ) + n * offset_;
+}
+
+dfloat IntegralImage::BoxSumOfSquares( IntegerArray const& origin, UnsignedArray const& sizes, dip::uint tensorElement ) const {
+   DIP_THROW_IF( !HasSquares(), "The integral image was not computed with squares" );
+   DIP_THROW_IF( tensorElement >= TensorElements(), E::INDEX_OUT_OF_RANGE );
+   IntegerArray lower;
+   IntegerArray upper;
+   dfloat n{};
+   DIP_STACK_TRACE_THIS( n = BoxToTable( origin, sizes, border_, sums_.Sizes(), lower, upper ));
+   if( n == 0 ) {
+      return 0;
+   }
+   dfloat sumSquares = BoxSumInTable( squares_, lower, upper, tensorElement );
+   if( offset_ != 0 ) {
+      // sum( ( x + o )^2 ) = sum( x^2 ) + 2 * o * sum( x ) + n * o^2
+      dfloat sum = BoxSumInTable( sums_, lower, upper, tensorElement );
+      sumSquares += ( 2 * sum + n * offset_ ) * offset_;
+   }
+   return sumSquares;
+}
+
+void IntegralImage::Compute( UnsignedArray filterSize, dip::uint statisticCode, Image& out1, Image& out2 ) const {
+   Statistic statistic = static_cast< Statistic >( statisticCode );
+   DIP_THROW_IF( !IsComputed(), "The integral image has not been computed" );
+   bool needSquares = statistic != Statistic::SUM && statistic != Statistic::MEAN;
+   DIP_THROW_IF( needSquares && !HasSquares(), "The integral image was not computed with squares" );
+   dip::uint nDims = sizes_.size();
+   DIP_STACK_TRACE_THIS( ArrayUseParameter( filterSize, nDims, dip::uint( 1 )));
+   DIP_THROW_IF( !filterSize.all(), E::INVALID_PARAMETER );
+   ComputeParameters params{ sizes_, sums_.Sizes(), IntegerArray( nDims ), IntegerArray( nDims ), sums_.Strides(),
+                             TensorElements(), offset_, sums_.DataType() == DT_SINT64, statistic };
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      params.tableSizes[ ii ] -= 1;
+      params.lowerShift[ ii ] = static_cast< dip::sint >( border_[ ii ] ) - static_cast< dip::sint >( filterSize[ ii ] / 2 );
+      params.upperShift[ ii ] = static_cast< dip::sint >( border_[ ii ] ) + static_cast< dip::sint >(( filterSize[ ii ] + 1 ) / 2 );
+   }
+   DataType outType = DataType::SuggestFlex( dataType_ );
+   // Returns the image to write into, which is a temporary image if `out` has a different data type
+   auto forge = [ & ]( Image& out ) {
+      out.ReForge( sizes_, TensorElements(), outType, Option::AcceptDataTypeChange::DO_ALLOW );
+      out.ReshapeTensor( tensor_ );
+      out.SetPixelSize( pixelSize_ );
+      if( !colorSpace_.empty() ) {
+         out.SetColorSpace( colorSpace_ );
+      }
+      if( out.DataType() == outType ) {
+         return out.QuickCopy();
+      }
+      Image tmp;
+      tmp.ReForge( sizes_, TensorElements(), outType );
+      return tmp;
+   };
+   DIP_START_STACK_TRACE
+      Image dest1 = forge( out1 );
+      Image dest2;
+      if( statistic == Statistic::MEAN_AND_VARIANCE ) {
+         dest2 = forge( out2 );
+      }
+      Image squares = needSquares ? squares_.QuickCopy() : Image{};
+      if( sums_.DataType() == DT_DFLOAT ) {
+         ComputeStatistic< dfloat, dfloat >( sums_, squares, dest1, dest2, params );
+      } else {
+         ComputeStatistic< uint64, uint64 >( sums_, squares, dest1, dest2, params );
+      }
+      if( out1.DataType() != outType ) {
+         out1.Copy( dest1 );
+      }
+      if( dest2.IsForged() && ( out2.DataType() != outType )) {
+         out2.Copy( dest2 );
+      }
+   DIP_END_STACK_TRACE
+}
+
+void IntegralImage::Sum( UnsignedArray const& filterSize, Image& out ) const {
+   Image dummy;
+   DIP_STACK_TRACE_THIS( Compute( filterSize, static_cast< dip::uint >( Statistic::SUM ), out, dummy ));
+}
+
+void IntegralImage::Mean( UnsignedArray const& filterSize, Image& out ) const {
+   Image dummy;
+   DIP_STACK_TRACE_THIS( Compute( filterSize, static_cast< dip::uint >( Statistic::MEAN ), out, dummy ));
+}
+
+void IntegralImage::Variance( UnsignedArray const& filterSize, Image& out ) const {
+   Image dummy;
+   DIP_STACK_TRACE_THIS( Compute( filterSize, static_cast< dip::uint >( Statistic::VARIANCE ), out, dummy ));
+}
+
+void IntegralImage::StandardDeviation( UnsignedArray const& filterSize, Image& out ) const {
+   Image dummy;
+   DIP_STACK_TRACE_THIS( Compute( filterSize, static_cast< dip::uint >( Statistic::STANDARD_DEVIATION ), out, dummy ));
+}
+
+void IntegralImage::MeanAndVariance( UnsignedArray const& filterSize, Image& mean, Image& variance ) const {
+   DIP_THROW_IF( &mean == &variance, "Output images must be different objects" );
+   DIP_STACK_TRACE_THIS( Compute( filterSize, static_cast< dip::uint >( Statistic::MEAN_AND_VARIANCE ), mean, variance ));
+}
+
+} // namespace dip
+
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/linear.h"
+#include "diplib/math.h"
+#include "diplib/nonlinear.h"
+#include "diplib/random.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE("[DIPlib] testing dip::IntegralImage") {
+   dip::Random random( 0 );
+   dip::Kernel kernel( dip::FloatArray{ 5, 4, 3 }, dip::S::RECTANGULAR ); // small enough for `VarianceFilter` not to use the integral image
+   for( auto dt : { dip::DT_UINT8, dip::DT_SINT16, dip::DT_UINT32, dip::DT_SFLOAT, dip::DT_DFLOAT } ) {
+      dip::Image img{ dip::UnsignedArray{ 37, 25, 6 }, 2, dip::DT_SFLOAT };
+      img.Fill( 100 );
+      dip::UniformNoise( img, img, random, -100.0, 100.0 );
+      img.Convert( dt );
+      dip::IntegralImage integral( img, { 2, 2, 1 }, { dip::S::PERIODIC }, "variance" );
+      dip::Image mean = integral.Mean( { 5, 4, 3 } );
+      dip::Image variance = integral.Variance( { 5, 4, 3 } );
+      DOCTEST_CHECK( mean.DataType() == dip::DataType::SuggestFlex( dt ));
+      DOCTEST_CHECK( mean.TensorElements() == 2 );
+      DOCTEST_CHECK( dip::testing::CompareImages( mean, dip::Uniform( img, kernel, { dip::S::PERIODIC } ), 1e-3 ));
+      DOCTEST_CHECK( dip::testing::CompareImages( variance, dip::VarianceFilter( img, kernel, { dip::S::PERIODIC } ), 1e-2 ));
+      // Single box queries
+      dip::Image box = img[ 1 ];
+      box = box.At( dip::Range{ 3, 9 }, dip::Range{ 10, 13 }, dip::Range{ 2, 3 } );
+      DOCTEST_CHECK( integral.BoxSum( { 3, 10, 2 }, { 7, 4, 2 }, 1 ) == doctest::Approx( dip::Sum( box ).As< dip::dfloat >() ));
+      DOCTEST_CHECK( integral.BoxSumOfSquares( { 3, 10, 2 }, { 7, 4, 2 }, 1 ) == doctest::Approx( dip::SumSquare( box ).As< dip::dfloat >() ));
+   }
+
+   // Windows that do not fit in the border are truncated
+   dip::Image img{ dip::UnsignedArray{ 20, 15 }, 1, dip::DT_UINT16 };
+   img.Fill( 60000 ); // large values, the sums of squares don't fit in 32 bits
+   dip::IntegralImage integral( img, {}, {}, "variance" );
+   DOCTEST_CHECK( integral.BoxSum( { -5, -5 }, { 10, 10 } ) == 60000.0 * 25.0 );
+   dip::Image sum = integral.Sum( { 7, 7 } );
+   DOCTEST_CHECK( sum.At( 0, 0 ).As< dip::dfloat >() == 60000.0 * 16.0 );
+   DOCTEST_CHECK( sum.At( 10, 14 ).As< dip::dfloat >() == 60000.0 * 28.0 );
+   DOCTEST_CHECK( dip::Maximum( integral.Variance( { 7, 7 } )).As< dip::dfloat >() == 0.0 );
+   DOCTEST_CHECK( dip::Minimum( integral.Mean( { 7, 7 } )).As< dip::dfloat >() == 60000.0 );
+   dip::Image mean;
+   dip::Image variance;
+   integral.MeanAndVariance( { 3, 1 }, mean, variance );
+   DOCTEST_CHECK( mean.At( 0, 0 ).As< dip::dfloat >() == 60000.0 );
+   DOCTEST_CHECK( variance.At( 0, 0 ).As< dip::dfloat >() == 0.0 );
+   dip::IntegralImage sumsOnly( img );
+   DOCTEST_CHECK_THROWS( sumsOnly.Variance( { 3, 3 }, variance ));
+
+   // The sums of squares of 32-bit integers are accumulated relative to the mean, large values don't cancel out
+   img = dip::Image{ dip::UnsignedArray{ 300, 200 }, 1, dip::DT_UINT32 };
+   img.Fill( 4000000000u );
+   integral = dip::IntegralImage( img, { 7 }, {}, "variance" );
+   DOCTEST_CHECK( dip::Maximum( integral.Variance( { 15, 15 } )).As< dip::dfloat >() == 0.0 );
+   DOCTEST_CHECK( dip::Minimum( integral.Mean( { 15, 15 } )).As< dip::dfloat >() == 4e9 );
+   DOCTEST_CHECK( dip::Maximum( dip::VarianceFilter( img, dip::Kernel( 15, dip::S::RECTANGULAR ))).As< dip::dfloat >() == 0.0 );
+
+   // The result doesn't depend on the number of threads
+   img = dip::Image{ dip::UnsignedArray{ 400, 300 }, 1, dip::DT_SFLOAT };
+   img.Fill( 0 );
+   dip::GaussianNoise( img, img, random, 10.0 );
+   dip::uint maxThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 );
+   dip::Image single = dip::IntegralImage( img, { 5 }, {}, "variance" ).StandardDeviation( { 11, 9 } );
+   dip::SetNumberOfThreads( maxThreads );
+   dip::Image multi = dip::IntegralImage( img, { 5 }, {}, "variance" ).StandardDeviation( { 11, 9 } );
+   DOCTEST_CHECK( dip::testing::CompareImages( single, multi, 0.0 ));
+   // A large kernel uses the integral image in `VarianceFilter` for a 16-bit integer image, but not for a
+   // floating-point image
+   dip::Kernel largeKernel( dip::FloatArray{ 11, 9 }, dip::S::RECTANGULAR );
+   img = dip::Convert( img * 100, dip::DT_SINT16 );
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::VarianceFilter( img, largeKernel ), dip::VarianceFilter( dip::Convert( img, dip::DT_DFLOAT ), largeKernel ), dip::Option::CompareImagesMode::APPROX_REL, 1e-6 ));
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
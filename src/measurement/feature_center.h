@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureCenter : public LineBased {
+class FeatureCenter : public LineBasedWithThreads< dfloat > {
    public:
-      FeatureCenter() : LineBased( { "Center", "Coordinates of the geometric mean of the object", false } ) {};
+      FeatureCenter() : LineBasedWithThreads( { "Center", "Coordinates of the geometric mean of the object", false } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const&, dip::uint nObjects ) override {
          nD_ = label.Dimensionality();
@@ -40,13 +40,15 @@ class FeatureCenter : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat >,
             UnsignedArray coordinates,
             dip::uint dimension,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< dfloat >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          dfloat* data = nullptr;
@@ -58,7 +60,7 @@ class FeatureCenter : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() * ( nD_ + 1 ) ] );
+                     data = &( threadData[ it.value() * ( nD_ + 1 ) ] );
                   }
                }
                if( data ) {
@@ -86,15 +88,13 @@ class FeatureCenter : public LineBased {
       }
 
       void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
+         LineBasedWithThreads::Cleanup();
          scales_.clear();
       }
 
    private:
       dip::uint nD_;
       FloatArray scales_;
-      std::vector< dfloat > data_; // size of this array is nObjects * ( nD_ + 1 ). Index as data_[ objectIndex * ( nD_ + 1 ) ]
 };
 
 
@@ -130,6 +130,66 @@ inline dfloat ReverseSizeScale( dip::uint nD, PixelSize const& pixelSize ) {
 }
 
 
+// Base class for the line-based features that can be computed in parallel. The derived class stores its
+// accumulators in `data_` (resized in `Initialize()`), and implements `ScanLineInThread()`, where it writes to
+// `ThreadData( thread )` instead of `data_`. Threads other than the first accumulate into a copy of `data_`.
+// Accumulators are combined using `+=`, a derived class for which that is not correct (e.g. a maximum over
+// `dfloat` values) overrides `Merge()`.
+template< typename Accumulator >
+class LineBasedWithThreads : public LineBased {
+   public:
+      using LineBased::LineBased;
+
+      bool SupportsMultithreading() const override { return true; }
+
+      void SetNumberOfThreads( dip::uint nThreads ) override {
+         threadData_.assign( nThreads - 1, data_ );
+      }
+
+      void ScanLine(
+            LineIterator< LabelType > label,
+            LineIterator< dfloat > grey,
+            UnsignedArray coordinates,
+            dip::uint dimension,
+            ObjectIdToIndexMap const& objectIndices
+      ) override {
+         ScanLineInThread( label, grey, std::move( coordinates ), dimension, objectIndices, 0 );
+      }
+
+      void Reduce() override {
+         // Thread `ii` processes the `ii`-th chunk of image lines. Merging in thread order makes the result
+         // independent of how the threads were scheduled.
+         for( auto const& threadData : threadData_ ) {
+            for( dip::uint ii = 0; ii < data_.size(); ++ii ) {
+               Merge( data_[ ii ], threadData[ ii ] );
+            }
+         }
+         threadData_.clear();
+      }
+
+      void Cleanup() override {
+         threadData_.clear();
+         data_.clear();
+         data_.shrink_to_fit();
+      }
+
+   protected:
+      // Adds `other`, accumulated over image lines that come after the ones accumulated into `data`.
+      virtual void Merge( Accumulator& data, Accumulator const& other ) {
+         data += other;
+      }
+
+      std::vector< Accumulator >& ThreadData( dip::uint thread ) {
+         return thread == 0 ? data_ : threadData_[ thread - 1 ];
+      }
+
+      std::vector< Accumulator > data_;
+
+   private:
+      std::vector< std::vector< Accumulator >> threadData_; // accumulators for threads 1 and up
+};
+
+
 } // namespace feature
 } // namespace dip
 
@@ -21,9 +21,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureDirectionalStatistics : public LineBased {
+class FeatureDirectionalStatistics : public LineBasedWithThreads< DirectionalStatisticsAccumulator > {
    public:
-      FeatureDirectionalStatistics() : LineBased( { "DirectionalStatistics", "Directional mean and standard deviation of object intensity", true } ) {};
+      FeatureDirectionalStatistics() : LineBasedWithThreads( { "DirectionalStatistics", "Directional mean and standard deviation of object intensity", true } ) {};
 
       ValueInformationArray Initialize( Image const& /*label*/, Image const& grey, dip::uint nObjects ) override {
          DIP_THROW_IF( !grey.IsScalar(), E::IMAGE_NOT_SCALAR );
@@ -35,13 +35,15 @@ class FeatureDirectionalStatistics : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray /*coordinates*/,
             dip::uint /*dimension*/,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< DirectionalStatisticsAccumulator >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          DirectionalStatisticsAccumulator* data = nullptr;
@@ -53,7 +55,7 @@ class FeatureDirectionalStatistics : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -69,14 +71,6 @@ class FeatureDirectionalStatistics : public LineBased {
          output[ 0 ] = data.Mean();
          output[ 1 ] = data.StandardDeviation();
       }
-
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
-   private:
-      std::vector< DirectionalStatisticsAccumulator > data_;
 };
 
 
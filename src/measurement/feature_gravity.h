@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureGravity : public LineBased {
+class FeatureGravity : public LineBasedWithThreads< dfloat > {
    public:
-      FeatureGravity() : LineBased( { "Gravity", "Coordinates of the center-of-mass of the grey-value object", true } ) {};
+      FeatureGravity() : LineBasedWithThreads( { "Gravity", "Coordinates of the center-of-mass of the grey-value object", true } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const& grey, dip::uint nObjects ) override {
          DIP_THROW_IF( !grey.IsScalar(), E::IMAGE_NOT_SCALAR );
@@ -41,13 +41,15 @@ class FeatureGravity : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray coordinates,
             dip::uint dimension,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< dfloat >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          dfloat* data = nullptr;
@@ -59,7 +61,7 @@ class FeatureGravity : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() * ( nD_ + 1 ) ] );
+                     data = &( threadData[ it.value() * ( nD_ + 1 ) ] );
                   }
                }
                if( data ) {
@@ -88,15 +90,13 @@ class FeatureGravity : public LineBased {
       }
 
       void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
+         LineBasedWithThreads::Cleanup();
          scales_.clear();
       }
 
    private:
       dip::uint nD_;
       FloatArray scales_;
-      std::vector< dfloat > data_; // size of this array is nObjects * ( nD_ + 1 ). Index as data_[ objectIndex * ( nD_ + 1 ) ]
 };
 
 
@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureGreyMu : public LineBased {
+class FeatureGreyMu : public LineBasedWithThreads< MomentAccumulator > {
    public:
-      FeatureGreyMu() : LineBased( { "GreyMu", "Elements of the grey-weighted inertia tensor", true } ) {};
+      FeatureGreyMu() : LineBasedWithThreads( { "GreyMu", "Elements of the grey-weighted inertia tensor", true } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const& grey, dip::uint nObjects ) override {
          DIP_THROW_IF( !grey.IsScalar(), E::IMAGE_NOT_SCALAR );
@@ -34,13 +34,15 @@ class FeatureGreyMu : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray coordinates,
             dip::uint dimension,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< MomentAccumulator >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          MomentAccumulator* data = nullptr;
@@ -53,7 +55,7 @@ class FeatureGreyMu : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -74,15 +76,13 @@ class FeatureGreyMu : public LineBased {
       }
 
       void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
+         LineBasedWithThreads::Cleanup();
          scales_.clear();
       }
 
    private:
       dip::uint nD_;       // number of dimensions (2 or 3).
       FloatArray scales_;  // nOut values.
-      std::vector< MomentAccumulator > data_; // size of this array is nObjects.
 };
 
 
@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureGreySize : public LineBased {
+class FeatureGreySize : public LineBasedWithThreads< dfloat > {
    public:
-      FeatureGreySize() : LineBased( { "GreySize", "Mass of object (sum of intensities times size of a pixel)", true } ) {};
+      FeatureGreySize() : LineBasedWithThreads( { "GreySize", "Mass of object (sum of intensities times size of a pixel)", true } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const& grey, dip::uint nObjects ) override {
          nTensor_ = grey.TensorElements();
@@ -43,13 +43,15 @@ class FeatureGreySize : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray /*coordinates*/,
             dip::uint /*dimension*/,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< dfloat >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't need to fetch the data pointer again
          LabelType objectID = 0;
          dfloat* data = nullptr;
@@ -61,7 +63,7 @@ class FeatureGreySize : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -81,15 +83,9 @@ class FeatureGreySize : public LineBased {
          }
       }
 
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
    private:
       dfloat scale_;
       dip::uint nTensor_;
-      std::vector< dfloat > data_;
 };
 
 
@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureMaximum : public LineBased {
+class FeatureMaximum : public LineBasedWithThreads< dip::uint > {
    public:
-      FeatureMaximum() : LineBased( { "Maximum", "Maximum coordinates of the object", false } ) {};
+      FeatureMaximum() : LineBasedWithThreads( { "Maximum", "Maximum coordinates of the object", false } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const&, dip::uint nObjects ) override {
          nD_ = label.Dimensionality();
@@ -40,13 +40,15 @@ class FeatureMaximum : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat >, // unused
             UnsignedArray coordinates,
             dip::uint dimension,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< dip::uint >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't need to fetch the data pointer again
          LabelType objectID = 0;
          dip::uint* data = nullptr;
@@ -58,7 +60,7 @@ class FeatureMaximum : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() * nD_ ] );
+                     data = &( threadData[ it.value() * nD_ ] );
                      for( dip::uint ii = 0; ii < nD_; ++ii ) {
                         data[ ii ] = std::max( data[ ii ], coordinates[ ii ] );
                      }
@@ -81,15 +83,18 @@ class FeatureMaximum : public LineBased {
       }
 
       void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
+         LineBasedWithThreads::Cleanup();
          scales_.clear();
       }
 
+   protected:
+      void Merge( dip::uint& data, dip::uint const& other ) override {
+         data = std::max( data, other );
+      }
+
    private:
       dip::uint nD_;
       FloatArray scales_;
-      std::vector< dip::uint > data_; // size of this array is nObjects * nD_. Index as data_[ objectIndex * nD_ ]
 };
 
 
@@ -20,9 +20,20 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureMean : public LineBased {
+struct SumAndNumber {
+   dfloat sum = 0;
+   dip::uint number = 0;
+
+   SumAndNumber& operator+=( SumAndNumber const& other ) {
+      sum += other.sum;
+      number += other.number;
+      return *this;
+   }
+};
+
+class FeatureMean : public LineBasedWithThreads< SumAndNumber > {
    public:
-      FeatureMean() : LineBased( { "Mean", "Mean object intensity", true } ) {};
+      FeatureMean() : LineBasedWithThreads( { "Mean", "Mean object intensity", true } ) {};
 
       ValueInformationArray Initialize( Image const& /*label*/, Image const& grey, dip::uint nObjects ) override {
          nTensor_ = grey.TensorElements();
@@ -39,16 +50,18 @@ class FeatureMean : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray /*coordinates*/,
             dip::uint /*dimension*/,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< SumAndNumber >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
-         Data* data = nullptr;
+         SumAndNumber* data = nullptr;
          do {
             if( *label > 0 ) {
                if( *label != objectID ) {
@@ -57,7 +70,7 @@ class FeatureMean : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() * nTensor_ ] );
+                     data = &( threadData[ it.value() * nTensor_ ] );
                   }
                }
                if( data ) {
@@ -72,24 +85,14 @@ class FeatureMean : public LineBased {
       }
 
       void Finish( dip::uint objectIndex, Measurement::ValueIterator output ) override {
-         Data* data = &data_[ objectIndex * nTensor_ ];
+         SumAndNumber* data = &data_[ objectIndex * nTensor_ ];
          for( dip::uint ii = 0; ii < nTensor_; ++ii ) {
             output[ ii ] = ( data[ ii ].number != 0 ) ? ( data[ ii ].sum / static_cast< dfloat >( data[ ii ].number )) : ( 0.0 );
          }
       }
 
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
    private:
-      struct Data {
-         dfloat sum = 0;
-         dip::uint number = 0;
-      };
       dip::uint nTensor_;
-      std::vector< Data > data_;
 };
 
 
@@ -20,17 +20,30 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureMinPos : public LineBased {
+struct MinValueAndPosition {
+   dfloat value;
+   UnsignedArray position;
+
+   // `other` comes from later image lines, taking the first minimum found yields the same
+   // result as scanning the image in a single thread.
+   MinValueAndPosition& operator+=( MinValueAndPosition const& other ) {
+      if( value > other.value ) {
+         value = other.value;
+         position = other.position;
+      }
+      return *this;
+   }
+};
+
+class FeatureMinPos : public LineBasedWithThreads< MinValueAndPosition > {
    public:
-      FeatureMinPos() : LineBased( { "MinPos", "Position of pixel with minimum intensity", true } ) {};
+      FeatureMinPos() : LineBasedWithThreads( { "MinPos", "Position of pixel with minimum intensity", true } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const& grey, dip::uint nObjects ) override {
          DIP_THROW_IF( !grey.IsScalar(), E::IMAGE_NOT_SCALAR );
          nD_ = label.Dimensionality();
-         pos_.clear();
          data_.clear();
-         pos_.resize( nObjects * nD_, 0 );
-         data_.resize( nObjects, infinity );
+         data_.resize( nObjects, { infinity, UnsignedArray( nD_, 0 ) } );
          scales_.resize( nD_ );
          ValueInformationArray out( nD_ );
          PixelSize ps = label.PixelSize();
@@ -43,35 +56,32 @@ class FeatureMinPos : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray coordinates,
             dip::uint dimension,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< MinValueAndPosition >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
-         dip::uint* pos = nullptr;
-         dfloat* data = nullptr;
+         MinValueAndPosition* data = nullptr;
          do {
             if( *label > 0 ) {
                if( *label != objectID ) {
                   objectID = *label;
                   auto it = objectIndices.find( objectID );
                   if( it == objectIndices.end() ) {
-                     pos = nullptr;
                      data = nullptr;
                   } else {
-                     pos = &( pos_[ it.value() * nD_ ] );
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
-               if( data && ( *data > *grey )) {
-                  *data = *grey;
-                  for( dip::uint ii = 0; ii < nD_; ++ii ) {
-                     pos[ ii ] = coordinates[ ii ];
-                  }
+               if( data && ( data->value > *grey )) {
+                  data->value = *grey;
+                  data->position = coordinates;
                }
             }
             ++grey;
@@ -80,24 +90,15 @@ class FeatureMinPos : public LineBased {
       }
 
       void Finish( dip::uint objectIndex, Measurement::ValueIterator output ) override {
-         dip::uint* pos = &( pos_[ objectIndex * nD_ ] );
+         UnsignedArray const& pos = data_[ objectIndex ].position;
          for( dip::uint ii = 0; ii < nD_; ++ii ) {
             output[ ii ] = static_cast< dfloat >( pos[ ii ] ) * scales_[ ii ];
          }
       }
 
-      void Cleanup() override {
-         pos_.clear();
-         pos_.shrink_to_fit();
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
    private:
       dip::uint nD_;
       FloatArray scales_;
-      std::vector< dip::uint > pos_; // size of this array is nObjects. Index as data_[ objectIndex ]
-      std::vector< dfloat > data_; // size of this array is nObjects * nD_. Index as data_[ objectIndex * nD_ ]
 };
 
 
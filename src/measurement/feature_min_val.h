@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureMinVal : public LineBased {
+class FeatureMinVal : public LineBasedWithThreads< dfloat > {
    public:
-      FeatureMinVal() : LineBased( { "MinVal", "Minimum object intensity", true } ) {};
+      FeatureMinVal() : LineBasedWithThreads( { "MinVal", "Minimum object intensity", true } ) {};
 
       ValueInformationArray Initialize( Image const& /*label*/, Image const& grey, dip::uint nObjects ) override {
          nTensor_ = grey.TensorElements();
@@ -39,13 +39,15 @@ class FeatureMinVal : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray /*coordinates*/,
             dip::uint /*dimension*/,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< dfloat >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          dfloat* data = nullptr;
@@ -57,7 +59,7 @@ class FeatureMinVal : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -77,14 +79,13 @@ class FeatureMinVal : public LineBased {
          }
       }
 
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
+   protected:
+      void Merge( dfloat& data, dfloat const& other ) override {
+         data = std::min( data, other );
       }
 
    private:
       dip::uint nTensor_;
-      std::vector< dfloat > data_;
 };
 
 
@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureMu : public LineBased {
+class FeatureMu : public LineBasedWithThreads< MomentAccumulator > {
    public:
-      FeatureMu() : LineBased( { "Mu", "Elements of the inertia tensor", false } ) {};
+      FeatureMu() : LineBasedWithThreads( { "Mu", "Elements of the inertia tensor", false } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const&, dip::uint nObjects ) override {
          nD_ = label.Dimensionality();
@@ -33,13 +33,15 @@ class FeatureMu : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat >,
             UnsignedArray coordinates,
             dip::uint dimension,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< MomentAccumulator >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          MomentAccumulator* data = nullptr;
@@ -52,7 +54,7 @@ class FeatureMu : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -72,15 +74,13 @@ class FeatureMu : public LineBased {
       }
 
       void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
+         LineBasedWithThreads::Cleanup();
          scales_.clear();
       }
 
    private:
       dip::uint nD_;       // number of dimensions (2 or 3).
       FloatArray scales_;  // nOut values.
-      std::vector< MomentAccumulator > data_; // size of this array is nObjects.
 };
 
 
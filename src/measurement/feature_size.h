@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureSize : public LineBased {
+class FeatureSize : public LineBasedWithThreads< dip::uint > {
    public:
-      FeatureSize() : LineBased( { "Size", "Number of object pixels", false } ) {};
+      FeatureSize() : LineBasedWithThreads( { "Size", "Number of object pixels", false } ) {};
 
       ValueInformationArray Initialize( Image const& label, Image const&, dip::uint nObjects ) override {
          data_.clear();
@@ -48,13 +48,15 @@ class FeatureSize : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat >, // unused
             UnsignedArray, // unused
             dip::uint, // unused
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< dip::uint >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't need to fetch the data pointer again
          LabelType objectID = 0;
          dip::uint* data = nullptr;
@@ -66,7 +68,7 @@ class FeatureSize : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -80,14 +82,8 @@ class FeatureSize : public LineBased {
          *output = static_cast< dfloat >( data_[ objectIndex ] ) * scale_;
       }
 
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
    private:
       dfloat scale_;
-      std::vector< dip::uint > data_;
 };
 
 
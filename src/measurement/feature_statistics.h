@@ -21,9 +21,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureStatistics : public LineBased {
+class FeatureStatistics : public LineBasedWithThreads< StatisticsAccumulator > {
    public:
-      FeatureStatistics() : LineBased( { "Statistics", "Mean, standard deviation, skewness and excess kurtosis of object intensity", true } ) {};
+      FeatureStatistics() : LineBasedWithThreads( { "Statistics", "Mean, standard deviation, skewness and excess kurtosis of object intensity", true } ) {};
 
       ValueInformationArray Initialize( Image const& /*label*/, Image const& grey, dip::uint nObjects ) override {
          DIP_THROW_IF( !grey.IsScalar(), E::IMAGE_NOT_SCALAR );
@@ -37,13 +37,15 @@ class FeatureStatistics : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray /*coordinates*/,
             dip::uint /*dimension*/,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< StatisticsAccumulator >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          StatisticsAccumulator* data = nullptr;
@@ -55,7 +57,7 @@ class FeatureStatistics : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -73,14 +75,6 @@ class FeatureStatistics : public LineBased {
          output[ 2 ] = data.Skewness();
          output[ 3 ] = data.ExcessKurtosis();
       }
-
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
-   private:
-      std::vector< StatisticsAccumulator > data_;
 };
 
 
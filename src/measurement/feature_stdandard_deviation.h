@@ -20,9 +20,9 @@ namespace dip {
 namespace Feature {
 
 
-class FeatureStandardDeviation : public LineBased {
+class FeatureStandardDeviation : public LineBasedWithThreads< FastVarianceAccumulator > {
    public:
-      FeatureStandardDeviation() : LineBased( { "StandardDeviation", "Standard deviation of object intensity", true } ) {};
+      FeatureStandardDeviation() : LineBasedWithThreads( { "StandardDeviation", "Standard deviation of object intensity", true } ) {};
 
       ValueInformationArray Initialize( Image const& /*label*/, Image const& grey, dip::uint nObjects ) override {
          nTensor_ = grey.TensorElements();
@@ -39,13 +39,15 @@ class FeatureStandardDeviation : public LineBased {
          return out;
       }
 
-      void ScanLine(
+      void ScanLineInThread(
             LineIterator< LabelType > label,
             LineIterator< dfloat > grey,
             UnsignedArray /*coordinates*/,
             dip::uint /*dimension*/,
-            ObjectIdToIndexMap const& objectIndices
+            ObjectIdToIndexMap const& objectIndices,
+            dip::uint thread
       ) override {
+         std::vector< FastVarianceAccumulator >& threadData = ThreadData( thread );
          // If new objectID is equal to previous one, we don't to fetch the data pointer again
          LabelType objectID = 0;
          FastVarianceAccumulator* data = nullptr;
@@ -57,7 +59,7 @@ class FeatureStandardDeviation : public LineBased {
                   if( it == objectIndices.end() ) {
                      data = nullptr;
                   } else {
-                     data = &( data_[ it.value() ] );
+                     data = &( threadData[ it.value() ] );
                   }
                }
                if( data ) {
@@ -77,14 +79,8 @@ class FeatureStandardDeviation : public LineBased {
          }
       }
 
-      void Cleanup() override {
-         data_.clear();
-         data_.shrink_to_fit();
-      }
-
    private:
       dip::uint nTensor_;
-      std::vector< FastVarianceAccumulator > data_;
 };
 
 
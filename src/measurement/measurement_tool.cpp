@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
 #include <vector>
 
 #include "diplib.h"
@@ -132,6 +133,17 @@ MeasurementTool::MeasurementTool() {
    Register( new Feature::FeatureGreyDimensionsEllipsoid );
 }
 
+void Feature::LineBased::ScanLineInThread(
+      LineIterator< LabelType > label,
+      LineIterator< dfloat > grey,
+      UnsignedArray coordinates,
+      dip::uint dimension,
+      ObjectIdToIndexMap const& objectIndices,
+      dip::uint /*thread*/
+) {
+   ScanLine( label, grey, std::move( coordinates ), dimension, objectIndices );
+}
+
 using LineBasedFeatureArray = std::vector< Feature::LineBased* >;
 using FeatureArray = std::vector< Feature::Base* >;
 
@@ -142,7 +154,14 @@ namespace {
 // that we call here are not overloaded.
 class MeasureLineFilter : public Framework::ScanLineFilter {
    public:
-      // not defining GetNumberOfOperations(), always called in a single thread
+      dip::uint GetNumberOfOperations( dip::uint /**/, dip::uint /**/, dip::uint /**/ ) override {
+         return 10 * features.size();
+      }
+      void SetNumberOfThreads( dip::uint threads ) override {
+         for( auto const& feature : features ) {
+            feature->SetNumberOfThreads( threads );
+         }
+      }
       void Filter( Framework::ScanLineFilterParameters const& params ) override {
          LineIterator< LabelType > label(
                static_cast< LabelType* >( params.inBuffer[ 0 ].buffer ),
@@ -161,7 +180,7 @@ class MeasureLineFilter : public Framework::ScanLineFilter {
          for( auto const& feature : features ) {
             // NOTE! params.dimension here works as long as params.tensorToSpatial is false.
             // As is now, MeasurementTool::Measure only works with scalar images, so we don't need to test here.
-            feature->ScanLine( label, grey, params.position, params.dimension, objectIndices );
+            feature->ScanLineInThread( label, grey, params.position, params.dimension, objectIndices, params.thread );
          }
       }
       MeasureLineFilter( LineBasedFeatureArray const& features, ObjectIdToIndexMap const& objectIndices ) :
@@ -278,10 +297,22 @@ Measurement MeasurementTool::Measure(
       }
       ImageRefArray outar{};
 
-      // Do the scan, which calls dip::Feature::LineBased::ScanLine()
+      // Do the scan, which calls dip::Feature::LineBased::ScanLineInThread(). We can only use multiple threads
+      // if all features support it.
+      Framework::ScanOptions scanOptions = Framework::ScanOption::NeedCoordinates;
+      for( auto const& feature : lineBasedFeatures ) {
+         if( !feature->SupportsMultithreading() ) {
+            scanOptions += Framework::ScanOption::NoMultiThreading;
+            break;
+         }
+      }
       MeasureLineFilter functor{ lineBasedFeatures, measurement.ObjectIndices() };
-      Framework::Scan( inar, outar, inBufT, {}, {}, {}, functor,
-            Framework::ScanOption::NoMultiThreading + Framework::ScanOption::NeedCoordinates );
+      Framework::Scan( inar, outar, inBufT, {}, {}, {}, functor, scanOptions );
+
+      // Call dip::Feature::LineBased::Reduce()
+      for( auto const& feature : lineBasedFeatures ) {
+         feature->Reduce();
+      }
 
       // Call dip::Feature::LineBased::Finish()
       for( auto const& feature : lineBasedFeatures ) {
@@ -364,6 +395,9 @@ Measurement MeasurementTool::Measure(
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
 #include "doctest.h"
 #include "diplib/generation.h"
+#include "diplib/multithreading.h"
+#include "diplib/random.h"
+#include "diplib/statistics.h"
 
 DOCTEST_TEST_CASE( "[DIPlib] testing dip::MeasurementTool::Measure" ) {
    // A test image with a single circle
@@ -763,4 +797,37 @@ DOCTEST_TEST_CASE( "[DIPlib] testing dip::MeasurementTool::Measure" ) {
    DOCTEST_CHECK( std::abs( msr_obj[ "GreyDimensionsEllipsoid" ][ 1 ] - 2 * r * ps ) < 0.2 * ps );
 }
 
+DOCTEST_TEST_CASE( "[DIPlib] testing dip::MeasurementTool::Measure in parallel" ) {
+   // Measuring in multiple threads must yield the same result as measuring in a single thread.
+   // The image has more pixels than `dip::threadingThreshold`, so the scan is split over threads
+   // even if each pixel were to count as a single operation.
+   dip::Random random( 0 );
+   dip::Image grey( { 500, 400 }, 1, dip::DT_SFLOAT );
+   DOCTEST_REQUIRE( grey.NumberOfPixels() > dip::threadingThreshold );
+   grey.Fill( 0 );
+   grey = dip::UniformNoise( grey, random );
+   dip::Image label = dip::Label( grey > 0.4, 1 );
+   dip::StringArray exact{ "Size", "Minimum", "Maximum", "CartesianBox", "MaxVal", "MinVal", "MaxPos", "MinPos" };
+   dip::StringArray approximate{ "Mass", "Mean", "StandardDeviation", "Statistics", "DirectionalStatistics", "Center", "Mu", "GreySize", "Gravity", "GreyMu" };
+   dip::StringArray features = exact;
+   features.insert( features.end(), approximate.begin(), approximate.end() );
+   dip::MeasurementTool measurementTool;
+   dip::uint maxThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 );
+   auto ref = measurementTool.Measure( label, grey, features );
+   dip::SetNumberOfThreads( 4 );
+   auto msr = measurementTool.Measure( label, grey, features );
+   auto msr2 = measurementTool.Measure( label, grey, features );
+   dip::SetNumberOfThreads( maxThreads );
+   DOCTEST_REQUIRE( msr.NumberOfObjects() == ref.NumberOfObjects() );
+   for( auto const& name : exact ) {
+      DOCTEST_CHECK( dip::All( msr[ name ].AsImage() == ref[ name ].AsImage() ).As< bool >() );
+   }
+   for( auto const& name : approximate ) {
+      DOCTEST_CHECK( dip::MaximumAbsoluteError( msr[ name ].AsImage(), ref[ name ].AsImage() ) < 1e-6 );
+      // The per-thread results are merged in a fixed order, repeating the measurement gives identical results
+      DOCTEST_CHECK( dip::All( msr[ name ].AsImage() == msr2[ name ].AsImage() ).As< bool >() );
+   }
+}
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST
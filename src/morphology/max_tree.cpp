@@ -0,0 +1,507 @@
+/*
+ * (c)2024, Cris Luengo.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "diplib/max_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "diplib.h"
+#include "diplib/boundary.h"
+#include "diplib/iterators.h"
+#include "diplib/multithreading.h"
+#include "diplib/neighborlist.h"
+#include "diplib/overload.h"
+
+#include "watershed_support.h"
+
+namespace dip {
+
+namespace {
+
+constexpr dip::sint NOT_PROCESSED = -1;
+
+// Finds the root of the union-find tree `zpar` that `p` belongs to, with path compression.
+dip::sint FindRoot( dip::sint* zpar, dip::sint p ) {
+   dip::sint root = p;
+   while( zpar[ root ] != root ) {
+      root = zpar[ root ];
+   }
+   while( zpar[ p ] != root ) {
+      dip::sint next = zpar[ p ];
+      zpar[ p ] = root;
+      p = next;
+   }
+   return root;
+}
+
+// Finds the canonical element of the level component that `p` belongs to: the pixel in the component
+// whose parent has a different grey value, or the root.
+template< typename TPI >
+dip::sint LevelRoot( TPI const* grey, dip::sint const* parent, dip::sint p ) {
+   for( ;; ) {
+      dip::sint q = parent[ p ];
+      if(( q == p ) || ( grey[ q ] != grey[ p ] )) {
+         return p;
+      }
+      p = q;
+   }
+}
+
+// Builds the tree for the pixels in `offsets` that are in [lo, hi). `offsets` is sorted from the leaves towards
+// the root (high first for a max-tree). Neighbors outside [lo, hi) are ignored, they belong to other slabs
+// that are being processed in parallel.
+// `zpar` is a union-find structure over the pixels processed so far, using union by rank. `repr` gives, for each
+// set root in `zpar`, the pixel that is the root of the corresponding partial tree in `parent`.
+template< typename TPI >
+void BuildSlabTree(
+      TPI const* grey,
+      std::vector< dip::sint > const& offsets,
+      IntegerArray const& neighborOffsets,
+      dip::sint lo,
+      dip::sint hi,
+      dip::sint* parent,
+      dip::sint* zpar,
+      dip::sint* repr,
+      uint8* rank
+) {
+   for( dip::sint p : offsets ) {
+      if(( p < lo ) || ( p >= hi )) {
+         continue;
+      }
+      parent[ p ] = p;
+      zpar[ p ] = p;
+      repr[ p ] = p;
+      dip::sint zp = p;
+      for( auto n : neighborOffsets ) {
+         dip::sint q = p + n;
+         if(( q >= lo ) && ( q < hi ) && ( zpar[ q ] != NOT_PROCESSED )) {
+            dip::sint zq = FindRoot( zpar, q );
+            if( zq != zp ) {
+               parent[ repr[ zq ]] = p;
+               if( rank[ zp ] < rank[ zq ] ) {
+                  std::swap( zp, zq );
+               } else if( rank[ zp ] == rank[ zq ] ) {
+                  ++rank[ zp ];
+               }
+               zpar[ zq ] = zp;
+               repr[ zp ] = p;
+            }
+         }
+      }
+   }
+   // Make the tree canonical: each pixel points directly to the level root of its level component, or to
+   // that of its parent component. This keeps `LevelRoot()` cheap when merging trees.
+   for( auto it = offsets.rbegin(); it != offsets.rend(); ++it ) {
+      if(( *it < lo ) || ( *it >= hi )) {
+         continue;
+      }
+      dip::sint q = parent[ *it ];
+      if( grey[ parent[ q ]] == grey[ q ] ) {
+         parent[ *it ] = parent[ q ];
+      }
+   }
+}
+
+// Merges the trees that the neighboring pixels `a` and `b` belong to.
+template< typename TPI >
+void ConnectTrees( TPI const* grey, dip::sint* parent, dip::sint a, dip::sint b, bool lowFirst ) {
+   auto isAbove = [ grey, lowFirst ]( dip::sint p, dip::sint q ) {
+      return lowFirst ? grey[ p ] < grey[ q ] : grey[ p ] > grey[ q ];
+   };
+   dip::sint x = LevelRoot( grey, parent, a );
+   dip::sint y = LevelRoot( grey, parent, b );
+   if( isAbove( y, x )) {
+      std::swap( x, y );
+   }
+   // We walk down the two branches towards the root, always keeping `x` at the same level as `y` or above it,
+   // and insert the nodes of one branch into the other.
+   while( x != y ) {
+      dip::sint px = parent[ x ];
+      if( px == x ) {
+         // `x` is the root of its tree
+         parent[ x ] = y;
+         break;
+      }
+      dip::sint z = LevelRoot( grey, parent, px );
+      if( !isAbove( y, z )) {
+         x = z;
+      } else {
+         parent[ x ] = y;
+         x = y;
+         y = z;
+      }
+   }
+}
+
+template< typename TPI >
+void MaxTreeInternal(
+      Image const& c_grey,
+      std::vector< dip::sint > const& offsets,
+      std::vector< dip::sint > const& slabBounds,
+      std::vector< std::vector< dip::sint >> const& boundaryOffsets,
+      IntegerArray const& neighborOffsets,
+      bool lowFirst,
+      LabelType* nodes,
+      std::vector< dip::uint >& nodeParent,
+      std::vector< dfloat >& nodeLevel
+) {
+   TPI const* grey = static_cast< TPI const* >( c_grey.Origin() );
+   dip::uint nSlabs = slabBounds.size() - 1;
+   std::vector< dip::sint > parentArray( c_grey.NumberOfPixels(), NOT_PROCESSED );
+   std::vector< dip::sint > zparArray( c_grey.NumberOfPixels(), NOT_PROCESSED );
+   dip::sint* parent = parentArray.data();
+   dip::sint* zpar = zparArray.data();
+
+   // Build the tree for each slab independently
+   {
+      std::vector< dip::sint > repr( c_grey.NumberOfPixels() );
+      std::vector< uint8 > rank( c_grey.NumberOfPixels(), 0 );
+      #pragma omp parallel for num_threads( static_cast< int >( nSlabs )) schedule( static )
+      for( dip::sint slab = 0; slab < static_cast< dip::sint >( nSlabs ); ++slab ) {
+         dip::uint ii = static_cast< dip::uint >( slab );
+         BuildSlabTree( grey, offsets, neighborOffsets, slabBounds[ ii ], slabBounds[ ii + 1 ], parent, zpar, repr.data(), rank.data() );
+      }
+   }
+
+   // Merge the trees across slab boundaries
+   for( dip::uint slab = 1; slab < nSlabs; ++slab ) {
+      dip::sint lo = slabBounds[ slab ];
+      for( dip::sint p : boundaryOffsets[ slab - 1 ] ) {
+         for( auto n : neighborOffsets ) {
+            dip::sint q = p + n;
+            if(( q < lo ) && ( parent[ q ] != NOT_PROCESSED )) {
+               ConnectTrees( grey, parent, p, q, lowFirst );
+            }
+         }
+      }
+   }
+
+   // Number the nodes in the order in which they are first encountered when going from the root towards the
+   // leaves. Parents get a lower index than their children, and the numbering doesn't depend on which pixel is the
+   // level root of each level component (which depends on how the image was split into slabs).
+   std::fill( zparArray.begin(), zparArray.end(), NOT_PROCESSED ); // We reuse `zpar` to store the node index for each level root
+   dip::uint nNodes = 0;
+   for( auto it = offsets.rbegin(); it != offsets.rend(); ++it ) {
+      dip::sint p = *it;
+      dip::sint root = LevelRoot( grey, parent, p );
+      if( zpar[ root ] == NOT_PROCESSED ) {
+         DIP_THROW_IF( nNodes > std::numeric_limits< LabelType >::max(), "Too many nodes in the tree" );
+         zpar[ root ] = static_cast< dip::sint >( nNodes );
+         ++nNodes;
+         dip::sint q = parent[ root ];
+         nodeParent.push_back( q == root ? 0 : static_cast< dip::uint >( zpar[ LevelRoot( grey, parent, q ) ] ));
+         nodeLevel.push_back( static_cast< dfloat >( grey[ root ] ));
+      }
+      // Path compression: all pixels in the level component point directly to the level root
+      while( p != root ) {
+         dip::sint next = parent[ p ];
+         parent[ p ] = root;
+         p = next;
+      }
+   }
+
+   // Write the node image, `nodes` has normal strides and is indexed in the same order as the image `grey`
+   // without its border.
+   std::vector< dip::sint > rasterOffsets = CreateOffsetsArray( c_grey.Sizes(), c_grey.Strides() );
+   dip::uint nPixels = rasterOffsets.size();
+   dip::uint nThreads = nSlabs > 1 ? GetNumberOfThreads() : 1;
+   #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( static )
+   for( dip::sint ii = 0; ii < static_cast< dip::sint >( nPixels ); ++ii ) {
+      dip::sint p = rasterOffsets[ static_cast< dip::uint >( ii ) ];
+      nodes[ ii ] = static_cast< LabelType >( zpar[ LevelRoot( grey, parent, p ) ] );
+   }
+}
+
+} // namespace
+
+MaxTree::MaxTree( Image const& c_in, dip::uint connectivity, String const& polarity ) {
+   // Check input
+   DIP_THROW_IF( !c_in.IsForged(), E::IMAGE_NOT_FORGED );
+   DIP_THROW_IF( !c_in.IsScalar(), E::IMAGE_NOT_SCALAR );
+   DIP_THROW_IF( !c_in.DataType().IsReal() && !c_in.DataType().IsBinary(), E::DATA_TYPE_NOT_SUPPORTED );
+   dip::uint nDims = c_in.Dimensionality();
+   DIP_THROW_IF( nDims < 1, E::DIMENSIONALITY_NOT_SUPPORTED );
+   DIP_THROW_IF( connectivity > nDims, E::ILLEGAL_CONNECTIVITY );
+   bool lowFirst{};
+   DIP_STACK_TRACE_THIS( lowFirst = BooleanFromString( polarity, S::CLOSING, S::OPENING ));
+   isMinTree_ = lowFirst;
+   dataType_ = c_in.DataType();
+   pixelSize_ = c_in.PixelSize();
+
+   // Add a 1-pixel boundary around the input image, its pixels are never processed
+   Image grey;
+   DIP_STACK_TRACE_THIS( ExtendImage( c_in, grey, { 1 }, { BoundaryCondition::ADD_MIN_VALUE } ));
+   if( grey.DataType().IsBinary() ) {
+      grey.Convert( DT_UINT8 );
+   }
+   grey.ForceNormalStrides(); // Offsets are used as indices into arrays, and slabs must be contiguous in memory
+   UnsignedArray const& sizes = grey.Sizes();
+   IntegerArray const& strides = grey.Strides();
+   dip::uint lastDim = nDims - 1;
+   dip::sint lastStride = strides[ lastDim ];
+
+   // Split the image into slabs along the last dimension. `slabBounds` are offsets to the first pixel of each
+   // slab, slabs are contiguous in memory. Merging the trees of two slabs requires walking down the branches of
+   // both trees, which is cheap only if the number of grey levels is small. For images with more than 8 bits
+   // per pixel we always use a single slab.
+   dip::uint nLines = sizes[ lastDim ] - 2;
+   bool fewLevels = grey.DataType().IsInteger() && ( grey.DataType().SizeOf() == 1 );
+   dip::uint nSlabs = ( !fewLevels || ( c_in.NumberOfPixels() < threadingThreshold )) ? 1 : std::min( GetNumberOfThreads(), nLines );
+   std::vector< dip::sint > slabBounds( nSlabs + 1 );
+   for( dip::uint slab = 0; slab <= nSlabs; ++slab ) {
+      slabBounds[ slab ] = static_cast< dip::sint >( 1 + slab * nLines / nSlabs ) * lastStride;
+   }
+
+   // The pixels in the first line of each slab (except the first one), these are merged with the previous slab
+   std::vector< std::vector< dip::sint >> boundaryOffsets( nSlabs - 1 );
+   UnsignedArray lineSizes = sizes;
+   lineSizes[ lastDim ] = 3;
+   for( dip::uint slab = 1; slab < nSlabs; ++slab ) {
+      boundaryOffsets[ slab - 1 ] = CreateOffsetsArray( lineSizes, strides );
+      for( auto& o : boundaryOffsets[ slab - 1 ] ) {
+         o += slabBounds[ slab ] - lastStride;
+      }
+   }
+
+   // Sort the pixels. The sort is stable, so the order doesn't depend on the number of threads
+   std::vector< dip::sint > offsets = CreateOffsetsArray( sizes, strides );
+   SortOffsets( grey, offsets, lowFirst );
+
+   // Create array with offsets to neighbors
+   NeighborList neighbors( { Metric::TypeCode::CONNECTED, connectivity }, nDims );
+   IntegerArray neighborOffsets = neighbors.ComputeOffsets( strides );
+
+   // Build the tree
+   nodes_.ReForge( c_in.Sizes(), 1, DT_LABEL );
+   nodes_.ForceNormalStrides();
+   DIP_OVL_CALL_REAL( MaxTreeInternal, ( grey, offsets, slabBounds, boundaryOffsets, neighborOffsets, lowFirst,
+                                         static_cast< LabelType* >( nodes_.Origin() ), parent_, level_ ), grey.DataType() );
+   offsets = {};
+   dip::uint nNodes = parent_.size();
+
+   // Compute node attributes: first the contribution of the pixels that belong to each node...
+   dip::uint nM2 = nDims * ( nDims + 1 ) / 2;
+   area_.assign( nNodes, 0 );
+   volume_.assign( nNodes, 0.0 );
+   bbLower_.assign( nNodes * nDims, std::numeric_limits< dip::uint >::max() );
+   bbUpper_.assign( nNodes * nDims, 0 );
+   m1_.assign( nNodes * nDims, 0.0 );
+   m2_.assign( nNodes * nM2, 0.0 );
+   ImageIterator< LabelType > it( { nodes_ } );
+   do {
+      dip::uint node = *it;
+      UnsignedArray const& coords = it.Coordinates();
+      ++area_[ node ];
+      dip::uint* lower = bbLower_.data() + node * nDims;
+      dip::uint* upper = bbUpper_.data() + node * nDims;
+      dfloat* m1 = m1_.data() + node * nDims;
+      dfloat* m2 = m2_.data() + node * nM2;
+      for( dip::uint ii = 0; ii < nDims; ++ii ) {
+         lower[ ii ] = std::min( lower[ ii ], coords[ ii ] );
+         upper[ ii ] = std::max( upper[ ii ], coords[ ii ] );
+         dfloat pos = static_cast< dfloat >( coords[ ii ] );
+         m1[ ii ] += pos;
+         m2[ ii ] += pos * pos;
+      }
+      for( dip::uint ii = 1, kk = nDims; ii < nDims; ++ii ) {
+         for( dip::uint jj = 0; jj < ii; ++jj, ++kk ) {
+            m2[ kk ] += static_cast< dfloat >( coords[ ii ] ) * static_cast< dfloat >( coords[ jj ] );
+         }
+      }
+   } while( ++it );
+   // ...then add each node's values to its parent, children are always processed before their parent
+   for( dip::uint node = nNodes - 1; node > 0; --node ) {
+      dip::uint p = parent_[ node ];
+      area_[ p ] += area_[ node ];
+      volume_[ p ] += volume_[ node ] + static_cast< dfloat >( area_[ node ] ) * std::abs( level_[ node ] - level_[ p ] );
+      for( dip::uint ii = 0; ii < nDims; ++ii ) {
+         bbLower_[ p * nDims + ii ] = std::min( bbLower_[ p * nDims + ii ], bbLower_[ node * nDims + ii ] );
+         bbUpper_[ p * nDims + ii ] = std::max( bbUpper_[ p * nDims + ii ], bbUpper_[ node * nDims + ii ] );
+         m1_[ p * nDims + ii ] += m1_[ node * nDims + ii ];
+      }
+      for( dip::uint ii = 0; ii < nM2; ++ii ) {
+         m2_[ p * nM2 + ii ] += m2_[ node * nM2 + ii ];
+      }
+   }
+}
+
+RangeArray MaxTree::BoundingBox( NodeIndex node ) const {
+   DIP_THROW_IF( node >= NumberOfNodes(), E::INDEX_OUT_OF_RANGE );
+   dip::uint nDims = nodes_.Dimensionality();
+   RangeArray out( nDims );
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      out[ ii ] = Range{ static_cast< dip::sint >( bbLower_[ node * nDims + ii ] ),
+                         static_cast< dip::sint >( bbUpper_[ node * nDims + ii ] ) };
+   }
+   return out;
+}
+
+FloatArray MaxTree::Centroid( NodeIndex node ) const {
+   DIP_THROW_IF( node >= NumberOfNodes(), E::INDEX_OUT_OF_RANGE );
+   dip::uint nDims = nodes_.Dimensionality();
+   FloatArray out( nDims );
+   dfloat area = static_cast< dfloat >( area_[ node ] );
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      out[ ii ] = m1_[ node * nDims + ii ] / area;
+   }
+   return out;
+}
+
+FloatArray MaxTree::SecondOrderCentralMoments( NodeIndex node ) const {
+   DIP_THROW_IF( node >= NumberOfNodes(), E::INDEX_OUT_OF_RANGE );
+   dip::uint nDims = nodes_.Dimensionality();
+   dip::uint nM2 = nDims * ( nDims + 1 ) / 2;
+   FloatArray mean = Centroid( node );
+   FloatArray out( nM2 );
+   dfloat area = static_cast< dfloat >( area_[ node ] );
+   dfloat const* m2 = m2_.data() + node * nM2;
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      out[ ii ] = m2[ ii ] / area - mean[ ii ] * mean[ ii ];
+   }
+   for( dip::uint ii = 1, kk = nDims; ii < nDims; ++ii ) {
+      for( dip::uint jj = 0; jj < ii; ++jj, ++kk ) {
+         out[ kk ] = m2[ kk ] / area - mean[ ii ] * mean[ jj ];
+      }
+   }
+   return out;
+}
+
+void MaxTree::Filter( std::vector< bool > const& keep, Image& out ) const {
+   DIP_THROW_IF( !nodes_.IsForged(), "The tree is empty" );
+   DIP_THROW_IF( keep.size() != NumberOfNodes(), E::ARRAY_PARAMETER_WRONG_LENGTH );
+   // Compute the output value for each node, parents are always processed before their children
+   dip::uint nNodes = NumberOfNodes();
+   std::vector< dfloat > value( nNodes );
+   value[ 0 ] = level_[ 0 ];
+   for( dip::uint node = 1; node < nNodes; ++node ) {
+      value[ node ] = keep[ node ] ? level_[ node ] : value[ parent_[ node ]];
+   }
+   // Paint the output image
+   Image tmp( nodes_.Sizes(), 1, DT_DFLOAT );
+   DIP_ASSERT( tmp.HasNormalStrides() );
+   LabelType const* nodes = static_cast< LabelType const* >( nodes_.Origin() );
+   dfloat* dest = static_cast< dfloat* >( tmp.Origin() );
+   dip::uint nPixels = nodes_.NumberOfPixels();
+   dip::uint nThreads = nPixels < threadingThreshold ? 1 : GetNumberOfThreads();
+   #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( static )
+   for( dip::sint ii = 0; ii < static_cast< dip::sint >( nPixels ); ++ii ) {
+      dest[ ii ] = value[ nodes[ ii ]];
+   }
+   DIP_STACK_TRACE_THIS( Convert( tmp, out, dataType_ ));
+   out.SetPixelSize( pixelSize_ );
+}
+
+void MaxTree::AreaFilter( dip::uint filterSize, Image& out ) const {
+   std::vector< bool > keep( NumberOfNodes() );
+   for( dip::uint node = 0; node < NumberOfNodes(); ++node ) {
+      keep[ node ] = area_[ node ] >= filterSize;
+   }
+   DIP_STACK_TRACE_THIS( Filter( keep, out ));
+}
+
+} // namespace dip
+
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/linear.h"
+#include "diplib/morphology.h"
+#include "diplib/random.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing dip::MaxTree" ) {
+   // A small image with known structure
+   dip::Image img( { 7, 3 }, 1, dip::DT_UINT8 );
+   img.Fill( 0 );
+   img.At( 1, 1 ) = 5;
+   img.At( 2, 1 ) = 5;
+   img.At( 4, 1 ) = 3;
+   img.At( 5, 1 ) = 8;
+   dip::MaxTree tree( img, 1, dip::S::OPENING );
+   DOCTEST_REQUIRE( tree.NumberOfNodes() == 4 );
+   DOCTEST_CHECK( tree.Level( tree.Root() ) == 0 );
+   DOCTEST_CHECK( tree.Area( tree.Root() ) == 21 );
+   DOCTEST_CHECK( tree.Volume( tree.Root() ) == 21 );
+   dip::MaxTree::NodeIndex node = tree.Node( { 5, 1 } );
+   DOCTEST_CHECK( tree.Level( node ) == 8 );
+   DOCTEST_CHECK( tree.Area( node ) == 1 );
+   dip::MaxTree::NodeIndex parent = tree.Parent( node );
+   DOCTEST_CHECK( parent == tree.Node( { 4, 1 } ));
+   DOCTEST_CHECK( tree.Level( parent ) == 3 );
+   DOCTEST_CHECK( tree.Area( parent ) == 2 );
+   DOCTEST_CHECK( tree.Volume( parent ) == 5 );
+   DOCTEST_CHECK( tree.Parent( parent ) == tree.Root() );
+   node = tree.Node( { 1, 1 } );
+   DOCTEST_CHECK( tree.Area( node ) == 2 );
+   DOCTEST_CHECK( tree.BoundingBox( node )[ 0 ].start == 1 );
+   DOCTEST_CHECK( tree.BoundingBox( node )[ 0 ].stop == 2 );
+   DOCTEST_CHECK( tree.Centroid( node )[ 0 ] == doctest::Approx( 1.5 ));
+   DOCTEST_CHECK( tree.SecondOrderCentralMoments( node )[ 0 ] == doctest::Approx( 0.25 ));
+   DOCTEST_CHECK( tree.SecondOrderCentralMoments( node )[ 1 ] == doctest::Approx( 0.0 ));
+   dip::Image out = tree.AreaFilter( 2 );
+   DOCTEST_CHECK( out.At( 5, 1 ) == 3 );
+   DOCTEST_CHECK( out.At( 1, 1 ) == 5 );
+   dip::MaxTree minTree( img, 1, dip::S::CLOSING );
+   DOCTEST_CHECK( minTree.IsMinTree() );
+   DOCTEST_CHECK( minTree.Level( minTree.Root() ) == 8 );
+   DOCTEST_CHECK( minTree.Area( minTree.Node( { 0, 0 } )) == 17 );
+
+   // The area filter produces the same result as dip::AreaOpening, and the tree does not depend on the number of threads
+   dip::Random random( 0 );
+   dip::uint maxThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 );
+   dip::Image in2D( { 300, 280 }, 1, dip::DT_SFLOAT );
+   in2D.Fill( 0 );
+   dip::UniformNoise( in2D, in2D, random, 0, 100 );
+   dip::Gauss( in2D, in2D, { 2 } );
+   dip::Image in3D( { 50, 40, 40 }, 1, dip::DT_SFLOAT );
+   in3D.Fill( 0 );
+   dip::UniformNoise( in3D, in3D, random, 0, 100 );
+   dip::Gauss( in3D, in3D, { 1 } );
+   dip::SetNumberOfThreads( maxThreads );
+   for( auto const& in : { in2D, in3D, dip::Image( dip::Convert( in2D, dip::DT_UINT8 )), dip::Image( dip::Convert( in3D, dip::DT_UINT8 )) } ) {
+      for( auto const& polarity : { dip::S::OPENING, dip::S::CLOSING } ) {
+         for( dip::uint connectivity = 1; connectivity <= in.Dimensionality(); ++connectivity ) {
+            dip::MaxTree tree( in, connectivity, polarity );
+            dip::SetNumberOfThreads( 1 );
+            dip::MaxTree ref( in, connectivity, polarity );
+            dip::SetNumberOfThreads( maxThreads );
+            DOCTEST_REQUIRE( tree.NumberOfNodes() == ref.NumberOfNodes() );
+            DOCTEST_CHECK( dip::testing::CompareImages( tree.Nodes(), ref.Nodes(), dip::Option::CompareImagesMode::EXACT ));
+            bool same = true;
+            for( dip::uint node = 0; node < tree.NumberOfNodes(); ++node ) {
+               same &= tree.Parent( node ) == ref.Parent( node );
+               same &= ( tree.Parent( node ) < node ) || ( node == 0 );
+               same &= tree.Area( node ) == ref.Area( node );
+            }
+            DOCTEST_CHECK( same );
+            DOCTEST_CHECK( tree.Area( tree.Root() ) == in.NumberOfPixels() );
+            for( dip::uint filterSize : std::vector< dip::uint >{ 10, 100 } ) {
+               dip::Image out = tree.AreaFilter( filterSize );
+               dip::Image expected = dip::AreaOpening( in, {}, filterSize, connectivity, polarity );
+               DOCTEST_CHECK( dip::testing::CompareImages( out, expected, dip::Option::CompareImagesMode::EXACT ));
+            }
+         }
+      }
+   }
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -17,6 +17,7 @@
 
 #include "diplib/morphology.h"
 
+#include <algorithm>
 #include <limits>
 #include <queue>
 #include <utility>
@@ -27,6 +28,7 @@
 #include "diplib/generation.h"
 #include "diplib/iterators.h"
 #include "diplib/math.h"
+#include "diplib/multithreading.h"
 #include "diplib/neighborlist.h"
 #include "diplib/overload.h"
 
@@ -61,116 +63,153 @@ inline void markProcessed( uint8& flag ) {
    flag |= PROCESSED_MASK;
 }
 
+// Forward raster pass, propagate values forward (to the right and down). `out_img` can be a slab of the image,
+// `in`, `out` and `flag` point at the origin of the full image. If `isSlab`, the first and last image lines
+// along the last dimension of `out_img` are treated as if they were on the image border, so that no pixels
+// outside `out_img` are accessed.
 template< typename TPI >
-void MorphologicalReconstructionInternal(
-      Image const& in_img,
-      Image& out_img,
-      Image& flag_img,
-      IntegerArray const& neighborOffsets,
+void ForwardRasterPass(
+      TPI const* in,
+      TPI const* out,
+      uint8 const* flag,
+      Image const& out_img,
       NeighborList const& neighborList,
+      NeighborList const& backwardNeighbors,
+      bool isSlab,
       bool dilation
 ) {
-   auto QitemComparator = dilation ? QitemComparator_HighFirst< TPI > : QitemComparator_LowFirst< TPI >;
-   std::priority_queue< Qitem< TPI >, std::vector< Qitem< TPI >>, decltype( QitemComparator ) > Q( QitemComparator );
-
-   dip::uint nNeigh = neighborList.Size();
-   UnsignedArray const& imsz = in_img.Sizes();
-   NeighborList backwardNeighbors = neighborList.SelectBackward();
-
-   TPI* in = static_cast< TPI* >( in_img.Origin() );
-   TPI* out = static_cast< TPI* >( out_img.Origin() );
-   uint8* flag = static_cast< uint8* >( flag_img.Origin() ); // It's binary, but we use other bit planes too.
-
-   // Step 1: Forward raster pass, propagate values forward (to the right and down)
-   {
-      IntegerArray backwardOffsets = backwardNeighbors.ComputeOffsets( out_img.Strides() );
-      ImageIterator< TPI > it( { out_img } );
-      do {
-         dip::sint offset = it.Offset();
-         TPI val = *it;
-         if( isBorder( flag[ offset ] )) {
-            if( dilation ) {
-               for( dip::uint ii = 0; ii < backwardOffsets.size(); ++ii ) {
-                  if( neighborList.IsInImage( ii, it.Coordinates(), imsz )) {
-                     val = std::max( val, it.Pointer()[ backwardOffsets[ ii ]] );
-                  }
-               }
-               val = std::min( val, in[ offset ] );
-            } else {
-               for( dip::uint ii = 0; ii < backwardOffsets.size(); ++ii ) {
-                  if( neighborList.IsInImage( ii, it.Coordinates(), imsz )) {
-                     val = std::min( val, it.Pointer()[ backwardOffsets[ ii ]] );
-                  }
+   UnsignedArray const& imsz = out_img.Sizes();
+   dip::uint lastDim = imsz.size() - 1;
+   IntegerArray backwardOffsets = backwardNeighbors.ComputeOffsets( out_img.Strides() );
+   ImageIterator< TPI > it( { out_img } );
+   do {
+      dip::sint offset = it.Pointer() - out;
+      TPI val = *it;
+      if( isBorder( flag[ offset ] ) ||
+          ( isSlab && (( it.Coordinates()[ lastDim ] == 0 ) || ( it.Coordinates()[ lastDim ] == imsz[ lastDim ] - 1 )))) {
+         if( dilation ) {
+            for( dip::uint ii = 0; ii < backwardOffsets.size(); ++ii ) {
+               if( neighborList.IsInImage( ii, it.Coordinates(), imsz )) {
+                  val = std::max( val, it.Pointer()[ backwardOffsets[ ii ]] );
                }
-               val = std::max( val, in[ offset ] );
-            }
-            if( *it != val ) {
-               *it = val;
             }
+            val = std::min( val, in[ offset ] );
          } else {
-            if( dilation ) {
-               for( auto n : backwardOffsets ) {
-                  val = std::max( val, it.Pointer()[ n ] );
-               }
-               val = std::min( val, in[ offset ] );
-            } else {
-               for( auto n : backwardOffsets ) {
-                  val = std::min( val, it.Pointer()[ n ] );
-               }
-               val = std::max( val, in[ offset ] );
-            }
-            if( *it != val ) {
-               *it = val;
-            }
-         }
-      } while( ++it );
-   }
-
-   // Step 2: Backward raster pass, propagate values backward (to the left and up), and enqueue pixels where we could
-   //         propagate from in Step 3
-   {
-      Image out_img_mirrored = out_img.QuickCopy();
-      out_img_mirrored.Mirror(); // a forward raster scan in a mirrored image is a backward raster scan in the original image
-      IntegerArray backwardOffsets = backwardNeighbors.ComputeOffsets( out_img_mirrored.Strides() );
-      ImageIterator< TPI > it( { out_img_mirrored } );
-      do {
-         dip::sint offset = it.Pointer() - out; // The offset in the original image, so we can use it to index into `flag`
-         TPI val = *it;
-         TPI maxNeighborValue = std::numeric_limits< TPI >::lowest();
-         TPI minNeighborValue = std::numeric_limits< TPI >::max();
-         if( isBorder( flag[ offset ] )) {
             for( dip::uint ii = 0; ii < backwardOffsets.size(); ++ii ) {
                if( neighborList.IsInImage( ii, it.Coordinates(), imsz )) {
-                  TPI v = it.Pointer()[ backwardOffsets[ ii ]];
-                  maxNeighborValue = std::max( maxNeighborValue, v );
-                  minNeighborValue = std::min( minNeighborValue, v );
+                  val = std::min( val, it.Pointer()[ backwardOffsets[ ii ]] );
                }
             }
-         } else {
-            for( auto n : backwardOffsets ) {
-               TPI v = it.Pointer()[ n ];
-               maxNeighborValue = std::max( maxNeighborValue, v );
-               minNeighborValue = std::min( minNeighborValue, v );
-            }
+            val = std::max( val, in[ offset ] );
          }
+         if( *it != val ) {
+            *it = val;
+         }
+      } else {
          if( dilation ) {
-            val = std::max( val, maxNeighborValue );
+            for( auto n : backwardOffsets ) {
+               val = std::max( val, it.Pointer()[ n ] );
+            }
             val = std::min( val, in[ offset ] );
          } else {
-            val = std::min( val, minNeighborValue );
+            for( auto n : backwardOffsets ) {
+               val = std::min( val, it.Pointer()[ n ] );
+            }
             val = std::max( val, in[ offset ] );
          }
          if( *it != val ) {
             *it = val;
-            // Enqueue only if pixels in the backward direction might be propagated into (the forward pixels we'll
-            // be propagating into later in this raster scan).
-            if( dilation ? ( minNeighborValue < val ) : ( maxNeighborValue > val )) {
-               Q.push( Qitem< TPI >{ val, offset } );
-               // TODO: we are still enqueueing too many elements, we have not checked to see if the neighbor can be incremented
+         }
+      }
+   } while( ++it );
+}
+
+// Backward raster pass, propagate values backward (to the left and up), and call `enqueue( value, offset )` for
+// pixels where we could propagate from in a queue-based pass. Parameters as for `ForwardRasterPass`.
+template< typename TPI, typename F >
+void BackwardRasterPass(
+      TPI const* in,
+      TPI const* out,
+      uint8 const* flag,
+      Image const& out_img,
+      NeighborList const& neighborList,
+      NeighborList const& backwardNeighbors,
+      bool isSlab,
+      bool dilation,
+      F const& enqueue
+) {
+   UnsignedArray const& imsz = out_img.Sizes();
+   dip::uint lastDim = imsz.size() - 1;
+   Image out_img_mirrored = out_img.QuickCopy();
+   out_img_mirrored.Mirror(); // a forward raster scan in a mirrored image is a backward raster scan in the original image
+   IntegerArray backwardOffsets = backwardNeighbors.ComputeOffsets( out_img_mirrored.Strides() );
+   ImageIterator< TPI > it( { out_img_mirrored } );
+   do {
+      dip::sint offset = it.Pointer() - out; // The offset in the original image, so we can use it to index into `flag`
+      TPI val = *it;
+      TPI maxNeighborValue = std::numeric_limits< TPI >::lowest();
+      TPI minNeighborValue = std::numeric_limits< TPI >::max();
+      if( isBorder( flag[ offset ] ) ||
+          ( isSlab && (( it.Coordinates()[ lastDim ] == 0 ) || ( it.Coordinates()[ lastDim ] == imsz[ lastDim ] - 1 )))) {
+         for( dip::uint ii = 0; ii < backwardOffsets.size(); ++ii ) {
+            if( neighborList.IsInImage( ii, it.Coordinates(), imsz )) {
+               TPI v = it.Pointer()[ backwardOffsets[ ii ]];
+               maxNeighborValue = std::max( maxNeighborValue, v );
+               minNeighborValue = std::min( minNeighborValue, v );
             }
          }
-      } while( ++it );
-   }
+      } else {
+         for( auto n : backwardOffsets ) {
+            TPI v = it.Pointer()[ n ];
+            maxNeighborValue = std::max( maxNeighborValue, v );
+            minNeighborValue = std::min( minNeighborValue, v );
+         }
+      }
+      if( dilation ) {
+         val = std::max( val, maxNeighborValue );
+         val = std::min( val, in[ offset ] );
+      } else {
+         val = std::min( val, minNeighborValue );
+         val = std::max( val, in[ offset ] );
+      }
+      if( *it != val ) {
+         *it = val;
+         // Enqueue only if pixels in the backward direction might be propagated into (the forward pixels we'll
+         // be propagating into later in this raster scan).
+         if( dilation ? ( minNeighborValue < val ) : ( maxNeighborValue > val )) {
+            enqueue( val, offset );
+            // TODO: we are still enqueueing too many elements, we have not checked to see if the neighbor can be incremented
+         }
+      }
+   } while( ++it );
+}
+
+template< typename TPI >
+void MorphologicalReconstructionInternal(
+      Image const& in_img,
+      Image& out_img,
+      Image& flag_img,
+      IntegerArray const& neighborOffsets,
+      NeighborList const& neighborList,
+      bool dilation
+) {
+   auto QitemComparator = dilation ? QitemComparator_HighFirst< TPI > : QitemComparator_LowFirst< TPI >;
+   std::priority_queue< Qitem< TPI >, std::vector< Qitem< TPI >>, decltype( QitemComparator ) > Q( QitemComparator );
+
+   dip::uint nNeigh = neighborList.Size();
+   UnsignedArray const& imsz = in_img.Sizes();
+   NeighborList backwardNeighbors = neighborList.SelectBackward();
+
+   TPI* in = static_cast< TPI* >( in_img.Origin() );
+   TPI* out = static_cast< TPI* >( out_img.Origin() );
+   uint8* flag = static_cast< uint8* >( flag_img.Origin() ); // It's binary, but we use other bit planes too.
+
+   // Step 1: Forward raster pass
+   ForwardRasterPass( in, out, flag, out_img, neighborList, backwardNeighbors, false, dilation );
+
+   // Step 2: Backward raster pass, enqueue pixels where we could propagate from in Step 3
+   BackwardRasterPass( in, out, flag, out_img, neighborList, backwardNeighbors, false, dilation,
+                       [ & ]( TPI val, dip::sint offset ) { Q.push( Qitem< TPI >{ val, offset } ); } );
 
    // Step 3: Priority queue pass, propagate values in every direction from the pixels on the queue.
    auto coordinatesComputer = out_img.OffsetToCoordinatesComputer();
@@ -219,6 +258,102 @@ void MorphologicalReconstructionInternal(
    //std::cout << "nDoubleEnqueue = " << nDoubleEnqueue << '\n';
 }
 
+// Vincent's hybrid algorithm: the raster passes are computed independently for slabs of the image along the last
+// dimension, in parallel. The pixels that can propagate after these passes, including those on either side of
+// slab boundaries, are propagated from using a FIFO queue. Pixels can be visited more than once, but in practice
+// the queue is short. The result is the same as that of `MorphologicalReconstructionInternal`.
+template< typename TPI >
+void MorphologicalReconstructionHybrid(
+      Image const& in_img,
+      Image& out_img,
+      Image& flag_img,
+      IntegerArray const& neighborOffsets,
+      NeighborList const& neighborList,
+      bool dilation
+) {
+   dip::uint nNeigh = neighborList.Size();
+   UnsignedArray const& imsz = in_img.Sizes();
+   dip::uint lastDim = imsz.size() - 1;
+   NeighborList backwardNeighbors = neighborList.SelectBackward();
+
+   TPI* in = static_cast< TPI* >( in_img.Origin() );
+   TPI* out = static_cast< TPI* >( out_img.Origin() );
+   uint8* flag = static_cast< uint8* >( flag_img.Origin() );
+
+   // Steps 1 and 2: Forward and backward raster passes, each thread processes one or more slabs
+   dip::uint nSlabs = out_img.NumberOfPixels() < threadingThreshold ? 1 : std::min( GetNumberOfThreads(), imsz[ lastDim ] );
+   std::vector< std::vector< dip::sint >> slabQueues( nSlabs );
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nSlabs ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      for( dip::uint slab = thread; slab < nSlabs; slab += nThreads ) {
+         RangeArray ranges( imsz.size() );
+         ranges[ lastDim ] = Range{ static_cast< dip::sint >( slab * imsz[ lastDim ] / nSlabs ),
+                                    static_cast< dip::sint >(( slab + 1 ) * imsz[ lastDim ] / nSlabs ) - 1 };
+         Image slab_img = out_img.At( ranges );
+         bool isSlab = nSlabs > 1;
+         ForwardRasterPass( in, out, flag, slab_img, neighborList, backwardNeighbors, isSlab, dilation );
+         std::vector< dip::sint >& queue = slabQueues[ slab ];
+         BackwardRasterPass( in, out, flag, slab_img, neighborList, backwardNeighbors, isSlab, dilation,
+                             [ & ]( TPI, dip::sint offset ) { queue.push_back( offset ); } );
+      }
+   DIP_PARALLEL_ERROR_END
+
+   // Pixels on either side of slab boundaries
+   std::vector< dip::sint > queue;
+   for( auto& q : slabQueues ) {
+      queue.insert( queue.end(), q.begin(), q.end() );
+      q = {};
+   }
+   for( dip::uint slab = 1; slab < nSlabs; ++slab ) {
+      dip::sint pos = static_cast< dip::sint >( slab * imsz[ lastDim ] / nSlabs );
+      for( dip::sint pp = pos - 1; pp <= pos; ++pp ) {
+         RangeArray ranges( imsz.size() );
+         ranges[ lastDim ] = Range{ pp };
+         Image line = out_img.At( ranges );
+         ImageIterator< TPI > it( { line } );
+         do {
+            queue.push_back( it.Pointer() - out );
+         } while( ++it );
+      }
+   }
+
+   // Step 3: FIFO queue pass, propagate values in every direction from the pixels on the queue.
+   auto coordinatesComputer = out_img.OffsetToCoordinatesComputer();
+   std::vector< dip::sint > next;
+   while( !queue.empty() ) {
+      for( dip::sint offset : queue ) {
+         // Compute coordinates if we're a border pixel
+         UnsignedArray coords;
+         bool onBorder = isBorder( flag[ offset ] );
+         if( onBorder ) {
+            coords = coordinatesComputer( offset );
+         }
+         TPI val = out[ offset ];
+         for( dip::uint jj = 0; jj < nNeigh; ++jj ) {
+            if( !onBorder || neighborList.IsInImage( jj, coords, imsz )) { // test IsInImage only for border pixels
+               dip::sint nOffset = offset + neighborOffsets[ jj ];
+               if( dilation ) {
+                  if(( out[ nOffset ] < val ) && ( out[ nOffset ] < in[ nOffset ] )) {
+                     out[ nOffset ] = std::min( val, in[ nOffset ] );
+                     next.push_back( nOffset );
+                  }
+               } else {
+                  if(( out[ nOffset ] > val ) && ( out[ nOffset ] > in[ nOffset ] )) {
+                     out[ nOffset ] = std::max( val, in[ nOffset ] );
+                     next.push_back( nOffset );
+                  }
+               }
+            }
+         }
+      }
+      queue.swap( next );
+      next.clear();
+   }
+}
+
 } // namespace
 
 void MorphologicalReconstruction (
@@ -226,7 +361,8 @@ void MorphologicalReconstruction (
       Image const& c_in, // grey-value mask
       Image& out,
       dip::uint connectivity,
-      String const& direction
+      String const& direction,
+      String const& method
 ) {
    // Check input
    DIP_THROW_IF( !c_marker.IsForged() || !c_in.IsForged(), E::IMAGE_NOT_FORGED );
@@ -238,6 +374,8 @@ void MorphologicalReconstruction (
    DIP_THROW_IF( connectivity > nDims, E::ILLEGAL_CONNECTIVITY );
    bool dilation{};
    DIP_STACK_TRACE_THIS( dilation = BooleanFromString( direction, S::DILATION, S::EROSION ));
+   bool hybrid{};
+   DIP_STACK_TRACE_THIS( hybrid = BooleanFromString( method, S::HYBRID, S::PRIORITY_QUEUE ));
 
    if( c_in.DataType().IsBinary() && c_marker.DataType().IsBinary() ) {
       if( dilation ) {
@@ -311,9 +449,15 @@ void MorphologicalReconstruction (
    IntegerArray neighborOffsets = neighborList.ComputeOffsets( fout.Strides() );
 
    // Do the data-type-dependent thing
-   DIP_OVL_CALL_REAL( MorphologicalReconstructionInternal,
-                            ( in, fout, flag, neighborOffsets, neighborList, dilation ),
-                            in.DataType() );
+   if( hybrid ) {
+      DIP_OVL_CALL_REAL( MorphologicalReconstructionHybrid,
+                               ( in, fout, flag, neighborOffsets, neighborList, dilation ),
+                               in.DataType() );
+   } else {
+      DIP_OVL_CALL_REAL( MorphologicalReconstructionInternal,
+                               ( in, fout, flag, neighborOffsets, neighborList, dilation ),
+                               in.DataType() );
+   }
    out.SetPixelSize( std::move( pixelSize ));
 }
 
@@ -323,7 +467,8 @@ void LimitedMorphologicalReconstruction(
       Image& out,
       dfloat maxDistance,
       dip::uint connectivity,
-      String const& direction
+      String const& direction,
+      String const& method
 ) {
    DIP_THROW_IF( maxDistance < 1, E::INVALID_PARAMETER );
    bool dilation{};
@@ -336,14 +481,15 @@ void LimitedMorphologicalReconstruction(
       DIP_STACK_TRACE_THIS( Erosion( marker, mask, { 2 * maxDistance, S::ELLIPTIC } ));
       Supremum( mask, in, mask );
    }
-   DIP_STACK_TRACE_THIS( MorphologicalReconstruction( marker, mask, out, connectivity, direction ));
+   DIP_STACK_TRACE_THIS( MorphologicalReconstruction( marker, mask, out, connectivity, direction, method ));
 }
 
 void ImposeMinima(
       Image const& in,
       Image const& marker,
       Image& out,
-      dip::uint connectivity
+      dip::uint connectivity,
+      String const& method
 ) {
    DIP_THROW_IF( !in.IsForged() || !marker.IsForged(), E::IMAGE_NOT_FORGED );
    DIP_THROW_IF( !in.IsScalar() || !marker.IsScalar(), E::IMAGE_NOT_SCALAR );
@@ -366,7 +512,78 @@ void ImposeMinima(
       DIP_STACK_TRACE_THIS( Supremum( gray, Image( floor ), gray ));
    }
    Infimum( gray, seed, gray );
-   DIP_STACK_TRACE_THIS( MorphologicalReconstruction( seed, gray, out, connectivity, S::EROSION ));
+   DIP_STACK_TRACE_THIS( MorphologicalReconstruction( seed, gray, out, connectivity, S::EROSION, method ));
 }
 
 } // namespace dip
+
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/linear.h"
+#include "diplib/random.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing dip::MorphologicalReconstruction" ) {
+   dip::Random random( 0 );
+   dip::uint maxThreads = dip::GetNumberOfThreads();
+   dip::SetNumberOfThreads( 1 ); // Make sure the input images are the same independently of the number of threads
+   dip::Image in2D( { 300, 260 }, 1, dip::DT_SFLOAT );
+   in2D.Fill( 0 );
+   dip::UniformNoise( in2D, in2D, random, 0, 100 );
+   dip::Gauss( in2D, in2D, { 2 } );
+   dip::Image in3D( { 60, 50, 40 }, 1, dip::DT_SFLOAT );
+   in3D.Fill( 0 );
+   dip::UniformNoise( in3D, in3D, random, 0, 100 );
+   dip::Gauss( in3D, in3D, { 2 } );
+   dip::Image in1D( { 100 }, 1, dip::DT_SFLOAT );
+   in1D.Fill( 0 );
+   dip::UniformNoise( in1D, in1D, random, 0, 100 );
+   dip::SetNumberOfThreads( maxThreads );
+   for( auto const& in : { in1D, in2D, in3D, dip::Image( dip::Convert( in2D, dip::DT_UINT8 )) } ) {
+      for( dip::uint connectivity = 0; connectivity <= in.Dimensionality(); ++connectivity ) {
+         // Reconstruction by dilation
+         dip::Image marker = in - 3;
+         dip::Image ref = dip::MorphologicalReconstruction( marker, in, connectivity, dip::S::DILATION, dip::S::PRIORITY_QUEUE );
+         dip::Image out = dip::MorphologicalReconstruction( marker, in, connectivity, dip::S::DILATION, dip::S::HYBRID );
+         DOCTEST_CHECK( dip::testing::CompareImages( out, ref, dip::Option::CompareImagesMode::EXACT ));
+         dip::SetNumberOfThreads( 1 );
+         out = dip::MorphologicalReconstruction( marker, in, connectivity, dip::S::DILATION, dip::S::HYBRID );
+         dip::SetNumberOfThreads( maxThreads );
+         DOCTEST_CHECK( dip::testing::CompareImages( out, ref, dip::Option::CompareImagesMode::EXACT ));
+         // Reconstruction by erosion
+         marker = in + 3;
+         ref = dip::MorphologicalReconstruction( marker, in, connectivity, dip::S::EROSION, dip::S::PRIORITY_QUEUE );
+         out = dip::MorphologicalReconstruction( marker, in, connectivity, dip::S::EROSION, dip::S::HYBRID );
+         DOCTEST_CHECK( dip::testing::CompareImages( out, ref, dip::Option::CompareImagesMode::EXACT ));
+         DOCTEST_CHECK( dip::testing::CompareImages( dip::Supremum( out, in ), out, dip::Option::CompareImagesMode::EXACT ));
+      }
+   }
+   // A single seed fills the whole image
+   dip::Image in( { 200, 400 }, 1, dip::DT_UINT8 );
+   in.Fill( 10 );
+   dip::Image marker = in.Similar();
+   marker.Fill( 0 );
+   marker.At( 100, 399 ) = 10;
+   dip::Image out = dip::MorphologicalReconstruction( marker, in, 1, dip::S::DILATION, dip::S::HYBRID );
+   DOCTEST_CHECK( dip::testing::CompareImages( out, in, dip::Option::CompareImagesMode::EXACT ));
+
+   // The functions that use dip::MorphologicalReconstruction produce the same output with both methods
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::HMaxima( in2D, 5, 2, dip::S::HYBRID ),
+                                               dip::HMaxima( in2D, 5, 2, dip::S::PRIORITY_QUEUE ),
+                                               dip::Option::CompareImagesMode::EXACT ));
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::HMinima( in3D, 5, 1, dip::S::HYBRID ),
+                                               dip::HMinima( in3D, 5, 1, dip::S::PRIORITY_QUEUE ),
+                                               dip::Option::CompareImagesMode::EXACT ));
+   marker = in2D - 10;
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::LimitedMorphologicalReconstruction( marker, in2D, 5, 1, dip::S::DILATION, dip::S::HYBRID ),
+                                               dip::LimitedMorphologicalReconstruction( marker, in2D, 5, 1, dip::S::DILATION, dip::S::PRIORITY_QUEUE ),
+                                               dip::Option::CompareImagesMode::EXACT ));
+   dip::Image seeds = dip::Minima( in2D, 2 );
+   dip::Image imposed = dip::ImposeMinima( in2D, seeds, 2, dip::S::HYBRID );
+   DOCTEST_CHECK( dip::testing::CompareImages( imposed, dip::ImposeMinima( in2D, seeds, 2, dip::S::PRIORITY_QUEUE ),
+                                               dip::Option::CompareImagesMode::EXACT ));
+   DOCTEST_CHECK( dip::testing::CompareImages( dip::Minima( imposed, 2 ), seeds, dip::Option::CompareImagesMode::EXACT ));
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
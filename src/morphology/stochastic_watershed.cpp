@@ -31,6 +31,7 @@
 #include "diplib/graph.h"
 #include "diplib/linear.h"
 #include "diplib/math.h"
+#include "diplib/multithreading.h"
 #include "diplib/random.h"
 #include "diplib/union_find.h"
 
@@ -566,21 +567,85 @@ void StochasticWatershed(
    }
    out.ReForge( in, DT_LABEL, Option::AcceptDataTypeChange::DO_ALLOW );
    out.Fill( 0 );
-   Image grid = in.Similar( DT_BIN );
-   Image edges = in.Similar( DT_BIN );
-   Image noisy = noise > 0.0 ? in.Similar( DataType::SuggestFloat( in.DataType() )) : in.QuickCopy();
+   // Each iteration gets its own random stream, such that the result doesn't depend on how the iterations are
+   // distributed over the threads.
+   std::vector< Random > randomArray;
+   randomArray.reserve( nIterations );
    for( dip::uint iter = 0; iter < nIterations; ++iter ) {
-      if( poisson ) {
-         FillPoissonPointProcess( grid, random, density );
-      } else {
-         FillRandomGrid( grid, random, density, seeds, S::ROTATION );
-      }
-      if( noise > 0.0 ) {
-         UniformNoise( in, noisy, random, 0.0, noise );
+      randomArray.push_back( random.Split() );
+   }
+   // Iterations run in parallel, each thread accumulates edges in its own image. Within the parallel section,
+   // the functions we call are single-threaded, so that their use of the random streams is deterministic.
+   dip::uint nThreads = std::min( GetNumberOfThreads(), nIterations );
+   std::vector< Image > counts( nThreads );
+   counts[ 0 ] = out.QuickCopy();
+   for( dip::uint ii = 1; ii < nThreads; ++ii ) {
+      counts[ ii ] = out.Similar();
+      counts[ ii ].Fill( 0 );
+   }
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nActualThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      dip::uint maxThreads = GetNumberOfThreads();
+      SetNumberOfThreads( 1 );
+      try {
+         Image grid = in.Similar( DT_BIN );
+         Image edges = in.Similar( DT_BIN );
+         Image noisy = noise > 0.0 ? in.Similar( DataType::SuggestFloat( in.DataType() )) : in.QuickCopy();
+         for( dip::uint iter = thread; iter < nIterations; iter += nActualThreads ) {
+            Random& iterRandom = randomArray[ iter ];
+            if( poisson ) {
+               FillPoissonPointProcess( grid, iterRandom, density );
+            } else {
+               FillRandomGrid( grid, iterRandom, density, seeds, S::ROTATION );
+            }
+            if( noise > 0.0 ) {
+               UniformNoise( in, noisy, iterRandom, 0.0, noise );
+            }
+            SeededWatershed( noisy, grid, {}, edges, 1, -1 /* no merging */ );
+            counts[ thread ] += edges;
+         }
+      } catch( ... ) {
+         SetNumberOfThreads( maxThreads );
+         throw;
       }
-      SeededWatershed( noisy, grid, {}, edges, 1, -1 /* no merging */ );
-      out += edges;
+      SetNumberOfThreads( maxThreads );
+   DIP_PARALLEL_ERROR_END
+   for( dip::uint ii = 1; ii < nThreads; ++ii ) {
+      out += counts[ ii ];
    }
 }
 
 } // namespace dip
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/statistics.h"
+#include "diplib/testing.h"
+
+DOCTEST_TEST_CASE( "[DIPlib] testing dip::StochasticWatershed" ) {
+   dip::Random random( 0 );
+   dip::Image in( { 80, 60 }, 1, dip::DT_SFLOAT );
+   in.Fill( 0 );
+   dip::UniformNoise( in, in, random );
+   dip::Gauss( in, in, { 3 } );
+   // The result is the same, no matter how many threads are used
+   dip::uint maxThreads = dip::GetNumberOfThreads();
+   for( auto const& seeds : { dip::S::HEXAGONAL, dip::S::POISSON } ) {
+      dip::SetNumberOfThreads( 1 );
+      random.Seed( 42 );
+      dip::Image ref = dip::StochasticWatershed( in, random, 20, 12, 0.01, seeds );
+      dip::SetNumberOfThreads( 4 );
+      random.Seed( 42 );
+      dip::Image out = dip::StochasticWatershed( in, random, 20, 12, 0.01, seeds );
+      DOCTEST_CHECK( dip::testing::CompareImages( out, ref, dip::Option::CompareImagesMode::EXACT ));
+      dip::uint max = dip::Maximum( out ).As< dip::uint >();
+      DOCTEST_CHECK( max > 0 );
+      DOCTEST_CHECK( max <= 12 );
+   }
+   dip::SetNumberOfThreads( maxThreads );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -17,9 +17,14 @@
 
 #include "watershed_support.h"
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "diplib.h"
+#include "diplib/multithreading.h"
 #include "diplib/overload.h"
 
 namespace dip {
@@ -98,16 +103,115 @@ std::vector< dip::sint > CreateOffsetsArray( Image const& maskim, IntegerArray c
 namespace {
 
 template< typename TPI >
-void SortOffsetsInternal( void const* ptr, std::vector< dip::sint >& offsets, bool lowFirst ) {
+struct IsSmallInteger {
+   static constexpr bool value = std::numeric_limits< TPI >::is_integer && ( sizeof( TPI ) <= 2 );
+};
+
+// Counting sort, used for 8-bit and 16-bit integer types. Each thread counts the values in its section of
+// the `offsets` array, then copies its offsets to the output positions computed from the cumulative counts.
+// Because each thread writes its offsets in order, and thread sections are ordered, the sort is stable.
+// Returns false if the sort was not done because the array is too short for this to be efficient.
+template< typename TPI, std::enable_if_t< IsSmallInteger< TPI >::value, int > = 0 >
+bool CountingSortOffsets( TPI const* data, std::vector< dip::sint >& offsets, bool lowFirst, dip::uint nThreads ) {
+   constexpr dip::uint nBins = dip::uint( 1 ) << ( 8 * sizeof( TPI ));
+   if( offsets.size() < nBins ) {
+      return false;
+   }
+   constexpr dip::sint lowest = std::numeric_limits< TPI >::lowest();
+   auto GetBin = [ data, lowFirst ]( dip::sint offset ) {
+      dip::uint bin = static_cast< dip::uint >( static_cast< dip::sint >( data[ offset ] ) - lowest );
+      return lowFirst ? bin : nBins - 1 - bin;
+   };
+   dip::uint nOffsets = offsets.size();
+   std::vector< std::vector< dip::uint >> counts( nThreads, std::vector< dip::uint >( nBins, 0 ));
+   std::vector< dip::sint > sorted( nOffsets );
+   #pragma omp parallel num_threads( static_cast< int >( nThreads ))
+   {
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint first = thread * nOffsets / nThreads;
+      dip::uint last = ( thread + 1 ) * nOffsets / nThreads;
+      auto& count = counts[ thread ];
+      for( dip::uint ii = first; ii < last; ++ii ) {
+         ++count[ GetBin( offsets[ ii ] ) ];
+      }
+      #pragma omp barrier
+      #pragma omp single
+      {
+         // Turn the counts into output positions: for each bin, thread sections are placed one after the other
+         dip::uint position = 0;
+         for( dip::uint bin = 0; bin < nBins; ++bin ) {
+            for( auto& c : counts ) {
+               dip::uint n = c[ bin ];
+               c[ bin ] = position;
+               position += n;
+            }
+         }
+      } // implied barrier
+      for( dip::uint ii = first; ii < last; ++ii ) {
+         sorted[ count[ GetBin( offsets[ ii ] ) ]++ ] = offsets[ ii ];
+      }
+   }
+   offsets.swap( sorted );
+   return true;
+}
+template< typename TPI, std::enable_if_t< !IsSmallInteger< TPI >::value, int > = 0 >
+bool CountingSortOffsets( TPI const* /*data*/, std::vector< dip::sint >& /*offsets*/, bool /*lowFirst*/, dip::uint /*nThreads*/ ) {
+   return false;
+}
+
+// Merge sort, used for all other types. Each thread sorts a section of the `offsets` array, then sections
+// are merged pairwise in a tree. `std::stable_sort` and `std::merge` are both stable, so the result is
+// identical to that of a single `std::stable_sort` call.
+template< typename Compare >
+void MergeSortOffsets( std::vector< dip::sint >& offsets, Compare const& compare, dip::uint nThreads ) {
+   if( nThreads == 1 ) {
+      std::stable_sort( offsets.begin(), offsets.end(), compare );
+      return;
+   }
+   dip::uint nOffsets = offsets.size();
+   std::vector< dip::uint > bounds( nThreads + 1 );
+   for( dip::uint ii = 0; ii <= nThreads; ++ii ) {
+      bounds[ ii ] = ii * nOffsets / nThreads;
+   }
+   dip::sint* src = offsets.data();
+   #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( static, 1 )
+   for( dip::sint ii = 0; ii < static_cast< dip::sint >( nThreads ); ++ii ) {
+      dip::uint kk = static_cast< dip::uint >( ii );
+      std::stable_sort( src + bounds[ kk ], src + bounds[ kk + 1 ], compare );
+   }
+   std::vector< dip::sint > buffer( nOffsets );
+   dip::sint* dest = buffer.data();
+   for( dip::uint step = 1; step < nThreads; step *= 2 ) {
+      dip::sint nMerges = static_cast< dip::sint >( div_ceil( nThreads, 2 * step ));
+      #pragma omp parallel for num_threads( static_cast< int >( nMerges )) schedule( static, 1 )
+      for( dip::sint jj = 0; jj < nMerges; ++jj ) {
+         dip::uint first = static_cast< dip::uint >( jj ) * 2 * step;
+         dip::uint middle = std::min( first + step, nThreads );
+         dip::uint last = std::min( first + 2 * step, nThreads );
+         std::merge( src + bounds[ first ], src + bounds[ middle ], src + bounds[ middle ], src + bounds[ last ],
+                     dest + bounds[ first ], compare );
+      }
+      std::swap( src, dest );
+   }
+   if( src != offsets.data() ) {
+      offsets.swap( buffer );
+   }
+}
+
+template< typename TPI >
+void SortOffsetsInternal( void const* ptr, std::vector< dip::sint >& offsets, bool lowFirst, dip::uint nThreads ) {
    TPI const* data = static_cast< TPI const* >( ptr );
+   if( CountingSortOffsets( data, offsets, lowFirst, nThreads )) {
+      return;
+   }
    if( lowFirst ) {
-      std::sort( offsets.begin(), offsets.end(), [ & ]( dip::sint const& a, dip::sint const& b ) {
+      MergeSortOffsets( offsets, [ data ]( dip::sint const& a, dip::sint const& b ) {
          return data[ a ] < data[ b ];
-      } );
+      }, nThreads );
    } else {
-      std::sort( offsets.begin(), offsets.end(), [ & ]( dip::sint const& a, dip::sint const& b ) {
+      MergeSortOffsets( offsets, [ data ]( dip::sint const& a, dip::sint const& b ) {
          return data[ a ] > data[ b ];
-      } );
+      }, nThreads );
    }
 }
 
@@ -118,7 +222,63 @@ void SortOffsets( Image const& img, std::vector< dip::sint >& offsets, bool lowF
    if( ovlType.IsBinary() ) {
       ovlType = DT_UINT8;
    }
-   DIP_OVL_CALL_REAL( SortOffsetsInternal, ( img.Origin(), offsets, lowFirst ), ovlType );
+   dip::uint nThreads = std::max( dip::uint( 1 ), std::min( GetNumberOfThreads(), offsets.size() / threadingThreshold ));
+   DIP_OVL_CALL_REAL( SortOffsetsInternal, ( img.Origin(), offsets, lowFirst, nThreads ), ovlType );
 }
 
 } // namespace dip
+
+#ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/random.h"
+
+namespace {
+
+template< typename TPI >
+bool IsStablySorted( dip::Image const& img, std::vector< dip::sint > const& offsets, bool lowFirst ) {
+   TPI const* data = static_cast< TPI const* >( img.Origin() );
+   for( dip::uint ii = 1; ii < offsets.size(); ++ii ) {
+      TPI a = data[ offsets[ ii - 1 ]];
+      TPI b = data[ offsets[ ii ]];
+      if( lowFirst ? ( a > b ) : ( a < b )) {
+         return false;
+      }
+      if(( a == b ) && ( offsets[ ii - 1 ] > offsets[ ii ] )) {
+         return false;
+      }
+   }
+   return true;
+}
+
+template< typename TPI >
+void TestSortOffsets( dip::Image const& img ) {
+   std::vector< dip::sint > offsets = dip::CreateOffsetsArray( img.Sizes(), img.Strides() );
+   for( bool lowFirst : { true, false } ) {
+      std::vector< dip::sint > serial = offsets;
+      dip::SortOffsetsInternal< TPI >( img.Origin(), serial, lowFirst, 1 );
+      DOCTEST_CHECK( IsStablySorted< TPI >( img, serial, lowFirst ));
+      for( dip::uint nThreads : { 2u, 3u, 8u } ) {
+         std::vector< dip::sint > parallel = offsets;
+         dip::SortOffsetsInternal< TPI >( img.Origin(), parallel, lowFirst, nThreads );
+         DOCTEST_CHECK( parallel == serial );
+      }
+   }
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("[DIPlib] testing dip::SortOffsets") {
+   dip::Random random( 0 );
+   dip::Image img( { 300, 250 }, 1, dip::DT_UINT8 );
+   img.Fill( 0 );
+   dip::UniformNoise( img, img, random, 0, 20 ); // lots of ties
+   TestSortOffsets< dip::uint8 >( img );
+   img.Convert( dip::DT_SINT16 );
+   img -= 10;
+   TestSortOffsets< dip::sint16 >( img );
+   img.Convert( dip::DT_SFLOAT );
+   TestSortOffsets< dip::sfloat >( img );
+}
+
+#endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -32,7 +32,8 @@ DIP_NO_EXPORT std::vector< dip::sint > CreateOffsetsArray( UnsignedArray const&
 // pixels set in `mask` are indexed. Pixels at the image boundary are excluded.
 DIP_NO_EXPORT std::vector< dip::sint > CreateOffsetsArray( Image const& mask, IntegerArray const& strides );
 
-// Sorts the list of offsets by the grey value they index.
+// Sorts the list of offsets by the grey value they index. The sort is stable: offsets that index the same grey
+// value keep their relative order. Thus, the result does not depend on the number of threads used.
 DIP_NO_EXPORT void SortOffsets( Image const& img, std::vector< dip::sint >& offsets, bool lowFirst );
 
 // This class manages a list of neighbor labels.
@@ -17,7 +17,9 @@
 
 #include "diplib/nonlinear.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <vector>
@@ -26,6 +28,7 @@
 #include "diplib/boundary.h"
 #include "diplib/framework.h"
 #include "diplib/morphology.h"
+#include "diplib/multithreading.h"
 #include "diplib/overload.h"
 #include "diplib/pixel_table.h"
 
@@ -530,6 +533,272 @@ class RankLineFilter : public Framework::FullLineFilter {
       }
 };
 
+// Constant-time rank filter for 2D images of 8-bit and 16-bit integer types, and a rectangular kernel.
+// See S. Perreault and P. Hébert, "Median filtering in constant time", IEEE Transactions on Image Processing
+// 16(9):2389-2394, 2007.
+// A histogram is kept for each image column, covering the kernel height. Going down one image line, these column
+// histograms are updated by removing one pixel and adding one pixel. The histogram for the kernel window is updated
+// by adding the histogram of the column entering the window and subtracting the one of the column leaving it.
+// Histograms have two levels: the coarse level uses the upper half of the bits of the pixel value, the fine level
+// all bits. Window histograms are kept for both levels, but only the section of the fine histogram that contains
+// the requested rank is updated, and only when it is needed (for a median filter this is usually the same
+// section as for the previous pixel).
+// The image is divided into vertical stripes that are processed in parallel. The column histograms for 16-bit
+// images are large, the stripes are kept narrow to limit memory usage.
+template< typename TPI >
+dip::uint HistogramBin( TPI value ) {
+   return static_cast< dip::uint >( static_cast< dip::sint >( value ) - static_cast< dip::sint >( std::numeric_limits< TPI >::lowest() ));
+}
+
+template< typename TPI >
+TPI HistogramBinValue( dip::uint bin ) {
+   return static_cast< TPI >( static_cast< dip::sint >( bin ) + static_cast< dip::sint >( std::numeric_limits< TPI >::lowest() ));
+}
+
+template< typename TPI >
+class HistogramRankFilter {
+   public:
+      static constexpr dip::uint nBits = 8 * sizeof( TPI );
+      static constexpr dip::uint fineBits = nBits / 2;
+      static constexpr dip::uint nBins = dip::uint( 1 ) << nBits;
+      static constexpr dip::uint nFine = dip::uint( 1 ) << fineBits; // number of fine bins in each coarse bin
+      static constexpr dip::uint nCoarse = nBins / nFine;
+      static constexpr dip::uint maxColumns = nBits > 8 ? 256 : std::numeric_limits< dip::uint >::max(); // limits memory usage
+      using ColumnCount = uint16;    // column histograms count at most the kernel height
+      using WindowCount = uint32;    // window histograms count at most the number of kernel pixels
+
+      // `in` has the boundary extended, such that the window for output pixel (0,0) starts at `in` pixel (0,0).
+      HistogramRankFilter( Image const& in, Image& out, UnsignedArray const& kernelSizes, dip::uint rank ) :
+            in_( static_cast< TPI const* >( in.Origin() )), inStride_( in.Strides() ),
+            out_( static_cast< TPI* >( out.Origin() )), outStride_( out.Strides() ),
+            width_( out.Size( 0 )), height_( out.Size( 1 )),
+            kernelWidth_( kernelSizes[ 0 ] ), kernelHeight_( kernelSizes[ 1 ] ), rank_( rank ) {}
+
+      void Apply( dip::uint nThreads ) {
+         // The stripe width
+         dip::uint stripeWidth = width_;
+         if( maxColumns < width_ + kernelWidth_ - 1 ) {
+            stripeWidth = std::max( maxColumns - std::min( maxColumns, kernelWidth_ - 1 ), kernelWidth_ );
+         }
+         stripeWidth = std::min( stripeWidth, div_ceil( width_, nThreads ));
+         dip::uint nStripes = div_ceil( width_, stripeWidth );
+         nThreads = std::min( nThreads, nStripes );
+         dip::uint nColumns = stripeWidth + kernelWidth_ - 1;
+         std::vector< Buffers > buffers( nThreads );
+         for( auto& b : buffers ) {
+            b.columnCoarse.resize( nColumns * nCoarse, 0 );
+            b.columnFine.resize( nColumns * nBins, 0 );
+            b.windowCoarse.resize( nCoarse );
+            b.windowFine.resize( nBins );
+            b.validColumn.resize( nCoarse );
+         }
+         #pragma omp parallel for num_threads( static_cast< int >( nThreads )) schedule( dynamic, 1 )
+         for( dip::sint stripe = 0; stripe < static_cast< dip::sint >( nStripes ); ++stripe ) {
+            dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+            dip::uint start = static_cast< dip::uint >( stripe ) * stripeWidth;
+            ProcessStripe( buffers[ thread ], start, std::min( stripeWidth, width_ - start ));
+         }
+      }
+
+   private:
+      struct Buffers {
+         std::vector< ColumnCount > columnCoarse; // nCoarse bins for each column
+         std::vector< ColumnCount > columnFine;   // nBins bins for each column
+         std::vector< WindowCount > windowCoarse;
+         std::vector< WindowCount > windowFine;
+         std::vector< dip::uint > validColumn;    // for each coarse bin, the output column for which the fine section of windowFine is valid
+      };
+
+      TPI const* in_;
+      IntegerArray inStride_;
+      TPI* out_;
+      IntegerArray outStride_;
+      dip::uint width_;
+      dip::uint height_;
+      dip::uint kernelWidth_;
+      dip::uint kernelHeight_;
+      dip::uint rank_;
+
+      static constexpr dip::uint invalid = std::numeric_limits< dip::uint >::max();
+
+      // Processes output columns [start, start+width).
+      void ProcessStripe( Buffers& buffers, dip::uint start, dip::uint width ) {
+         dip::uint nColumns = width + kernelWidth_ - 1;
+         dip::sint inStride0 = inStride_[ 0 ];
+         dip::sint inStride1 = inStride_[ 1 ];
+         TPI const* in = in_ + static_cast< dip::sint >( start ) * inStride0;
+         TPI* out = out_ + static_cast< dip::sint >( start ) * outStride_[ 0 ];
+         ColumnCount* columnCoarse = buffers.columnCoarse.data();
+         ColumnCount* columnFine = buffers.columnFine.data();
+         WindowCount* windowCoarse = buffers.windowCoarse.data();
+         WindowCount* windowFine = buffers.windowFine.data();
+         dip::uint* validColumn = buffers.validColumn.data();
+         auto AddLine = [ & ]( TPI const* ptr ) {
+            for( dip::uint ii = 0; ii < nColumns; ++ii, ptr += inStride0 ) {
+               dip::uint bin = HistogramBin( *ptr );
+               ++columnCoarse[ ii * nCoarse + ( bin >> fineBits ) ];
+               ++columnFine[ ii * nBins + bin ];
+            }
+         };
+         auto RemoveLine = [ & ]( TPI const* ptr ) {
+            for( dip::uint ii = 0; ii < nColumns; ++ii, ptr += inStride0 ) {
+               dip::uint bin = HistogramBin( *ptr );
+               --columnCoarse[ ii * nCoarse + ( bin >> fineBits ) ];
+               --columnFine[ ii * nBins + bin ];
+            }
+         };
+         // Initialize column histograms
+         for( dip::uint jj = 0; jj < kernelHeight_ - 1; ++jj ) {
+            AddLine( in + static_cast< dip::sint >( jj ) * inStride1 );
+         }
+         for( dip::uint jj = 0; jj < height_; ++jj, in += inStride1, out += outStride_[ 1 ] ) {
+            // Update column histograms
+            if( jj > 0 ) {
+               RemoveLine( in - inStride1 );
+            }
+            AddLine( in + static_cast< dip::sint >( kernelHeight_ - 1 ) * inStride1 );
+            // Initialize window histogram
+            std::fill( windowCoarse, windowCoarse + nCoarse, WindowCount( 0 ));
+            for( dip::uint ii = 0; ii < kernelWidth_; ++ii ) {
+               ColumnCount const* column = columnCoarse + ii * nCoarse;
+               for( dip::uint kk = 0; kk < nCoarse; ++kk ) {
+                  windowCoarse[ kk ] += column[ kk ];
+               }
+            }
+            std::fill( validColumn, validColumn + nCoarse, invalid );
+            TPI* outPtr = out;
+            for( dip::uint ii = 0; ii < width; ++ii, outPtr += outStride_[ 0 ] ) {
+               // Update window histogram
+               if( ii > 0 ) {
+                  ColumnCount const* add = columnCoarse + ( ii + kernelWidth_ - 1 ) * nCoarse;
+                  ColumnCount const* sub = columnCoarse + ( ii - 1 ) * nCoarse;
+                  for( dip::uint kk = 0; kk < nCoarse; ++kk ) {
+                     windowCoarse[ kk ] += add[ kk ];
+                     windowCoarse[ kk ] -= sub[ kk ];
+                  }
+               }
+               // Find coarse bin
+               dip::uint sum = 0;
+               dip::uint coarse = 0;
+               while( sum + windowCoarse[ coarse ] <= rank_ ) {
+                  sum += windowCoarse[ coarse ];
+                  ++coarse;
+               }
+               // Update the section of the fine histogram for this coarse bin
+               WindowCount* fine = windowFine + coarse * nFine;
+               ColumnCount const* column = columnFine + coarse * nFine;
+               dip::uint valid = validColumn[ coarse ];
+               if(( valid == invalid ) || ( 2 * ( ii - valid ) >= kernelWidth_ )) {
+                  std::fill( fine, fine + nFine, WindowCount( 0 ));
+                  for( dip::uint cc = ii; cc < ii + kernelWidth_; ++cc ) {
+                     ColumnCount const* add = column + cc * nBins;
+                     for( dip::uint kk = 0; kk < nFine; ++kk ) {
+                        fine[ kk ] += add[ kk ];
+                     }
+                  }
+               } else {
+                  for( dip::uint cc = valid + 1; cc <= ii; ++cc ) {
+                     ColumnCount const* add = column + ( cc + kernelWidth_ - 1 ) * nBins;
+                     ColumnCount const* sub = column + ( cc - 1 ) * nBins;
+                     for( dip::uint kk = 0; kk < nFine; ++kk ) {
+                        fine[ kk ] += add[ kk ];
+                        fine[ kk ] -= sub[ kk ];
+                     }
+                  }
+               }
+               validColumn[ coarse ] = ii;
+               // Find fine bin
+               dip::uint bin = 0;
+               while( sum + fine[ bin ] <= rank_ ) {
+                  sum += fine[ bin ];
+                  ++bin;
+               }
+               *outPtr = HistogramBinValue< TPI >( coarse * nFine + bin );
+            }
+         }
+         // Empty the column histograms for the next stripe
+         in -= inStride1;
+         for( dip::uint jj = 0; jj < kernelHeight_; ++jj, in += inStride1 ) {
+            RemoveLine( in );
+         }
+      }
+};
+
+// Returns true if the histogram-based algorithm can and should be used.
+bool UseHistogramRankFilter( Image const& in, PixelTable const& pixelTable, BoundaryConditionArray const& bc ) {
+   if(( in.Dimensionality() != 2 ) || !in.IsScalar() ) {
+      return false;
+   }
+   if( std::find( bc.begin(), bc.end(), BoundaryCondition::ALREADY_EXPANDED ) != bc.end() ) {
+      return false;
+   }
+   DataType dtype = in.DataType();
+   if( !dtype.IsInteger() || ( dtype.SizeOf() > 2 )) {
+      return false;
+   }
+   UnsignedArray const& sizes = pixelTable.Sizes();
+   if(( pixelTable.NumberOfPixels() != sizes.product() ) || ( sizes[ 1 ] > std::numeric_limits< uint16 >::max() )) {
+      return false; // Not a rectangle, or column histograms would overflow
+   }
+   // For 8-bit images the histogram-based algorithm is always faster. For 16-bit images, the tree-based algorithm
+   // is faster for small kernels (crossover at about 8x8 pixels).
+   return ( dtype.SizeOf() == 1 ) || ( pixelTable.NumberOfPixels() >= 64 );
+}
+
+void ComputeHistogramRankFilter(
+      Image const& c_in,
+      Image& out,
+      PixelTable const& pixelTable,
+      dip::uint rank,
+      BoundaryConditionArray const& bc
+) {
+   UnsignedArray sizes = c_in.Sizes();
+   DataType dtype = c_in.DataType();
+   PixelSize pixelSize = c_in.PixelSize();
+   String colorSpace = c_in.ColorSpace();
+   // Extend the boundary, and find the top-left corner of the window for output pixel (0,0)
+   UnsignedArray boundary = pixelTable.Boundary();
+   Image in;
+   DIP_STACK_TRACE_THIS( ExtendImage( c_in, in, boundary, bc ));
+   IntegerArray const& origin = pixelTable.Origin();
+   IntegerArray corner{ static_cast< dip::sint >( boundary[ 0 ] ) + origin[ 0 ], static_cast< dip::sint >( boundary[ 1 ] ) + origin[ 1 ] };
+   in = in.At( Range{ corner[ 0 ], -1 }, Range{ corner[ 1 ], -1 } );
+   // Forge the output image
+   DIP_STACK_TRACE_THIS( out.ReForge( sizes, 1, dtype, Option::AcceptDataTypeChange::DO_ALLOW ));
+   Image tmp = out.QuickCopy();
+   if( tmp.DataType() != dtype ) {
+      tmp = Image( sizes, 1, dtype );
+   }
+   // Compute
+   dip::uint nThreads = 1;
+   if( sizes.product() * pixelTable.Sizes()[ 0 ] >= threadingThreshold ) {
+      nThreads = GetNumberOfThreads();
+   }
+   switch( dtype ) {
+      case DT_UINT8:
+         HistogramRankFilter< dip::uint8 >( in, tmp, pixelTable.Sizes(), rank ).Apply( nThreads );
+         break;
+      case DT_SINT8:
+         HistogramRankFilter< dip::sint8 >( in, tmp, pixelTable.Sizes(), rank ).Apply( nThreads );
+         break;
+      case DT_UINT16:
+         HistogramRankFilter< dip::uint16 >( in, tmp, pixelTable.Sizes(), rank ).Apply( nThreads );
+         break;
+      case DT_SINT16:
+         HistogramRankFilter< dip::sint16 >( in, tmp, pixelTable.Sizes(), rank ).Apply( nThreads );
+         break;
+      default:
+         DIP_THROW_ASSERTION( "Data type not supported by HistogramRankFilter" );
+   }
+   if( !tmp.SharesData( out )) {
+      DIP_STACK_TRACE_THIS( out.Copy( tmp ));
+   }
+   out.SetPixelSize( std::move( pixelSize ));
+   if( !colorSpace.empty() ) {
+      out.SetColorSpace( std::move( colorSpace ));
+   }
+}
+
 void ComputeRankFilter(
       Image const& in,
       Image& out,
@@ -539,6 +808,13 @@ void ComputeRankFilter(
 ) {
    DIP_START_STACK_TRACE
       DataType dtype = in.DataType();
+      if( in.Dimensionality() == 2 ) {
+         PixelTable pixelTable = kernel.PixelTable( 2, 0 );
+         if( UseHistogramRankFilter( in, pixelTable, bc )) {
+            ComputeHistogramRankFilter( in, out, pixelTable, rank, bc );
+            return;
+         }
+      }
       std::unique_ptr< Framework::FullLineFilter > lineFilter;
       DIP_OVL_NEW_NONCOMPLEX( lineFilter, RankLineFilter, ( rank ), dtype );
       Framework::Full( in, out, dtype, dtype, dtype, 1, bc, kernel, *lineFilter, Framework::FullOption::AsScalarImage );
@@ -612,6 +888,9 @@ void PercentileFilter(
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
 #include "doctest.h"
+#include "diplib/generation.h"
+#include "diplib/random.h"
+#include "diplib/testing.h"
 
 DOCTEST_TEST_CASE("[DIPlib] testing OrderStatisticTree<>") {
    std::vector< int > data( 21 );
@@ -643,4 +922,32 @@ DOCTEST_TEST_CASE("[DIPlib] testing OrderStatisticTree<>") {
    DOCTEST_CHECK( tree.Select( 5 ) == 5 );
 }
 
+DOCTEST_TEST_CASE("[DIPlib] testing the histogram-based rank filter") {
+   // The histogram-based algorithm is used for 8-bit and 16-bit integer images; for floating-point images the
+   // tree-based algorithm is used, which we use here as reference.
+   dip::Random random( 0 );
+   dip::Image in( { 300, 60 }, 1, dip::DT_SFLOAT );
+   in.Fill( 0 );
+   dip::UniformNoise( in, in, random, 0, 1 );
+   for( auto dtype : { dip::DT_UINT8, dip::DT_SINT8, dip::DT_UINT16, dip::DT_SINT16 } ) {
+      // Fill the whole range of the data type
+      dip::dfloat lowest = dip::Image::Sample::Minimum( dtype ).As< dip::dfloat >();
+      dip::dfloat highest = dip::Image::Sample::Maximum( dtype ).As< dip::dfloat >();
+      dip::Image img = dip::Convert( in * ( highest - lowest + 1 ) + lowest, dtype );
+      dip::Image fimg = dip::Convert( img, dip::DT_SFLOAT );
+      for( auto const& kernel : { dip::Kernel{ 15 }, dip::Kernel{ dip::FloatArray{ 30, 11 }, dip::S::RECTANGULAR },
+                                  dip::Kernel{ dip::FloatArray{ 9, 40 }, dip::S::RECTANGULAR } } ) {
+         for( dip::dfloat percentile : { 0.0, 10.0, 50.0, 90.0 } ) {
+            dip::Image out = dip::PercentileFilter( img, percentile, kernel );
+            DOCTEST_CHECK( out.DataType() == dtype );
+            dip::Image ref = dip::PercentileFilter( fimg, percentile, kernel );
+            DOCTEST_CHECK( dip::testing::CompareImages( out, dip::Convert( ref, dtype ), dip::Option::CompareImagesMode::EXACT ));
+         }
+      }
+      dip::Image out = dip::RankFilter( img, dip::StructuringElement{ { 25, 12 }, dip::S::RECTANGULAR }, 37, dip::S::DECREASING, { dip::S::PERIODIC } );
+      dip::Image ref = dip::RankFilter( fimg, dip::StructuringElement{ { 25, 12 }, dip::S::RECTANGULAR }, 37, dip::S::DECREASING, { dip::S::PERIODIC } );
+      DOCTEST_CHECK( dip::testing::CompareImages( out, dip::Convert( ref, dtype ), dip::Option::CompareImagesMode::EXACT ));
+   }
+}
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST
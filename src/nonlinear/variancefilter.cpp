@@ -23,6 +23,7 @@
 #include "diplib/accumulators.h"
 #include "diplib/boundary.h"
 #include "diplib/framework.h"
+#include "diplib/integral_image.h"
 #include "diplib/kernel.h"
 #include "diplib/overload.h"
 #include "diplib/pixel_table.h"
@@ -65,6 +66,32 @@ class VarianceLineFilter : public Framework::FullLineFilter {
       }
 };
 
+// The line filter above has a cost proportional to the number of pixel table runs, using an integral image
+// has a constant cost per pixel. This is the number of runs above which the integral image is cheaper.
+constexpr dip::uint integralImageMinimumRuns = 12;
+
+bool UseIntegralImage( Image const& in, Kernel const& kernel, UnsignedArray& filterSize ) {
+   dip::uint nDims = in.Dimensionality();
+   if( !kernel.IsRectangular() || ( nDims < 1 )) {
+      return false;
+   }
+   // The integral image computes the variance without rounding errors only if the sums of squares are accumulated
+   // in integers, which is the case for 8-bit and 16-bit integer images. For other types, the difference between
+   // the large sums is much less precise than the running statistics in the line filter above.
+   if( !in.DataType().IsBinary() && !( in.DataType().IsInteger() && ( in.DataType().SizeOf() <= 2 ))) {
+      return false;
+   }
+   // The integral image uses a window centered as in the default, unshifted, rectangular kernel
+   PixelTable pixelTable = kernel.PixelTable( nDims, 0 );
+   filterSize = pixelTable.Sizes();
+   for( dip::uint ii = 0; ii < nDims; ++ii ) {
+      if( pixelTable.Origin()[ ii ] != -static_cast< dip::sint >( filterSize[ ii ] / 2 )) {
+         return false;
+      }
+   }
+   return pixelTable.Runs().size() >= integralImageMinimumRuns;
+}
+
 } // namespace
 
 void VarianceFilter(
@@ -76,6 +103,12 @@ void VarianceFilter(
    DIP_THROW_IF( !in.IsForged(), E::IMAGE_NOT_FORGED );
    DIP_THROW_IF( kernel.HasWeights(), E::KERNEL_NOT_BINARY );
    DIP_START_STACK_TRACE
+      UnsignedArray filterSize;
+      if( UseIntegralImage( in, kernel, filterSize )) {
+         IntegralImage integral( in, kernel.Boundary( in.Dimensionality() ), boundaryCondition, "variance" );
+         integral.Variance( filterSize, out );
+         return;
+      }
       BoundaryConditionArray bc = StringArrayToBoundaryConditionArray( boundaryCondition );
       DataType dtype = DataType::SuggestFlex( in.DataType() );
       std::unique_ptr< Framework::FullLineFilter > lineFilter;
@@ -27,6 +27,7 @@
 #include "diplib/neighborlist.h"
 #include "diplib/iterators.h"
 #include "diplib/framework.h"
+#include "diplib/multithreading.h"
 
 #include "labelingGrana2016.h"
 
@@ -107,9 +108,9 @@ void LabelFirstPass(
       Image& c_img,
       LabelRegionList& regions,
       NeighborList const& c_neighborList,
-      dip::uint connectivity
+      dip::uint connectivity,
+      dip::uint procDim
 ) {
-   dip::uint procDim = Framework::OptimalProcessingDim( c_img ); // this will typically be 0, because we've "standardized the strides".
    dip::uint length = c_img.Size( procDim );
    if( length < 3 ) {
       // Note that if length < 3, the image is very small all around, because `OptimalProcessingDim` will return a larger dimension if it exists.
@@ -232,8 +233,9 @@ void LabelFirstPass(
       // The last pixel:
       if( *img ) {
          coords[ procDim ] = length - 1;
+         bool previousIsSet = lastLabel != 0; // If `p` is set, we need to test only `m` pixels, otherwise all of them
          for( dip::uint ii = 0; ii < neighborList.Size(); ++ii ) {
-            if( neighborIsForward[ ii ] && neighorIsInImage[ ii ] && neighborList.IsInImage( ii, coords, c_img.Sizes() )) {
+            if(( neighborIsForward[ ii ] || !previousIsSet ) && neighorIsInImage[ ii ] && neighborList.IsInImage( ii, coords, c_img.Sizes() )) {
                LabelType lab = img[ neighborOffsets[ ii ]];
                if( lab ) {
                   if( lastLabel ) {
@@ -256,16 +258,132 @@ void LabelFirstPass(
 
 }
 
-} // namespace
+// Splits `img` into `n` slabs along dimension `dim`. Returns the slabs and, in `starts`, the coordinate along `dim`
+// of the first pixel of each slab.
+ImageArray SplitIntoSlabs( Image const& img, dip::uint dim, dip::uint n, UnsignedArray& starts ) {
+   dip::uint size = img.Size( dim );
+   n = std::max( dip::uint( 1 ), std::min( n, size ));
+   ImageArray slabs( n );
+   starts.resize( n );
+   RangeArray ranges( img.Dimensionality() );
+   for( dip::uint ii = 0; ii < n; ++ii ) {
+      starts[ ii ] = size * ii / n;
+      ranges[ dim ] = Range{ static_cast< dip::sint >( starts[ ii ] ), static_cast< dip::sint >( size * ( ii + 1 ) / n - 1 ) };
+      slabs[ ii ] = img.At( ranges );
+   }
+   return slabs;
+}
 
-dip::uint Label(
+// Calls `function( thread )` for `thread` in [0, n), in parallel using up to `n` threads.
+template< typename Function >
+void ParallelForEachSlab( dip::uint n, Function function ) {
+   DIP_PARALLEL_ERROR_DECLARE
+   #pragma omp parallel num_threads( static_cast< int >( n ))
+   DIP_PARALLEL_ERROR_START
+      dip::uint thread = static_cast< dip::uint >( omp_get_thread_num() );
+      dip::uint nThreads = static_cast< dip::uint >( omp_get_num_threads() );
+      for( dip::uint ii = thread; ii < n; ii += nThreads ) {
+         function( ii );
+      }
+   DIP_PARALLEL_ERROR_END
+}
+
+// Runs the first pass of the labeling in parallel. `out` is split into slabs along `splitDim`, each slab is processed
+// independently by `firstPass( ii, slab, slabRegions )`, which must produce labels in raster order (with `splitDim` as
+// the slowest changing dimension). The region lists for the slabs are then concatenated into `regions`, labels in
+// the slabs are shifted to index into the concatenated list, and regions touching across the boundary between slabs
+// are merged. Because labels are created in the same order as in a single pass over the whole image, and the
+// union-find structure always picks the lowest label as the root, the final labels are identical to those obtained
+// by a single pass.
+// If `reservedLabel` is true, `firstPass` creates a region with label 1 before processing the image, this region
+// is merged with the background for each slab except the first one (the caller takes care of that one).
+template< typename FirstPass >
+void LabelFirstPassParallel(
+      Image& out,
+      LabelRegionList& regions,
+      dip::uint splitDim,
+      dip::uint connectivity,
+      bool reservedLabel,
+      dip::uint nThreads,
+      FirstPass firstPass
+) {
+   UnsignedArray starts;
+   ImageArray slabs = SplitIntoSlabs( out, splitDim, nThreads, starts );
+   nThreads = slabs.size();
+   std::plus< dip::uint > sum;
+   std::vector< LabelRegionList > slabRegions( nThreads, LabelRegionList{ sum } );
+   ParallelForEachSlab( nThreads, [ & ]( dip::uint ii ) {
+      firstPass( ii, slabs[ ii ], slabRegions[ ii ] );
+   } );
+   // Concatenate the region lists
+   std::vector< LabelType > labelOffsets( nThreads );
+   for( dip::uint ii = 0; ii < nThreads; ++ii ) {
+      labelOffsets[ ii ] = static_cast< LabelType >( regions.Size() - 1 );
+      LabelRegionList& local = slabRegions[ ii ];
+      for( LabelType lab = 1; lab < local.Size(); ++lab ) {
+         LabelType root = local.FindRoot( lab );
+         LabelType index = regions.Create( root == lab ? local.Value( lab ) : 0 );
+         if( root != lab ) {
+            regions.Union( index, root + labelOffsets[ ii ] );
+         }
+      }
+      if( reservedLabel && ( ii > 0 )) {
+         regions.Union( 0, labelOffsets[ ii ] + 1 );
+      }
+   }
+   // Shift the labels in the slabs
+   ParallelForEachSlab( nThreads, [ & ]( dip::uint ii ) {
+      LabelType offset = labelOffsets[ ii ];
+      if( offset == 0 ) {
+         return;
+      }
+      ImageIterator< LabelType > it( slabs[ ii ] );
+      do {
+         if( *it ) {
+            *it += offset;
+         }
+      } while( ++it );
+   } );
+   // Merge regions across slab boundaries
+   NeighborList neighborList( { Metric::TypeCode::CONNECTED, connectivity }, out.Dimensionality() );
+   IntegerArray neighborOffsets = neighborList.ComputeOffsets( out.Strides() );
+   std::vector< dip::uint > crossingNeighbors; // The neighbors across the boundary between slabs
+   for( dip::uint ii = 0; ii < neighborList.Size(); ++ii ) {
+      if( neighborList.Coordinates( ii )[ splitDim ] == -1 ) {
+         crossingNeighbors.push_back( ii );
+      }
+   }
+   RangeArray ranges( out.Dimensionality() );
+   for( dip::uint ii = 1; ii < nThreads; ++ii ) {
+      ranges[ splitDim ] = Range{ static_cast< dip::sint >( starts[ ii ] ) };
+      Image seam = out.At( ranges );
+      ImageIterator< LabelType > it( seam );
+      do {
+         if( *it ) {
+            UnsignedArray coords = it.Coordinates();
+            coords[ splitDim ] = starts[ ii ];
+            for( auto jj : crossingNeighbors ) {
+               if( neighborList.IsInImage( jj, coords, out.Sizes() )) {
+                  LabelType lab = it.Pointer()[ neighborOffsets[ jj ]];
+                  if( lab ) {
+                     regions.Union( *it, lab );
+                  }
+               }
+            }
+         }
+      } while( ++it );
+   }
+}
+
+dip::uint LabelInternal(
       Image const& c_in,
       Image& c_out,
       dip::uint connectivity,
       dip::uint minSize,
       dip::uint maxSize,
       StringArray boundaryCondition,
-      String const& mode
+      String const& mode,
+      dip::uint nThreads
 ) {
    DIP_THROW_IF( !c_in.IsForged(), E::IMAGE_NOT_FORGED );
    DIP_THROW_IF( !c_in.IsScalar(), E::IMAGE_NOT_SCALAR );
@@ -299,13 +417,35 @@ dip::uint Label(
          granaIn.Squeeze();
          granaOut.Squeeze();
       }
-      LabelFirstPass_Grana2016( granaIn, granaOut, regions );
+      if( nThreads > 1 ) {
+         // The Grana algorithm processes the image row by row, rows are along the dimension with the smallest stride
+         // in `granaIn`. We split the image into slabs of consecutive rows.
+         dip::uint splitDim = granaIn.Stride( 1 ) < granaIn.Stride( 0 ) ? 0 : 1;
+         UnsignedArray starts;
+         ImageArray inSlabs = SplitIntoSlabs( granaIn, splitDim, nThreads, starts );
+         DIP_STACK_TRACE_THIS( LabelFirstPassParallel( granaOut, regions, splitDim, 2, false, nThreads,
+               [ & ]( dip::uint slab, Image& slabOut, LabelRegionList& slabRegions ) {
+                  LabelFirstPass_Grana2016( inSlabs[ slab ], slabOut, slabRegions );
+               } ));
+      } else {
+         LabelFirstPass_Grana2016( granaIn, granaOut, regions );
+      }
       // This saves ~20% on an image 2k x 2k pixels: 0.0559 vs 0.0658s
       // (including MATLAB overhead, probably slightly larger relative difference without that overhead).
    } else {
       c_out.Copy( in ); // Copy `in` into `c_out`, not into `out`, which could be reshaped.
       NeighborList neighborList( { Metric::TypeCode::CONNECTED, trueConnectivity }, trueNDims );
-      DIP_STACK_TRACE_THIS( LabelFirstPass( out, regions, neighborList, trueConnectivity ));
+      dip::uint procDim = Framework::OptimalProcessingDim( out ); // this will typically be 0, because we've "standardized the strides".
+      if(( nThreads > 1 ) && ( trueNDims > 1 ) && ( out.Size( procDim ) >= 3 )) {
+         // We split the image into slabs along the slowest changing dimension that is not `procDim`
+         dip::uint splitDim = procDim == trueNDims - 1 ? trueNDims - 2 : trueNDims - 1;
+         DIP_STACK_TRACE_THIS( LabelFirstPassParallel( out, regions, splitDim, trueConnectivity, true, nThreads,
+               [ & ]( dip::uint /*slab*/, Image& slabOut, LabelRegionList& slabRegions ) {
+                  LabelFirstPass( slabOut, slabRegions, neighborList, trueConnectivity, procDim );
+               } ));
+      } else {
+         DIP_STACK_TRACE_THIS( LabelFirstPass( out, regions, neighborList, trueConnectivity, procDim ));
+      }
       regions.Union( 0, 1 ); // This gets rid of label 1, which we used internally, but otherwise causes the first region to get label 2.
    }
 
@@ -439,16 +579,38 @@ dip::uint Label(
    }
 
    // Second scan
-   ImageIterator< LabelType > it( out );
-   do {
-      if( *it > 0 ) {
-         *it = regions.Label( *it );
-      }
-   } while( ++it );
+   ImageArray slabs{ out };
+   if(( nThreads > 1 ) && ( out.Dimensionality() > 0 )) {
+      UnsignedArray starts;
+      slabs = SplitIntoSlabs( out, out.Dimensionality() - 1, nThreads, starts );
+   }
+   ParallelForEachSlab( slabs.size(), [ & ]( dip::uint ii ) {
+      ImageIterator< LabelType > it( slabs[ ii ] );
+      do {
+         if( *it > 0 ) {
+            *it = regions.Label( *it );
+         }
+      } while( ++it );
+   } );
 
    return nLabel;
 }
 
+} // namespace
+
+dip::uint Label(
+      Image const& c_in,
+      Image& c_out,
+      dip::uint connectivity,
+      dip::uint minSize,
+      dip::uint maxSize,
+      StringArray boundaryCondition,
+      String const& mode
+) {
+   dip::uint nThreads = std::min( GetNumberOfThreads(), c_in.NumberOfPixels() / threadingThreshold );
+   return LabelInternal( c_in, c_out, connectivity, minSize, maxSize, std::move( boundaryCondition ), mode, nThreads );
+}
+
 } // namespace dip
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
@@ -456,6 +618,7 @@ dip::uint Label(
 #include "diplib/generation.h"
 #include "diplib/statistics.h"
 #include "diplib/binary.h"
+#include "diplib/random.h"
 
 DOCTEST_TEST_CASE("[DIPlib] testing dip::Label") {
 
@@ -572,4 +735,39 @@ DOCTEST_TEST_CASE("[DIPlib] testing dip::Label") {
    DOCTEST_CHECK( dip::All(( lab > 0 ) == img ).As< bool >() );
 }
 
+DOCTEST_TEST_CASE("[DIPlib] testing dip::Label in parallel") {
+   // Labeling in multiple slabs must yield exactly the same result as labeling in one go
+   dip::Random random( 0 );
+   dip::Image img2D( { 211, 150 }, 1, dip::DT_SFLOAT );
+   img2D.Fill( 0 );
+   img2D = dip::UniformNoise( img2D, random ) < 0.45;
+   dip::Image img3D( { 41, 30, 27 }, 1, dip::DT_SFLOAT );
+   img3D.Fill( 0 );
+   img3D = dip::UniformNoise( img3D, random ) < 0.15;
+   dip::Image img2DTransposed = img2D.QuickCopy();
+   img2DTransposed.SwapDimensions( 0, 1 );
+   for( dip::Image const* img : { &img2D, &img2DTransposed, &img3D } ) {
+      for( dip::uint connectivity = 1; connectivity <= img->Dimensionality(); ++connectivity ) {
+         dip::Image ref;
+         dip::uint nRef = dip::LabelInternal( *img, ref, connectivity, 0, 0, {}, "all", 1 );
+         DOCTEST_CHECK( nRef > 10 );
+         dip::Image refFiltered;
+         dip::uint nRefFiltered = dip::LabelInternal( *img, refFiltered, connectivity, 5, 0, { "periodic" }, "all", 1 );
+         dip::Image refLargest;
+         dip::LabelInternal( *img, refLargest, connectivity, 0, 0, { "remove" }, "largest", 1 );
+         for( dip::uint nThreads : { 2u, 3u, 7u } ) {
+            dip::Image lab;
+            dip::uint n = dip::LabelInternal( *img, lab, connectivity, 0, 0, {}, "all", nThreads );
+            DOCTEST_CHECK( n == nRef );
+            DOCTEST_CHECK( dip::All( lab == ref ).As< bool >() );
+            n = dip::LabelInternal( *img, lab, connectivity, 5, 0, { "periodic" }, "all", nThreads );
+            DOCTEST_CHECK( n == nRefFiltered );
+            DOCTEST_CHECK( dip::All( lab == refFiltered ).As< bool >() );
+            dip::LabelInternal( *img, lab, connectivity, 0, 0, { "remove" }, "largest", nThreads );
+            DOCTEST_CHECK( dip::All( lab == refLargest ).As< bool >() );
+         }
+      }
+   }
+}
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST
@@ -165,6 +165,15 @@ DOCTEST_TEST_CASE("[DIPlib] testing the statistical accumulators") {
       acc1 += acc2;
       DOCTEST_CHECK( acc1.Mean() == doctest::Approx( 0.0 ));
       DOCTEST_CHECK( acc1.Variance() == doctest::Approx( 1.0 - 3.0 / 9.0 ));
+      dip::DirectionalStatisticsAccumulator acc3;
+      dip::DirectionalStatisticsAccumulator acc4;
+      for( dip::uint ii = 0; ii < 1000; ++ii ) {
+         acc3.Push( 2.9 );
+         acc4.Push( 2.9 );
+      }
+      acc3 += acc4;
+      DOCTEST_CHECK( acc3.Mean() == doctest::Approx( 2.9 ));
+      DOCTEST_CHECK( acc3.StandardDeviation() == 0.0 );
    }
    {
       dip::MinMaxAccumulator acc1;
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 #include "diplib/library/numeric.h"
@@ -128,4 +129,80 @@ FloatArray ThinPlateSpline::Evaluate( FloatArray const& pt ) {
    return res;
 }
 
+// Bounds the error of multilinear interpolation within a box: along each dimension `d`, the error of linear
+// interpolation over a distance `h` is at most `h^2/8` times the maximum of the absolute second derivative, and the
+// errors along the dimensions add up. The affine part of the function is reproduced exactly. The second derivative
+// along `d` of the radial basis function `r^2 log(r)` is `g = 2 log(r) + 1 + 2 (x_d-c_d)^2 / r^2`. We compute the
+// weighted sum of `g` and its gradient at the center of the box, and bound the remainder of this first-order Taylor
+// expansion within the box using the norm of the Hessian of `g`, which is at most `6 / r^2`. Because the sums are
+// computed exactly, the large, nearly constant contributions of distant control points cancel, which keeps the
+// bound tight.
+dfloat ThinPlateSpline::InterpolationErrorBound( FloatArray const& lower, FloatArray const& upper ) const {
+   dip::uint nPoints = c_.size();
+   dip::uint nDims = c_[ 0 ].size();
+   DIP_ASSERT( lower.size() == nDims );
+   DIP_ASSERT( upper.size() == nDims );
+   dip::uint N = nPoints + nDims + 1;
+   FloatArray center( nDims );
+   dfloat rho2 = 0; // square of the largest distance between the center and a point in the box
+   for( dip::uint dd = 0; dd < nDims; ++dd ) {
+      center[ dd ] = ( lower[ dd ] + upper[ dd ] ) / 2;
+      dfloat h = ( upper[ dd ] - lower[ dd ] ) / 2;
+      rho2 += h * h;
+   }
+   FloatArray value( nDims * nDims, 0 );          // second derivative along `d` of output `j` at the center
+   FloatArray gradient( nDims * nDims * nDims, 0 ); // its gradient
+   FloatArray remainder( nDims, 0 );              // bound to the Taylor remainder for output `j`, divided by `rho2`
+   FloatArray x( nDims );
+   for( dip::uint ii = 0; ii < nPoints; ++ii ) {
+      dfloat rmin2 = 0; // square of the smallest distance between the control point and the box
+      dfloat r2 = 0;
+      for( dip::uint dd = 0; dd < nDims; ++dd ) {
+         dfloat near = std::max( { lower[ dd ] - c_[ ii ][ dd ], c_[ ii ][ dd ] - upper[ dd ], 0.0 } );
+         rmin2 += near * near;
+         x[ dd ] = center[ dd ] - c_[ ii ][ dd ];
+         r2 += x[ dd ] * x[ dd ];
+      }
+      if( rmin2 == 0 ) {
+         return infinity;
+      }
+      // Note that 2 log(r) = log(r^2)
+      dfloat logR2 = std::log( r2 );
+      for( dip::uint dd = 0; dd < nDims; ++dd ) {
+         dfloat g = logR2 + 1 + 2 * x[ dd ] * x[ dd ] / r2;
+         for( dip::uint jj = 0; jj < nDims; ++jj ) {
+            dfloat w = x_[ ii + jj * N ];
+            value[ dd + jj * nDims ] += w * g;
+            for( dip::uint kk = 0; kk < nDims; ++kk ) {
+               dfloat dg = 2 * x[ kk ] / r2 - 4 * x[ dd ] * x[ dd ] * x[ kk ] / ( r2 * r2 );
+               if( kk == dd ) {
+                  dg += 4 * x[ dd ] / r2;
+               }
+               gradient[ kk + ( dd + jj * nDims ) * nDims ] += w * dg;
+            }
+         }
+      }
+      for( dip::uint jj = 0; jj < nDims; ++jj ) {
+         remainder[ jj ] += std::abs( x_[ ii + jj * N ] ) * 3 / rmin2;
+      }
+   }
+   dfloat rho = std::sqrt( rho2 );
+   dfloat error2 = 0;
+   for( dip::uint jj = 0; jj < nDims; ++jj ) {
+      dfloat error = 0;
+      for( dip::uint dd = 0; dd < nDims; ++dd ) {
+         dfloat gradientNorm2 = 0;
+         for( dip::uint kk = 0; kk < nDims; ++kk ) {
+            dfloat v = gradient[ kk + ( dd + jj * nDims ) * nDims ];
+            gradientNorm2 += v * v;
+         }
+         dfloat maxSecondDerivative = std::abs( value[ dd + jj * nDims ] ) + rho * std::sqrt( gradientNorm2 ) + rho2 * remainder[ jj ];
+         dfloat h = upper[ dd ] - lower[ dd ];
+         error += h * h / 8 * maxSecondDerivative;
+      }
+      error2 += error * error;
+   }
+   return std::sqrt( error2 );
+}
+
 } // namespace dip
@@ -17,10 +17,13 @@
 
 #include "diplib/dft.h"
 
+#include <atomic>
 #include <cmath>
 #include <complex>
+#include <fstream>
 #include <limits>
-#include <mutex>
+#include <memory>
+#include <sstream>
 #include <vector>
 
 #include "diplib.h"
@@ -34,6 +37,9 @@
 
 #else // DIP_CONFIG_HAS_FFTW
 
+#include <mutex>
+#include <shared_mutex>
+
 #include "diplib/private/robin_map.h"
 
 #if defined(__GNUG__) || defined(__clang__)
@@ -76,6 +82,88 @@ using CPlan = typename fftwapidef< T >::plan;
 template< typename T >
 using RPlan = typename fftwapidef< T >::plan;
 
+namespace {
+
+// FFTW plans are not cached, FFTW's wisdom serves that purpose. We keep the settings and count the plans created.
+std::atomic< dip::uint > planCacheCapacity{ 30 };
+std::atomic< dip::uint > plansCreated{ 0 };
+
+void WriteWisdomCharacter( char c, void* data ) {
+   static_cast< String* >( data )->push_back( c );
+}
+
+// Splits the contents of a wisdom file into its top-level parenthesized blocks
+std::vector< String > SplitWisdom( String const& text ) {
+   std::vector< String > blocks;
+   dip::uint depth = 0;
+   dip::uint start = 0;
+   for( dip::uint ii = 0; ii < text.size(); ++ii ) {
+      if( text[ ii ] == '(' ) {
+         if( depth == 0 ) {
+            start = ii;
+         }
+         ++depth;
+      } else if(( text[ ii ] == ')' ) && ( depth > 0 )) {
+         --depth;
+         if( depth == 0 ) {
+            blocks.push_back( text.substr( start, ii - start + 1 ));
+         }
+      }
+   }
+   return blocks;
+}
+
+} // namespace
+
+void SetDFTPlanCacheSize( dip::uint size ) {
+   planCacheCapacity = size;
+}
+
+dip::uint GetDFTPlanCacheSize() {
+   return planCacheCapacity;
+}
+
+DFTPlanCacheStatistics GetDFTPlanCacheStatistics() {
+   DFTPlanCacheStatistics statistics;
+   statistics.misses = plansCreated;
+   return statistics;
+}
+
+void ResetDFTPlanCacheStatistics() {
+   plansCreated = 0;
+}
+
+bool SaveDFTWisdom( String const& filename ) {
+   // The double-precision and single-precision wisdom are written one after the other
+   String wisdom;
+   fftwapidef< dfloat >::export_wisdom( WriteWisdomCharacter, &wisdom );
+   wisdom.push_back( '\n' );
+   fftwapidef< sfloat >::export_wisdom( WriteWisdomCharacter, &wisdom );
+   wisdom.push_back( '\n' );
+   std::ofstream file( filename, std::ios::binary );
+   if( !file ) {
+      return false;
+   }
+   file << wisdom;
+   return static_cast< bool >( file );
+}
+
+bool LoadDFTWisdom( String const& filename ) {
+   std::ifstream file( filename, std::ios::binary );
+   if( !file ) {
+      return false;
+   }
+   std::stringstream contents;
+   contents << file.rdbuf();
+   std::vector< String > blocks = SplitWisdom( contents.str() );
+   if( blocks.size() != 2 ) {
+      return false;
+   }
+   bool success = fftwapidef< dfloat >::import_wisdom_from_string( blocks[ 0 ].c_str() ) != 0;
+   success &= fftwapidef< sfloat >::import_wisdom_from_string( blocks[ 1 ].c_str() ) != 0;
+   return success;
+}
+
 #else // DIP_CONFIG_HAS_FFTW
 
 dip::uint const maximumDFTSize = std::numeric_limits< dip::uint >::max();
@@ -92,88 +180,166 @@ using RPlan = pocketfft::pocketfft_r< T >;
 
 namespace {
 
-std::mutex planCacheMutex;
+// The maximum number of plans kept in each of the plan caches. If there are more plans, ones not in use are deleted.
+std::atomic< dip::uint > planCacheCapacity{ 30 };
 
-// This is a container that holds plans, and maintains a use count. Plans in use cannot be
-// deleted.
+// This is a container that holds plans, and maintains a use count. Plans in use cannot be deleted.
 //
 // This code is developed based on pocketfft::detail::get_plan<>(), but modified beyond recognition.
 //
+// Finding a plan that is already in the cache, and releasing it again, requires only a shared lock. Many threads
+// can thus obtain plans at the same time. The use count and access time are atomic for this reason. Creating and
+// deleting plans requires an exclusive lock. Plans are created outside the lock.
+//
 // PlanType is CPlan< T > or RPlan< T >, T is dip::sfloat or dip::dfloat. There are 4 caches.
 template< typename PlanType >
-PlanType* PlanCache( dip::uint length, bool free = false ) {
-   std::lock_guard< std::mutex > guard( planCacheMutex );
-
-   struct Data {
-      dip::uint use_count;
-      dip::uint last_access;
-      std::unique_ptr< PlanType > plan;
-   };
-   static tsl::robin_map< dip::uint, Data > cache;
-   static dip::uint access_counter = 0;
-   constexpr dip::uint maxSize = 30; // If there are more than maxSize plans, delete ones not in use.
-
-   if( free ) {
-      auto it = cache.find( length );
-      if( it != cache.end()) {
-         auto& data = it.value();
-         if( data.use_count > 0 ) {
-            --( data.use_count );
-            //std::cout << "Freeing cache element for length = " << length;
-            //std::cout << ", current use count = " << data.use_count << '\n';
-         }
+class PlanCache {
+   public:
+      static PlanCache& Instance() {
+         static PlanCache cache;
+         return cache;
       }
-      return nullptr;
-   }
 
-   if( access_counter == std::numeric_limits< dip::uint >::max()) {
-      // This could happen... but really???
-      access_counter = 1;
-      // Update `last_access` from all plans to be 0, so that things make sense again.
-      for( auto& p : cache ) {
-         const_cast< Data& >( p.second ).last_access = 0; // Why is the data const-qualified here?
+      PlanType* Get( dip::uint length ) {
+         {
+            std::shared_lock< std::shared_timed_mutex > lock( mutex_ );
+            auto it = cache_.find( length );
+            if( it != cache_.end() ) {
+               Data& data = *( it->second );
+               ++( data.useCount );
+               data.lastAccess = ++accessCounter_;
+               ++hits_;
+               return data.plan.get();
+            }
+         }
+         // Not found
+         auto plan = std::make_unique< PlanType >( length );
+         std::unique_lock< std::shared_timed_mutex > lock( mutex_ );
+         ++misses_;
+         auto it = cache_.find( length );
+         if( it != cache_.end() ) {
+            // Another thread created this plan in the meantime, we use that one
+            Data& data = *( it->second );
+            ++( data.useCount );
+            data.lastAccess = ++accessCounter_;
+            return data.plan.get();
+         }
+         dip::uint capacity = planCacheCapacity;
+         DeleteUnused( capacity > 0 ? capacity - 1 : 0 );
+         auto data = std::make_unique< Data >();
+         data->useCount = 1;
+         data->lastAccess = ++accessCounter_;
+         data->plan = std::move( plan );
+         PlanType* out = data->plan.get();
+         cache_.insert( { length, std::move( data ) } );
+         return out;
       }
-   }
-   auto it = cache.find( length );
-   if( it != cache.end()) {
-      // Update
-      //std::cout << "Re-using cache element for length = " << length;
-      auto& data = it.value();
-      ++( data.use_count );
-      data.last_access = ++access_counter;
-      //std::cout << ", current use count = " << data.use_count << '\n';
-      return data.plan.get();
-   }
-   // Not found
-   if( cache.size() >= maxSize ) {
-      //std::cout << "Cache is getting big... ";
-      // Delete one cache element that is not in use, if possible
-      dip::uint acc = access_counter;
-      dip::uint len = 0;
-      for( auto& p : cache ) {
-         if( p.second.use_count == 0 ) { // not in use
-            if( p.second.last_access < acc ) {
-               acc = p.second.last_access;
-               len = p.second.plan->length();
+
+      void Release( dip::uint length ) {
+         bool trim = false;
+         {
+            std::shared_lock< std::shared_timed_mutex > lock( mutex_ );
+            auto it = cache_.find( length );
+            if( it != cache_.end() ) {
+               DIP_ASSERT( it->second->useCount > 0 );
+               if(( --( it->second->useCount ) == 0 ) && ( cache_.size() > planCacheCapacity )) {
+                  trim = true;
+               }
             }
          }
+         if( trim ) {
+            Trim();
+         }
       }
-      // If there is something to delete, we will
-      if( len > 0 ) {
-         //std::cout << "Deleting cache element for length = " << len << '\n';
-         cache.erase( len );
-      } else {
-         //std::cout << "Nothing found to delete\n";
+
+      // Deletes plans not in use until there are no more than `planCacheCapacity` plans
+      void Trim() {
+         std::unique_lock< std::shared_timed_mutex > lock( mutex_ );
+         DeleteUnused( planCacheCapacity );
+      }
+
+      void AddStatistics( DFTPlanCacheStatistics& statistics ) {
+         std::shared_lock< std::shared_timed_mutex > lock( mutex_ );
+         statistics.hits += hits_;
+         statistics.misses += misses_;
+         statistics.size += cache_.size();
+      }
+
+      void ResetStatistics() {
+         hits_ = 0;
+         misses_ = 0;
       }
-   }
-   //std::cout << "Creating cache element for length = " << length << '\n';
-   Data data{ 1, ++access_counter, std::make_unique< PlanType >( length ) };
-   cache.insert( { length, std::move( data ) } );
-   return cache[ length ].plan.get();
-}
+
+   private:
+      struct Data {
+         std::atomic< dip::uint > useCount{ 0 };
+         std::atomic< uint64 > lastAccess{ 0 };
+         std::unique_ptr< PlanType > plan;
+      };
+      std::shared_timed_mutex mutex_;
+      tsl::robin_map< dip::uint, std::unique_ptr< Data >> cache_;
+      std::atomic< uint64 > accessCounter_{ 0 };
+      std::atomic< dip::uint > hits_{ 0 };
+      std::atomic< dip::uint > misses_{ 0 };
+
+      // Deletes least recently used plans that are not in use, until the cache has at most `maxSize` elements.
+      // The exclusive lock must be held.
+      void DeleteUnused( dip::uint maxSize ) {
+         while( cache_.size() > maxSize ) {
+            uint64 acc = std::numeric_limits< uint64 >::max();
+            auto candidate = cache_.end();
+            for( auto it = cache_.begin(); it != cache_.end(); ++it ) {
+               if(( it->second->useCount == 0 ) && ( it->second->lastAccess < acc )) {
+                  acc = it->second->lastAccess;
+                  candidate = it;
+               }
+            }
+            if( candidate == cache_.end() ) {
+               break; // all plans are in use
+            }
+            cache_.erase( candidate );
+         }
+      }
+};
 
 } // namespace
 
+void SetDFTPlanCacheSize( dip::uint size ) {
+   planCacheCapacity = size;
+   PlanCache< CPlan< sfloat >>::Instance().Trim();
+   PlanCache< CPlan< dfloat >>::Instance().Trim();
+   PlanCache< RPlan< sfloat >>::Instance().Trim();
+   PlanCache< RPlan< dfloat >>::Instance().Trim();
+}
+
+dip::uint GetDFTPlanCacheSize() {
+   return planCacheCapacity;
+}
+
+DFTPlanCacheStatistics GetDFTPlanCacheStatistics() {
+   DFTPlanCacheStatistics statistics;
+   PlanCache< CPlan< sfloat >>::Instance().AddStatistics( statistics );
+   PlanCache< CPlan< dfloat >>::Instance().AddStatistics( statistics );
+   PlanCache< RPlan< sfloat >>::Instance().AddStatistics( statistics );
+   PlanCache< RPlan< dfloat >>::Instance().AddStatistics( statistics );
+   return statistics;
+}
+
+void ResetDFTPlanCacheStatistics() {
+   PlanCache< CPlan< sfloat >>::Instance().ResetStatistics();
+   PlanCache< CPlan< dfloat >>::Instance().ResetStatistics();
+   PlanCache< RPlan< sfloat >>::Instance().ResetStatistics();
+   PlanCache< RPlan< dfloat >>::Instance().ResetStatistics();
+}
+
+bool SaveDFTWisdom( String const& /*filename*/ ) {
+   return false;
+}
+
+bool LoadDFTWisdom( String const& /*filename*/ ) {
+   return false;
+}
+
 #endif // DIP_CONFIG_HAS_FFTW
 
 
@@ -207,9 +373,10 @@ void DFT< T >::Initialize( dip::uint size, bool inverse, Option::DFTOptions opti
       complex< T >* out = reinterpret_cast< complex< T >* >( outBuffer.data() );
       plan_ = fftwapidef< T >::plan_dft_1d( static_cast< int >( size ), in, out, sign, flags );
    }
+   ++plansCreated;
 #else // DIP_CONFIG_HAS_FFTW
    ( void ) options; // parameter ignored
-   plan_ = PlanCache< CPlan< T >>( size );
+   plan_ = PlanCache< CPlan< T >>::Instance().Get( size );
 #endif // DIP_CONFIG_HAS_FFTW
 }
 
@@ -252,7 +419,7 @@ void DFT< T >::Destroy() {
 #ifdef DIP_CONFIG_HAS_FFTW
       fftwapidef< T >::destroy_plan( static_cast< CPlan< T >>( plan_ ));
 #else // DIP_CONFIG_HAS_FFTW
-      PlanCache< CPlan< T >>( nfft_, true );
+      PlanCache< CPlan< T >>::Instance().Release( nfft_ );
 #endif // DIP_CONFIG_HAS_FFTW
       plan_ = nullptr;
    }
@@ -296,8 +463,9 @@ void RDFT< T >::Initialize( dip::uint size, bool inverse, Option::DFTOptions opt
          plan_ = fftwapidef< T >::plan_dft_r2c_1d( static_cast< int >( size ), real, comp, flags );
       }
    }
+   ++plansCreated;
 #else // DIP_CONFIG_HAS_FFTW
-   plan_ = PlanCache< RPlan< T >>( size );
+   plan_ = PlanCache< RPlan< T >>::Instance().Get( size );
 #endif // DIP_CONFIG_HAS_FFTW
 }
 
@@ -364,7 +532,7 @@ void RDFT< T >::Destroy() {
 #ifdef DIP_CONFIG_HAS_FFTW
       fftwapidef< T >::destroy_plan( static_cast< RPlan< T >>( plan_ ));
 #else // DIP_CONFIG_HAS_FFTW
-      PlanCache< RPlan< T >>( nfft_, true );
+      PlanCache< RPlan< T >>::Instance().Release( nfft_ );
 #endif // DIP_CONFIG_HAS_FFTW
       plan_ = nullptr;
    }
@@ -377,6 +545,8 @@ template void RDFT< sfloat >::Destroy();
 
 
 #ifdef DIP_CONFIG_ENABLE_DOCTEST
+#include <algorithm>
+
 #include "doctest.h"
 #include "diplib/random.h"
 
@@ -516,4 +686,44 @@ DOCTEST_TEST_CASE("[DIPlib] testing the RDFT class") {
    DOCTEST_CHECK( doctest::Approx( test_RDFTi< dip::sfloat >( 97 )) == 0 ); // prime
 }
 
+DOCTEST_TEST_CASE("[DIPlib] testing the DFT plan cache") {
+   dip::uint cacheSize = dip::GetDFTPlanCacheSize();
+   dip::SetDFTPlanCacheSize( 2 );
+   DOCTEST_CHECK( dip::GetDFTPlanCacheSize() == 2 );
+   dip::ResetDFTPlanCacheStatistics();
+   if( !dip::usingFFTW ) {
+      DOCTEST_CHECK( dip::GetDFTPlanCacheStatistics().size <= 8 );
+      {
+         dip::DFT< dip::dfloat > a( 1009, false );
+         dip::DFT< dip::dfloat > b( 1009, true ); // uses the same plan
+         dip::DFT< dip::dfloat > c( 1013, false );
+         dip::DFT< dip::dfloat > d( 1019, false ); // the cache grows beyond its size, all plans are in use
+         dip::DFTPlanCacheStatistics stats = dip::GetDFTPlanCacheStatistics();
+         DOCTEST_CHECK( stats.hits == 1 );
+         DOCTEST_CHECK( stats.misses == 3 );
+         DOCTEST_CHECK( stats.size <= 9 );
+      }
+      DOCTEST_CHECK( dip::GetDFTPlanCacheStatistics().size <= 8 );
+      dip::DFT< dip::dfloat > e( 1009, false ); // this one was not deleted
+      DOCTEST_CHECK( dip::GetDFTPlanCacheStatistics().hits == 2 );
+      // Many threads obtaining the same plans
+      std::vector< int > results( 64, 0 );
+      #pragma omp parallel for num_threads( 4 )
+      for( int ii = 0; ii < 64; ++ii ) {
+         dip::DFT< dip::sfloat > f( static_cast< dip::uint >( 1000 + ii % 4 ), false );
+         dip::RDFT< dip::sfloat > g( static_cast< dip::uint >( 1000 + ii % 4 ), false );
+         results[ static_cast< dip::uint >( ii ) ] = ( f.TransformSize() == g.TransformSize() ) && ( f.TransformSize() >= 1000 );
+      }
+      DOCTEST_CHECK( std::count( results.begin(), results.end(), 1 ) == 64 );
+      dip::DFTPlanCacheStatistics stats = dip::GetDFTPlanCacheStatistics();
+      DOCTEST_CHECK( stats.hits + stats.misses == 5 + 128 );
+   } else {
+      dip::DFT< dip::dfloat > a( 1009, false );
+      DOCTEST_CHECK( dip::GetDFTPlanCacheStatistics().misses == 1 );
+   }
+   dip::SetDFTPlanCacheSize( cacheSize );
+   // Wisdom files are only written with FFTW
+   DOCTEST_CHECK( dip::LoadDFTWisdom( "nonexistent_file.wisdom" ) == false );
+}
+
 #endif // DIP_CONFIG_ENABLE_DOCTEST